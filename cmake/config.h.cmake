@@ -45,9 +45,12 @@
 #cmakedefine HAVE_PMRRR
 #cmakedefine AVOID_COMPLEX_MPI
 #cmakedefine HAVE_FLA_BSVD
+#cmakedefine HAVE_GEMMT
 #cmakedefine HAVE_MPI_REDUCE_SCATTER_BLOCK
 #cmakedefine HAVE_MPI_IN_PLACE
 #cmakedefine HAVE_MPI_COMM_SET_ERRHANDLER
+#cmakedefine HAVE_MPI_COMM_SPLIT_TYPE
+#cmakedefine HAVE_MPI_WIN_ALLOCATE_SHARED
 #cmakedefine HAVE_MPI_INIT_THREAD
 #cmakedefine HAVE_MPI_QUERY_THREAD
 #cmakedefine HAVE_MPI3_NONBLOCKING_COLLECTIVES
@@ -9,6 +9,7 @@
 // NOTE: It is possible to simply include "elemental.hpp" instead
 #include "elemental-lite.hpp"
 #include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Lazy.hpp"
 #include "elemental/blas-like/level1/Scale.hpp"
 #include "elemental/lapack-like/Norm/Frobenius.hpp"
 #include "elemental/lapack-like/Norm/EntrywiseOne.hpp"
@@ -123,16 +124,13 @@ void RPCA_ADMM
         ++numIts;
 
         // ST_{tau/beta}(M - L + Y/beta)
-        S = M;
-        Axpy( F(-1), L, S );
-        Axpy( F(1)/beta, Y, S );
-        SoftThreshold( S, tau/beta );
+        Evaluate
+        ( lazy::SoftThreshold
+          ( Lazy(M)-Lazy(L)+(F(1)/beta)*Lazy(Y), tau/beta ), S );
         const int numNonzeros = ZeroNorm( S );
 
         // SVT_{1/beta}(M - S + Y/beta)
-        L = M;
-        Axpy( F(-1), S, L );
-        Axpy( F(1)/beta, Y, L );
+        Evaluate( Lazy(M)-Lazy(S)+(F(1)/beta)*Lazy(Y), L );
         int rank;
         if( numStepsQR == -1 )
             rank = SingularValueSoftThreshold( L, R(1)/beta );
@@ -140,9 +138,7 @@ void RPCA_ADMM
             rank = SingularValueSoftThreshold( L, R(1)/beta, numStepsQR );
       
         // E := M - (L + S)
-        E = M;    
-        Axpy( F(-1), L, E );
-        Axpy( F(-1), S, E );
+        Evaluate( Lazy(M)-Lazy(L)-Lazy(S), E );
         const R frobE = FrobeniusNorm( E );
 
         if( frobE/frobM <= tol )            
@@ -241,16 +237,13 @@ void RPCA_ALM
             SLast = S;
 
             // ST_{tau/beta}(M - L + Y/beta)
-            S = M;
-            Axpy( F(-1), L, S );
-            Axpy( F(1)/beta, Y, S );
-            SoftThreshold( S, tau/beta );
+            Evaluate
+            ( lazy::SoftThreshold
+              ( Lazy(M)-Lazy(L)+(F(1)/beta)*Lazy(Y), tau/beta ), S );
             numNonzeros = ZeroNorm( S );
 
             // SVT_{1/beta}(M - S + Y/beta)
-            L = M;
-            Axpy( F(-1), S, L );
-            Axpy( F(1)/beta, Y, L );
+            Evaluate( Lazy(M)-Lazy(S)+(F(1)/beta)*Lazy(Y), L );
             if( commRank == 0 )
                 std::cout << "beta=" << beta << std::endl;
             if( numStepsQR == -1 )
@@ -288,9 +281,7 @@ void RPCA_ALM
         }
 
         // E := M - (L + S)
-        E = M;    
-        Axpy( -1., L, E );
-        Axpy( -1., S, E );
+        Evaluate( Lazy(M)-Lazy(L)-Lazy(S), E );
         const R frobE = FrobeniusNorm( E );
 
         if( frobE/frobM <= tol )            
@@ -33,6 +33,60 @@ Copy( const DistMatrix<T,U,V>& A, DistMatrix<T,W,Z>& B )
     B = A;
 }
 
+namespace internal {
+
+template<typename S,typename T>
+inline void
+ConvertScalar( const S& alpha, T& beta )
+{ beta = T(alpha); }
+
+template<typename R,typename S>
+inline void
+ConvertScalar( const Complex<R>& alpha, Complex<S>& beta )
+{ 
+    beta.real = S(alpha.real);
+    beta.imag = S(alpha.imag);
+}
+
+} // namespace internal
+
+// Entrywise conversion between datatypes, e.g., from double to float
+template<typename S,typename T>
+inline void
+Convert( const Matrix<S>& A, Matrix<T>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Convert");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    B.ResizeTo( height, width );
+    const S* ABuffer = A.LockedBuffer();
+    T* BBuffer = B.Buffer();
+    const int ALDim = A.LDim();
+    const int BLDim = B.LDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int j=0; j<width; ++j )
+        for( int i=0; i<height; ++i )
+            internal::ConvertScalar( ABuffer[i+j*ALDim], BBuffer[i+j*BLDim] );
+}
+
+template<typename S,typename T,Distribution U,Distribution V>
+inline void
+Convert( const DistMatrix<S,U,V>& A, DistMatrix<T,U,V>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Convert");
+#endif
+    if( B.Grid() != A.Grid() )
+        B.SetGrid( A.Grid() );
+    B.AlignWith( A.DistData() );
+    B.ResizeTo( A.Height(), A.Width() );
+    Convert( A.LockedMatrix(), B.Matrix() );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_COPY_HPP
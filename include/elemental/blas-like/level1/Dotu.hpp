@@ -10,6 +10,8 @@
 #ifndef LAPACK_DOTU_HPP
 #define LAPACK_DOTU_HPP
 
+#include "elemental/blas-like/level1/Reductions.hpp"
+
 namespace elem {
 
 // TODO: Think about using a more stable accumulation algorithm?
@@ -23,13 +25,7 @@ Dotu( const Matrix<F>& A, const Matrix<F>& B )
 #endif
     if( A.Height() != B.Height() || A.Width() != B.Width() )
         throw std::logic_error("Matrices must be the same size");
-    F sum(0);
-    const int width = A.Width();
-    const int height = A.Height();
-    for( int j=0; j<width; ++j )
-        for( int i=0; i<height; ++i )
-            sum += A.Get(i,j)*B.Get(i,j);
-    return sum;
+    return norm::LocalInnerProduct( A, B, false );
 }
 
 template<typename F,Distribution U,Distribution V> 
@@ -47,12 +43,8 @@ Dotu( const DistMatrix<F,U,V>& A, const DistMatrix<F,U,V>& B )
         A.RowAlignment() != B.RowAlignment() )
         throw std::logic_error("Matrices must be aligned");
 
-    F localSum(0);
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-            localSum += A.GetLocal(iLoc,jLoc)*B.GetLocal(iLoc,jLoc);
+    const F localSum = 
+        norm::LocalInnerProduct( A.LockedMatrix(), B.LockedMatrix(), false );
 
     F sum;
     mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
@@ -0,0 +1,526 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_FFT_HPP
+#define BLAS_FFT_HPP
+
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Discrete Fourier transforms of each column of a matrix. Lengths whose
+// prime factors are all at most seven are handled by a recursive
+// mixed-radix Cooley-Tukey algorithm, and all other lengths are reduced to
+// a power-of-two circular convolution with Bluestein's algorithm, so that
+// every transform requires O(n log n) work.
+//
+// Columns of a [VC,* ] matrix are transformed with the "four-step"
+// algorithm when the square of the number of processes divides their
+// length: viewing each column as an n1 x n2 matrix (with n1 and n2 both
+// multiples of p) whose rows are already owned by single processes, the
+// rows are transformed locally, scaled by twiddle factors, exchanged with a
+// single AllToAll so that each process owns full columns, and transformed
+// again, which leaves the result in the original [VC,* ] distribution.
+// Otherwise the columns are redistributed so that each is owned by a single
+// process.
+
+namespace elem {
+namespace fft {
+
+inline bool
+IsFastSize( int n )
+{
+    if( n < 1 )
+        return false;
+    const int radices[4] = { 2, 3, 5, 7 };
+    for( int j=0; j<4; ++j )
+        while( n % radices[j] == 0 )
+            n /= radices[j];
+    return n == 1;
+}
+
+inline int
+NextFastSize( int n )
+{
+    int N = std::max(n,1);
+    while( !IsFastSize(N) )
+        ++N;
+    return N;
+}
+
+// roots[t] = exp(sign 2 pi i t / N)
+template<typename R>
+inline void
+Roots( int sign, int N, std::vector<Complex<R> >& roots )
+{
+    const R pi = 4*Atan( R(1) );
+    roots.resize( N );
+    for( int t=0; t<N; ++t )
+    {
+        const R theta = sign*2*pi*t/N;
+        roots[t] = Complex<R>( Cos(theta), Sin(theta) );
+    }
+}
+
+// y[k] := sum_j x[j*stride] w^(j k), where w = roots[N/n] and the prime
+// factors of n are at most seven
+template<typename R>
+inline void
+MixedRadix
+( int n, const Complex<R>* x, int stride, Complex<R>* y,
+  const Complex<R>* roots, int N )
+{
+    typedef Complex<R> C;
+    if( n == 1 )
+    {
+        y[0] = x[0];
+        return;
+    }
+    int p = 2;
+    while( n % p != 0 )
+        ++p;
+    const int m = n/p;
+    for( int r=0; r<p; ++r )
+        MixedRadix( m, &x[r*stride], stride*p, &y[r*m], roots, N );
+
+    const int rootStride = N/n;
+    if( p == 2 )
+    {
+        for( int k=0; k<m; ++k )
+        {
+            const C tau = roots[k*rootStride]*y[m+k];
+            y[m+k] = y[k] - tau;
+            y[k] += tau;
+        }
+    }
+    else
+    {
+        const int pStride = N/p;
+        C temp[7];
+        for( int k=0; k<m; ++k )
+        {
+            for( int r=0; r<p; ++r )
+                temp[r] = roots[(r*k*rootStride)%N]*y[r*m+k];
+            for( int s=0; s<p; ++s )
+            {
+                C sum = temp[0];
+                for( int r=1; r<p; ++r )
+                    sum += roots[((r*s)%p)*pStride]*temp[r];
+                y[k+s*m] = sum;
+            }
+        }
+    }
+}
+
+// Overwrite each column of X with its unnormalized DFT using the root of
+// unity exp(sign 2 pi i / n)
+template<typename R>
+inline void
+Transform( int sign, Matrix<Complex<R> >& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::Transform");
+#endif
+    typedef Complex<R> C;
+    const int n = X.Height();
+    const int width = X.Width();
+    if( n <= 1 || width == 0 )
+        return;
+
+    if( IsFastSize(n) )
+    {
+        std::vector<C> roots, y( n );
+        Roots( sign, n, roots );
+        for( int j=0; j<width; ++j )
+        {
+            C* x = X.Buffer(0,j);
+            MixedRadix( n, x, 1, &y[0], &roots[0], n );
+            MemCopy( x, &y[0], n );
+        }
+        return;
+    }
+
+    // Bluestein: since j k = (j^2 + k^2 - (k-j)^2)/2, the DFT is a chirp
+    // times the convolution of the chirped input with the conjugate chirp
+    const R pi = 4*Atan( R(1) );
+    int M = 1;
+    while( M < 2*n-1 )
+        M *= 2;
+    std::vector<C> chirp( n );
+    for( int t=0; t<n; ++t )
+    {
+        const long long tSquared = (long long)t*t % (2*n);
+        const R theta = sign*pi*R(tSquared)/n;
+        chirp[t] = Complex<R>( Cos(theta), Sin(theta) );
+    }
+    std::vector<C> forwardRoots, backwardRoots, kernel( M, C(0) ),
+                   work( M ), y( M );
+    Roots( -1, M, forwardRoots );
+    Roots( +1, M, backwardRoots );
+    kernel[0] = Conj(chirp[0]);
+    for( int t=1; t<n; ++t )
+        kernel[t] = kernel[M-t] = Conj(chirp[t]);
+    MixedRadix( M, &kernel[0], 1, &y[0], &forwardRoots[0], M );
+    for( int t=0; t<M; ++t )
+        kernel[t] = y[t]/R(M);
+
+    for( int j=0; j<width; ++j )
+    {
+        C* x = X.Buffer(0,j);
+        for( int t=0; t<n; ++t )
+            work[t] = x[t]*chirp[t];
+        for( int t=n; t<M; ++t )
+            work[t] = 0;
+        MixedRadix( M, &work[0], 1, &y[0], &forwardRoots[0], M );
+        for( int t=0; t<M; ++t )
+            y[t] *= kernel[t];
+        MixedRadix( M, &y[0], 1, &work[0], &backwardRoots[0], M );
+        for( int t=0; t<n; ++t )
+            x[t] = chirp[t]*work[t];
+    }
+}
+
+// Choose n1 = p m1 and n2 = p m2 with n1 n2 = n and n1 close to sqrt(n)
+inline void
+FourStepSizes( int n, int p, int& n1, int& n2 )
+{
+    const int s = n/(p*p);
+    int m1 = 1;
+    for( int d=1; d*d<=s; ++d )
+        if( s % d == 0 )
+            m1 = d;
+    n1 = p*m1;
+    n2 = n/n1;
+}
+
+template<typename R>
+inline void
+Transform( int sign, DistMatrix<Complex<R>,VC,STAR>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::Transform");
+#endif
+    typedef Complex<R> C;
+    const Grid& g = X.Grid();
+    const int n = X.Height();
+    const int width = X.Width();
+    const int p = g.Size();
+    if( !X.Participating() || n <= 1 || width == 0 )
+        return;
+    if( p == 1 )
+    {
+        Transform( sign, X.Matrix() );
+        return;
+    }
+    if( n % (p*p) != 0 || X.ColAlignment() != 0 )
+    {
+        // Transform each column on a single process
+        DistMatrix<C,STAR,VR> X_STAR_VR( X );
+        Transform( sign, X_STAR_VR.Matrix() );
+        X = X_STAR_VR;
+        return;
+    }
+
+    int n1, n2;
+    FourStepSizes( n, p, n1, n2 );
+    const int m1 = n1/p;
+    const int m2 = n2/p;
+    const int q = g.VCRank();
+    const R pi = 4*Atan( R(1) );
+    Matrix<C>& XLoc = X.Matrix();
+
+    // Local row t of X is entry j = q + t p = j1 + n1 j2, with
+    // j1 = q + (t mod m1) p and j2 = t / m1. Transform over j2 and scale by
+    // exp(sign 2 pi i j1 k2 / n).
+    Matrix<C> Z( n2, m1*width );
+    for( int j=0; j<width; ++j )
+        for( int tt=0; tt<m1; ++tt )
+            for( int j2=0; j2<n2; ++j2 )
+                Z.Set( j2, tt+m1*j, XLoc.Get(tt+m1*j2,j) );
+    Transform( sign, Z );
+    for( int tt=0; tt<m1; ++tt )
+    {
+        const long long j1 = q + tt*p;
+        for( int k2=0; k2<n2; ++k2 )
+        {
+            const R theta = sign*2*pi*R((j1*k2)%n)/n;
+            const C omega( Cos(theta), Sin(theta) );
+            for( int j=0; j<width; ++j )
+                Z.Set( k2, tt+m1*j, omega*Z.Get(k2,tt+m1*j) );
+        }
+    }
+
+    // Exchange so that process q owns each k2 = q + u p for every j1
+    const int portionSize = m1*m2*width;
+    std::vector<C> sendBuf( p*portionSize ), recvBuf( p*portionSize );
+    for( int r=0; r<p; ++r )
+    {
+        C* data = &sendBuf[r*portionSize];
+        for( int j=0; j<width; ++j )
+            for( int tt=0; tt<m1; ++tt )
+                for( int u=0; u<m2; ++u )
+                    data[u+m2*(tt+m1*j)] = Z.Get( r+u*p, tt+m1*j );
+    }
+    mpi::AllToAll
+    ( &sendBuf[0], portionSize, &recvBuf[0], portionSize, g.VCComm() );
+    Matrix<C> W( n1, m2*width );
+    for( int r=0; r<p; ++r )
+    {
+        const C* data = &recvBuf[r*portionSize];
+        for( int j=0; j<width; ++j )
+            for( int tt=0; tt<m1; ++tt )
+                for( int u=0; u<m2; ++u )
+                    W.Set( r+tt*p, u+m2*j, data[u+m2*(tt+m1*j)] );
+    }
+
+    // Transform over j1, after which k = k2 + n2 k1 = q + (u + m2 k1) p
+    Transform( sign, W );
+    for( int j=0; j<width; ++j )
+        for( int k1=0; k1<n1; ++k1 )
+            for( int u=0; u<m2; ++u )
+                XLoc.Set( u+m2*k1, j, W.Get(k1,u+m2*j) );
+}
+
+// Z := inv(F) diag(lambda) G Z, where F is the DFT matrix and G is either
+// F (sign=-1) or its unnormalized inverse (sign=+1), so that each column of
+// Z is circularly convolved with the inverse DFT of lambda (or correlated
+// with it, respectively)
+template<typename R>
+inline void
+ApplySpectrum
+( int sign, const std::vector<Complex<R> >& lambda, Matrix<Complex<R> >& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::ApplySpectrum");
+#endif
+    const int N = Z.Height();
+    const int width = Z.Width();
+    Transform( sign, Z );
+    for( int j=0; j<width; ++j )
+        for( int i=0; i<N; ++i )
+            Z.Set( i, j, lambda[i]*Z.Get(i,j)/R(N) );
+    Transform( +1, Z );
+}
+
+template<typename R>
+inline void
+ApplySpectrum
+( int sign, const std::vector<Complex<R> >& lambda,
+  DistMatrix<Complex<R>,VC,STAR>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::ApplySpectrum");
+#endif
+    const int N = Z.Height();
+    const int width = Z.Width();
+    const int localHeight = Z.LocalHeight();
+    const int colShift = Z.ColShift();
+    const int colStride = Z.ColStride();
+    Transform( sign, Z );
+    for( int j=0; j<width; ++j )
+    {
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int i = colShift + iLoc*colStride;
+            Z.SetLocal( iLoc, j, lambda[i]*Z.GetLocal(iLoc,j)/R(N) );
+        }
+    }
+    Transform( +1, Z );
+}
+
+template<typename R>
+inline Complex<R>
+ToComplex( const R& alpha, bool conjugate )
+{ return Complex<R>(alpha); }
+
+template<typename R>
+inline Complex<R>
+ToComplex( const Complex<R>& alpha, bool conjugate )
+{ return ( conjugate ? Conj(alpha) : alpha ); }
+
+template<typename R>
+inline void
+FromComplex( const Complex<R>& alpha, R& beta, bool conjugate )
+{ beta = alpha.real; }
+
+template<typename R>
+inline void
+FromComplex( const Complex<R>& alpha, Complex<R>& beta, bool conjugate )
+{ beta = ( conjugate ? Conj(alpha) : alpha ); }
+
+// Z := [X; 0] (or its conjugate), with Z of height N
+template<typename T>
+inline void
+Embed
+( const Matrix<T>& X, Matrix<Complex<BASE(T)> >& Z, int N, bool conjugate )
+{
+    const int n = X.Height();
+    const int width = X.Width();
+    Zeros( Z, N, width );
+    for( int j=0; j<width; ++j )
+        for( int i=0; i<n; ++i )
+            Z.Set( i, j, ToComplex(X.Get(i,j),conjugate) );
+}
+
+// Y := the first m rows of Z (or their conjugate)
+template<typename T>
+inline void
+Extract
+( const Matrix<Complex<BASE(T)> >& Z, Matrix<T>& Y, int m, bool conjugate )
+{
+    const int width = Z.Width();
+    Y.ResizeTo( m, width );
+    for( int j=0; j<width; ++j )
+    {
+        for( int i=0; i<m; ++i )
+        {
+            T upsilon;
+            FromComplex( Z.Get(i,j), upsilon, conjugate );
+            Y.Set( i, j, upsilon );
+        }
+    }
+}
+
+// Both X and Z are distributed starting from the first process, so that
+// the first n rows of Z are owned by the same processes as those of X
+template<typename T,Distribution U,Distribution V>
+inline void
+Embed
+( const DistMatrix<T,U,V>& X, DistMatrix<Complex<BASE(T)>,VC,STAR>& Z,
+  int N, bool conjugate )
+{
+    const Grid& g = X.Grid();
+    const int width = X.Width();
+    // Redistribute through an [MC,MR] matrix aligned with the origin so that
+    // the [VC,* ] redistribution is always aligned
+    DistMatrix<T> X_MC_MR( X.Height(), width, 0, 0, g );
+    X_MC_MR = X;
+    DistMatrix<T,VC,STAR> X_VC_STAR( X.Height(), width, 0, g );
+    X_VC_STAR = X_MC_MR;
+    X_MC_MR.Empty();
+
+    Z.Empty();
+    Z.AlignWith( X_VC_STAR.DistData() );
+    Zeros( Z, N, width );
+    const int localHeight = X_VC_STAR.LocalHeight();
+    for( int j=0; j<width; ++j )
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+            Z.SetLocal
+            ( iLoc, j, ToComplex(X_VC_STAR.GetLocal(iLoc,j),conjugate) );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+Extract
+( const DistMatrix<Complex<BASE(T)>,VC,STAR>& Z, DistMatrix<T,U,V>& Y,
+  int m, bool conjugate )
+{
+    const Grid& g = Z.Grid();
+    const int width = Z.Width();
+    DistMatrix<T,VC,STAR> Y_VC_STAR( m, width, 0, g );
+    const int localHeight = Y_VC_STAR.LocalHeight();
+    for( int j=0; j<width; ++j )
+    {
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            T upsilon;
+            FromComplex( Z.GetLocal(iLoc,j), upsilon, conjugate );
+            Y_VC_STAR.SetLocal( iLoc, j, upsilon );
+        }
+    }
+    DistMatrix<T> Y_MC_MR( m, width, 0, 0, g );
+    Y_MC_MR = Y_VC_STAR;
+    Y_VC_STAR.Empty();
+    Y = Y_MC_MR;
+}
+
+// Y := the first m rows of inv(F) diag(lambda) G [X; 0] (see ApplySpectrum),
+// where the conjugates of X and Y are used instead if 'conjugate' is true
+template<typename T>
+inline void
+StructuredApply
+( int sign, const std::vector<Complex<BASE(T)> >& lambda, int m,
+  bool conjugate, const Matrix<T>& X, Matrix<T>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::StructuredApply");
+#endif
+    Matrix<Complex<BASE(T)> > Z;
+    Embed( X, Z, lambda.size(), conjugate );
+    ApplySpectrum( sign, lambda, Z );
+    Extract( Z, Y, m, conjugate );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+StructuredApply
+( int sign, const std::vector<Complex<BASE(T)> >& lambda, int m,
+  bool conjugate, const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::StructuredApply");
+#endif
+    DistMatrix<Complex<BASE(T)>,VC,STAR> Z( X.Grid() );
+    Embed( X, Z, lambda.size(), conjugate );
+    ApplySpectrum( sign, lambda, Z );
+    Extract( Z, Y, m, conjugate );
+}
+
+} // namespace fft
+
+// Overwrite each column of X with its (unnormalized) discrete Fourier
+// transform, y(k) = sum_j x(j) exp(-2 pi i j k / n)
+template<typename R>
+inline void
+FFT( Matrix<Complex<R> >& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("FFT");
+#endif
+    fft::Transform( -1, X );
+}
+
+template<typename R>
+inline void
+FFT( DistMatrix<Complex<R>,VC,STAR>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("FFT");
+#endif
+    fft::Transform( -1, X );
+}
+
+// Overwrite each column of X with its inverse discrete Fourier transform,
+// x(j) = (1/n) sum_k y(k) exp(2 pi i j k / n)
+template<typename R>
+inline void
+InverseFFT( Matrix<Complex<R> >& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("InverseFFT");
+#endif
+    fft::Transform( +1, X );
+    if( X.Height() > 0 )
+        Scale( Complex<R>(R(1)/X.Height()), X );
+}
+
+template<typename R>
+inline void
+InverseFFT( DistMatrix<Complex<R>,VC,STAR>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("InverseFFT");
+#endif
+    fft::Transform( +1, X );
+    if( X.Height() > 0 )
+        Scale( Complex<R>(R(1)/X.Height()), X );
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_FFT_HPP
@@ -0,0 +1,502 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_LAZY_HPP
+#define BLAS_LAZY_HPP
+
+//
+// Lazily-evaluated entrywise expressions over Matrix and DistMatrix, so that
+// a chain such as
+//
+//     Scale( beta, B ); Axpy( alpha, A, B ); SoftThreshold( B, tau );
+//
+// may be fused into a single pass over local memory, e.g.,
+//
+//     Evaluate( lazy::SoftThreshold( alpha*Lazy(A)+beta*Lazy(B), tau ), B );
+//
+// The operands of a distributed expression must share their distribution,
+// alignments, and grid, so that every entry only depends upon local data.
+// Since each entry of the result only depends upon the same entry of each
+// operand, the result may overwrite any of the operands.
+//
+
+namespace elem {
+namespace lazy {
+
+// The (global and local) extents and distribution of an expression
+struct Layout
+{
+    int height, width, localHeight, localWidth;
+    int colShift, colStride, rowShift, rowStride;
+    bool distributed;
+    elem::DistData<int> distData;
+};
+
+inline void
+CheckLayouts( const Layout& A, const Layout& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lazy::CheckLayouts");
+#endif
+    if( A.height != B.height || A.width != B.width )
+        throw std::logic_error("Operands must have equal dimensions");
+    if( A.distributed != B.distributed )
+        throw std::logic_error
+        ("Cannot mix sequential and distributed operands");
+    if( A.distributed )
+    {
+        const DistData<int>& a = A.distData;
+        const DistData<int>& b = B.distData;
+        if( a.colDist != b.colDist || a.rowDist != b.rowDist )
+            throw std::logic_error("Operands must have equal distributions");
+        if( *a.grid != *b.grid )
+            throw std::logic_error("Operands must have the same grid");
+        if( A.colShift != B.colShift || A.rowShift != B.rowShift ||
+            a.colAlignment != b.colAlignment ||
+            a.rowAlignment != b.rowAlignment || a.root != b.root ||
+            a.diagPath != b.diagPath )
+            throw std::logic_error("Operands must be aligned");
+    }
+}
+
+// Every expression type, E, provides the entry type 'E::T', a Layout, and
+// the ability to evaluate an entry given its local indices
+template<typename Derived>
+struct Expression
+{
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+};
+
+template<typename Scalar>
+class Terminal : public Expression<Terminal<Scalar> >
+{
+public:
+    typedef Scalar T;
+
+    Terminal( const Matrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim())
+    {
+        layout_.height = layout_.localHeight = A.Height();
+        layout_.width = layout_.localWidth = A.Width();
+        layout_.colShift = layout_.rowShift = 0;
+        layout_.colStride = layout_.rowStride = 1;
+        layout_.distributed = false;
+        layout_.distData.grid = 0;
+    }
+
+    template<Distribution U,Distribution V>
+    Terminal( const DistMatrix<T,U,V>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim())
+    {
+        layout_.height = A.Height();
+        layout_.width = A.Width();
+        layout_.localHeight = A.LocalHeight();
+        layout_.localWidth = A.LocalWidth();
+        layout_.colShift = A.ColShift();
+        layout_.colStride = A.ColStride();
+        layout_.rowShift = A.RowShift();
+        layout_.rowStride = A.RowStride();
+        layout_.distributed = true;
+        layout_.distData = A.DistData();
+    }
+
+    const Layout& GetLayout() const { return layout_; }
+    T operator()( int iLoc, int jLoc ) const
+    { return buffer_[iLoc+jLoc*ldim_]; }
+
+private:
+    const T* buffer_;
+    int ldim_;
+    Layout layout_;
+};
+
+template<typename E>
+class Scaled : public Expression<Scaled<E> >
+{
+public:
+    typedef typename E::T T;
+
+    Scaled( T alpha, const E& A ) : alpha_(alpha), A_(A) { }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const
+    { return alpha_*A_(iLoc,jLoc); }
+
+private:
+    T alpha_;
+    E A_;
+};
+
+template<typename E>
+class Negation : public Expression<Negation<E> >
+{
+public:
+    typedef typename E::T T;
+
+    Negation( const E& A ) : A_(A) { }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const { return -A_(iLoc,jLoc); }
+
+private:
+    E A_;
+};
+
+template<typename E1,typename E2>
+class Sum : public Expression<Sum<E1,E2> >
+{
+public:
+    typedef typename E1::T T;
+
+    Sum( const E1& A, const E2& B ) : A_(A), B_(B)
+    { CheckLayouts( A.GetLayout(), B.GetLayout() ); }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const
+    { return A_(iLoc,jLoc) + B_(iLoc,jLoc); }
+
+private:
+    E1 A_;
+    E2 B_;
+};
+
+template<typename E1,typename E2>
+class Difference : public Expression<Difference<E1,E2> >
+{
+public:
+    typedef typename E1::T T;
+
+    Difference( const E1& A, const E2& B ) : A_(A), B_(B)
+    { CheckLayouts( A.GetLayout(), B.GetLayout() ); }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const
+    { return A_(iLoc,jLoc) - B_(iLoc,jLoc); }
+
+private:
+    E1 A_;
+    E2 B_;
+};
+
+template<typename E1,typename E2>
+class HadamardProduct : public Expression<HadamardProduct<E1,E2> >
+{
+public:
+    typedef typename E1::T T;
+
+    HadamardProduct( const E1& A, const E2& B ) : A_(A), B_(B)
+    { CheckLayouts( A.GetLayout(), B.GetLayout() ); }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const
+    { return A_(iLoc,jLoc)*B_(iLoc,jLoc); }
+
+private:
+    E1 A_;
+    E2 B_;
+};
+
+template<typename E>
+class Conjugation : public Expression<Conjugation<E> >
+{
+public:
+    typedef typename E::T T;
+
+    Conjugation( const E& A ) : A_(A) { }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const { return Conj(A_(iLoc,jLoc)); }
+
+private:
+    E A_;
+};
+
+// Zero the entries outside of the trapezoid; the offset and side are
+// interpreted as in MakeTrapezoidal
+template<typename E>
+class Trapezoid : public Expression<Trapezoid<E> >
+{
+public:
+    typedef typename E::T T;
+
+    Trapezoid( UpperOrLower uplo, const E& A, int offset, LeftOrRight side )
+    : uplo_(uplo), A_(A)
+    {
+        const Layout& layout = A.GetLayout();
+        offset_ =
+            ( side==LEFT ? offset : offset-layout.height+layout.width );
+    }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const
+    {
+        const Layout& layout = A_.GetLayout();
+        const int i = layout.colShift + iLoc*layout.colStride;
+        const int j = layout.rowShift + jLoc*layout.rowStride;
+        const bool inside =
+            ( uplo_==LOWER ? i >= j-offset_ : i <= j-offset_ );
+        return ( inside ? A_(iLoc,jLoc) : T(0) );
+    }
+
+private:
+    UpperOrLower uplo_;
+    int offset_;
+    E A_;
+};
+
+// Scale the rows (or columns) by the local portion of a diagonal matrix,
+// which is stored (and conjugated, if requested) during construction
+template<typename E,typename D>
+class DiagonalScaled : public Expression<DiagonalScaled<E,D> >
+{
+public:
+    typedef typename E::T T;
+
+    DiagonalScaled
+    ( LeftOrRight side, Orientation orientation,
+      const Matrix<D>& d, const E& A )
+    : side_(side), A_(A)
+    {
+        const Layout& layout = A.GetLayout();
+        const int localLength =
+            ( side==LEFT ? layout.localHeight : layout.localWidth );
+        d_.resize( localLength );
+        for( int k=0; k<localLength; ++k )
+            d_[k] = d.Get(k,0);
+        if( orientation == ADJOINT )
+            for( int k=0; k<localLength; ++k )
+                d_[k] = Conj(d_[k]);
+    }
+
+    template<Distribution U,Distribution V>
+    DiagonalScaled
+    ( LeftOrRight side, Orientation orientation,
+      const DistMatrix<D,U,V>& d, const E& A )
+    : side_(side), A_(A)
+    {
+        const Layout& layout = A.GetLayout();
+        if( !layout.distributed )
+            throw std::logic_error
+            ("Cannot scale a sequential expression by a DistMatrix");
+        if( d.Grid() != *layout.distData.grid )
+            throw std::logic_error("d must have the same grid as A");
+        const int localLength =
+            ( side==LEFT ? layout.localHeight : layout.localWidth );
+        const int shift = ( side==LEFT ? layout.colShift : layout.rowShift );
+        const int stride =
+            ( side==LEFT ? layout.colStride : layout.rowStride );
+        const Distribution dist =
+            ( side==LEFT ? layout.distData.colDist : layout.distData.rowDist );
+        const int align = ( side==LEFT ? layout.distData.colAlignment
+                                       : layout.distData.rowAlignment );
+        d_.resize( localLength );
+        if( V == STAR && U == dist && d.ColAlignment() == align )
+        {
+            for( int k=0; k<localLength; ++k )
+                d_[k] = d.GetLocal(k,0);
+        }
+        else
+        {
+            DistMatrix<D,STAR,STAR> d_STAR_STAR( d );
+            for( int k=0; k<localLength; ++k )
+                d_[k] = d_STAR_STAR.GetLocal(shift+k*stride,0);
+        }
+        if( orientation == ADJOINT )
+            for( int k=0; k<localLength; ++k )
+                d_[k] = Conj(d_[k]);
+    }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const
+    { return ( side_==LEFT ? d_[iLoc] : d_[jLoc] )*A_(iLoc,jLoc); }
+
+private:
+    LeftOrRight side_;
+    std::vector<D> d_;
+    E A_;
+};
+
+// Apply an arbitrary entrywise function object, which must provide the
+// member function 'T operator()( T alpha ) const'
+template<typename E,typename Functor>
+class Mapped : public Expression<Mapped<E,Functor> >
+{
+public:
+    typedef typename E::T T;
+
+    Mapped( const E& A, const Functor& func ) : A_(A), func_(func) { }
+
+    const Layout& GetLayout() const { return A_.GetLayout(); }
+    T operator()( int iLoc, int jLoc ) const { return func_(A_(iLoc,jLoc)); }
+
+private:
+    E A_;
+    Functor func_;
+};
+
+//
+// Operators and builders
+//
+
+template<typename E1,typename E2>
+inline Sum<E1,E2>
+operator+( const Expression<E1>& A, const Expression<E2>& B )
+{ return Sum<E1,E2>( A.Self(), B.Self() ); }
+
+template<typename E1,typename E2>
+inline Difference<E1,E2>
+operator-( const Expression<E1>& A, const Expression<E2>& B )
+{ return Difference<E1,E2>( A.Self(), B.Self() ); }
+
+template<typename E>
+inline Negation<E>
+operator-( const Expression<E>& A )
+{ return Negation<E>( A.Self() ); }
+
+template<typename E>
+inline Scaled<E>
+operator*( typename E::T alpha, const Expression<E>& A )
+{ return Scaled<E>( alpha, A.Self() ); }
+
+template<typename E>
+inline Scaled<E>
+operator*( const Expression<E>& A, typename E::T alpha )
+{ return Scaled<E>( alpha, A.Self() ); }
+
+template<typename E1,typename E2>
+inline HadamardProduct<E1,E2>
+Hadamard( const Expression<E1>& A, const Expression<E2>& B )
+{ return HadamardProduct<E1,E2>( A.Self(), B.Self() ); }
+
+template<typename E>
+inline Conjugation<E>
+Conjugate( const Expression<E>& A )
+{ return Conjugation<E>( A.Self() ); }
+
+template<typename E>
+inline Trapezoid<E>
+MakeTrapezoidal
+( UpperOrLower uplo, const Expression<E>& A,
+  int offset=0, LeftOrRight side=LEFT )
+{ return Trapezoid<E>( uplo, A.Self(), offset, side ); }
+
+template<typename E,typename D>
+inline DiagonalScaled<E,D>
+DiagonalScale
+( LeftOrRight side, Orientation orientation,
+  const Matrix<D>& d, const Expression<E>& A )
+{ return DiagonalScaled<E,D>( side, orientation, d, A.Self() ); }
+
+template<typename E,typename D,Distribution U,Distribution V>
+inline DiagonalScaled<E,D>
+DiagonalScale
+( LeftOrRight side, Orientation orientation,
+  const DistMatrix<D,U,V>& d, const Expression<E>& A )
+{ return DiagonalScaled<E,D>( side, orientation, d, A.Self() ); }
+
+template<typename E,typename Functor>
+inline Mapped<E,Functor>
+Map( const Expression<E>& A, const Functor& func )
+{ return Mapped<E,Functor>( A.Self(), func ); }
+
+template<typename E>
+inline void
+EvaluateLocal
+( const E& A, int localHeight, int localWidth,
+  typename E::T* buffer, int ldim )
+{
+    typedef typename E::T T;
+    if( localWidth == 1 )
+    {
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+            buffer[iLoc] = A(iLoc,0);
+    }
+    else
+    {
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            T* col = &buffer[jLoc*ldim];
+            for( int iLoc=0; iLoc<localHeight; ++iLoc )
+                col[iLoc] = A(iLoc,jLoc);
+        }
+    }
+}
+
+} // namespace lazy
+
+template<typename T>
+inline lazy::Terminal<T>
+Lazy( const Matrix<T>& A )
+{ return lazy::Terminal<T>( A ); }
+
+template<typename T,Distribution U,Distribution V>
+inline lazy::Terminal<T>
+Lazy( const DistMatrix<T,U,V>& A )
+{ return lazy::Terminal<T>( A ); }
+
+// B := A, where B is resized if necessary
+template<typename E,typename T>
+inline void
+Evaluate( const lazy::Expression<E>& A, Matrix<T>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Evaluate");
+#endif
+    const lazy::Layout& layout = A.Self().GetLayout();
+    if( layout.distributed )
+        throw std::logic_error
+        ("Cannot evaluate a distributed expression into a Matrix");
+    B.ResizeTo( layout.height, layout.width );
+    lazy::EvaluateLocal
+    ( A.Self(), layout.localHeight, layout.localWidth,
+      B.Buffer(), B.LDim() );
+}
+
+// B := A, where B is realigned (unless it is a view) and resized if necessary
+template<typename E,typename T,Distribution U,Distribution V>
+inline void
+Evaluate( const lazy::Expression<E>& A, DistMatrix<T,U,V>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Evaluate");
+#endif
+    const lazy::Layout& layout = A.Self().GetLayout();
+    const DistData<int>& data = layout.distData;
+    if( !layout.distributed )
+        throw std::logic_error
+        ("Cannot evaluate a sequential expression into a DistMatrix");
+    if( data.colDist != U || data.rowDist != V )
+        throw std::logic_error("Distributions of A and B must match");
+    if( B.Grid() != *data.grid || B.ColShift() != layout.colShift ||
+        B.RowShift() != layout.rowShift ||
+        B.DistData().colAlignment != data.colAlignment ||
+        B.DistData().rowAlignment != data.rowAlignment ||
+        B.DistData().root != data.root ||
+        B.DistData().diagPath != data.diagPath )
+    {
+        if( B.Viewing() )
+            throw std::logic_error("Cannot realign a view");
+        B.Empty();
+        B.AlignWith( data );
+    }
+    B.ResizeTo( layout.height, layout.width );
+    lazy::EvaluateLocal
+    ( A.Self(), layout.localHeight, layout.localWidth,
+      B.Buffer(), B.LDim() );
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_LAZY_HPP
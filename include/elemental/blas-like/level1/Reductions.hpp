@@ -0,0 +1,244 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_REDUCTIONS_HPP
+#define BLAS_REDUCTIONS_HPP
+
+#include <limits>
+
+namespace elem {
+namespace norm {
+
+// Single-pass kernels for maxima, inner products and overflow-safe sums of
+// squares of contiguous segments, which are shared by the level 1 BLAS and
+// the norms. The segments are traversed with several independent
+// accumulators so that the compiler may vectorize the inner loops.
+
+template<typename R>
+inline R
+SegmentMaxAbs( int n, const R* x )
+{
+    R max0=0, max1=0, max2=0, max3=0;
+    int i=0;
+    for( ; i+3<n; i+=4 )
+    {
+        max0 = std::max( max0, Abs(x[i  ]) );
+        max1 = std::max( max1, Abs(x[i+1]) );
+        max2 = std::max( max2, Abs(x[i+2]) );
+        max3 = std::max( max3, Abs(x[i+3]) );
+    }
+    for( ; i<n; ++i )
+        max0 = std::max( max0, Abs(x[i]) );
+    return std::max( std::max(max0,max1), std::max(max2,max3) );
+}
+
+template<typename R>
+inline R
+SegmentMaxAbs( int n, const Complex<R>* x )
+{
+    R maxAbs = 0;
+    for( int i=0; i<n; ++i )
+        maxAbs = std::max( maxAbs, Abs(x[i]) );
+    return maxAbs;
+}
+
+template<typename F>
+inline F
+SegmentInnerProduct( int n, const F* x, const F* y, bool conjugate )
+{
+    F sum0=0, sum1=0, sum2=0, sum3=0;
+    int i=0;
+    if( conjugate )
+    {
+        for( ; i+3<n; i+=4 )
+        {
+            sum0 += Conj(x[i  ])*y[i  ];
+            sum1 += Conj(x[i+1])*y[i+1];
+            sum2 += Conj(x[i+2])*y[i+2];
+            sum3 += Conj(x[i+3])*y[i+3];
+        }
+        for( ; i<n; ++i )
+            sum0 += Conj(x[i])*y[i];
+    }
+    else
+    {
+        for( ; i+3<n; i+=4 )
+        {
+            sum0 += x[i  ]*y[i  ];
+            sum1 += x[i+1]*y[i+1];
+            sum2 += x[i+2]*y[i+2];
+            sum3 += x[i+3]*y[i+3];
+        }
+        for( ; i<n; ++i )
+            sum0 += x[i]*y[i];
+    }
+    return (sum0+sum1)+(sum2+sum3);
+}
+
+// Merge the scaled square (scale,scaledSquare), which represents the sum of
+// squares scale^2 scaledSquare, into (scaleTotal,scaledSquareTotal). A zero
+// scale represents an empty sum.
+template<typename R>
+inline void
+CombineScaledSquares
+( R scale, R scaledSquare, R& scaleTotal, R& scaledSquareTotal )
+{
+    if( scale == 0 )
+        return;
+    if( scale <= scaleTotal )
+    {
+        const R relScale = scale/scaleTotal;
+        scaledSquareTotal += scaledSquare*relScale*relScale;
+    }
+    else
+    {
+        const R relScale = scaleTotal/scale;
+        scaledSquareTotal =
+            scaledSquare + scaledSquareTotal*relScale*relScale;
+        scaleTotal = scale;
+    }
+}
+
+// Rather than rescaling the running sum every time a larger entry appears,
+// scale each (cache-resident) chunk by its maximum magnitude, which allows
+// the inner loops to be free of branches
+template<typename R>
+inline void
+UpdateScaledSquare( int n, const R* x, R& scale, R& scaledSquare )
+{
+    const int chunkSize = 1024;
+    for( int i0=0; i0<n; i0+=chunkSize )
+    {
+        const int nChunk = std::min(chunkSize,n-i0);
+        const R* xChunk = &x[i0];
+        const R maxAbs = SegmentMaxAbs( nChunk, xChunk );
+        if( maxAbs == 0 )
+            continue;
+
+        R sum0=0, sum1=0, sum2=0, sum3=0;
+        const R invMaxAbs = 1/maxAbs;
+        if( invMaxAbs <= std::numeric_limits<R>::max() )
+        {
+            int i=0;
+            for( ; i+3<nChunk; i+=4 )
+            {
+                const R a0=xChunk[i  ]*invMaxAbs, a1=xChunk[i+1]*invMaxAbs,
+                        a2=xChunk[i+2]*invMaxAbs, a3=xChunk[i+3]*invMaxAbs;
+                sum0 += a0*a0;
+                sum1 += a1*a1;
+                sum2 += a2*a2;
+                sum3 += a3*a3;
+            }
+            for( ; i<nChunk; ++i )
+            {
+                const R a = xChunk[i]*invMaxAbs;
+                sum0 += a*a;
+            }
+        }
+        else
+        {
+            // The maximum is subnormal, so its reciprocal overflows
+            for( int i=0; i<nChunk; ++i )
+            {
+                const R a = xChunk[i]/maxAbs;
+                sum0 += a*a;
+            }
+        }
+        CombineScaledSquares
+        ( maxAbs, (sum0+sum1)+(sum2+sum3), scale, scaledSquare );
+    }
+}
+
+// The squared magnitude of a complex number is the sum of the squares of
+// its real and imaginary parts, so treat the segment as 2n real numbers
+template<typename R>
+inline void
+UpdateScaledSquare
+( int n, const Complex<R>* x, R& scale, R& scaledSquare )
+{
+    UpdateScaledSquare
+    ( 2*n, reinterpret_cast<const R*>(x), scale, scaledSquare );
+}
+
+//
+// Kernels for local matrices
+//
+
+// The sum of conj(A(i,j)) B(i,j), or of A(i,j) B(i,j) if 'conjugate' is
+// false, over every local entry
+template<typename F>
+inline F
+LocalInnerProduct
+( const Matrix<F>& A, const Matrix<F>& B, bool conjugate=true )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalInnerProduct");
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        throw std::logic_error("Local matrices must be the same size");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    F innerProd = 0;
+#ifdef HAVE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        F threadInnerProd = 0;
+#ifdef HAVE_OPENMP
+#pragma omp for
+#endif
+        for( int jLoc=0; jLoc<width; ++jLoc )
+            threadInnerProd += SegmentInnerProduct
+                ( height, A.LockedBuffer(0,jLoc), B.LockedBuffer(0,jLoc),
+                  conjugate );
+#ifdef HAVE_OPENMP
+#pragma omp critical
+#endif
+        innerProd += threadInnerProd;
+    }
+    return innerProd;
+}
+
+//
+// Distributed reductions
+//
+
+// Combine numPairs (scale,scaledSquare) pairs over the communicator with a
+// single AllReduce. Each pair is packed into a complex number so that it is
+// never split between the segments of a pipelined reduction.
+template<typename R>
+inline void
+AllReduceScaledSquares
+( R* scales, R* scaledSquares, int numPairs, mpi::Comm comm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::AllReduceScaledSquares");
+#endif
+    if( numPairs == 0 || mpi::CommSize( comm ) == 1 )
+        return;
+    std::vector<Complex<R> > pairs( numPairs );
+    for( int k=0; k<numPairs; ++k )
+        pairs[k] = Complex<R>( scales[k], scaledSquares[k] );
+    mpi::AllReduce( &pairs[0], numPairs, ScaledSquareOp<R>(), comm );
+    for( int k=0; k<numPairs; ++k )
+    {
+        scales[k] = pairs[k].real;
+        scaledSquares[k] = pairs[k].imag;
+    }
+}
+
+template<typename R>
+inline R
+ScaledSquareToNorm( R scale, R scaledSquare )
+{ return ( scale == 0 ? R(0) : scale*Sqrt(scaledSquare) ); }
+
+} // namespace norm
+} // namespace elem
+
+#endif // ifndef BLAS_REDUCTIONS_HPP
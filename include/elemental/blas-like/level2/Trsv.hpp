@@ -15,6 +15,9 @@
 #include "./Trsv/UN.hpp"
 #include "./Trsv/UT.hpp"
 
+#include "elemental/blas-like/level1/Transpose.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+
 namespace elem {
 
 template<typename F>
@@ -71,6 +74,45 @@ Trsv
     }
 }
 
+// Solve against a triangular matrix with a single small reduction per
+// diagonal block; see PipelinedTrsm
+template<typename F>
+inline void
+PipelinedTrsv
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  const DistMatrix<F>& A, DistMatrix<F>& x, bool selectiveInversion=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PipelinedTrsv");
+    if( A.Grid() != x.Grid() )
+        throw std::logic_error("A and x must use the same grid");
+    if( x.Height() != 1 && x.Width() != 1 )
+        throw std::logic_error("x must be a vector");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    const int xLength = ( x.Width()==1 ? x.Height() : x.Width() );
+    if( xLength != A.Height() )
+        throw std::logic_error("x must conform with A");
+#endif
+    if( x.Width() == 1 )
+    {
+        internal::TrsmLPipelined
+        ( uplo, orientation, diag, F(1), A, x, selectiveInversion, false );
+    }
+    else
+    {
+        DistMatrix<F,STAR,STAR> x_STAR_STAR( x );
+        Matrix<F> y;
+        Transpose( x_STAR_STAR.LockedMatrix(), y );
+        trsm::PipelinedSolve
+        ( uplo, orientation, diag, A.Height(), A.LockedMatrix(),
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride(),
+          A.Grid().Comm(), y, selectiveInversion, false );
+        Transpose( y, x_STAR_STAR.Matrix() );
+        x = x_STAR_STAR;
+    }
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_TRSV_HPP
@@ -11,6 +11,7 @@
 #define BLAS_LEVEL3_HPP
 
 #include "./level3/Gemm.hpp"
+#include "./level3/Gemmt.hpp"
 #include "./level3/Hemm.hpp"
 #include "./level3/Her2k.hpp"
 #include "./level3/Herk.hpp"
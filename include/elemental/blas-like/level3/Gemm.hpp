@@ -225,6 +225,59 @@ Gemm
     Gemm( orientationOfA, orientationOfB, alpha, A, B, T(0), C );
 }
 
+namespace batch {
+
+template<typename T>
+struct GemmFunctor
+{
+    Orientation orientationOfA, orientationOfB;
+    T alpha, beta;
+    const MatrixBatch<T>* A;
+    const MatrixBatch<T>* B;
+    MatrixBatch<T>* C;
+
+    GemmFunctor
+    ( Orientation orientA, Orientation orientB, T a,
+      const MatrixBatch<T>& ABatch, const MatrixBatch<T>& BBatch,
+      T b, MatrixBatch<T>& CBatch )
+    : orientationOfA(orientA), orientationOfB(orientB), alpha(a), beta(b),
+      A(&ABatch), B(&BBatch), C(&CBatch)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<T> AView, BView, CView;
+        A->LockedView( k, AView );
+        B->LockedView( k, BView );
+        C->View( k, CView );
+        Gemm
+        ( orientationOfA, orientationOfB, alpha, AView, BView, beta, CView );
+    }
+};
+
+} // namespace batch
+
+// Independently update each member of a batch, C[k] := alpha A[k] B[k] +
+// beta C[k], starting with the most expensive members
+template<typename T>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B,
+  T beta,        MatrixBatch<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gemm");
+#endif
+    if( A.Size() != C.Size() || B.Size() != C.Size() )
+        throw std::logic_error("Batches must be the same size");
+    std::vector<int> order;
+    batch::DescendingCostOrder( C, order );
+    batch::Apply
+    ( order, batch::GemmFunctor<T>
+             (orientationOfA,orientationOfB,alpha,A,B,beta,C) );
+}
+
 template<typename T>
 inline void
 Gemm
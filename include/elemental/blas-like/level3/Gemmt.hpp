@@ -0,0 +1,205 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_GEMMT_HPP
+#define BLAS_GEMMT_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+
+namespace elem {
+
+namespace gemmt {
+
+// The width of the column panels used by the local kernel. Only a staircase-
+// shaped strip of roughly this width is computed redundantly for each panel.
+inline int LocalBlocksize() { return 32; }
+
+// Update the entries of the local matrix C which lie within the 'uplo'
+// triangle of the global matrix,
+//
+//   C := alpha op(A) op(B) + beta C,
+//
+// where the local entry (iLoc,jLoc) of C is the global entry
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride).
+template<typename T>
+inline void
+LocalKernel
+( UpperOrLower uplo,
+  Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C,
+  int colShift, int colStride, int rowShift, int rowStride )
+{
+#ifndef RELEASE
+    CallStackEntry entry("gemmt::LocalKernel");
+#endif
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    const int bsize = LocalBlocksize();
+
+    Matrix<T> AView, BView, CView, S;
+    for( int jLoc0=0; jLoc0<n; jLoc0+=bsize )
+    {
+        const int nb = std::min(bsize,n-jLoc0);
+        const int jFirst = rowShift + jLoc0*rowStride;
+        const int jLast = rowShift + (jLoc0+nb-1)*rowStride;
+
+        // Rows [full0,full1) are within the triangle for every column of the
+        // panel, while rows [part0,part1) are only partially within it
+        int full0, full1, part0, part1;
+        if( uplo == LOWER )
+        {
+            part0 = std::min( Length(jFirst,colShift,colStride), m );
+            part1 = std::min( Length(jLast,colShift,colStride), m );
+            full0 = part1;
+            full1 = m;
+        }
+        else
+        {
+            full0 = 0;
+            full1 = std::min( Length(jFirst+1,colShift,colStride), m );
+            part0 = full1;
+            part1 = std::min( Length(jLast+1,colShift,colStride), m );
+        }
+
+        if( orientationOfB == NORMAL )
+            LockedView( BView, B, 0, jLoc0, k, nb );
+        else
+            LockedView( BView, B, jLoc0, 0, nb, k );
+
+        if( full1 > full0 )
+        {
+            if( orientationOfA == NORMAL )
+                LockedView( AView, A, full0, 0, full1-full0, k );
+            else
+                LockedView( AView, A, 0, full0, k, full1-full0 );
+            View( CView, C, full0, jLoc0, full1-full0, nb );
+            Gemm
+            ( orientationOfA, orientationOfB, alpha, AView, BView,
+              beta, CView );
+        }
+
+        if( part1 > part0 )
+        {
+            const int height = part1-part0;
+            if( orientationOfA == NORMAL )
+                LockedView( AView, A, part0, 0, height, k );
+            else
+                LockedView( AView, A, 0, part0, k, height );
+            S.ResizeTo( height, nb );
+            Gemm
+            ( orientationOfA, orientationOfB, alpha, AView, BView, T(0), S );
+            for( int jj=0; jj<nb; ++jj )
+            {
+                const int j = rowShift + (jLoc0+jj)*rowStride;
+                int iBeg, iEnd;
+                if( uplo == LOWER )
+                {
+                    iBeg = std::max
+                           ( std::min(Length(j,colShift,colStride),m), part0 );
+                    iEnd = part1;
+                }
+                else
+                {
+                    iBeg = part0;
+                    iEnd = std::min
+                           ( std::min(Length(j+1,colShift,colStride),m),
+                             part1 );
+                }
+                const T* SCol = S.LockedBuffer(0,jj);
+                T* CCol = C.Buffer(0,jLoc0+jj);
+                if( beta == T(0) )
+                    for( int i=iBeg; i<iEnd; ++i )
+                        CCol[i] = SCol[i-part0];
+                else
+                    for( int i=iBeg; i<iEnd; ++i )
+                        CCol[i] = beta*CCol[i] + SCol[i-part0];
+            }
+        }
+    }
+}
+
+} // namespace gemmt
+
+// Update only the 'uplo' triangle of the square matrix C,
+//   C := alpha op(A) op(B) + beta C
+template<typename T>
+inline void
+Gemmt
+( UpperOrLower uplo, Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gemmt");
+    const int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    const int mA = ( orientationOfA == NORMAL ? A.Height() : A.Width() );
+    const int kB = ( orientationOfB == NORMAL ? B.Height() : B.Width() );
+    const int nB = ( orientationOfB == NORMAL ? B.Width() : B.Height() );
+    if( C.Height() != C.Width() || mA != C.Height() || nB != C.Width() ||
+        k != kB )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal Gemmt:\n"
+            << "  A ~ " << A.Height() << " x " << A.Width() << "\n"
+            << "  B ~ " << B.Height() << " x " << B.Width() << "\n"
+            << "  C ~ " << C.Height() << " x " << C.Width();
+        throw std::logic_error( msg.str().c_str() );
+    }
+#endif
+#ifdef HAVE_GEMMT
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transA = OrientationToChar( orientationOfA );
+    const char transB = OrientationToChar( orientationOfB );
+    const int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    blas::Gemmt
+    ( uploChar, transA, transB, C.Height(), k,
+      alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+      beta, C.Buffer(), C.LDim() );
+#else
+    gemmt::LocalKernel
+    ( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, C, 0, 1, 0, 1 );
+#endif
+}
+
+// Update the local portion of the 'uplo' triangle of the square matrix C,
+// C := alpha op(A) op(B) + beta C, where the local data of A and B must be
+// conformal with that of C (as in LocalGemm)
+template<typename T,Distribution AColDist,Distribution ARowDist,
+                    Distribution BColDist,Distribution BRowDist,
+                    Distribution CColDist,Distribution CRowDist>
+inline void
+LocalGemmt
+( UpperOrLower uplo, Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T,AColDist,ARowDist>& A,
+           const DistMatrix<T,BColDist,BRowDist>& B,
+  T beta,        DistMatrix<T,CColDist,CRowDist>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LocalGemmt");
+    if( C.Height() != C.Width() )
+        throw std::logic_error("C must be square");
+    const int mA = ( orientationOfA == NORMAL ? A.Height() : A.Width() );
+    const int nB = ( orientationOfB == NORMAL ? B.Width() : B.Height() );
+    if( mA != C.Height() || nB != C.Width() )
+        throw std::logic_error("Nonconformal LocalGemmt");
+#endif
+    if( C.ColStride() == 1 && C.RowStride() == 1 )
+        Gemmt
+        ( uplo, orientationOfA, orientationOfB,
+          alpha, A.LockedMatrix(), B.LockedMatrix(), beta, C.Matrix() );
+    else
+        gemmt::LocalKernel
+        ( uplo, orientationOfA, orientationOfB,
+          alpha, A.LockedMatrix(), B.LockedMatrix(), beta, C.Matrix(),
+          C.ColShift(), C.ColStride(), C.RowShift(), C.RowStride() );
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_GEMMT_HPP
@@ -43,6 +43,7 @@ LocalTrsm
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Pipelined.hpp"
 
 namespace elem {
 
@@ -85,6 +86,62 @@ Trsm
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
 }
 
+namespace batch {
+
+template<typename F>
+struct TrsmFunctor
+{
+    LeftOrRight side;
+    UpperOrLower uplo;
+    Orientation orientation;
+    UnitOrNonUnit diag;
+    F alpha;
+    const MatrixBatch<F>* A;
+    MatrixBatch<F>* B;
+    bool checkIfSingular;
+
+    TrsmFunctor
+    ( LeftOrRight s, UpperOrLower u, Orientation o, UnitOrNonUnit d,
+      F a, const MatrixBatch<F>& ABatch, MatrixBatch<F>& BBatch, bool check )
+    : side(s), uplo(u), orientation(o), diag(d), alpha(a),
+      A(&ABatch), B(&BBatch), checkIfSingular(check)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F> AView, BView;
+        A->LockedView( k, AView );
+        B->View( k, BView );
+        Trsm
+        ( side, uplo, orientation, diag, alpha, AView, BView,
+          checkIfSingular );
+    }
+};
+
+} // namespace batch
+
+// Independently solve against each member of a batch, starting with the
+// most expensive members
+template<typename F>
+inline void
+Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const MatrixBatch<F>& A, MatrixBatch<F>& B,
+  bool checkIfSingular=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Trsm");
+#endif
+    if( A.Size() != B.Size() )
+        throw std::logic_error("Batches must be the same size");
+    std::vector<int> order;
+    batch::DescendingCostOrder( B, order );
+    batch::Apply
+    ( order, batch::TrsmFunctor<F>
+             (side,uplo,orientation,diag,alpha,A,B,checkIfSingular) );
+}
+
 template<typename F>
 inline void
 Trsm
@@ -167,6 +224,79 @@ Trsm
     }
 }
 
+// Overwrite each Blocksize() x Blocksize() diagonal block of the triangular
+// matrix A with its inverse so that it may be used by PipelinedTrsm with
+// selective inversion. Only the 'uplo' triangle of each block is modified.
+template<typename F>
+inline void
+InvertDiagonalBlocks( UpperOrLower uplo, UnitOrNonUnit diag, DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("InvertDiagonalBlocks");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int bsize = Blocksize();
+    DistMatrix<F> A11(g);
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    Matrix<F> A11Inv;
+    for( int s=0; s<n; s+=bsize )
+    {
+        const int b = std::min(bsize,n-s);
+        View( A11, A, s, s, b, b );
+        A11_STAR_STAR = A11;
+        Identity( A11Inv, b, b );
+        Trsm
+        ( LEFT, uplo, NORMAL, diag,
+          F(1), A11_STAR_STAR.LockedMatrix(), A11Inv, true );
+
+        const int colShift = A11.ColShift();
+        const int rowShift = A11.RowShift();
+        const int colStride = A11.ColStride();
+        const int rowStride = A11.RowStride();
+        const int localHeight = A11.LocalHeight();
+        const int localWidth = A11.LocalWidth();
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int j = rowShift + jLoc*rowStride;
+            for( int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int i = colShift + iLoc*colStride;
+                if( (uplo == LOWER && i > j) || (uplo == UPPER && i < j) ||
+                    (diag == NON_UNIT && i == j) )
+                    A11.SetLocal( iLoc, jLoc, A11Inv.Get(i,j) );
+            }
+        }
+    }
+}
+
+// Solve against a triangular matrix from the left with a small number of
+// right-hand sides using one small reduction per diagonal block. If
+// 'selectiveInversion' is true, then the diagonal blocks of A must have been
+// overwritten by InvertDiagonalBlocks (with the same blocksize).
+template<typename F>
+inline void
+PipelinedTrsm
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const DistMatrix<F>& A, DistMatrix<F>& B,
+  bool selectiveInversion=false, bool checkIfSingular=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PipelinedTrsm");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("A and B must use the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("Nonconformal PipelinedTrsm");
+#endif
+    internal::TrsmLPipelined
+    ( uplo, orientation, diag, alpha, A, B,
+      selectiveInversion, checkIfSingular );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_TRSM_HPP
@@ -242,8 +242,9 @@ TrsmLLNSmall
 
         // X1[* ,* ] := (L11[* ,* ])^-1 X1[* ,* ]
         LocalTrsm
-        ( LEFT, LOWER, NORMAL, diag, 
+        ( LEFT, LOWER, NORMAL, diag,
           F(1), L11_STAR_STAR, X1_STAR_STAR, checkIfSingular );
+        X1 = X1_STAR_STAR;
 
         // X2[VC,* ] -= L21[VC,* ] X1[* ,* ]
         LocalGemm( NORMAL, NORMAL, F(-1), L21, X1_STAR_STAR, F(1), X2 );
@@ -0,0 +1,278 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_TRSM_PIPELINED_HPP
+#define BLAS_TRSM_PIPELINED_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Trmm.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Latency-oriented solves against a distributed triangular matrix with only
+// a few right-hand sides. The right-hand sides are replicated, so that each
+// block of the solution is known to every process as soon as it has been
+// computed, and each process accumulates the updates from its own piece of
+// the triangle. The only communication per diagonal block is then a single
+// small all-reduce, which combines the updates to the next block with the
+// next diagonal block itself. It is started (with a nonblocking collective,
+// when available) before the rest of the trailing update is performed, so
+// that the two can overlap.
+//
+// With selective inversion, the diagonal blocks of the triangular matrix are
+// assumed to have already been overwritten with their inverses (see
+// InvertDiagonalBlocks), so that each step is a triangular matrix-vector
+// (or matrix-matrix) product rather than a triangular solve.
+
+namespace elem {
+namespace trsm {
+
+// Z(tLocBeg:tLocEnd-1,:) += op(A) XLoc, where the rows of XLoc correspond to
+// the local source indices beginning with sLocBeg
+template<typename F>
+inline void
+PipelinedUpdate
+( Orientation orientation, const Matrix<F>& ALoc, const Matrix<F>& XLoc,
+  int sLocBeg, int tLocBeg, int tLocEnd, Matrix<F>& Z )
+{
+    const int sLocSize = XLoc.Height();
+    const int tLocSize = tLocEnd - tLocBeg;
+    if( sLocSize == 0 || tLocSize == 0 || Z.Width() == 0 )
+        return;
+    Matrix<F> ZT, AST;
+    View( ZT, Z, tLocBeg, 0, tLocSize, Z.Width() );
+    if( orientation == NORMAL )
+        LockedView( AST, ALoc, tLocBeg, sLocBeg, tLocSize, sLocSize );
+    else
+        LockedView( AST, ALoc, sLocBeg, tLocBeg, sLocSize, tLocSize );
+    Gemm( orientation, NORMAL, F(1), AST, XLoc, F(1), ZT );
+}
+
+// Pack our contributions to the reduction for the diagonal block occupying
+// indices [s,s+b): the first Z.Width() columns hold our updates to the
+// right-hand sides and the remaining b columns hold our piece of the block
+template<typename F>
+inline void
+PipelinedPack
+( int s, int b, const Matrix<F>& ALoc, int colShift, int colStride,
+  int rowShift, int rowStride, int tShift, int tStride, const Matrix<F>& Z,
+  Matrix<F>& sendBuf )
+{
+    const int width = Z.Width();
+    sendBuf.Empty();
+    Zeros( sendBuf, b, width+b );
+    F* sendBuffer = sendBuf.Buffer();
+    const int sendLDim = sendBuf.LDim();
+
+    const int tLocBeg = Length_( s, tShift, tStride );
+    const int tLocEnd = Length_( s+b, tShift, tStride );
+    for( int c=0; c<width; ++c )
+        for( int iLoc=tLocBeg; iLoc<tLocEnd; ++iLoc )
+            sendBuffer[(tShift+iLoc*tStride-s)+c*sendLDim] = Z.Get(iLoc,c);
+
+    const F* ABuffer = ALoc.LockedBuffer();
+    const int ALDim = ALoc.LDim();
+    const int iLocBeg = Length_( s, colShift, colStride );
+    const int iLocEnd = Length_( s+b, colShift, colStride );
+    const int jLocBeg = Length_( s, rowShift, rowStride );
+    const int jLocEnd = Length_( s+b, rowShift, rowStride );
+    for( int jLoc=jLocBeg; jLoc<jLocEnd; ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        for( int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const int i = colShift + iLoc*colStride;
+            sendBuffer[(i-s)+(width+j-s)*sendLDim] =
+                ABuffer[iLoc+jLoc*ALDim];
+        }
+    }
+}
+
+template<typename F>
+inline void
+PipelinedStartReduce
+( const Matrix<F>& sendBuf, Matrix<F>& recvBuf, mpi::Comm comm,
+  mpi::Request& request )
+{
+    recvBuf.Empty();
+    recvBuf.ResizeTo( sendBuf.Height(), sendBuf.Width() );
+    const int count = sendBuf.Height()*sendBuf.Width();
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::IAllReduce
+    ( sendBuf.LockedBuffer(), recvBuf.Buffer(), count, mpi::SUM, comm,
+      request );
+#else
+    mpi::AllReduce
+    ( sendBuf.LockedBuffer(), recvBuf.Buffer(), count, mpi::SUM, comm );
+#endif
+}
+
+inline void
+PipelinedFinishReduce( mpi::Request& request )
+{
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    mpi::Wait( request );
+#endif
+}
+
+// Overwrite the replicated matrix B with op(A)^-1 B, where A is an n x n
+// triangular matrix whose local entries, 'ALoc', lie in the global rows
+// colShift + iLoc*colStride and the global columns rowShift + jLoc*rowStride,
+// and each entry of A is owned by exactly one process in 'comm'
+template<typename F>
+inline void
+PipelinedSolve
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag, int n,
+  const Matrix<F>& ALoc, int colShift, int colStride,
+  int rowShift, int rowStride, mpi::Comm comm, Matrix<F>& B,
+  bool selectiveInversion, bool checkIfSingular )
+{
+#ifndef RELEASE
+    CallStackEntry entry("trsm::PipelinedSolve");
+    if( B.Height() != n )
+        throw std::logic_error("Nonconformal PipelinedSolve");
+#endif
+    if( n == 0 )
+        return;
+    const int width = B.Width();
+    const int bsize = Blocksize();
+    const int numBlocks = (n+bsize-1)/bsize;
+    const bool forward = ( (uplo==LOWER) == (orientation==NORMAL) );
+
+    // The updates are accumulated into the 'target' indices and make use of
+    // the solution at the 'source' indices
+    const bool normal = ( orientation == NORMAL );
+    const int tShift = ( normal ? colShift : rowShift );
+    const int tStride = ( normal ? colStride : rowStride );
+    const int sShift = ( normal ? rowShift : colShift );
+    const int sStride = ( normal ? rowStride : colStride );
+
+    Matrix<F> Z, XLoc, sendBuf, recvBuf;
+    Zeros( Z, Length_(n,tShift,tStride), width );
+
+    // Start by replicating the first diagonal block
+    mpi::Request request;
+    {
+        const int K = ( forward ? 0 : numBlocks-1 );
+        const int s = K*bsize;
+        const int b = std::min(bsize,n-s);
+        PipelinedPack
+        ( s, b, ALoc, colShift, colStride, rowShift, rowStride,
+          tShift, tStride, Z, sendBuf );
+        PipelinedStartReduce( sendBuf, recvBuf, comm, request );
+    }
+    for( int step=0; step<numBlocks; ++step )
+    {
+        const int K = ( forward ? step : numBlocks-1-step );
+        const int s = K*bsize;
+        const int b = std::min(bsize,n-s);
+
+        // BK := op(AKK)^-1 (BK - the updates from the solved blocks)
+        PipelinedFinishReduce( request );
+        Matrix<F> BK, ZK, DK;
+        View( BK, B, s, 0, b, width );
+        LockedView( ZK, recvBuf, 0, 0, b, width );
+        LockedView( DK, recvBuf, 0, width, b, b );
+        Axpy( F(-1), ZK, BK );
+        if( selectiveInversion )
+            Trmm( LEFT, uplo, orientation, diag, F(1), DK, BK );
+        else
+            Trsm
+            ( LEFT, uplo, orientation, diag, F(1), DK, BK, checkIfSingular );
+        if( step == numBlocks-1 )
+            break;
+
+        // Pack the entries of this block of the solution which are needed
+        // by our piece of the triangle
+        const int sLocBeg = Length_( s, sShift, sStride );
+        const int sLocEnd = Length_( s+b, sShift, sStride );
+        XLoc.Empty();
+        XLoc.ResizeTo( sLocEnd-sLocBeg, width );
+        for( int jLoc=sLocBeg; jLoc<sLocEnd; ++jLoc )
+        {
+            const int j = sShift + jLoc*sStride;
+            for( int c=0; c<width; ++c )
+                XLoc.Set( jLoc-sLocBeg, c, BK.Get(j-s,c) );
+        }
+
+        // Update the next block first and start its reduction
+        const int KNext = ( forward ? K+1 : K-1 );
+        const int sNext = KNext*bsize;
+        const int bNext = std::min(bsize,n-sNext);
+        const int tLocBeg = Length_( sNext, tShift, tStride );
+        const int tLocEnd = Length_( sNext+bNext, tShift, tStride );
+        PipelinedUpdate
+        ( orientation, ALoc, XLoc, sLocBeg, tLocBeg, tLocEnd, Z );
+        PipelinedPack
+        ( sNext, bNext, ALoc, colShift, colStride, rowShift, rowStride,
+          tShift, tStride, Z, sendBuf );
+        PipelinedStartReduce( sendBuf, recvBuf, comm, request );
+
+        // Update the remainder of the unsolved blocks during the reduction
+        if( forward )
+            PipelinedUpdate
+            ( orientation, ALoc, XLoc, sLocBeg, tLocEnd, Z.Height(), Z );
+        else
+            PipelinedUpdate
+            ( orientation, ALoc, XLoc, sLocBeg, 0, tLocBeg, Z );
+    }
+}
+
+} // namespace trsm
+
+namespace internal {
+
+// Left (Upper/Lower) (Normal/Transpose/Adjoint) (Non)Unit Trsm for a small
+// number of right-hand sides
+template<typename F>
+inline void
+TrsmLPipelined
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const DistMatrix<F>& A, DistMatrix<F>& X,
+  bool selectiveInversion, bool checkIfSingular )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::TrsmLPipelined");
+#endif
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( X );
+    Scale( alpha, X_STAR_STAR.Matrix() );
+    trsm::PipelinedSolve
+    ( uplo, orientation, diag, A.Height(), A.LockedMatrix(),
+      A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride(),
+      A.Grid().Comm(), X_STAR_STAR.Matrix(),
+      selectiveInversion, checkIfSingular );
+    X = X_STAR_STAR;
+}
+
+// Pipelined version of TrsmLLNSmall
+template<typename F>
+inline void
+TrsmLLNSmallPipelined
+( UnitOrNonUnit diag,
+  F alpha, const DistMatrix<F,VC,STAR>& L, DistMatrix<F,VC,STAR>& X,
+  bool selectiveInversion, bool checkIfSingular )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::TrsmLLNSmallPipelined");
+#endif
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( X );
+    Scale( alpha, X_STAR_STAR.Matrix() );
+    trsm::PipelinedSolve
+    ( LOWER, NORMAL, diag, L.Height(), L.LockedMatrix(),
+      L.ColShift(), L.ColStride(), 0, 1, L.Grid().VCComm(),
+      X_STAR_STAR.Matrix(), selectiveInversion, checkIfSingular );
+    X = X_STAR_STAR;
+}
+
+} // namespace internal
+} // namespace elem
+
+#endif // ifndef BLAS_TRSM_PIPELINED_HPP
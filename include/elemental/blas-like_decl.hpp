@@ -227,6 +227,29 @@ void TrrkTT
 
 } // namespace internal
 
+//----------------------------------------------------------------------------//
+// Utilities                                                                  //
+//----------------------------------------------------------------------------//
+
+// Combines (scale,scaledSquare) pairs, each packed into a Complex<R>, so that
+// the sums of squares behind Nrm2 and FrobeniusNorm may be reduced without
+// overflow in a single AllReduce
+template<typename R>
+void ScaledSquareFunc
+( void* inData, void* outData, int* length, mpi::Datatype* datatype );
+
+template<typename R> mpi::Op ScaledSquareOp();
+template<> mpi::Op ScaledSquareOp<float>();
+template<> mpi::Op ScaledSquareOp<double>();
+
+template<typename R> void CreateScaledSquareOp();
+template<> void CreateScaledSquareOp<float>();
+template<> void CreateScaledSquareOp<double>();
+
+template<typename R> void DestroyScaledSquareOp();
+template<> void DestroyScaledSquareOp<float>();
+template<> void DestroyScaledSquareOp<double>();
+
 //----------------------------------------------------------------------------//
 // Tuning parameters                                                          //
 //----------------------------------------------------------------------------//
@@ -11,11 +11,368 @@
 #define CONTROL_LYAPUNOV_HPP
 
 #include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
 #include "elemental/control/Sylvester.hpp"
+#include "elemental/lapack-like/ApplyColumnPivots.hpp"
+#include "elemental/lapack-like/QR/BusingerGolub.hpp"
 
 namespace elem {
+namespace lyapunov {
 
-// A is assumed to have all of its eigenvalues in the open-half plane.
+// The special case of sylvester::NewtonStep where B = A^H, which remains
+// true of every iterate of
+//
+//   W = | A -C   |,
+//       | 0 -A^H |
+//
+// so that only A needs to be inverted in each step
+template<typename F>
+inline void
+NewtonStep
+( const Matrix<F>& A, const Matrix<F>& C, Matrix<F>& ANew, Matrix<F>& CNew,
+  sign::Scaling scaling=sign::FROB_NORM )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::NewtonStep");
+#endif
+    typedef BASE(F) R;
+
+    // Form inv(A) and inv(A) C inv(A)^H
+    ANew = A;
+    const R kappa = sylvester::Invert( ANew, scaling );
+    Matrix<F> T;
+    Gemm( NORMAL, NORMAL, F(1), ANew, C, T );
+    Gemm( NORMAL, ADJOINT, F(1), T, ANew, CNew );
+
+    R mu;
+    if( scaling == sign::DETERMINANT )
+        mu = R(1)/Exp(kappa);
+    else if( scaling == sign::FROB_NORM )
+    {
+        const R frobA = FrobeniusNorm( A );
+        const R frobC = FrobeniusNorm( C );
+        const R frobAInv = FrobeniusNorm( ANew );
+        const R frobCNew = FrobeniusNorm( CNew );
+        mu = Sqrt( Sqrt(2*frobAInv*frobAInv+frobCNew*frobCNew)/
+                   Sqrt(2*frobA*frobA+frobC*frobC) );
+    }
+    else
+        mu = 1;
+
+    // Overwrite the new blocks with the new iterate
+    const R halfMu = mu/R(2);
+    const R halfMuInv = R(1)/(2*mu);
+    Scale( halfMuInv, ANew ); Axpy( halfMu, A, ANew );
+    Scale( halfMuInv, CNew ); Axpy( halfMu, C, CNew );
+}
+
+template<typename F>
+inline void
+NewtonStep
+( const DistMatrix<F>& A, const DistMatrix<F>& C,
+  DistMatrix<F>& ANew, DistMatrix<F>& CNew,
+  sign::Scaling scaling=sign::FROB_NORM )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::NewtonStep");
+#endif
+    typedef BASE(F) R;
+
+    // Form inv(A) and inv(A) C inv(A)^H
+    ANew = A;
+    const R kappa = sylvester::Invert( ANew, scaling );
+    DistMatrix<F> T( A.Grid() );
+    Gemm( NORMAL, NORMAL, F(1), ANew, C, T );
+    Gemm( NORMAL, ADJOINT, F(1), T, ANew, CNew );
+
+    R mu;
+    if( scaling == sign::DETERMINANT )
+        mu = R(1)/Exp(kappa);
+    else if( scaling == sign::FROB_NORM )
+    {
+        const R frobA = FrobeniusNorm( A );
+        const R frobC = FrobeniusNorm( C );
+        const R frobAInv = FrobeniusNorm( ANew );
+        const R frobCNew = FrobeniusNorm( CNew );
+        mu = Sqrt( Sqrt(2*frobAInv*frobAInv+frobCNew*frobCNew)/
+                   Sqrt(2*frobA*frobA+frobC*frobC) );
+    }
+    else
+        mu = 1;
+
+    // Overwrite the new blocks with the new iterate
+    const R halfMu = mu/R(2);
+    const R halfMuInv = R(1)/(2*mu);
+    Scale( halfMuInv, ANew ); Axpy( halfMu, A, ANew );
+    Scale( halfMuInv, CNew ); Axpy( halfMu, C, CNew );
+}
+
+// Overwrite A and C with the top blocks of sgn(W), which should respectively
+// be the identity and 2 X, and return the number of iterations
+template<typename F>
+inline int
+Newton
+( Matrix<F>& A, Matrix<F>& C,
+  sign::Scaling scaling=sign::FROB_NORM, int maxIts=100, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::Newton");
+#endif
+    typedef BASE(F) R;
+    Matrix<F> ATmp, CTmp;
+    Matrix<F> *X=&A, *Z=&C, *XNew=&ATmp, *ZNew=&CTmp;
+
+    if( tol == R(0) )
+        tol = 2*A.Height()*lapack::MachineEpsilon<R>();
+
+    int numIts=0;
+    while( numIts < maxIts )
+    {
+        // Overwrite the new blocks with the new iterate
+        NewtonStep( *X, *Z, *XNew, *ZNew, scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( R(-1), *XNew, *X );
+        Axpy( R(-1), *ZNew, *Z );
+        const R diffA = FrobeniusNorm( *X );
+        const R diffC = FrobeniusNorm( *Z );
+        const R frobA = FrobeniusNorm( *XNew );
+        const R frobC = FrobeniusNorm( *ZNew );
+        const R frobDiff = Sqrt( 2*diffA*diffA + diffC*diffC );
+        const R frobNew = Sqrt( 2*frobA*frobA + frobC*frobC );
+
+        // Ensure that X and Z hold the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        std::swap( Z, ZNew );
+        if( frobDiff/frobNew <= tol )
+            break;
+    }
+    if( X != &A )
+    {
+        A = *X;
+        C = *Z;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline int
+Newton
+( DistMatrix<F>& A, DistMatrix<F>& C,
+  sign::Scaling scaling=sign::FROB_NORM, int maxIts=100, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::Newton");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    DistMatrix<F> ATmp(g), CTmp(g);
+    DistMatrix<F> *X=&A, *Z=&C, *XNew=&ATmp, *ZNew=&CTmp;
+
+    if( tol == R(0) )
+        tol = 2*A.Height()*lapack::MachineEpsilon<R>();
+
+    int numIts=0;
+    while( numIts < maxIts )
+    {
+        // Overwrite the new blocks with the new iterate
+        NewtonStep( *X, *Z, *XNew, *ZNew, scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( R(-1), *XNew, *X );
+        Axpy( R(-1), *ZNew, *Z );
+        const R diffA = FrobeniusNorm( *X );
+        const R diffC = FrobeniusNorm( *Z );
+        const R frobA = FrobeniusNorm( *XNew );
+        const R frobC = FrobeniusNorm( *ZNew );
+        const R frobDiff = Sqrt( 2*diffA*diffA + diffC*diffC );
+        const R frobNew = Sqrt( 2*frobA*frobA + frobC*frobC );
+
+        // Ensure that X and Z hold the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        std::swap( Z, ZNew );
+        if( frobDiff/frobNew <= tol )
+            break;
+    }
+    if( X != &A )
+    {
+        A = *X;
+        C = *Z;
+    }
+    return numIts;
+}
+
+// A column compression of G which (approximately) preserves G G^H:
+// if G^H P = Q R is a QR factorization with column pivoting, then
+// G G^H = P R^H R P^T, so that G may be replaced by the columns of P R^H
+// which correspond to the diagonal entries of R which are above tol times
+// the largest row norm of G
+template<typename F>
+inline void
+CompressColumns( Matrix<F>& G, BASE(F) tol )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::CompressColumns");
+#endif
+    const int m = G.Height();
+    const int k = G.Width();
+    Matrix<F> Y, R;
+    Matrix<int> p;
+    Adjoint( G, Y );
+    qr::BusingerGolub( Y, p, std::min(k,m), tol );
+    const int rank = p.Height();
+    View( R, Y, 0, 0, rank, m );
+    MakeTrapezoidal( UPPER, R );
+    ApplyInverseColumnPivots( R, p );
+    Adjoint( R, G );
+}
+
+template<typename F>
+inline void
+CompressColumns( DistMatrix<F>& G, BASE(F) tol )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::CompressColumns");
+#endif
+    const int m = G.Height();
+    const int k = G.Width();
+    DistMatrix<F> Y( G.Grid() ), R( G.Grid() );
+    DistMatrix<int,VR,STAR> p( G.Grid() );
+    Adjoint( G, Y );
+    qr::BusingerGolub( Y, p, std::min(k,m), tol );
+    const int rank = p.Height();
+    View( R, Y, 0, 0, rank, m );
+    MakeTrapezoidal( UPPER, R );
+    ApplyInverseColumnPivots( R, p );
+    Adjoint( R, G );
+}
+
+// The low-rank factored Newton iteration for the sign of W when C = G G^H:
+// since C := (mu C + inv(A) C inv(A)^H/mu)/2, the factor can be updated as
+// G := [sqrt(mu/2) G, inv(A) G/sqrt(2 mu)] and then compressed. On exit, A
+// should be the identity and G G^H should be 2 X.
+template<typename F>
+inline int
+FactoredNewton
+( Matrix<F>& A, Matrix<F>& G,
+  sign::Scaling scaling=sign::FROB_NORM, int maxIts=100, BASE(F) tol=0,
+  BASE(F) compressTol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::FactoredNewton");
+#endif
+    typedef BASE(F) R;
+    const int m = A.Height();
+    if( tol == R(0) )
+        tol = m*lapack::MachineEpsilon<R>();
+    if( compressTol == R(0) )
+        compressTol = Sqrt(m*lapack::MachineEpsilon<R>());
+
+    Matrix<F> AInv, GNew, GL, GR;
+    int numIts=0;
+    while( numIts < maxIts )
+    {
+        AInv = A;
+        const R kappa = sylvester::Invert( AInv, scaling );
+        R mu;
+        if( scaling == sign::DETERMINANT )
+            mu = R(1)/Exp(kappa);
+        else if( scaling == sign::FROB_NORM )
+            mu = Sqrt( FrobeniusNorm(AInv)/FrobeniusNorm(A) );
+        else
+            mu = 1;
+
+        // G := [sqrt(mu/2) G, inv(A) G/sqrt(2 mu)], with compressed columns
+        const int r = G.Width();
+        Zeros( GNew, m, 2*r );
+        View( GL, GNew, 0, 0, m, r );
+        View( GR, GNew, 0, r, m, r );
+        Axpy( Sqrt(mu/R(2)), G, GL );
+        Gemm( NORMAL, NORMAL, F(1)/Sqrt(2*mu), AInv, G, F(0), GR );
+        CompressColumns( GNew, compressTol );
+        G = GNew;
+
+        // A := (mu A + inv(A)/mu)/2, and test for convergence using the
+        // difference in its iterates
+        const R halfMu = mu/R(2);
+        const R halfMuInv = R(1)/(2*mu);
+        Scale( halfMuInv, AInv ); Axpy( halfMu, A, AInv );
+        Axpy( R(-1), AInv, A );
+        const R frobDiff = FrobeniusNorm( A );
+        const R frobNew = FrobeniusNorm( AInv );
+        A = AInv;
+
+        ++numIts;
+        if( frobDiff/frobNew <= tol )
+            break;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline int
+FactoredNewton
+( DistMatrix<F>& A, DistMatrix<F>& G,
+  sign::Scaling scaling=sign::FROB_NORM, int maxIts=100, BASE(F) tol=0,
+  BASE(F) compressTol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lyapunov::FactoredNewton");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    if( tol == R(0) )
+        tol = m*lapack::MachineEpsilon<R>();
+    if( compressTol == R(0) )
+        compressTol = Sqrt(m*lapack::MachineEpsilon<R>());
+
+    DistMatrix<F> AInv(g), GNew(g), GL(g), GR(g);
+    int numIts=0;
+    while( numIts < maxIts )
+    {
+        AInv = A;
+        const R kappa = sylvester::Invert( AInv, scaling );
+        R mu;
+        if( scaling == sign::DETERMINANT )
+            mu = R(1)/Exp(kappa);
+        else if( scaling == sign::FROB_NORM )
+            mu = Sqrt( FrobeniusNorm(AInv)/FrobeniusNorm(A) );
+        else
+            mu = 1;
+
+        // G := [sqrt(mu/2) G, inv(A) G/sqrt(2 mu)], with compressed columns
+        const int r = G.Width();
+        Zeros( GNew, m, 2*r );
+        View( GL, GNew, 0, 0, m, r );
+        View( GR, GNew, 0, r, m, r );
+        Axpy( Sqrt(mu/R(2)), G, GL );
+        Gemm( NORMAL, NORMAL, F(1)/Sqrt(2*mu), AInv, G, F(0), GR );
+        CompressColumns( GNew, compressTol );
+        G = GNew;
+
+        // A := (mu A + inv(A)/mu)/2, and test for convergence using the
+        // difference in its iterates
+        const R halfMu = mu/R(2);
+        const R halfMuInv = R(1)/(2*mu);
+        Scale( halfMuInv, AInv ); Axpy( halfMu, A, AInv );
+        Axpy( R(-1), AInv, A );
+        const R frobDiff = FrobeniusNorm( A );
+        const R frobNew = FrobeniusNorm( AInv );
+        A = AInv;
+
+        ++numIts;
+        if( frobDiff/frobNew <= tol )
+            break;
+    }
+    return numIts;
+}
+
+} // namespace lyapunov
+
+// A is assumed to have all of its eigenvalues in the open right-half plane.
 // X is then returned as the solution of the system of equations:
 //    A X + X A^H = C
 //
@@ -32,17 +389,11 @@ Lyapunov( const Matrix<F>& A, const Matrix<F>& C, Matrix<F>& X )
     if( C.Height() != A.Height() || C.Width() != A.Height() )
         throw std::logic_error("C must conform with A");
 #endif
-    const int m = A.Height();
-    Matrix<F> W, WTL, WTR,
-                 WBL, WBR;
-    Zeros( W, 2*m, 2*m );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    Adjoint( A, WBR ); Scale( F(-1), WBR );
-    WTR = C; Scale( F(-1), WTR );
-    return Sylvester( m, W, X );
+    Matrix<F> ACopy( A );
+    X = C;
+    const int numIts = lyapunov::Newton( ACopy, X );
+    Scale( F(1)/F(2), X );
+    return numIts;
 }
 
 template<typename F>
@@ -50,7 +401,7 @@ inline int
 Lyapunov( const DistMatrix<F>& A, const DistMatrix<F>& C, DistMatrix<F>& X )
 {
 #ifndef RELEASE
-    CallStackEntry cse("Sylvester");
+    CallStackEntry cse("Lyapunov");
     if( A.Height() != A.Width() )
         throw std::logic_error("A must be square");
     if( C.Height() != A.Height() || C.Width() != A.Height() )
@@ -58,18 +409,56 @@ Lyapunov( const DistMatrix<F>& A, const DistMatrix<F>& C, DistMatrix<F>& X )
     if( A.Grid() != C.Grid() )
         throw std::logic_error("A and C must have the same grid");
 #endif
-    const Grid& g = A.Grid();
-    const int m = A.Height();
-    DistMatrix<F> W(g), WTL(g), WTR(g),
-                        WBL(g), WBR(g);
-    Zeros( W, 2*m, 2*m );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    Adjoint( A, WBR ); Scale( F(-1), WBR );
-    WTR = C; Scale( F(-1), WTR );
-    return Sylvester( m, W, X );
+    DistMatrix<F> ACopy( A );
+    X = C;
+    const int numIts = lyapunov::Newton( ACopy, X );
+    Scale( F(1)/F(2), X );
+    return numIts;
+}
+
+// When the right-hand side has the low-rank factorization C = G G^H, the
+// (numerically) low-rank factor Z of the solution, X = Z Z^H, is returned
+// instead, and the cost of each iteration is dominated by the inversion of A
+
+template<typename F>
+inline int
+FactoredLyapunov( const Matrix<F>& A, const Matrix<F>& G, Matrix<F>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry cse("FactoredLyapunov");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( G.Height() != A.Height() )
+        throw std::logic_error("G must conform with A");
+#endif
+    typedef BASE(F) R;
+    Matrix<F> ACopy( A );
+    Z = G;
+    const int numIts = lyapunov::FactoredNewton( ACopy, Z );
+    Scale( F(1)/Sqrt(R(2)), Z );
+    return numIts;
+}
+
+template<typename F>
+inline int
+FactoredLyapunov
+( const DistMatrix<F>& A, const DistMatrix<F>& G, DistMatrix<F>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry cse("FactoredLyapunov");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( G.Height() != A.Height() )
+        throw std::logic_error("G must conform with A");
+    if( A.Grid() != G.Grid() )
+        throw std::logic_error("A and G must have the same grid");
+#endif
+    typedef BASE(F) R;
+    DistMatrix<F> ACopy( A );
+    Z = G;
+    const int numIts = lyapunov::FactoredNewton( ACopy, Z );
+    Scale( F(1)/Sqrt(R(2)), Z );
+    return numIts;
 }
 
 } // namespace elem
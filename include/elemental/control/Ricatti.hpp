@@ -10,6 +10,7 @@
 #ifndef CONTROL_RICATTI_HPP
 #define CONTROL_RICATTI_HPP
 
+#include "elemental/blas-like/level1/Adjoint.hpp"
 #include "elemental/blas-like/level1/Axpy.hpp"
 #include "elemental/blas-like/level1/MakeHermitian.hpp"
 #include "elemental/blas-like/level1/Scale.hpp"
@@ -40,7 +41,7 @@ Ricatti( Matrix<F>& W, Matrix<F>& X )
     const int n = W.Height()/2;
     Matrix<F> WTL, WTR,
               WBL, WBR;
-    PartititionDownDiagonal
+    PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, n );
 
@@ -71,7 +72,7 @@ Ricatti( DistMatrix<F>& W, DistMatrix<F>& X )
     const int n = W.Height()/2;
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
-    PartititionDownDiagonal
+    PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, n );
 
@@ -97,7 +98,7 @@ Ricatti
   const Matrix<F>& A, const Matrix<F>& K, const Matrix<F>& L, Matrix<F>& X )
 {
 #ifndef RELEASE
-    CallStackEntry cse("Sylvester");
+    CallStackEntry cse("Ricatti");
     if( A.Height() != A.Width() )
         throw std::logic_error("A must be square");
     if( K.Height() != K.Width() )
@@ -106,8 +107,6 @@ Ricatti
         throw std::logic_error("L must be square");
     if( A.Height() != K.Height() || A.Height() != L.Height() )
         throw std::logic_error("A, K, and L must be the same size");
-    if( A.Grid() != K.Grid() || K.Grid() != L.Grid() )
-        throw std::logic_error("A, K, and L must have the same grid");
 #endif
     const int n = A.Height();
     Matrix<F> W, WTL, WTR,
@@ -133,7 +132,7 @@ Ricatti
   DistMatrix<F>& X )
 {
 #ifndef RELEASE
-    CallStackEntry cse("Sylvester");
+    CallStackEntry cse("Ricatti");
     if( A.Height() != A.Width() )
         throw std::logic_error("A must be square");
     if( K.Height() != K.Width() )
@@ -12,12 +12,275 @@
 
 #include "elemental/blas-like/level1/Axpy.hpp"
 #include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Determinant.hpp"
+#include "elemental/lapack-like/Inverse.hpp"
+#include "elemental/lapack-like/LU.hpp"
 #include "elemental/lapack-like/Norm/Frobenius.hpp"
 #include "elemental/lapack-like/Sign.hpp"
 #include "elemental/matrices/Identity.hpp"
 #include "elemental/matrices/Zeros.hpp"
 
 namespace elem {
+namespace sylvester {
+
+// Overwrite X with its inverse and return the logarithm of |det(X)|^(1/n)
+// when it is needed for determinant scaling (and zero otherwise)
+template<typename F>
+inline BASE(F)
+Invert( Matrix<F>& X, sign::Scaling scaling )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sylvester::Invert");
+#endif
+    typedef BASE(F) R;
+    R kappa = 0;
+    Matrix<int> p;
+    LU( X, p );
+    if( scaling == sign::DETERMINANT )
+        kappa = determinant::AfterLUPartialPiv( X, p ).kappa;
+    inverse::AfterLUPartialPiv( X, p );
+    return kappa;
+}
+
+template<typename F>
+inline BASE(F)
+Invert( DistMatrix<F>& X, sign::Scaling scaling )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sylvester::Invert");
+#endif
+    typedef BASE(F) R;
+    R kappa = 0;
+    DistMatrix<int,VC,STAR> p( X.Grid() );
+    LU( X, p );
+    if( scaling == sign::DETERMINANT )
+        kappa = determinant::AfterLUPartialPiv( X, p ).kappa;
+    inverse::AfterLUPartialPiv( X, p );
+    return kappa;
+}
+
+// A Newton step for the sign of the block upper-triangular matrix
+//
+//   W = | A -C |,
+//       | 0 -B |
+//
+// whose iterates all keep the same structure, so that only the diagonal
+// blocks need to be inverted:
+//
+//   A := (mu A + inv(A)/mu)/2,
+//   B := (mu B + inv(B)/mu)/2,
+//   C := (mu C + inv(A) C inv(B)/mu)/2.
+//
+// The scaling parameter, mu, is chosen exactly as it would be for W.
+
+template<typename F>
+inline void
+NewtonStep
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& C,
+  Matrix<F>& ANew, Matrix<F>& BNew, Matrix<F>& CNew,
+  sign::Scaling scaling=sign::FROB_NORM )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sylvester::NewtonStep");
+#endif
+    typedef BASE(F) R;
+    const int m = A.Height();
+    const int n = B.Height();
+
+    // Form the inverses of the diagonal blocks and inv(A) C inv(B)
+    ANew = A;
+    BNew = B;
+    const R kappaA = Invert( ANew, scaling );
+    const R kappaB = Invert( BNew, scaling );
+    Matrix<F> T;
+    Gemm( NORMAL, NORMAL, F(1), ANew, C, T );
+    Gemm( NORMAL, NORMAL, F(1), T, BNew, CNew );
+
+    R mu;
+    if( scaling == sign::DETERMINANT )
+        mu = R(1)/Exp((m*kappaA+n*kappaB)/(m+n));
+    else if( scaling == sign::FROB_NORM )
+    {
+        const R frobA = FrobeniusNorm( A );
+        const R frobB = FrobeniusNorm( B );
+        const R frobC = FrobeniusNorm( C );
+        const R frobAInv = FrobeniusNorm( ANew );
+        const R frobBInv = FrobeniusNorm( BNew );
+        const R frobCNew = FrobeniusNorm( CNew );
+        mu = Sqrt( Sqrt(frobAInv*frobAInv+frobBInv*frobBInv+frobCNew*frobCNew)/
+                   Sqrt(frobA*frobA+frobB*frobB+frobC*frobC) );
+    }
+    else
+        mu = 1;
+
+    // Overwrite the new blocks with the new iterate
+    const R halfMu = mu/R(2);
+    const R halfMuInv = R(1)/(2*mu);
+    Scale( halfMuInv, ANew ); Axpy( halfMu, A, ANew );
+    Scale( halfMuInv, BNew ); Axpy( halfMu, B, BNew );
+    Scale( halfMuInv, CNew ); Axpy( halfMu, C, CNew );
+}
+
+template<typename F>
+inline void
+NewtonStep
+( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& C,
+  DistMatrix<F>& ANew, DistMatrix<F>& BNew, DistMatrix<F>& CNew,
+  sign::Scaling scaling=sign::FROB_NORM )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sylvester::NewtonStep");
+#endif
+    typedef BASE(F) R;
+    const int m = A.Height();
+    const int n = B.Height();
+
+    // Form the inverses of the diagonal blocks and inv(A) C inv(B)
+    ANew = A;
+    BNew = B;
+    const R kappaA = Invert( ANew, scaling );
+    const R kappaB = Invert( BNew, scaling );
+    DistMatrix<F> T( A.Grid() );
+    Gemm( NORMAL, NORMAL, F(1), ANew, C, T );
+    Gemm( NORMAL, NORMAL, F(1), T, BNew, CNew );
+
+    R mu;
+    if( scaling == sign::DETERMINANT )
+        mu = R(1)/Exp((m*kappaA+n*kappaB)/(m+n));
+    else if( scaling == sign::FROB_NORM )
+    {
+        const R frobA = FrobeniusNorm( A );
+        const R frobB = FrobeniusNorm( B );
+        const R frobC = FrobeniusNorm( C );
+        const R frobAInv = FrobeniusNorm( ANew );
+        const R frobBInv = FrobeniusNorm( BNew );
+        const R frobCNew = FrobeniusNorm( CNew );
+        mu = Sqrt( Sqrt(frobAInv*frobAInv+frobBInv*frobBInv+frobCNew*frobCNew)/
+                   Sqrt(frobA*frobA+frobB*frobB+frobC*frobC) );
+    }
+    else
+        mu = 1;
+
+    // Overwrite the new blocks with the new iterate
+    const R halfMu = mu/R(2);
+    const R halfMuInv = R(1)/(2*mu);
+    Scale( halfMuInv, ANew ); Axpy( halfMu, A, ANew );
+    Scale( halfMuInv, BNew ); Axpy( halfMu, B, BNew );
+    Scale( halfMuInv, CNew ); Axpy( halfMu, C, CNew );
+}
+
+// Overwrite A, B, and C with the blocks of sgn(W), which should respectively
+// be the identity, the identity, and 2 X, and return the number of iterations
+template<typename F>
+inline int
+Newton
+( Matrix<F>& A, Matrix<F>& B, Matrix<F>& C,
+  sign::Scaling scaling=sign::FROB_NORM, int maxIts=100, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sylvester::Newton");
+#endif
+    typedef BASE(F) R;
+    Matrix<F> ATmp, BTmp, CTmp;
+    Matrix<F> *X=&A, *Y=&B, *Z=&C, *XNew=&ATmp, *YNew=&BTmp, *ZNew=&CTmp;
+
+    if( tol == R(0) )
+        tol = (A.Height()+B.Height())*lapack::MachineEpsilon<R>();
+
+    int numIts=0;
+    while( numIts < maxIts )
+    {
+        // Overwrite the new blocks with the new iterate
+        NewtonStep( *X, *Y, *Z, *XNew, *YNew, *ZNew, scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( R(-1), *XNew, *X );
+        Axpy( R(-1), *YNew, *Y );
+        Axpy( R(-1), *ZNew, *Z );
+        const R diffA = FrobeniusNorm( *X );
+        const R diffB = FrobeniusNorm( *Y );
+        const R diffC = FrobeniusNorm( *Z );
+        const R frobA = FrobeniusNorm( *XNew );
+        const R frobB = FrobeniusNorm( *YNew );
+        const R frobC = FrobeniusNorm( *ZNew );
+        const R frobDiff = Sqrt( diffA*diffA + diffB*diffB + diffC*diffC );
+        const R frobNew = Sqrt( frobA*frobA + frobB*frobB + frobC*frobC );
+
+        // Ensure that X, Y, and Z hold the current iterate and break if
+        // possible
+        ++numIts;
+        std::swap( X, XNew );
+        std::swap( Y, YNew );
+        std::swap( Z, ZNew );
+        if( frobDiff/frobNew <= tol )
+            break;
+    }
+    if( X != &A )
+    {
+        A = *X;
+        B = *Y;
+        C = *Z;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline int
+Newton
+( DistMatrix<F>& A, DistMatrix<F>& B, DistMatrix<F>& C,
+  sign::Scaling scaling=sign::FROB_NORM, int maxIts=100, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sylvester::Newton");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    DistMatrix<F> ATmp(g), BTmp(g), CTmp(g);
+    DistMatrix<F> *X=&A, *Y=&B, *Z=&C, *XNew=&ATmp, *YNew=&BTmp, *ZNew=&CTmp;
+
+    if( tol == R(0) )
+        tol = (A.Height()+B.Height())*lapack::MachineEpsilon<R>();
+
+    int numIts=0;
+    while( numIts < maxIts )
+    {
+        // Overwrite the new blocks with the new iterate
+        NewtonStep( *X, *Y, *Z, *XNew, *YNew, *ZNew, scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( R(-1), *XNew, *X );
+        Axpy( R(-1), *YNew, *Y );
+        Axpy( R(-1), *ZNew, *Z );
+        const R diffA = FrobeniusNorm( *X );
+        const R diffB = FrobeniusNorm( *Y );
+        const R diffC = FrobeniusNorm( *Z );
+        const R frobA = FrobeniusNorm( *XNew );
+        const R frobB = FrobeniusNorm( *YNew );
+        const R frobC = FrobeniusNorm( *ZNew );
+        const R frobDiff = Sqrt( diffA*diffA + diffB*diffB + diffC*diffC );
+        const R frobNew = Sqrt( frobA*frobA + frobB*frobB + frobC*frobC );
+
+        // Ensure that X, Y, and Z hold the current iterate and break if
+        // possible
+        ++numIts;
+        std::swap( X, XNew );
+        std::swap( Y, YNew );
+        std::swap( Z, ZNew );
+        if( frobDiff/frobNew <= tol )
+            break;
+    }
+    if( X != &A )
+    {
+        A = *X;
+        B = *Y;
+        C = *Z;
+    }
+    return numIts;
+}
+
+} // namespace sylvester
+
 
 // W = | A -C |, where A is m x m, B is n x n, and both are assumed to have 
 //     | 0 -B |  all of their eigenvalues in the open right-half plane.
@@ -25,6 +288,8 @@ namespace elem {
 // The solution, X, to the equation
 //   A X + X B = C
 // is returned, as well as the number of Newton iterations for computing sgn(W).
+// The routines which accept A, B, and C never form W and instead apply
+// sylvester::Newton to its nonzero blocks.
 //
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
 
@@ -38,7 +303,7 @@ Sylvester( int m, Matrix<F>& W, Matrix<F>& X )
     const int numIts = Sign( W );
     Matrix<F> WTL, WTR,
               WBL, WBR;
-    PartititionDownDiagonal
+    PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
     // WTL and WBR should be the positive and negative identity, WBL should be 
@@ -75,7 +340,7 @@ Sylvester( int m, DistMatrix<F>& W, DistMatrix<F>& X )
     const int numIts = Sign( W );
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
-    PartititionDownDiagonal
+    PartitionDownDiagonal
     ( W, WTL, WTR,
          WBL, WBR, m );
     // WTL and WBR should be the positive and negative identity, WBL should be 
@@ -116,18 +381,12 @@ Sylvester
     if( C.Height() != A.Height() || C.Width() != B.Height() )
         throw std::logic_error("C must conform with A and B");
 #endif
-    const int m = C.Height();
-    const int n = C.Width();
-    Matrix<F> W, WTL, WTR,
-                 WBL, WBR;
-    Zeros( W, m+n, m+n );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    WBR = B; Scale( F(-1), WBR );
-    WTR = C; Scale( F(-1), WTR );
-    return Sylvester( m, W, X );
+    // Rather than forming W, iterate directly on its nonzero blocks
+    Matrix<F> ACopy( A ), BCopy( B );
+    X = C;
+    const int numIts = sylvester::Newton( ACopy, BCopy, X );
+    Scale( F(1)/F(2), X );
+    return numIts;
 }
 
 template<typename F>
@@ -147,19 +406,12 @@ Sylvester
     if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
         throw std::logic_error("A, B, and C must have the same grid");
 #endif
-    const int m = C.Height();
-    const int n = C.Width();
-    const Grid& g = A.Grid();
-    DistMatrix<F> W(g), WTL(g), WTR(g),
-                        WBL(g), WBR(g);
-    Zeros( W, m+n, m+n );
-    PartitionDownDiagonal
-    ( W, WTL, WTR,
-         WBL, WBR, m );
-    WTL = A;
-    WBR = B; Scale( F(-1), WBR );
-    WTR = C; Scale( F(-1), WTR );
-    return Sylvester( m, W, X );
+    // Rather than forming W, iterate directly on its nonzero blocks
+    DistMatrix<F> ACopy( A ), BCopy( B );
+    X = C;
+    const int numIts = sylvester::Newton( ACopy, BCopy, X );
+    Scale( F(1)/F(2), X );
+    return numIts;
 }
 
 } // namespace elem
@@ -57,9 +57,9 @@ SingularValueSoftThreshold( Matrix<F>& A, BASE(F) tau, int numSteps )
     Matrix<F> ACopyUpper;
     LockedView( ACopyUpper, ACopy, 0, 0, numSteps, n );
 
-    Matrix<F> U( ACopyUpper ), V;
+    Matrix<F> U, V;
     Matrix<Real> s;
-    MakeTriangular( UPPER, U );
+    Evaluate( lazy::MakeTrapezoidal( UPPER, Lazy(ACopyUpper) ), U );
     svd::Thresholded( U, s, V, tau );
     SoftThreshold( s, tau );
     DiagonalScale( RIGHT, NORMAL, s, U );
@@ -115,9 +115,9 @@ SingularValueSoftThreshold( DistMatrix<F>& A, BASE(F) tau, int numSteps )
     DistMatrix<F> ACopyUpper(g);
     LockedView( ACopyUpper, ACopy, 0, 0, numSteps, n );
 
-    DistMatrix<F> U( ACopyUpper ), V(g);
+    DistMatrix<F> U(g), V(g);
     DistMatrix<Real,VR,STAR> s(g);
-    MakeTriangular( UPPER, U );
+    Evaluate( lazy::MakeTrapezoidal( UPPER, Lazy(ACopyUpper) ), U );
     svd::Thresholded( U, s, V, tau );
     SoftThreshold( s, tau );
     DiagonalScale( RIGHT, NORMAL, s, U );
@@ -10,6 +10,8 @@
 #ifndef CONVEX_SOFTTHRESHOLD_HPP
 #define CONVEX_SOFTTHRESHOLD_HPP
 
+#include "elemental/blas-like/level1/Lazy.hpp"
+
 namespace elem {
 
 template<typename F>
@@ -26,6 +28,36 @@ SoftThreshold( F alpha, BASE(F) tau )
     return ( scale <= tau ? F(0) : alpha-(alpha/scale)*tau );
 }
 
+namespace lazy {
+
+template<typename F>
+struct SoftThresholdFunctor
+{
+    BASE(F) tau;
+    SoftThresholdFunctor( BASE(F) threshold ) : tau(threshold) { }
+    F operator()( F alpha ) const
+    {
+        typedef BASE(F) R;
+        const R scale = Abs(alpha);
+        return ( scale <= tau ? F(0) : alpha-(alpha/scale)*tau );
+    }
+};
+
+template<typename E>
+inline Mapped<E,SoftThresholdFunctor<typename E::T> >
+SoftThreshold( const Expression<E>& A, BASE(typename E::T) tau )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lazy::SoftThreshold");
+    if( tau < 0 )
+        throw std::logic_error("Negative threshold does not make sense");
+#endif
+    typedef typename E::T F;
+    return Map( A, SoftThresholdFunctor<F>(tau) );
+}
+
+} // namespace lazy
+
 template<typename F>
 inline void
 SoftThreshold( Matrix<F>& A, BASE(F) tau )
@@ -33,11 +65,7 @@ SoftThreshold( Matrix<F>& A, BASE(F) tau )
 #ifndef RELEASE
     CallStackEntry entry("SoftThreshold");
 #endif
-    const int height = A.Height();
-    const int width = A.Width();
-    for( int j=0; j<width; ++j )
-        for( int i=0; i<height; ++i )
-            A.Set( i, j, SoftThreshold(A.Get(i,j),tau) );
+    Evaluate( lazy::SoftThreshold( Lazy(A), tau ), A );
 }
 
 template<typename F,Distribution U,Distribution V>
@@ -47,7 +75,7 @@ SoftThreshold( DistMatrix<F,U,V>& A, BASE(F) tau )
 #ifndef RELEASE
     CallStackEntry entry("SoftThreshold");
 #endif
-    SoftThreshold( A.Matrix(), tau );
+    Evaluate( lazy::SoftThreshold( Lazy(A), tau ), A );
 }
 
 } // namespace elem
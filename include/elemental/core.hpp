@@ -19,8 +19,10 @@
 #include <cstring>
 #include <ctime>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <queue>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
@@ -63,6 +65,9 @@
 #include "elemental/core/imports/mpi.hpp"
 #include "elemental/core/grid_decl.hpp"
 #include "elemental/core/dist_matrix.hpp"
+#include "elemental/core/grid_partition_decl.hpp"
+#include "elemental/core/shared_star_star_decl.hpp"
+#include "elemental/core/disk_dist_matrix_decl.hpp"
 #include "elemental/core/environment_decl.hpp"
 #include "elemental/core/indexing_decl.hpp"
 
@@ -93,8 +98,15 @@
 #include "elemental/core/slide_partition_impl.hpp"
 #include "elemental/core/random_decl.hpp"
 #include "elemental/core/random_impl.hpp"
+#include "elemental/core/batch_decl.hpp"
+#include "elemental/core/batch_impl.hpp"
+#include "elemental/core/grid_partition_impl.hpp"
+#include "elemental/core/shared_star_star_impl.hpp"
+#include "elemental/core/disk_dist_matrix_impl.hpp"
 #include "elemental/core/axpy_interface_decl.hpp"
 #include "elemental/core/axpy_interface_impl.hpp"
+#include "elemental/core/rma_axpy_interface_decl.hpp"
+#include "elemental/core/rma_axpy_interface_impl.hpp"
 
 #include "elemental/core/ReduceComm.hpp"
 
@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_BATCH_DECL_HPP
+#define CORE_BATCH_DECL_HPP
+
+namespace elem {
+
+// A collection of independent, column-major matrices (of possibly differing
+// sizes). The members are either stored contiguously within a buffer owned
+// by the batch or are attached views of existing matrices.
+template<typename T>
+class MatrixBatch
+{
+public:
+    MatrixBatch();
+    // A batch of 'batchSize' matrices, each of the same size
+    MatrixBatch( int batchSize, int height, int width );
+    // A batch of matrices of the specified sizes
+    MatrixBatch
+    ( const std::vector<int>& heights, const std::vector<int>& widths );
+
+    int Size() const;
+    // Whether or not any of the members are attached views
+    bool Viewing() const;
+    int Height( int k ) const;
+    int Width( int k ) const;
+    int LDim( int k ) const;
+    T* Buffer( int k );
+    const T* LockedBuffer( int k ) const;
+
+    // Make A a view of (or a locked view of) the k'th member
+    void View( int k, Matrix<T>& A );
+    void LockedView( int k, Matrix<T>& A ) const;
+
+    // Append a view of an existing matrix as a new member
+    void Attach( Matrix<T>& A );
+
+    // Reallocate the batch (which must not have any attached members)
+    void ResizeTo( int batchSize, int height, int width );
+    void ResizeTo
+    ( const std::vector<int>& heights, const std::vector<int>& widths );
+    void Empty();
+
+private:
+    bool viewing_;
+    std::vector<int> heights_, widths_, ldims_;
+    std::vector<T*> buffers_;
+    Memory<T> memory_;
+
+    MatrixBatch( const MatrixBatch<T>& );
+    const MatrixBatch<T>& operator=( const MatrixBatch<T>& );
+};
+
+namespace batch {
+
+// Estimate the cost of factoring an m x n matrix
+double Cost( int m, int n );
+
+// The indices of the members of a batch, sorted by decreasing cost
+template<typename T>
+void DescendingCostOrder( const MatrixBatch<T>& A, std::vector<int>& order );
+
+// Apply a functor to each member index within 'order', in parallel (when
+// OpenMP is available). If any members fail, the exception raised by the
+// earliest of them within 'order' is rethrown with its original type (see
+// ClassifyException for the types which are preserved across threads)
+template<typename Functor>
+void Apply( const std::vector<int>& order, const Functor& functor );
+
+} // namespace batch
+
+// Assigns each member of a batch of square matrices to a team of processes
+// so as to balance the cost of factoring them. Each team is formed from
+// 'teamSize' consecutive ranks of 'comm' (the last team may be smaller) and
+// owns a grid over which its members may be distributed; with the default
+// team size of one, each member is assigned to a single process and may be
+// processed locally with the batched routines. Random streams are numbered
+// separately for each team grid, so teams which draw over their grids do not
+// affect the streams of 'comm', but their streams coincide; random members
+// should instead be drawn from a stream of 'comm' split by batch index (see
+// RandomStream), which also makes them independent of the team layout.
+class BatchDistribution
+{
+public:
+    BatchDistribution
+    ( mpi::Comm comm, const std::vector<int>& sizes, int teamSize=1 );
+    ~BatchDistribution();
+
+    int NumTeams() const;
+    int TeamSize( int team ) const;
+    // The team of this process
+    int Team() const;
+    // The team which owns the k'th member
+    int Owner( int k ) const;
+    // The members owned by the team of this process, sorted by decreasing cost
+    const std::vector<int>& LocalMembers() const;
+    const Grid& TeamGrid() const;
+
+private:
+    int numTeams_, team_, teamSize_, commSize_;
+    std::vector<int> owners_, localMembers_;
+    Grid* teamGrid_;
+
+    BatchDistribution( const BatchDistribution& );
+    const BatchDistribution& operator=( const BatchDistribution& );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_BATCH_DECL_HPP
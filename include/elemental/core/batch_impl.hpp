@@ -0,0 +1,305 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_BATCH_IMPL_HPP
+#define CORE_BATCH_IMPL_HPP
+
+namespace elem {
+
+//
+// MatrixBatch
+//
+
+template<typename T>
+inline
+MatrixBatch<T>::MatrixBatch()
+: viewing_(false)
+{ }
+
+template<typename T>
+inline
+MatrixBatch<T>::MatrixBatch( int batchSize, int height, int width )
+: viewing_(false)
+{ ResizeTo( batchSize, height, width ); }
+
+template<typename T>
+inline
+MatrixBatch<T>::MatrixBatch
+( const std::vector<int>& heights, const std::vector<int>& widths )
+: viewing_(false)
+{ ResizeTo( heights, widths ); }
+
+template<typename T>
+inline int
+MatrixBatch<T>::Size() const
+{ return heights_.size(); }
+
+template<typename T>
+inline bool
+MatrixBatch<T>::Viewing() const
+{ return viewing_; }
+
+template<typename T>
+inline int
+MatrixBatch<T>::Height( int k ) const
+{ return heights_[k]; }
+
+template<typename T>
+inline int
+MatrixBatch<T>::Width( int k ) const
+{ return widths_[k]; }
+
+template<typename T>
+inline int
+MatrixBatch<T>::LDim( int k ) const
+{ return ldims_[k]; }
+
+template<typename T>
+inline T*
+MatrixBatch<T>::Buffer( int k )
+{ return buffers_[k]; }
+
+template<typename T>
+inline const T*
+MatrixBatch<T>::LockedBuffer( int k ) const
+{ return buffers_[k]; }
+
+template<typename T>
+inline void
+MatrixBatch<T>::View( int k, Matrix<T>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MatrixBatch::View");
+    if( k < 0 || k >= Size() )
+        throw std::logic_error("Batch index is out of bounds");
+#endif
+    A.Attach( heights_[k], widths_[k], buffers_[k], ldims_[k] );
+}
+
+template<typename T>
+inline void
+MatrixBatch<T>::LockedView( int k, Matrix<T>& A ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("MatrixBatch::LockedView");
+    if( k < 0 || k >= Size() )
+        throw std::logic_error("Batch index is out of bounds");
+#endif
+    A.LockedAttach( heights_[k], widths_[k], buffers_[k], ldims_[k] );
+}
+
+template<typename T>
+inline void
+MatrixBatch<T>::Attach( Matrix<T>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MatrixBatch::Attach");
+#endif
+    if( A.Locked() )
+        throw std::logic_error("Cannot attach a locked matrix to a batch");
+    viewing_ = true;
+    heights_.push_back( A.Height() );
+    widths_.push_back( A.Width() );
+    ldims_.push_back( A.LDim() );
+    buffers_.push_back( A.Buffer() );
+}
+
+template<typename T>
+inline void
+MatrixBatch<T>::ResizeTo( int batchSize, int height, int width )
+{
+    std::vector<int> heights( batchSize, height ), widths( batchSize, width );
+    ResizeTo( heights, widths );
+}
+
+template<typename T>
+inline void
+MatrixBatch<T>::ResizeTo
+( const std::vector<int>& heights, const std::vector<int>& widths )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MatrixBatch::ResizeTo");
+#endif
+    if( viewing_ )
+        throw std::logic_error("Cannot resize a batch with attached members");
+    if( heights.size() != widths.size() )
+        throw std::logic_error("Heights and widths must be the same length");
+    const int batchSize = heights.size();
+    heights_ = heights;
+    widths_ = widths;
+    ldims_.resize( batchSize );
+    buffers_.resize( batchSize );
+    std::size_t totalSize = 0;
+    for( int k=0; k<batchSize; ++k )
+    {
+        if( heights[k] < 0 || widths[k] < 0 )
+            throw std::logic_error("Dimensions must be non-negative");
+        ldims_[k] = std::max( heights[k], 1 );
+        totalSize += std::size_t(ldims_[k])*widths[k];
+    }
+    T* buffer = memory_.Require( totalSize );
+    std::size_t offset = 0;
+    for( int k=0; k<batchSize; ++k )
+    {
+        buffers_[k] = &buffer[offset];
+        offset += std::size_t(ldims_[k])*widths[k];
+    }
+}
+
+template<typename T>
+inline void
+MatrixBatch<T>::Empty()
+{
+    viewing_ = false;
+    heights_.clear();
+    widths_.clear();
+    ldims_.clear();
+    buffers_.clear();
+    memory_.Empty();
+}
+
+namespace batch {
+
+inline double
+Cost( int m, int n )
+{ return double(m)*double(n)*double(std::min(m,n)); }
+
+template<typename T>
+inline void
+DescendingCostOrder( const MatrixBatch<T>& A, std::vector<int>& order )
+{
+    const int batchSize = A.Size();
+    std::vector<std::pair<double,int> > costs( batchSize );
+    for( int k=0; k<batchSize; ++k )
+        costs[k] = std::make_pair( -Cost(A.Height(k),A.Width(k)), k );
+    std::sort( costs.begin(), costs.end() );
+    order.resize( batchSize );
+    for( int s=0; s<batchSize; ++s )
+        order[s] = costs[s].second;
+}
+
+template<typename Functor>
+inline void
+Apply( const std::vector<int>& order, const Functor& functor )
+{
+    const int numMembers = order.size();
+#ifdef HAVE_OPENMP
+    // Exceptions cannot escape a parallel region, so the one raised at the
+    // earliest position within 'order' is recorded and recreated afterwards
+    int failedPos = numMembers;
+    ExceptionKind kind = NO_EXCEPTION;
+    std::string message;
+#pragma omp parallel for schedule(dynamic,1)
+    for( int s=0; s<numMembers; ++s )
+    {
+        try { functor( order[s] ); }
+        catch( std::exception& e )
+        {
+#pragma omp critical
+            {
+                if( s < failedPos )
+                {
+                    failedPos = s;
+                    kind = ClassifyException( e );
+                    message = e.what();
+                }
+            }
+        }
+    }
+    ThrowException( kind, message );
+#else
+    for( int s=0; s<numMembers; ++s )
+        functor( order[s] );
+#endif
+}
+
+} // namespace batch
+
+//
+// BatchDistribution
+//
+
+inline
+BatchDistribution::BatchDistribution
+( mpi::Comm comm, const std::vector<int>& sizes, int teamSize )
+: teamGrid_(0)
+{
+#ifndef RELEASE
+    CallStackEntry entry("BatchDistribution::BatchDistribution");
+#endif
+    if( teamSize < 1 )
+        throw std::logic_error("Team size must be positive");
+    commSize_ = mpi::CommSize( comm );
+    const int commRank = mpi::CommRank( comm );
+    teamSize_ = std::min( teamSize, commSize_ );
+    numTeams_ = (commSize_+teamSize_-1) / teamSize_;
+    team_ = commRank / teamSize_;
+
+    // Assign the members in order of decreasing cost to the team with the
+    // smallest load per process (this is deterministic, so every process
+    // forms the same assignment)
+    const int batchSize = sizes.size();
+    std::vector<std::pair<double,int> > costs( batchSize );
+    for( int k=0; k<batchSize; ++k )
+        costs[k] = std::make_pair( -batch::Cost(sizes[k],sizes[k]), k );
+    std::sort( costs.begin(), costs.end() );
+    typedef std::pair<double,int> Load;
+    std::priority_queue<Load,std::vector<Load>,std::greater<Load> > loads;
+    for( int team=0; team<numTeams_; ++team )
+        loads.push( Load(0,team) );
+    owners_.resize( batchSize );
+    for( int s=0; s<batchSize; ++s )
+    {
+        const int k = costs[s].second;
+        const Load load = loads.top();
+        loads.pop();
+        owners_[k] = load.second;
+        if( load.second == team_ )
+            localMembers_.push_back( k );
+        loads.push
+        ( Load(load.first-costs[s].first/TeamSize(load.second),load.second) );
+    }
+
+    mpi::Comm teamComm;
+    mpi::CommSplit( comm, team_, commRank, teamComm );
+    teamGrid_ = new Grid( teamComm );
+    mpi::CommFree( teamComm );
+}
+
+inline
+BatchDistribution::~BatchDistribution()
+{ delete teamGrid_; }
+
+inline int
+BatchDistribution::NumTeams() const
+{ return numTeams_; }
+
+inline int
+BatchDistribution::TeamSize( int team ) const
+{ return ( team < numTeams_-1 ? teamSize_ : commSize_-team*teamSize_ ); }
+
+inline int
+BatchDistribution::Team() const
+{ return team_; }
+
+inline int
+BatchDistribution::Owner( int k ) const
+{ return owners_[k]; }
+
+inline const std::vector<int>&
+BatchDistribution::LocalMembers() const
+{ return localMembers_; }
+
+inline const Grid&
+BatchDistribution::TeamGrid() const
+{ return *teamGrid_; }
+
+} // namespace elem
+
+#endif // ifndef CORE_BATCH_IMPL_HPP
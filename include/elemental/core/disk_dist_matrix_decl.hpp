@@ -0,0 +1,78 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_DISK_DIST_MATRIX_DECL_HPP
+#define CORE_DISK_DIST_MATRIX_DECL_HPP
+
+namespace elem {
+
+// An [MC,MR] matrix (with zero alignments) whose entries are stored within
+// a file rather than in memory. Each process owns a contiguous region of
+// the file which holds its local matrix in column-major order, so that the
+// local portion of any contiguous set of columns is itself contiguous.
+// Such panels of columns are (asynchronously) transferred to and from
+// in-core [MC,MR] matrices which view buffers provided by the caller.
+template<typename T>
+class DiskDistMatrix
+{
+public:
+    // Collectively create a height x width matrix within the given file,
+    // which is deleted upon destruction unless 'keep' is true
+    DiskDistMatrix
+    ( const std::string& filename, int height, int width,
+      const elem::Grid& g, bool keep=false );
+    ~DiskDistMatrix();
+
+    const std::string& Filename() const;
+    int Height() const;
+    int Width() const;
+    const elem::Grid& Grid() const;
+    int LocalHeight() const;
+    // The leading dimension of the in-core panels
+    int LDim() const;
+
+    // The number of entries needed to hold the local portion of any panel
+    // of the given width
+    std::size_t PanelSize( int width ) const;
+    // Make P a view of 'buffer' with the distribution of columns
+    // [j,j+width) of this matrix
+    void AttachPanel( int j, int width, T* buffer, DistMatrix<T>& P ) const;
+
+    // Begin reading columns [j,j+P.Width()) into (or writing them from) a
+    // panel formed by AttachPanel; the transfer is complete once Wait has
+    // been called on the requests
+    void StartRead
+    ( int j, DistMatrix<T>& P, std::vector<mpi::Request>& requests );
+    void StartWrite
+    ( int j, const DistMatrix<T>& P, std::vector<mpi::Request>& requests );
+    static void Wait( std::vector<mpi::Request>& requests );
+
+    // Copy the entire matrix to/from an in-core matrix (through a temporary
+    // copy with the in-core panel distribution)
+    void Read( DistMatrix<T>& A );
+    void Write( const DistMatrix<T>& A );
+
+private:
+    std::string filename_;
+    int height_, width_, localHeight_;
+    const elem::Grid* grid_;
+    mpi::File file_;
+    mpi::Offset offset_;
+
+    void StartTransfer
+    ( int j, const DistMatrix<T>& P, bool read,
+      std::vector<mpi::Request>& requests );
+
+    DiskDistMatrix( const DiskDistMatrix<T>& );
+    const DiskDistMatrix<T>& operator=( const DiskDistMatrix<T>& );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_DISK_DIST_MATRIX_DECL_HPP
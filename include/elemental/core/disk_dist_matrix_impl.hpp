@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_DISK_DIST_MATRIX_IMPL_HPP
+#define CORE_DISK_DIST_MATRIX_IMPL_HPP
+
+namespace elem {
+
+template<typename T>
+inline
+DiskDistMatrix<T>::DiskDistMatrix
+( const std::string& filename, int height, int width,
+  const elem::Grid& g, bool keep )
+: filename_(filename), height_(height), width_(width), grid_(&g),
+  file_(mpi::FILE_NULL), offset_(0)
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::DiskDistMatrix");
+#endif
+    if( height < 0 || width < 0 )
+        throw std::logic_error("Dimensions must be non-negative");
+    const int r = g.Height();
+    const int c = g.Width();
+    localHeight_ = Length( height, g.MCRank(), r );
+
+    // Each process's region follows those of the processes with smaller
+    // VC ranks
+    mpi::Offset totalSize = 0;
+    for( int q=0; q<r*c; ++q )
+    {
+        if( q == g.VCRank() )
+            offset_ = totalSize;
+        totalSize += mpi::Offset(Length(height,q%r,r))*
+                     mpi::Offset(Length(width,q/r,c))*sizeof(T);
+    }
+    mpi::FileOpen( g.Comm(), filename, !keep, file_ );
+    mpi::FileSetSize( file_, totalSize );
+}
+
+template<typename T>
+inline
+DiskDistMatrix<T>::~DiskDistMatrix()
+{
+    if( file_ != mpi::FILE_NULL && !mpi::Finalized() )
+        mpi::FileClose( file_ );
+}
+
+template<typename T>
+inline const std::string&
+DiskDistMatrix<T>::Filename() const
+{ return filename_; }
+
+template<typename T>
+inline int
+DiskDistMatrix<T>::Height() const
+{ return height_; }
+
+template<typename T>
+inline int
+DiskDistMatrix<T>::Width() const
+{ return width_; }
+
+template<typename T>
+inline const elem::Grid&
+DiskDistMatrix<T>::Grid() const
+{ return *grid_; }
+
+template<typename T>
+inline int
+DiskDistMatrix<T>::LocalHeight() const
+{ return localHeight_; }
+
+template<typename T>
+inline int
+DiskDistMatrix<T>::LDim() const
+{ return std::max( localHeight_, 1 ); }
+
+template<typename T>
+inline std::size_t
+DiskDistMatrix<T>::PanelSize( int width ) const
+{ return std::size_t(LDim())*std::max(MaxLength(width,grid_->Width()),1); }
+
+template<typename T>
+inline void
+DiskDistMatrix<T>::AttachPanel
+( int j, int width, T* buffer, DistMatrix<T>& P ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::AttachPanel");
+    if( j < 0 || width < 0 || j+width > width_ )
+        throw std::logic_error("Panel is out of bounds");
+#endif
+    P.Attach( height_, width, 0, j % grid_->Width(), buffer, LDim(), *grid_ );
+}
+
+template<typename T>
+inline void
+DiskDistMatrix<T>::StartTransfer
+( int j, const DistMatrix<T>& P, bool read,
+  std::vector<mpi::Request>& requests )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::StartTransfer");
+    if( P.Grid() != *grid_ )
+        throw std::logic_error("Grids must match");
+    if( P.Height() != height_ || j < 0 || j+P.Width() > width_ )
+        throw std::logic_error("Panel is out of bounds");
+    if( P.ColAlignment() != 0 || P.RowAlignment() != j % grid_->Width() ||
+        P.LDim() != LDim() )
+        throw std::logic_error("Panel must be formed with AttachPanel");
+#endif
+    const int localWidth = P.LocalWidth();
+    if( localHeight_ == 0 || localWidth == 0 )
+        return;
+
+    // The local columns of the panel are contiguous within our region of
+    // the file, but the transfers are split so that their sizes fit in an
+    // int
+    const int c = grid_->Width();
+    const int firstLocalCol = Length( j, grid_->MRRank(), c );
+    const std::size_t columnSize = std::size_t(localHeight_)*sizeof(T);
+    const int maxCols = std::max( int((1u<<30)/columnSize), 1 );
+    for( int jLoc=0; jLoc<localWidth; jLoc+=maxCols )
+    {
+        const int numCols = std::min( maxCols, localWidth-jLoc );
+        const mpi::Offset offset =
+            offset_ + mpi::Offset(firstLocalCol+jLoc)*columnSize;
+        const int numBytes = numCols*columnSize;
+        requests.push_back( mpi::REQUEST_NULL );
+        if( read )
+            mpi::FileIReadAt
+            ( file_, offset, const_cast<T*>(P.LockedBuffer(0,jLoc)), numBytes,
+              requests.back() );
+        else
+            mpi::FileIWriteAt
+            ( file_, offset, P.LockedBuffer(0,jLoc), numBytes,
+              requests.back() );
+    }
+}
+
+template<typename T>
+inline void
+DiskDistMatrix<T>::StartRead
+( int j, DistMatrix<T>& P, std::vector<mpi::Request>& requests )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::StartRead");
+    if( P.Locked() )
+        throw std::logic_error("Cannot read into a locked panel");
+#endif
+    StartTransfer( j, P, true, requests );
+}
+
+template<typename T>
+inline void
+DiskDistMatrix<T>::StartWrite
+( int j, const DistMatrix<T>& P, std::vector<mpi::Request>& requests )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::StartWrite");
+#endif
+    StartTransfer( j, P, false, requests );
+}
+
+template<typename T>
+inline void
+DiskDistMatrix<T>::Wait( std::vector<mpi::Request>& requests )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::Wait");
+#endif
+    if( !requests.empty() )
+        mpi::WaitAll( requests.size(), &requests[0] );
+    requests.clear();
+}
+
+template<typename T>
+inline void
+DiskDistMatrix<T>::Read( DistMatrix<T>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::Read");
+#endif
+    Memory<T> memory;
+    DistMatrix<T> B( *grid_ );
+    AttachPanel( 0, width_, memory.Require(PanelSize(width_)), B );
+    std::vector<mpi::Request> requests;
+    StartRead( 0, B, requests );
+    Wait( requests );
+    A = B;
+}
+
+template<typename T>
+inline void
+DiskDistMatrix<T>::Write( const DistMatrix<T>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiskDistMatrix::Write");
+    if( A.Height() != height_ || A.Width() != width_ )
+        throw std::logic_error("Matrices must be the same size");
+#endif
+    Memory<T> memory;
+    DistMatrix<T> B( *grid_ );
+    AttachPanel( 0, width_, memory.Require(PanelSize(width_)), B );
+    B = A;
+    std::vector<mpi::Request> requests;
+    StartWrite( 0, B, requests );
+    Wait( requests );
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_DISK_DIST_MATRIX_IMPL_HPP
@@ -37,6 +37,11 @@ void SetBlocksize( int blocksize );
 void PushBlocksizeStack( int blocksize );
 void PopBlocksizeStack();
 
+// Whether or not the processes of each node should share a single copy of 
+// the replicated matrices which support it (see SharedStarStar)
+bool NodeSharedReplicas();
+void SetNodeSharedReplicas( bool share );
+
 // Replacement for std::memcpy, which is known to often be suboptimal.
 // Notice the sizeof(T) is no longer required.
 template<typename T>
@@ -252,6 +257,21 @@ public:
     : std::runtime_error( msg ) { }
 };
 
+// The types of exceptions which can be recreated, with their original type,
+// on another thread or process; any other exception is recreated as a
+// std::runtime_error with the same message
+enum ExceptionKind
+{
+    NO_EXCEPTION=0,
+    LOGIC_ERROR,
+    RUNTIME_ERROR,
+    SINGULAR_MATRIX,
+    NON_HPD_MATRIX,
+    NON_HPSD_MATRIX
+};
+ExceptionKind ClassifyException( const std::exception& e );
+void ThrowException( ExceptionKind kind, const std::string& msg );
+
 #ifndef RELEASE
 void PushCallStack( std::string s );
 void PopCallStack();
@@ -42,6 +42,32 @@ inline void ReportException( const std::exception& e, std::ostream& os )
 #endif
 }
 
+inline ExceptionKind ClassifyException( const std::exception& e )
+{
+    if( dynamic_cast<const SingularMatrixException*>(&e) )
+        return SINGULAR_MATRIX;
+    if( dynamic_cast<const NonHPDMatrixException*>(&e) )
+        return NON_HPD_MATRIX;
+    if( dynamic_cast<const NonHPSDMatrixException*>(&e) )
+        return NON_HPSD_MATRIX;
+    if( dynamic_cast<const std::logic_error*>(&e) )
+        return LOGIC_ERROR;
+    return RUNTIME_ERROR;
+}
+
+inline void ThrowException( ExceptionKind kind, const std::string& msg )
+{
+    switch( kind )
+    {
+    case NO_EXCEPTION:    return;
+    case SINGULAR_MATRIX: throw SingularMatrixException( msg.c_str() );
+    case NON_HPD_MATRIX:  throw NonHPDMatrixException( msg.c_str() );
+    case NON_HPSD_MATRIX: throw NonHPSDMatrixException( msg.c_str() );
+    case LOGIC_ERROR:     throw std::logic_error( msg.c_str() );
+    default:              throw std::runtime_error( msg.c_str() );
+    }
+}
+
 inline void ComplainIfDebug()
 {
 #ifndef RELEASE
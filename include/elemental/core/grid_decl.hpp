@@ -18,6 +18,11 @@ class Grid
 public:
     Grid( mpi::Comm comm=mpi::COMM_WORLD );
     Grid( mpi::Comm comm, int height );
+    // Topology-aware construction: the processes are sorted by node and then
+    // laid out over the grid in the specified order, so that each process
+    // column (if order is COLUMN_MAJOR) or process row (if ROW_MAJOR) spans
+    // as few nodes as possible
+    Grid( mpi::Comm comm, int height, GridOrder order );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -62,6 +67,11 @@ public:
     int DiagPathRank( int vectorColRank ) const;
     int FirstVCRank( int diagPath ) const;
 
+    // Distributed random streams are drawn collectively by the processes of
+    // a grid, so they are numbered separately for each grid; the numbering
+    // restarts whenever 'epoch' changes (i.e., whenever the seed is reset)
+    unsigned NextRandomStreamId( unsigned epoch ) const;
+
     static int FindFactor( int p );
 
 private:
@@ -84,6 +94,9 @@ private:
     // in the group and that the result is MPI_UNDEFINED.
     bool inGrid_;
 
+    // Whether or not the grid created (and must free) the owning group
+    bool ownOwningGroup_;
+
     // Create a communicator for our (not-)owning team
     mpi::Comm owningComm_;
     int owningRank_;
@@ -93,6 +106,10 @@ private:
     mpi::Comm matrixColComm_, matrixRowComm_;
     mpi::Comm vectorColComm_, vectorRowComm_;
 
+    // The number of random streams drawn over the grid during the current
+    // epoch of the seed
+    mutable unsigned randomStreamCount_, randomStreamEpoch_;
+
     void SetUpGrid();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
@@ -108,6 +125,25 @@ bool operator!= ( const Grid& A, const Grid& B );
 // Return a grid constructed using mpi::COMM_WORLD.
 const Grid& DefaultGrid();
 
+// Choose the height of a (topology-aware) grid over 'comm', and the order in
+// which each node's processes are laid out over it, so as to minimize a
+// model of the per-process communication volume of an algorithm in which,
+// over an r x c grid, each MC communicator (process column) transfers
+// mcVolume/c entries and each MR communicator (process row) transfers
+// mrVolume/r entries. Communication within a node is modeled as costing
+// 'intraNodeCost' times as much as communication between nodes.
+void GridShape
+( mpi::Comm comm, double mcVolume, double mrVolume,
+  int& height, GridOrder& order, double intraNodeCost=0.25 );
+
+// The grid shape for C := A B, with A m x k and B k x n
+void GemmGridShape
+( mpi::Comm comm, int m, int n, int k, int& height, GridOrder& order );
+
+// The grid shape for the Cholesky factorization of an n x n matrix
+void CholeskyGridShape
+( mpi::Comm comm, int n, int& height, GridOrder& order );
+
 } // namespace elem
 
 #endif // ifndef CORE_GRID_DECL_HPP
@@ -29,6 +29,7 @@ Grid::Grid( mpi::Comm comm )
     CallStackEntry entry("Grid::Grid");
 #endif
     inGrid_ = true; // this is true by assumption for this constructor
+    ownOwningGroup_ = false;
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::CommDup( comm, viewingComm_ );
@@ -55,6 +56,7 @@ Grid::Grid( mpi::Comm comm, int height )
     CallStackEntry entry("Grid::Grid");
 #endif
     inGrid_ = true; // this is true by assumption for this constructor
+    ownOwningGroup_ = false;
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::CommDup( comm, viewingComm_ );
@@ -75,12 +77,66 @@ Grid::Grid( mpi::Comm comm, int height )
     SetUpGrid();
 }
 
+inline
+Grid::Grid( mpi::Comm comm, int height, GridOrder order )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Grid::Grid");
+#endif
+    inGrid_ = true; // this is true by assumption for this constructor
+    ownOwningGroup_ = true;
+
+    // Extract our rank, the underlying group, and the number of processes
+    mpi::CommDup( comm, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    viewingRank_ = mpi::CommRank( viewingComm_ );
+    size_ = mpi::CommSize( viewingComm_ );
+    notOwningGroup_ = mpi::GROUP_EMPTY;
+
+    height_ = height;
+    if( height_ <= 0 || size_ % height_ != 0 )
+        throw std::logic_error("Grid height must be a positive divisor of p");
+    width_ = size_ / height_;
+
+    // Label each process by the smallest rank on its node, and then sort
+    // the processes by (label,rank)
+    mpi::Comm nodeComm;
+    mpi::CommSplitNode( viewingComm_, nodeComm );
+    int nodeLabel = viewingRank_;
+    mpi::AllReduce( &nodeLabel, 1, mpi::MIN, nodeComm );
+    mpi::CommFree( nodeComm );
+    std::vector<int> nodeLabels( size_ );
+    mpi::AllGather( &nodeLabel, 1, &nodeLabels[0], 1, viewingComm_ );
+    std::vector<std::pair<int,int> > sortedRanks( size_ );
+    for( int q=0; q<size_; ++q )
+        sortedRanks[q] = std::make_pair( nodeLabels[q], q );
+    std::sort( sortedRanks.begin(), sortedRanks.end() );
+
+    // Lay the sorted processes out over the grid (the owning group is
+    // ordered by VC rank)
+    std::vector<int> ranks( size_ );
+    for( int j=0; j<width_; ++j )
+    {
+        for( int i=0; i<height_; ++i )
+        {
+            const int q = ( order==COLUMN_MAJOR ? i+j*height_ : j+i*width_ );
+            ranks[i+j*height_] = sortedRanks[q].second;
+        }
+    }
+    mpi::GroupIncl( viewingGroup_, size_, &ranks[0], owningGroup_ );
+    owningRank_ = mpi::GroupRank( owningGroup_ );
+
+    SetUpGrid();
+}
+
 inline void 
 Grid::SetUpGrid()
 {
 #ifndef RELEASE
     CallStackEntry entry("Grid::SetUpGrid");
 #endif
+    randomStreamCount_ = 0;
+    randomStreamEpoch_ = 0;
     if( size_ != height_*width_ )
     {
         std::ostringstream msg;
@@ -166,7 +222,6 @@ Grid::SetUpGrid()
         vectorColRank_ = mpi::UNDEFINED;
         vectorRowRank_ = mpi::UNDEFINED;
     }
-    mpi::Broadcast( &diagPathsAndRanks_[0], 2*size_, 0, viewingComm_ );
 
     // Set up the map from the VC group to the viewingGroup_ ranks.
     // Since the VC communicator preserves the ordering of the owningGroup_
@@ -178,6 +233,12 @@ Grid::SetUpGrid()
     mpi::GroupTranslateRanks
     ( owningGroup_, size_, &ranks[0], viewingGroup_, 
       &vectorColToViewingMap_[0] );
+
+    // Broadcast from the first member of the grid, as the root of the 
+    // viewing communicator need not own any of the grid
+    mpi::Broadcast
+    ( &diagPathsAndRanks_[0], 2*size_, vectorColToViewingMap_[0], 
+      viewingComm_ );
 }
 
 inline 
@@ -197,6 +258,8 @@ Grid::~Grid()
         mpi::CommFree( owningComm_ );
         if( notOwningGroup_ != mpi::GROUP_EMPTY )
             mpi::GroupFree( notOwningGroup_ );
+        if( ownOwningGroup_ )
+            mpi::GroupFree( owningGroup_ );
 
         mpi::CommFree( viewingComm_ );
         mpi::GroupFree( viewingGroup_ );
@@ -303,6 +366,8 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height )
     CallStackEntry entry("Grid::Grid");
 #endif
 
+    ownOwningGroup_ = false;
+
     // Extract our rank and the underlying group from the viewing comm
     mpi::CommDup( viewers, viewingComm_ );
     mpi::CommGroup( viewingComm_, viewingGroup_ );
@@ -402,6 +467,17 @@ inline int
 Grid::FirstVCRank( int diagPath ) const
 { return diagPath*height_; }
 
+inline unsigned
+Grid::NextRandomStreamId( unsigned epoch ) const
+{
+    if( epoch != randomStreamEpoch_ )
+    {
+        randomStreamEpoch_ = epoch;
+        randomStreamCount_ = 0;
+    }
+    return randomStreamCount_++;
+}
+
 //
 // Comparison functions
 //
@@ -414,6 +490,79 @@ inline bool
 operator!=( const Grid& A, const Grid& B )
 { return &A != &B; }
 
+//
+// Choosing topology-aware grid shapes
+//
+
+inline void
+GridShape
+( mpi::Comm comm, double mcVolume, double mrVolume,
+  int& height, GridOrder& order, double intraNodeCost )
+{
+#ifndef RELEASE
+    CallStackEntry entry("GridShape");
+#endif
+    const int p = mpi::CommSize( comm );
+    mpi::Comm nodeComm;
+    mpi::CommSplitNode( comm, nodeComm );
+    int nodeSize = mpi::CommSize( nodeComm );
+    mpi::CommFree( nodeComm );
+    mpi::AllReduce( &nodeSize, 1, mpi::MAX, comm );
+
+    // A process column (row) is contained within a node when it is laid out
+    // in column-major (row-major) order and its size divides the node size,
+    // whereas the transverse communicators only avoid leaving a node if the
+    // entire grid fits within one
+    double minCost = -1;
+    for( int r=1; r<=p; ++r )
+    {
+        if( p % r != 0 )
+            continue;
+        const int c = p / r;
+        for( int k=0; k<2; ++k )
+        {
+            const GridOrder thisOrder = ( k==0 ? COLUMN_MAJOR : ROW_MAJOR );
+            bool mcIntraNode = ( p <= nodeSize ), mrIntraNode = mcIntraNode;
+            if( thisOrder == COLUMN_MAJOR && nodeSize % r == 0 )
+                mcIntraNode = true;
+            if( thisOrder == ROW_MAJOR && nodeSize % c == 0 )
+                mrIntraNode = true;
+            const double cost = 
+                ( mcIntraNode ? intraNodeCost : 1 )*mcVolume/c +
+                ( mrIntraNode ? intraNodeCost : 1 )*mrVolume/r;
+            if( minCost < 0 || cost < minCost )
+            {
+                minCost = cost;
+                height = r;
+                order = thisOrder;
+            }
+        }
+    }
+}
+
+inline void
+GemmGridShape
+( mpi::Comm comm, int m, int n, int k, int& height, GridOrder& order )
+{
+#ifndef RELEASE
+    CallStackEntry entry("GemmGridShape");
+#endif
+    // Each panel of B is gathered within the process columns and each panel
+    // of A within the process rows
+    GridShape( comm, double(k)*double(n), double(m)*double(k), height, order );
+}
+
+inline void
+CholeskyGridShape( mpi::Comm comm, int n, int& height, GridOrder& order )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyGridShape");
+#endif
+    // Each panel is gathered both within the process rows and columns
+    const double volume = double(n)*double(n)/2;
+    GridShape( comm, volume, volume, height, order );
+}
+
 } // namespace elem
 
 #endif // ifndef CORE_GRID_IMPL_HPP
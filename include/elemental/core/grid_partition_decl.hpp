@@ -0,0 +1,64 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_GRID_PARTITION_DECL_HPP
+#define CORE_GRID_PARTITION_DECL_HPP
+
+namespace elem {
+
+// Splits the processes of a grid into 'numParts' subgrids, each formed from
+// a contiguous range of (nearly equally many) VC ranks. Every subgrid is
+// viewed by the viewing communicator of the parent grid, so that matrices
+// may be redistributed between the parent and its subgrids (or between
+// subgrids), and each subgrid may then work independently of the others.
+class GridPartition
+{
+public:
+    GridPartition( const Grid& grid, int numParts );
+    ~GridPartition();
+
+    const Grid& Parent() const;
+    int NumParts() const;
+    // The part containing this process (or mpi::UNDEFINED)
+    int Part() const;
+    int PartSize( int part ) const;
+    // The VC rank (within the parent grid) of the first process of a part
+    int PartOffset( int part ) const;
+    const Grid& SubGrid( int part ) const;
+
+private:
+    const Grid* parent_;
+    int part_;
+    std::vector<int> partOffsets_;
+    std::vector<mpi::Group> groups_;
+    std::vector<Grid*> subGrids_;
+
+    GridPartition( const GridPartition& );
+    const GridPartition& operator=( const GridPartition& );
+};
+
+// Redistribute A into B, where the two matrices may be distributed over
+// different grids (as long as their viewing communicators are congruent).
+// Each process exchanges a single message with each of the processes it
+// shares data with, and the routine must be called by every process which
+// participates in either grid.
+template<typename T,typename Int>
+void InterGridCopy
+( const DistMatrix<T,MC,MR,Int>& A, DistMatrix<T,MC,MR,Int>& B );
+
+// Redistribute each A[k] into B[k] simultaneously, so that, for instance,
+// the copies between a parent grid and each of its subgrids overlap
+template<typename T,typename Int>
+void InterGridCopy
+( const std::vector<const DistMatrix<T,MC,MR,Int>*>& A,
+  const std::vector<DistMatrix<T,MC,MR,Int>*>& B );
+
+} // namespace elem
+
+#endif // ifndef CORE_GRID_PARTITION_DECL_HPP
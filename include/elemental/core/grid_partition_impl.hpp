@@ -0,0 +1,305 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_GRID_PARTITION_IMPL_HPP
+#define CORE_GRID_PARTITION_IMPL_HPP
+
+namespace elem {
+
+//
+// GridPartition
+//
+
+inline
+GridPartition::GridPartition( const Grid& grid, int numParts )
+: parent_(&grid), part_(mpi::UNDEFINED)
+{
+#ifndef RELEASE
+    CallStackEntry entry("GridPartition::GridPartition");
+#endif
+    const int p = grid.Size();
+    if( numParts < 1 || numParts > p )
+        throw std::logic_error
+        ("Number of parts must be between one and the size of the grid");
+
+    // The first p % numParts parts have one extra process
+    partOffsets_.resize( numParts+1 );
+    partOffsets_[0] = 0;
+    for( int part=0; part<numParts; ++part )
+        partOffsets_[part+1] = partOffsets_[part] + p/numParts +
+                               ( part < p % numParts ? 1 : 0 );
+    if( grid.InGrid() )
+    {
+        const int rank = grid.VCRank();
+        for( int part=0; part<numParts; ++part )
+            if( rank >= partOffsets_[part] && rank < partOffsets_[part+1] )
+                part_ = part;
+    }
+
+    // Every subgrid is (collectively) formed over the parent's viewers
+    mpi::Group viewingGroup;
+    mpi::CommGroup( grid.ViewingComm(), viewingGroup );
+    groups_.resize( numParts );
+    subGrids_.resize( numParts );
+    for( int part=0; part<numParts; ++part )
+    {
+        const int partSize = PartSize( part );
+        std::vector<int> ranks( partSize );
+        for( int q=0; q<partSize; ++q )
+            ranks[q] = grid.VCToViewingMap( partOffsets_[part]+q );
+        mpi::GroupIncl( viewingGroup, partSize, &ranks[0], groups_[part] );
+        subGrids_[part] = 
+            new Grid
+            ( grid.ViewingComm(), groups_[part], Grid::FindFactor(partSize) );
+    }
+    mpi::GroupFree( viewingGroup );
+}
+
+inline
+GridPartition::~GridPartition()
+{
+    const int numParts = subGrids_.size();
+    for( int part=0; part<numParts; ++part )
+    {
+        delete subGrids_[part];
+        if( !mpi::Finalized() )
+            mpi::GroupFree( groups_[part] );
+    }
+}
+
+inline const Grid&
+GridPartition::Parent() const
+{ return *parent_; }
+
+inline int
+GridPartition::NumParts() const
+{ return subGrids_.size(); }
+
+inline int
+GridPartition::Part() const
+{ return part_; }
+
+inline int
+GridPartition::PartSize( int part ) const
+{ return partOffsets_[part+1] - partOffsets_[part]; }
+
+inline int
+GridPartition::PartOffset( int part ) const
+{ return partOffsets_[part]; }
+
+inline const Grid&
+GridPartition::SubGrid( int part ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("GridPartition::SubGrid");
+    if( part < 0 || part >= NumParts() )
+        throw std::logic_error("Invalid part");
+#endif
+    return *subGrids_[part];
+}
+
+//
+// Redistribution between grids
+//
+
+namespace internal {
+
+// For each of the local indices of a matrix dimension distributed with the
+// given shift and stride, compute the owner within a distribution with a
+// different alignment and stride, as well as the number of indices which
+// each of the latter owns
+inline void
+InterGridOwners
+( int localLength, int shift, int stride, int otherAlignment, int otherStride,
+  std::vector<int>& owners, std::vector<int>& counts )
+{
+    owners.resize( localLength );
+    counts.assign( otherStride, 0 );
+    for( int iLoc=0; iLoc<localLength; ++iLoc )
+    {
+        const int i = shift + iLoc*stride;
+        owners[iLoc] = (i+otherAlignment) % otherStride;
+        ++counts[owners[iLoc]];
+    }
+}
+
+} // namespace internal
+
+template<typename T,typename Int>
+inline void
+InterGridCopy
+( const DistMatrix<T,MC,MR,Int>& A, DistMatrix<T,MC,MR,Int>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("InterGridCopy");
+#endif
+    std::vector<const DistMatrix<T,MC,MR,Int>*> AList( 1, &A );
+    std::vector<DistMatrix<T,MC,MR,Int>*> BList( 1, &B );
+    InterGridCopy( AList, BList );
+}
+
+template<typename T,typename Int>
+inline void
+InterGridCopy
+( const std::vector<const DistMatrix<T,MC,MR,Int>*>& A,
+  const std::vector<DistMatrix<T,MC,MR,Int>*>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("InterGridCopy");
+#endif
+    if( A.size() != B.size() )
+        throw std::logic_error("Must have the same number of sources/targets");
+    const int numCopies = A.size();
+    for( int k=0; k<numCopies; ++k )
+    {
+        const DistMatrix<T,MC,MR,Int>& Ak = *A[k];
+        DistMatrix<T,MC,MR,Int>& Bk = *B[k];
+        if( !mpi::CongruentComms
+            ( Ak.Grid().ViewingComm(), Bk.Grid().ViewingComm() ) )
+            throw std::logic_error
+            ("Redistributing between grids requires congruent viewing "
+             "communicators");
+        if( Bk.Viewing() )
+        {
+            if( Bk.Height() != Ak.Height() || Bk.Width() != Ak.Width() )
+                throw std::logic_error("Cannot resize a view");
+        }
+        else
+            Bk.ResizeTo( Ak.Height(), Ak.Width() );
+    }
+
+    // Pack the data for each of the targets and post all of the receives
+    // and sends at once. Since the messages for different copies between 
+    // the same pair of processes are sent and received in the same order, 
+    // they cannot be confused.
+    std::vector<std::vector<T> > sendBufs( numCopies ), recvBufs( numCopies );
+    std::vector<std::vector<int> > recvOffsets( numCopies );
+    std::vector<mpi::Request> requests;
+    std::vector<int> rowOwners, colOwners, rowCounts, colCounts;
+    for( int k=0; k<numCopies; ++k )
+    {
+        const DistMatrix<T,MC,MR,Int>& Ak = *A[k];
+        DistMatrix<T,MC,MR,Int>& Bk = *B[k];
+        const Grid& gA = Ak.Grid();
+        const Grid& gB = Bk.Grid();
+        const int heightA = gA.Height();
+        const int heightB = gB.Height();
+        mpi::Comm comm = gB.ViewingComm();
+        if( Bk.Participating() )
+        {
+            const int localHeight = Bk.LocalHeight();
+            const int localWidth = Bk.LocalWidth();
+            internal::InterGridOwners
+            ( localHeight, Bk.ColShift(), Bk.ColStride(), 
+              Ak.ColAlignment(), Ak.ColStride(), rowOwners, rowCounts );
+            internal::InterGridOwners
+            ( localWidth, Bk.RowShift(), Bk.RowStride(),
+              Ak.RowAlignment(), Ak.RowStride(), colOwners, colCounts );
+            const int numSources = gA.Size();
+            recvOffsets[k].resize( numSources );
+            recvBufs[k].resize( localHeight*localWidth );
+            int offset = 0;
+            for( int q=0; q<numSources; ++q )
+            {
+                recvOffsets[k][q] = offset;
+                const int count = 
+                    rowCounts[q % heightA]*colCounts[q / heightA];
+                if( count != 0 )
+                {
+                    requests.push_back( mpi::Request() );
+                    mpi::IRecv
+                    ( &recvBufs[k][offset], count, gA.VCToViewingMap(q), 0,
+                      comm, requests.back() );
+                }
+                offset += count;
+            }
+        }
+        if( Ak.Participating() )
+        {
+            const int localHeight = Ak.LocalHeight();
+            const int localWidth = Ak.LocalWidth();
+            internal::InterGridOwners
+            ( localHeight, Ak.ColShift(), Ak.ColStride(), 
+              Bk.ColAlignment(), Bk.ColStride(), rowOwners, rowCounts );
+            internal::InterGridOwners
+            ( localWidth, Ak.RowShift(), Ak.RowStride(),
+              Bk.RowAlignment(), Bk.RowStride(), colOwners, colCounts );
+            const int numTargets = gB.Size();
+            std::vector<int> offsets( numTargets );
+            int offset = 0;
+            for( int q=0; q<numTargets; ++q )
+            {
+                offsets[q] = offset;
+                offset += rowCounts[q % heightB]*colCounts[q / heightB];
+            }
+            sendBufs[k].resize( localHeight*localWidth );
+            std::vector<int> packOffsets = offsets;
+            const T* ABuffer = Ak.LockedBuffer();
+            const int ALDim = Ak.LDim();
+            T* sendBuf = ( localHeight*localWidth != 0 ? &sendBufs[k][0] : 0 );
+            for( int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                const int colOffset = colOwners[jLoc]*heightB;
+                for( int iLoc=0; iLoc<localHeight; ++iLoc )
+                {
+                    const int q = rowOwners[iLoc] + colOffset;
+                    sendBuf[packOffsets[q]++] = ABuffer[iLoc+jLoc*ALDim];
+                }
+            }
+            for( int q=0; q<numTargets; ++q )
+            {
+                const int count = 
+                    rowCounts[q % heightB]*colCounts[q / heightB];
+                if( count != 0 )
+                {
+                    requests.push_back( mpi::Request() );
+                    mpi::ISend
+                    ( &sendBuf[offsets[q]], count, gB.VCToViewingMap(q), 0,
+                      comm, requests.back() );
+                }
+            }
+        }
+    }
+    if( !requests.empty() )
+        mpi::WaitAll( requests.size(), &requests[0] );
+
+    // Unpack the received data in the same order in which it was packed
+    for( int k=0; k<numCopies; ++k )
+    {
+        const DistMatrix<T,MC,MR,Int>& Ak = *A[k];
+        DistMatrix<T,MC,MR,Int>& Bk = *B[k];
+        if( !Bk.Participating() )
+            continue;
+        const int heightA = Ak.Grid().Height();
+        const int localHeight = Bk.LocalHeight();
+        const int localWidth = Bk.LocalWidth();
+        internal::InterGridOwners
+        ( localHeight, Bk.ColShift(), Bk.ColStride(), 
+          Ak.ColAlignment(), Ak.ColStride(), rowOwners, rowCounts );
+        internal::InterGridOwners
+        ( localWidth, Bk.RowShift(), Bk.RowStride(),
+          Ak.RowAlignment(), Ak.RowStride(), colOwners, colCounts );
+        std::vector<int>& offsets = recvOffsets[k];
+        T* BBuffer = Bk.Buffer();
+        const int BLDim = Bk.LDim();
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int colOffset = colOwners[jLoc]*heightA;
+            for( int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int q = rowOwners[iLoc] + colOffset;
+                BBuffer[iLoc+jLoc*BLDim] = recvBufs[k][offsets[q]++];
+            }
+        }
+    }
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_GRID_PARTITION_IMPL_HPP
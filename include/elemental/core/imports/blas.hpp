@@ -347,6 +347,26 @@ void Gemm
   T alpha, const T* A, int lda, const T* B, int ldb,
   T beta,        T* C, int ldc );
 
+#ifdef HAVE_GEMMT
+// Only the 'uplo' triangle of the n x n matrix C is updated
+void Gemmt
+( char uplo, char transA, char transB, int n, int k,
+  float alpha, const float* A, int lda, const float* B, int ldb,
+  float beta,        float* C, int ldc );
+void Gemmt
+( char uplo, char transA, char transB, int n, int k,
+  double alpha, const double* A, int lda, const double* B, int ldb,
+  double beta,        double* C, int ldc );
+void Gemmt
+( char uplo, char transA, char transB, int n, int k,
+  scomplex alpha, const scomplex* A, int lda, const scomplex* B, int ldb,
+  scomplex beta,        scomplex* C, int ldc );
+void Gemmt
+( char uplo, char transA, char transB, int n, int k,
+  dcomplex alpha, const dcomplex* A, int lda, const dcomplex* B, int ldb,
+  dcomplex beta,        dcomplex* C, int ldc );
+#endif // ifdef HAVE_GEMMT
+
 void Hemm
 ( char side, char uplo, int m, int n,
   float alpha, const float* A, int lda, const float* B, int ldb,
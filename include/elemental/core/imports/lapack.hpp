@@ -168,6 +168,26 @@ void HessenbergEig( int n, double* H, int ldh, dcomplex* w );
 void HessenbergEig( int n, scomplex* H, int ldh, scomplex* w );
 void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w );
 
+//
+// Compute the Schur decomposition of an upper Hessenberg matrix, 
+// H = Q T Q^H, where T is (quasi-)triangular. If 'multiplyQ' is true, then
+// the Schur vectors are right-multiplied into the input Q, otherwise Q is
+// overwritten with them.
+//
+
+void HessenbergSchur
+( int n, float* H, int ldh, scomplex* w, float* Q, int ldq, 
+  bool fullTriangle=true, bool multiplyQ=false );
+void HessenbergSchur
+( int n, double* H, int ldh, dcomplex* w, double* Q, int ldq, 
+  bool fullTriangle=true, bool multiplyQ=false );
+void HessenbergSchur
+( int n, scomplex* H, int ldh, scomplex* w, scomplex* Q, int ldq, 
+  bool fullTriangle=true, bool multiplyQ=false );
+void HessenbergSchur
+( int n, dcomplex* H, int ldh, dcomplex* w, dcomplex* Q, int ldq, 
+  bool fullTriangle=true, bool multiplyQ=false );
+
 //
 // Compute the eigenpairs of a Hermitian matrix
 //
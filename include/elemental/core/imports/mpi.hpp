@@ -17,6 +17,7 @@ namespace mpi {
 #if defined(HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define HAVE_NONBLOCKING 1
+#define HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define HAVE_NONBLOCKING 0
 #endif
@@ -40,11 +41,14 @@ struct ValueInt
 typedef MPI_Comm Comm;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
+typedef MPI_File File;
 typedef MPI_Group Group;
+typedef MPI_Offset Offset;
 typedef MPI_Op Op;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
+typedef MPI_Win Window;
 
 // Standard constants
 const int ANY_SOURCE = MPI_ANY_SOURCE;
@@ -65,8 +69,10 @@ const Comm COMM_SELF = MPI_COMM_SELF;
 const Comm COMM_WORLD = MPI_COMM_WORLD;
 const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
+const File FILE_NULL = MPI_FILE_NULL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
 const Request REQUEST_NULL = MPI_REQUEST_NULL;
+const Window WINDOW_NULL = MPI_WIN_NULL;
 const Op MAX = MPI_MAX;
 const Op MIN = MPI_MIN;
 const Op MAXLOC = MPI_MAXLOC;
@@ -106,6 +112,8 @@ int CommSize( Comm comm );
 void CommCreate( Comm parentComm, Group subsetGroup, Comm& subsetComm );
 void CommDup( Comm original, Comm& duplicate );
 void CommSplit( Comm comm, int color, int key, Comm& newComm );
+// Split a communicator into the sets of processes which share a node
+void CommSplitNode( Comm comm, Comm& nodeComm );
 void CommFree( Comm& comm );
 bool CongruentComms( Comm comm1, Comm comm2 );
 void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler );
@@ -190,6 +198,59 @@ template<typename R>
 void SendRecv
 ( Complex<R>* buf, int count, int to, int stag, int from, int rtag, Comm comm );
 
+// One-sided communication (only passive-target synchronization is exposed)
+void WindowCreate
+( void* baseAddress, std::size_t numBytes, int dispUnit, Comm comm, 
+  Window& window );
+void WindowFree( Window& window );
+void WindowLock( int rank, Window& window );
+void WindowUnlock( int rank, Window& window );
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+// Collectively allocate memory which may be directly accessed by every 
+// process of 'comm' (which must share a node); WindowSharedQuery returns the
+// address at which the memory of the given process may be accessed
+void WindowAllocateShared
+( std::size_t numBytes, Comm comm, Window& window );
+void* WindowSharedQuery( int rank, Window& window );
+void WindowLockAll( Window& window );
+void WindowUnlockAll( Window& window );
+void WindowSync( Window& window );
+#endif
+
+// Combine the contiguous origin buffer into the blocks of the target's 
+// window starting at the given entry displacements
+template<typename R>
+void Accumulate
+( const R* buf, int numBlocks, const int* blockLengths, const int* displs,
+  Op op, int rank, Window& window );
+template<typename R>
+void Accumulate
+( const Complex<R>* buf, int numBlocks, const int* blockLengths, 
+  const int* displs, Op op, int rank, Window& window );
+
+// Fetch a height x width column-major submatrix with leading dimension ldim 
+// which begins at entry 'displ' of the target's window
+template<typename R>
+void Get
+( R* buf, int height, int width, int ldim, int displ, 
+  int rank, Window& window );
+template<typename R>
+void Get
+( Complex<R>* buf, int height, int width, int ldim, int displ, 
+  int rank, Window& window );
+
+// File I/O (each process independently accesses byte offsets of a file
+// which was collectively opened)
+void FileOpen
+( Comm comm, const std::string& filename, bool deleteOnClose, File& file );
+void FileClose( File& file );
+void FileSetSize( File& file, Offset numBytes );
+void FileIReadAt
+( File& file, Offset offset, void* buf, int numBytes, Request& request );
+void FileIWriteAt
+( File& file, Offset offset, const void* buf, int numBytes,
+  Request& request );
+
 // Collective communication
 
 template<typename R>
@@ -313,6 +374,16 @@ void AllReduce( T* buf, int count, Op op, Comm comm );
 template<typename R>
 void AllReduce( Complex<R>* buf, int count, Op op, Comm comm );
 
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm, Request& request );
+template<typename R>
+void IAllReduce
+( const Complex<R>* sbuf, Complex<R>* rbuf, int count, Op op, Comm comm,
+  Request& request );
+#endif
+
 template<typename R>
 void ReduceScatter
 ( R* sbuf, R* rbuf, int rc, Op op, Comm comm );
@@ -2,8 +2,8 @@
    Copyright (c) 2009-2013, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #pragma once
@@ -14,9 +14,61 @@ namespace elem {
 
 const double Pi = 3.141592653589793;
 
-// Generate a sample from a uniform PDF over the (closed) unit ball about the 
+// Counter-based random number generation: the Philox-4x32-10 bijection of
+// Salmon et al., "Parallel random numbers: as easy as 1, 2, 3". Each sample
+// is a pure function of a (key,counter) pair, so there is no hidden state to
+// protect between threads, and an entry of a random distributed matrix only
+// depends upon its global indices, not upon which process generated it.
+namespace philox {
+
+// Overwrite the 128-bit counter with its image under the keyed bijection
+void Bijection( unsigned counter[4], const unsigned key[2] );
+
+} // namespace philox
+
+// The seed is shared by every process (it is broadcast from the root of
+// mpi::COMM_WORLD during Initialize) and may be reset at any time.
+unsigned RandomSeed();
+void SetRandomSeed( unsigned seed );
+
+// Entry (i,j) of a random stream is drawn from the counter (i,j,id,index)
+// under the key (seed,owner), where 'owner' is zero for distributed streams
+// and one plus the rank in mpi::COMM_WORLD for local streams. New streams
+// have an index of zero; a stream may be split into independent streams by
+// assigning distinct indices (e.g., one per member of a batch).
+struct RandomStream
+{
+    unsigned id, index, owner, seed;
+};
+
+// Each random matrix draws from a fresh stream. A distributed stream must be
+// requested by every process of the grid it is drawn over, in the same order,
+// so that the result does not depend upon the shape of the grid. Since the
+// streams are numbered separately for each grid, draws over other grids
+// (e.g., the subgrids of a GridPartition) do not affect them, but, for the
+// same reason, the streams of different grids are not independent. Local
+// streams are independent between processes.
+RandomStream NewDistRandomStream( const Grid& g );
+RandomStream NewLocalRandomStream();
+
+// Generate a sample from a uniform PDF over [0,1) using a stream which is
+// local to this process
+double Uniform();
+
+// Generate a pair of independent samples from a uniform PDF over [0,1)
+void SampleUniformPair
+( const RandomStream& stream, int i, int j, double& u0, double& u1 );
+
+// Generate a sample from a uniform PDF over the (closed) unit ball about the
 // origin of the ring implied by the type T using the most natural metric.
 template<typename T> T SampleUnitBall();
+template<typename T>
+T SampleUnitBall( const RandomStream& stream, int i, int j );
+
+// Generate a sample from a normal PDF with mean zero and unit variance
+// (the real and imaginary parts of a complex sample each have variance 1/2)
+template<typename T>
+T SampleNormal( const RandomStream& stream, int i, int j );
 
 } // namespace elem
 
@@ -2,8 +2,8 @@
    Copyright (c) 2009-2013, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #pragma once
@@ -12,13 +12,60 @@
 
 namespace elem {
 
-inline double Uniform()
+namespace philox {
+
+// The high and low halves of the 64-bit product of two 32-bit words, formed
+// from 16-bit pieces so that no 64-bit integer type is required
+inline void
+MulHiLo( unsigned a, unsigned b, unsigned& hi, unsigned& lo )
+{
+    const unsigned aLo = a & 0xffffu, aHi = (a >> 16) & 0xffffu;
+    const unsigned bLo = b & 0xffffu, bHi = (b >> 16) & 0xffffu;
+    const unsigned p0 = aLo*bLo;
+    const unsigned p1 = aLo*bHi;
+    const unsigned p2 = aHi*bLo;
+    const unsigned p3 = aHi*bHi;
+    const unsigned mid = (p0 >> 16) + (p1 & 0xffffu) + (p2 & 0xffffu);
+    lo = ((p0 & 0xffffu) | (mid << 16)) & 0xffffffffu;
+    hi = (p3 + (p1 >> 16) + (p2 >> 16) + (mid >> 16)) & 0xffffffffu;
+}
+
+inline void
+Bijection( unsigned counter[4], const unsigned key[2] )
+{
+    const unsigned M0=0xD2511F53u, M1=0xCD9E8D57u,
+                   W0=0x9E3779B9u, W1=0xBB67AE85u;
+    unsigned k0=key[0], k1=key[1];
+    for( int round=0; round<10; ++round )
+    {
+        unsigned hi0, lo0, hi1, lo1;
+        MulHiLo( M0, counter[0], hi0, lo0 );
+        MulHiLo( M1, counter[2], hi1, lo1 );
+        counter[0] = hi1 ^ counter[1] ^ k0;
+        counter[1] = lo1;
+        counter[2] = hi0 ^ counter[3] ^ k1;
+        counter[3] = lo0;
+        k0 = (k0 + W0) & 0xffffffffu;
+        k1 = (k1 + W1) & 0xffffffffu;
+    }
+}
+
+// Map two 32-bit words to a double in [0,1) with 53 random bits
+inline double
+ToUniform( unsigned a, unsigned b )
+{ return ((a>>5)*67108864.+(b>>6))*(1./9007199254740992.); }
+
+} // namespace philox
+
+inline void
+SampleUniformPair
+( const RandomStream& stream, int i, int j, double& u0, double& u1 )
 {
-#ifdef WIN32    
-    return rand()/RAND_MAX;
-#else
-    return drand48();
-#endif
+    unsigned counter[4] = { unsigned(i), unsigned(j), stream.id, stream.index };
+    const unsigned key[2] = { stream.seed, stream.owner };
+    philox::Bijection( counter, key );
+    u0 = philox::ToUniform( counter[0], counter[1] );
+    u1 = philox::ToUniform( counter[2], counter[3] );
 }
 
 template<>
@@ -67,6 +114,113 @@ SampleUnitBall<Complex<double> >()
     return Complex<double>(r*cos(angle),r*sin(angle));
 }
 
+template<>
+inline int
+SampleUnitBall<int>( const RandomStream& stream, int i, int j )
+{
+    double u, uUnused;
+    SampleUniformPair( stream, i, j, u, uUnused );
+    if( u <= 1./3. )
+        return -1;
+    else if( u <= 2./3. )
+        return 0;
+    else
+        return +1;
+}
+
+template<>
+inline Complex<int>
+SampleUnitBall<Complex<int> >( const RandomStream& stream, int i, int j )
+{
+    double u0, u1;
+    SampleUniformPair( stream, i, j, u0, u1 );
+    const int real = ( u0 <= 1./3. ? -1 : ( u0 <= 2./3. ? 0 : +1 ) );
+    const int imag = ( u1 <= 1./3. ? -1 : ( u1 <= 2./3. ? 0 : +1 ) );
+    return Complex<int>( real, imag );
+}
+
+template<>
+inline float
+SampleUnitBall<float>( const RandomStream& stream, int i, int j )
+{
+    double u, uUnused;
+    SampleUniformPair( stream, i, j, u, uUnused );
+    return 2*float(u)-1.0f;
+}
+
+template<>
+inline double
+SampleUnitBall<double>( const RandomStream& stream, int i, int j )
+{
+    double u, uUnused;
+    SampleUniformPair( stream, i, j, u, uUnused );
+    return 2*u-1.0;
+}
+
+template<>
+inline Complex<float>
+SampleUnitBall<Complex<float> >( const RandomStream& stream, int i, int j )
+{
+    double u0, u1;
+    SampleUniformPair( stream, i, j, u0, u1 );
+    const float r = u0;
+    const float angle = 2*Pi*u1;
+    return Complex<float>(r*cos(angle),r*sin(angle));
+}
+
+template<>
+inline Complex<double>
+SampleUnitBall<Complex<double> >( const RandomStream& stream, int i, int j )
+{
+    double u0, u1;
+    SampleUniformPair( stream, i, j, u0, u1 );
+    const double r = u0;
+    const double angle = 2*Pi*u1;
+    return Complex<double>(r*cos(angle),r*sin(angle));
+}
+
+// Use the Box-Muller transform on a pair of uniform samples; the first
+// sample is shifted to (0,1] so that its logarithm is finite
+template<>
+inline float
+SampleNormal<float>( const RandomStream& stream, int i, int j )
+{
+    double u0, u1;
+    SampleUniformPair( stream, i, j, u0, u1 );
+    return float(Sqrt(-2*Log(1-u0))*cos(2*Pi*u1));
+}
+
+template<>
+inline double
+SampleNormal<double>( const RandomStream& stream, int i, int j )
+{
+    double u0, u1;
+    SampleUniformPair( stream, i, j, u0, u1 );
+    return Sqrt(-2*Log(1-u0))*cos(2*Pi*u1);
+}
+
+template<>
+inline Complex<float>
+SampleNormal<Complex<float> >( const RandomStream& stream, int i, int j )
+{
+    double u0, u1;
+    SampleUniformPair( stream, i, j, u0, u1 );
+    const double r = Sqrt(-Log(1-u0));
+    const double angle = 2*Pi*u1;
+    return Complex<float>(r*cos(angle),r*sin(angle));
+}
+
+template<>
+inline Complex<double>
+SampleNormal<Complex<double> >( const RandomStream& stream, int i, int j )
+{
+    double u0, u1;
+    SampleUniformPair( stream, i, j, u0, u1 );
+    const double r = Sqrt(-Log(1-u0));
+    const double angle = 2*Pi*u1;
+    return Complex<double>(r*cos(angle),r*sin(angle));
+}
+
 } // namespace elem
 
 #endif // ifndef CORE_RANDOM_IMPL_HPP
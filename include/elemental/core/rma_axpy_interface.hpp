@@ -0,0 +1,16 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_RMAAXPYINTERFACE_HPP
+#define CORE_RMAAXPYINTERFACE_HPP
+
+#include "elemental/core/rma_axpy_interface_decl.hpp"
+#include "elemental/core/rma_axpy_interface_impl.hpp"
+
+#endif // ifndef CORE_RMAAXPYINTERFACE_HPP
@@ -0,0 +1,74 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_RMAAXPYINTERFACE_DECL_HPP
+#define CORE_RMAAXPYINTERFACE_DECL_HPP
+
+namespace elem {
+
+// A drop-in alternative to AxpyInterface which is built upon MPI one-sided
+// communication with passive-target synchronization. Local-to-global updates
+// are queued for each owning process, and, once a queue fills (or upon a
+// Flush/Detach), the queue is sorted, duplicate entries are summed, and
+// contiguous runs are sent with a single MPI_Accumulate. Global-to-local
+// requests are satisfied with one strided MPI_Get per owning process.
+template<typename T,typename Int=int>
+class RmaAxpyInterface
+{
+public:
+    RmaAxpyInterface();
+    ~RmaAxpyInterface();
+
+    RmaAxpyInterface( AxpyType type,       DistMatrix<T,MC,MR>& Z );
+    RmaAxpyInterface( AxpyType type, const DistMatrix<T,MC,MR>& Z );
+
+    void Attach( AxpyType type,       DistMatrix<T,MC,MR>& Z );
+    void Attach( AxpyType type, const DistMatrix<T,MC,MR>& Z );
+
+    void Axpy( T alpha,       Matrix<T>& Z, Int i, Int j );
+    void Axpy( T alpha, const Matrix<T>& Z, Int i, Int j );
+
+    // Send all of the queued local-to-global updates to their owners
+    void Flush();
+
+    void Detach();
+
+    // The number of queued updates per destination which triggers a flush
+    void SetMaxQueueSize( Int maxQueueSize );
+    Int MaxQueueSize() const;
+
+private:
+    struct Update
+    {
+        int offset;
+        T value;
+    };
+    static bool CompareUpdates( const Update& a, const Update& b );
+
+    bool attachedForLocalToGlobal_, attachedForGlobalToLocal_;
+    DistMatrix<T,MC,MR>* localToGlobalMat_;
+    const DistMatrix<T,MC,MR>* globalToLocalMat_;
+
+    mpi::Window window_;
+    Int maxQueueSize_;
+    std::vector<int> ldims_;
+    std::vector<std::vector<Update> > updateQueues_;
+    std::vector<T> values_;
+    std::vector<int> blockLengths_, displacements_;
+
+    void CreateWindow( const DistMatrix<T,MC,MR>& Z );
+    void FlushQueue( Int rank );
+
+    void AxpyLocalToGlobal( T alpha, const Matrix<T>& X, Int i, Int j );
+    void AxpyGlobalToLocal( T alpha,       Matrix<T>& Y, Int i, Int j );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_RMAAXPYINTERFACE_DECL_HPP
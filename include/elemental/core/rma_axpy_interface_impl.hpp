@@ -0,0 +1,424 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_RMAAXPYINTERFACE_IMPL_HPP
+#define CORE_RMAAXPYINTERFACE_IMPL_HPP
+
+namespace elem {
+
+template<typename T,typename Int>
+inline bool
+RmaAxpyInterface<T,Int>::CompareUpdates( const Update& a, const Update& b )
+{ return a.offset < b.offset; }
+
+template<typename T,typename Int>
+inline
+RmaAxpyInterface<T,Int>::RmaAxpyInterface()
+: attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false),
+  localToGlobalMat_(0), globalToLocalMat_(0),
+  window_(mpi::WINDOW_NULL), maxQueueSize_(1<<16)
+{ }
+
+template<typename T,typename Int>
+inline
+RmaAxpyInterface<T,Int>::RmaAxpyInterface
+( AxpyType type, DistMatrix<T,MC,MR>& Z )
+: attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false),
+  localToGlobalMat_(0), globalToLocalMat_(0),
+  window_(mpi::WINDOW_NULL), maxQueueSize_(1<<16)
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::RmaAxpyInterface");
+#endif
+    Attach( type, Z );
+}
+
+template<typename T,typename Int>
+inline
+RmaAxpyInterface<T,Int>::RmaAxpyInterface
+( AxpyType type, const DistMatrix<T,MC,MR>& X )
+: attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false),
+  localToGlobalMat_(0), globalToLocalMat_(0),
+  window_(mpi::WINDOW_NULL), maxQueueSize_(1<<16)
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::RmaAxpyInterface");
+#endif
+    Attach( type, X );
+}
+
+template<typename T,typename Int>
+inline
+RmaAxpyInterface<T,Int>::~RmaAxpyInterface()
+{
+    if( attachedForLocalToGlobal_ || attachedForGlobalToLocal_ )
+    {
+#if __cplusplus >= 201703L
+        if( std::uncaught_exceptions() > 0 )
+#else
+        if( std::uncaught_exception() )
+#endif
+        {
+           const Grid& g = ( attachedForLocalToGlobal_ ?
+                             localToGlobalMat_->Grid() :
+                             globalToLocalMat_->Grid() );
+           std::ostringstream os;
+           os << g.Rank()
+              << "Uncaught exception detected during RmaAxpyInterface "
+                 "destructor that required a call to Detach. Instead of "
+                 "allowing for the possibility of Detach throwing another "
+                 "exception and resulting in a 'terminate', we instead "
+                 "immediately dump the call stack (if not in RELEASE mode) "
+                 "since the program will likely hang:" << std::endl;
+           std::cerr << os.str();
+#ifndef RELEASE
+           DumpCallStack();
+#endif
+        }
+        else
+        {
+            Detach();
+        }
+    }
+}
+
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::SetMaxQueueSize( Int maxQueueSize )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::SetMaxQueueSize");
+    if( maxQueueSize < 1 )
+        throw std::logic_error("Maximum queue size must be positive");
+#endif
+    maxQueueSize_ = maxQueueSize;
+}
+
+template<typename T,typename Int>
+inline Int
+RmaAxpyInterface<T,Int>::MaxQueueSize() const
+{ return maxQueueSize_; }
+
+// Expose the local buffer of Z and share the local leading dimensions so
+// that each process can compute displacements into any other's window
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::CreateWindow( const DistMatrix<T,MC,MR>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::CreateWindow");
+#endif
+    const Grid& g = Z.Grid();
+    const Int p = g.Size();
+
+    const int ldim = Z.LDim();
+    ldims_.resize( p );
+    mpi::AllGather( &ldim, 1, &ldims_[0], 1, g.VCComm() );
+
+    const std::size_t numLocalEntries = std::size_t(ldim)*Z.LocalWidth();
+    void* baseAddress =
+        ( numLocalEntries==0 ? 0 : const_cast<T*>(Z.LockedBuffer()) );
+    mpi::WindowCreate
+    ( baseAddress, numLocalEntries*sizeof(T), sizeof(T), g.VCComm(), window_ );
+}
+
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::Attach( AxpyType type, DistMatrix<T,MC,MR>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::Attach");
+#endif
+    if( attachedForLocalToGlobal_ || attachedForGlobalToLocal_ )
+        throw std::logic_error("Must detach before reattaching.");
+
+    if( type == LOCAL_TO_GLOBAL )
+    {
+        attachedForLocalToGlobal_ = true;
+        localToGlobalMat_ = &Z;
+        updateQueues_.resize( Z.Grid().Size() );
+    }
+    else
+    {
+        attachedForGlobalToLocal_ = true;
+        globalToLocalMat_ = &Z;
+    }
+    CreateWindow( Z );
+}
+
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::Attach( AxpyType type, const DistMatrix<T,MC,MR>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::Attach");
+#endif
+    if( attachedForLocalToGlobal_ || attachedForGlobalToLocal_ )
+        throw std::logic_error("Must detach before reattaching.");
+
+    if( type == LOCAL_TO_GLOBAL )
+        throw std::logic_error("Cannot update a constant matrix");
+
+    attachedForGlobalToLocal_ = true;
+    globalToLocalMat_ = &X;
+    CreateWindow( X );
+}
+
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::Axpy( T alpha, Matrix<T>& Z, Int i, Int j )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::Axpy");
+#endif
+    if( attachedForLocalToGlobal_ )
+        AxpyLocalToGlobal( alpha, Z, i, j );
+    else if( attachedForGlobalToLocal_ )
+        AxpyGlobalToLocal( alpha, Z, i, j );
+    else
+        throw std::logic_error("Cannot axpy before attaching.");
+}
+
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::Axpy( T alpha, const Matrix<T>& Z, Int i, Int j )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::Axpy");
+#endif
+    if( attachedForLocalToGlobal_ )
+        AxpyLocalToGlobal( alpha, Z, i, j );
+    else if( attachedForGlobalToLocal_ )
+        throw std::logic_error("Cannot update a constant matrix.");
+    else
+        throw std::logic_error("Cannot axpy before attaching.");
+}
+
+// Queue the updates Y(i:i+height-1,j:j+width-1) += alpha X, where X is
+// height x width, as (local offset,value) pairs for each owning process
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::AxpyLocalToGlobal
+( T alpha, const Matrix<T>& X, Int i, Int j )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::AxpyLocalToGlobal");
+#endif
+    DistMatrix<T,MC,MR>& Y = *localToGlobalMat_;
+    if( i < 0 || j < 0 )
+        throw std::logic_error("Submatrix offsets must be non-negative");
+    if( i+X.Height() > Y.Height() || j+X.Width() > Y.Width() )
+        throw std::logic_error("Submatrix out of bounds of global matrix");
+
+    const Grid& g = Y.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int colAlignment = (Y.ColAlignment() + i) % r;
+    const Int rowAlignment = (Y.RowAlignment() + j) % c;
+
+    const Int height = X.Height();
+    const Int width = X.Width();
+    const T* XBuffer = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+
+    for( Int receivingCol=0; receivingCol<c; ++receivingCol )
+    {
+        const Int rowShift = Shift( receivingCol, rowAlignment, c );
+        const Int localWidth = Length( width, rowShift, c );
+        if( localWidth == 0 )
+            continue;
+        const Int jLocalOffset =
+            Length( j, Shift(receivingCol,Y.RowAlignment(),c), c );
+        for( Int receivingRow=0; receivingRow<r; ++receivingRow )
+        {
+            const Int colShift = Shift( receivingRow, colAlignment, r );
+            const Int localHeight = Length( height, colShift, r );
+            if( localHeight == 0 )
+                continue;
+            const Int iLocalOffset =
+                Length( i, Shift(receivingRow,Y.ColAlignment(),r), r );
+
+            const Int destination = receivingRow + r*receivingCol;
+            const Int ldim = ldims_[destination];
+            std::vector<Update>& queue = updateQueues_[destination];
+            Int queueSize = queue.size();
+            queue.resize( queueSize+localHeight*localWidth );
+            for( Int t=0; t<localWidth; ++t )
+            {
+                const T* XCol = &XBuffer[(rowShift+t*c)*XLDim];
+                const Int offset = iLocalOffset + (jLocalOffset+t)*ldim;
+                for( Int s=0; s<localHeight; ++s )
+                {
+                    Update& update = queue[queueSize++];
+                    update.offset = offset + s;
+                    update.value = alpha*XCol[colShift+s*r];
+                }
+            }
+            if( queueSize >= maxQueueSize_ )
+                FlushQueue( destination );
+        }
+    }
+}
+
+// Sum duplicate updates and then send the contiguous runs of the sorted
+// offsets within a single passive-target accumulation epoch
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::FlushQueue( Int rank )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::FlushQueue");
+#endif
+    std::vector<Update>& queue = updateQueues_[rank];
+    const Int queueSize = queue.size();
+    if( queueSize == 0 )
+        return;
+    std::sort( queue.begin(), queue.end(), CompareUpdates );
+
+    values_.resize( queueSize );
+    blockLengths_.resize( queueSize );
+    displacements_.resize( queueSize );
+    Int numValues=0, numBlocks=0;
+    for( Int k=0; k<queueSize; ++k )
+    {
+        const int offset = queue[k].offset;
+        if( numValues > 0 && offset == queue[k-1].offset )
+        {
+            values_[numValues-1] += queue[k].value;
+        }
+        else if( numValues > 0 && offset == queue[k-1].offset+1 )
+        {
+            values_[numValues++] = queue[k].value;
+            ++blockLengths_[numBlocks-1];
+        }
+        else
+        {
+            values_[numValues++] = queue[k].value;
+            blockLengths_[numBlocks] = 1;
+            displacements_[numBlocks] = offset;
+            ++numBlocks;
+        }
+    }
+
+    mpi::WindowLock( rank, window_ );
+    mpi::Accumulate
+    ( &values_[0], numBlocks, &blockLengths_[0], &displacements_[0],
+      mpi::SUM, rank, window_ );
+    mpi::WindowUnlock( rank, window_ );
+
+    queue.clear();
+}
+
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::Flush()
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::Flush");
+#endif
+    if( !attachedForLocalToGlobal_ )
+        return;
+    const Int p = updateQueues_.size();
+    for( Int rank=0; rank<p; ++rank )
+        FlushQueue( rank );
+}
+
+// Update Y += alpha X(i:i+height-1,j:j+width-1), where X is the dist-matrix
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::AxpyGlobalToLocal
+( T alpha, Matrix<T>& Y, Int i, Int j )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::AxpyGlobalToLocal");
+#endif
+    const DistMatrix<T,MC,MR>& X = *globalToLocalMat_;
+
+    const Int height = Y.Height();
+    const Int width = Y.Width();
+    if( i < 0 || j < 0 )
+        throw std::logic_error("Submatrix offsets must be non-negative");
+    if( i+height > X.Height() || j+width > X.Width() )
+        throw std::logic_error("Invalid AxpyGlobalToLocal submatrix");
+
+    const Grid& g = X.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int colAlignment = (X.ColAlignment() + i) % r;
+    const Int rowAlignment = (X.RowAlignment() + j) % c;
+
+    for( Int col=0; col<c; ++col )
+    {
+        const Int rowShift = Shift( col, rowAlignment, c );
+        const Int localWidth = Length( width, rowShift, c );
+        if( localWidth == 0 )
+            continue;
+        const Int jLocalOffset = Length( j, Shift(col,X.RowAlignment(),c), c );
+        for( Int row=0; row<r; ++row )
+        {
+            const Int colShift = Shift( row, colAlignment, r );
+            const Int localHeight = Length( height, colShift, r );
+            if( localHeight == 0 )
+                continue;
+            const Int iLocalOffset =
+                Length( i, Shift(row,X.ColAlignment(),r), r );
+
+            const Int source = row + r*col;
+            const Int ldim = ldims_[source];
+            values_.resize( localHeight*localWidth );
+            mpi::WindowLock( source, window_ );
+            mpi::Get
+            ( &values_[0], localHeight, localWidth, ldim,
+              iLocalOffset+jLocalOffset*ldim, source, window_ );
+            mpi::WindowUnlock( source, window_ );
+
+            for( Int t=0; t<localWidth; ++t )
+            {
+                T* YCol = Y.Buffer(0,rowShift+t*c);
+                const T* XCol = &values_[t*localHeight];
+                for( Int s=0; s<localHeight; ++s )
+                    YCol[colShift+s*r] += alpha*XCol[s];
+            }
+        }
+    }
+}
+
+template<typename T,typename Int>
+inline void
+RmaAxpyInterface<T,Int>::Detach()
+{
+#ifndef RELEASE
+    CallStackEntry entry("RmaAxpyInterface::Detach");
+#endif
+    if( !attachedForLocalToGlobal_ && !attachedForGlobalToLocal_ )
+        throw std::logic_error("Must attach before detaching.");
+
+    const Grid& g = ( attachedForLocalToGlobal_ ?
+                      localToGlobalMat_->Grid() :
+                      globalToLocalMat_->Grid() );
+
+    Flush();
+    mpi::Barrier( g.VCComm() );
+    mpi::WindowFree( window_ );
+
+    attachedForLocalToGlobal_ = false;
+    attachedForGlobalToLocal_ = false;
+    localToGlobalMat_ = 0;
+    globalToLocalMat_ = 0;
+
+    ldims_.clear();
+    updateQueues_.clear();
+    values_.clear();
+    blockLengths_.clear();
+    displacements_.clear();
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_RMAAXPYINTERFACE_IMPL_HPP
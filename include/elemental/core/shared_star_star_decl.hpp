@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_SHARED_STAR_STAR_DECL_HPP
+#define CORE_SHARED_STAR_STAR_DECL_HPP
+
+namespace elem {
+
+// A [* ,* ] matrix of which, if NodeSharedReplicas() was true upon
+// construction and MPI-3 shared-memory windows are available, the processes
+// of each node share a single copy. Redistributions into the shared copy are
+// zero-copy within a node, and only one 'leader' process per node takes part
+// in the communication between nodes. Since the copy is shared, it should
+// only be modified by the node leaders, followed by a call to Synchronize().
+// A leader whose update throws should pass the exception to Fail from within
+// its catch block, so that Synchronize rethrows it on the whole node rather
+// than leaving the other members of the node waiting on the leader.
+// Otherwise, each process simply holds its own copy (and is its own leader).
+template<typename T>
+class SharedStarStar
+{
+public:
+    SharedStarStar( const elem::Grid& g );
+    ~SharedStarStar();
+
+    const elem::Grid& Grid() const;
+    bool Shared() const;
+    // Whether or not this process should perform updates of its node's copy
+    bool NodeLeader() const;
+    // The number of entries allocated by this process
+    std::size_t AllocatedMemory() const;
+
+    // Collective over the grid
+    void ResizeTo( int height, int width );
+    const SharedStarStar<T>& operator=( const DistMatrix<T>& A );
+    // Make the updates of each node leader visible to the rest of its node,
+    // and rethrow any failure of the leader on every member of the node
+    void Synchronize();
+    // Must be called from within a catch block. Unless the copy is shared,
+    // the exception is simply rethrown; otherwise it is recorded until the
+    // next call to Synchronize.
+    void Fail( const std::exception& e );
+
+    // The (shared) copy of the matrix
+    DistMatrix<T,STAR,STAR>& Replica();
+    const DistMatrix<T,STAR,STAR>& LockedReplica() const;
+
+private:
+    bool shared_, leader_;
+    DistMatrix<T,STAR,STAR> replica_;
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    mpi::Comm nodeComm_, leaderComm_;
+    mpi::Window window_;
+    T* buffer_;
+    std::size_t capacity_;
+    // The VC ranks of the members of each node (only set on node leaders)
+    std::vector<int> nodeOffsets_, nodeMembers_;
+    int node_;
+    // The kind of the exception recorded by Fail (zero if there was none)
+    int error_;
+    std::string errorMsg_;
+#endif
+
+    SharedStarStar( const SharedStarStar<T>& );
+    const SharedStarStar<T>& operator=( const SharedStarStar<T>& );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_SHARED_STAR_STAR_DECL_HPP
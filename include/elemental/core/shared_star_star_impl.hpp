@@ -0,0 +1,332 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_SHARED_STAR_STAR_IMPL_HPP
+#define CORE_SHARED_STAR_STAR_IMPL_HPP
+
+namespace elem {
+
+template<typename T>
+inline
+SharedStarStar<T>::SharedStarStar( const elem::Grid& g )
+: shared_(false), leader_(true), replica_(g)
+{
+#ifndef RELEASE
+    CallStackEntry entry("SharedStarStar::SharedStarStar");
+#endif
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    if( NodeSharedReplicas() && g.InGrid() )
+    {
+        shared_ = true;
+        window_ = mpi::WINDOW_NULL;
+        buffer_ = 0;
+        capacity_ = 0;
+        error_ = NO_EXCEPTION;
+
+        // Split the grid into nodes, each led by its member with the
+        // smallest VC rank, and form a communicator from the leaders
+        const int vcRank = g.VCRank();
+        mpi::CommSplitNode( g.VCComm(), nodeComm_ );
+        const int nodeSize = mpi::CommSize( nodeComm_ );
+        leader_ = ( mpi::CommRank( nodeComm_ ) == 0 );
+        mpi::CommSplit( g.VCComm(), ( leader_ ? 0 : 1 ), vcRank, leaderComm_ );
+
+        // Have the leaders store the members of every node
+        std::vector<int> members( nodeSize );
+        mpi::AllGather( &vcRank, 1, &members[0], 1, nodeComm_ );
+        if( leader_ )
+        {
+            const int numNodes = mpi::CommSize( leaderComm_ );
+            node_ = mpi::CommRank( leaderComm_ );
+            std::vector<int> nodeSizes( numNodes );
+            mpi::AllGather( &nodeSize, 1, &nodeSizes[0], 1, leaderComm_ );
+            nodeOffsets_.resize( numNodes+1 );
+            nodeOffsets_[0] = 0;
+            for( int node=0; node<numNodes; ++node )
+                nodeOffsets_[node+1] = nodeOffsets_[node] + nodeSizes[node];
+            nodeMembers_.resize( nodeOffsets_[numNodes] );
+            mpi::AllGather
+            ( &members[0], nodeSize,
+              &nodeMembers_[0], &nodeSizes[0], &nodeOffsets_[0],
+              leaderComm_ );
+        }
+    }
+#endif
+}
+
+template<typename T>
+inline
+SharedStarStar<T>::~SharedStarStar()
+{
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    if( shared_ && !mpi::Finalized() )
+    {
+        if( window_ != mpi::WINDOW_NULL )
+        {
+            mpi::WindowUnlockAll( window_ );
+            mpi::WindowFree( window_ );
+        }
+        mpi::CommFree( nodeComm_ );
+        mpi::CommFree( leaderComm_ );
+    }
+#endif
+}
+
+template<typename T>
+inline const elem::Grid&
+SharedStarStar<T>::Grid() const
+{ return replica_.Grid(); }
+
+template<typename T>
+inline bool
+SharedStarStar<T>::Shared() const
+{ return shared_; }
+
+template<typename T>
+inline bool
+SharedStarStar<T>::NodeLeader() const
+{ return leader_; }
+
+template<typename T>
+inline std::size_t
+SharedStarStar<T>::AllocatedMemory() const
+{
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    if( shared_ )
+        return ( leader_ ? capacity_ : 0 );
+#endif
+    return replica_.AllocatedMemory();
+}
+
+template<typename T>
+inline DistMatrix<T,STAR,STAR>&
+SharedStarStar<T>::Replica()
+{ return replica_; }
+
+template<typename T>
+inline const DistMatrix<T,STAR,STAR>&
+SharedStarStar<T>::LockedReplica() const
+{ return replica_; }
+
+template<typename T>
+inline void
+SharedStarStar<T>::Synchronize()
+{
+#ifndef RELEASE
+    CallStackEntry entry("SharedStarStar::Synchronize");
+#endif
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    if( shared_ )
+    {
+        // The reduction of the error kinds doubles as the node barrier. Only
+        // the leader (the root of the node communicator) can have failed.
+        // The window does not exist until the first resize, but the
+        // reduction is still required to keep the node in step.
+        const bool haveWindow = ( window_ != mpi::WINDOW_NULL );
+        if( haveWindow )
+            mpi::WindowSync( window_ );
+        int error = error_;
+        mpi::AllReduce( &error, 1, mpi::MAX, nodeComm_ );
+        if( haveWindow )
+            mpi::WindowSync( window_ );
+        if( error != NO_EXCEPTION )
+        {
+            int msgLength = errorMsg_.size();
+            mpi::Broadcast( &msgLength, 1, 0, nodeComm_ );
+            std::vector<byte> msgBuf( msgLength+1, 0 );
+            if( leader_ )
+                std::copy( errorMsg_.begin(), errorMsg_.end(), msgBuf.begin() );
+            mpi::Broadcast( &msgBuf[0], msgLength, 0, nodeComm_ );
+            error_ = NO_EXCEPTION;
+            errorMsg_.clear();
+            ThrowException
+            ( ExceptionKind(error),
+              std::string( (const char*)&msgBuf[0], msgLength ) );
+        }
+    }
+#endif
+}
+
+template<typename T>
+inline void
+SharedStarStar<T>::Fail( const std::exception& e )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SharedStarStar::Fail");
+#endif
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    if( shared_ )
+    {
+        error_ = ClassifyException( e );
+        errorMsg_ = e.what();
+        return;
+    }
+#endif
+    throw;
+}
+
+template<typename T>
+inline void
+SharedStarStar<T>::ResizeTo( int height, int width )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SharedStarStar::ResizeTo");
+#endif
+    if( !shared_ )
+    {
+        replica_.ResizeTo( height, width );
+        return;
+    }
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    const int ldim = std::max( height, 1 );
+    const std::size_t requiredSize = std::size_t(ldim)*std::max(width,1);
+    if( requiredSize > capacity_ )
+    {
+        // Every process must be finished with the old copy before it is freed
+        if( window_ != mpi::WINDOW_NULL )
+        {
+            mpi::Barrier( nodeComm_ );
+            mpi::WindowUnlockAll( window_ );
+            mpi::WindowFree( window_ );
+        }
+        capacity_ = requiredSize;
+        mpi::WindowAllocateShared
+        ( ( leader_ ? capacity_*sizeof(T) : 0 ), nodeComm_, window_ );
+        buffer_ = static_cast<T*>( mpi::WindowSharedQuery( 0, window_ ) );
+        mpi::WindowLockAll( window_ );
+    }
+    replica_.Attach( height, width, buffer_, ldim, replica_.Grid() );
+#endif
+}
+
+template<typename T>
+inline const SharedStarStar<T>&
+SharedStarStar<T>::operator=( const DistMatrix<T>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SharedStarStar = [MC,MR]");
+    if( A.Grid() != Grid() )
+        throw std::logic_error("Grids must match");
+#endif
+    if( !shared_ )
+    {
+        replica_ = A;
+        return *this;
+    }
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    const elem::Grid& g = A.Grid();
+    const int height = A.Height();
+    const int width = A.Width();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int colAlignment = A.ColAlignment();
+    const int rowAlignment = A.RowAlignment();
+    ResizeTo( height, width );
+    const int ldim = replica_.LDim();
+
+    // Once the previous contents are no longer in use, have each process
+    // write its entries directly into its node's copy
+    Synchronize();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const T* ABuffer = A.LockedBuffer();
+    const int ALDim = A.LDim();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        T* destCol = &buffer_[colShift+(rowShift+jLoc*c)*ldim];
+        const T* sourceCol = &ABuffer[jLoc*ALDim];
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+            destCol[iLoc*r] = sourceCol[iLoc];
+    }
+    Synchronize();
+
+    // Have the node leaders exchange the entries owned by their nodes
+    if( leader_ )
+    {
+        const int numNodes = nodeOffsets_.size()-1;
+        std::vector<int> recvCounts( numNodes ), recvDispls( numNodes );
+        int totalSize = 0;
+        for( int node=0; node<numNodes; ++node )
+        {
+            int count = 0;
+            for( int s=nodeOffsets_[node]; s<nodeOffsets_[node+1]; ++s )
+            {
+                const int q = nodeMembers_[s];
+                const int qColShift = Shift( q % r, colAlignment, r );
+                const int qRowShift = Shift( q / r, rowAlignment, c );
+                count += Length( height, qColShift, r )*
+                         Length( width, qRowShift, c );
+            }
+            recvCounts[node] = count;
+            recvDispls[node] = totalSize;
+            totalSize += count;
+        }
+        if( numNodes > 1 && totalSize > 0 )
+        {
+            std::vector<T> sendBuf( std::max(recvCounts[node_],1) ),
+                           recvBuf( totalSize );
+
+            // Pack the entries of our node's members, in order
+            int offset = 0;
+            for( int s=nodeOffsets_[node_]; s<nodeOffsets_[node_+1]; ++s )
+            {
+                const int q = nodeMembers_[s];
+                const int qColShift = Shift( q % r, colAlignment, r );
+                const int qRowShift = Shift( q / r, rowAlignment, c );
+                const int qLocalHeight = Length( height, qColShift, r );
+                const int qLocalWidth = Length( width, qRowShift, c );
+                for( int jLoc=0; jLoc<qLocalWidth; ++jLoc )
+                {
+                    const T* sourceCol =
+                        &buffer_[qColShift+(qRowShift+jLoc*c)*ldim];
+                    for( int iLoc=0; iLoc<qLocalHeight; ++iLoc )
+                        sendBuf[offset++] = sourceCol[iLoc*r];
+                }
+            }
+            mpi::AllGather
+            ( &sendBuf[0], recvCounts[node_],
+              &recvBuf[0], &recvCounts[0], &recvDispls[0], leaderComm_ );
+
+            // Unpack the entries of the other nodes
+            for( int node=0; node<numNodes; ++node )
+            {
+                if( node == node_ )
+                    continue;
+                offset = recvDispls[node];
+                for( int s=nodeOffsets_[node]; s<nodeOffsets_[node+1]; ++s )
+                {
+                    const int q = nodeMembers_[s];
+                    const int qColShift = Shift( q % r, colAlignment, r );
+                    const int qRowShift = Shift( q / r, rowAlignment, c );
+                    const int qLocalHeight = Length( height, qColShift, r );
+                    const int qLocalWidth = Length( width, qRowShift, c );
+                    for( int jLoc=0; jLoc<qLocalWidth; ++jLoc )
+                    {
+                        T* destCol =
+                            &buffer_[qColShift+(qRowShift+jLoc*c)*ldim];
+                        for( int iLoc=0; iLoc<qLocalHeight; ++iLoc )
+                            destCol[iLoc*r] = recvBuf[offset++];
+                    }
+                }
+            }
+        }
+    }
+    Synchronize();
+#endif
+    return *this;
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_SHARED_STAR_STAR_IMPL_HPP
@@ -30,6 +30,14 @@ struct SafeProduct
     SafeProduct( Int numEntries );
 };
 
+// The number of positive, negative, and zero eigenvalues of a Hermitian
+// (or real symmetric) matrix
+template<typename Int=int>
+struct InertiaType
+{
+    Int numPositive, numNegative, numZero;
+};
+
 namespace conjugation_wrapper {
 enum Conjugation
 {
@@ -23,6 +23,10 @@ void LocalReverseCholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Square.hpp"
 #include "./Cholesky/SolveAfter.hpp"
+#include "./Cholesky/SelectedInverse.hpp"
+#include "./Cholesky/Hutchinson.hpp"
+#include "./Cholesky/OutOfCore.hpp"
+#include "./Cholesky/Mod.hpp"
 
 namespace elem {
 
@@ -61,6 +65,42 @@ Cholesky( UpperOrLower uplo, Matrix<F>& A )
         cholesky::UVar3( A );
 }
 
+namespace batch {
+
+template<typename F>
+struct CholeskyFunctor
+{
+    UpperOrLower uplo;
+    MatrixBatch<F>* A;
+
+    CholeskyFunctor( UpperOrLower u, MatrixBatch<F>& ABatch )
+    : uplo(u), A(&ABatch)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F> AView;
+        A->View( k, AView );
+        Cholesky( uplo, AView );
+    }
+};
+
+} // namespace batch
+
+// Independently factor each member of a batch, starting with the most
+// expensive members
+template<typename F>
+inline void
+Cholesky( UpperOrLower uplo, MatrixBatch<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Cholesky");
+#endif
+    std::vector<int> order;
+    batch::DescendingCostOrder( A, order );
+    batch::Apply( order, batch::CholeskyFunctor<F>(uplo,A) );
+}
+
 template<typename F>
 inline void
 ReverseCholesky( UpperOrLower uplo, Matrix<F>& A )
@@ -100,6 +140,24 @@ Cholesky( UpperOrLower uplo, DistMatrix<F>& A )
     }
 }
 
+// Factor a matrix stored on disk by streaming panels of its columns through
+// roughly 'memoryBudget' bytes of memory per process
+template<typename F>
+inline void
+Cholesky
+( UpperOrLower uplo, DiskDistMatrix<F>& A, std::size_t memoryBudget )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Cholesky");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    if( uplo == LOWER )
+        cholesky::OutOfCoreL( A, memoryBudget );
+    else
+        cholesky::OutOfCoreU( A, memoryBudget );
+}
+
 template<typename F> 
 inline void
 ReverseCholesky( UpperOrLower uplo, DistMatrix<F>& A )
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CHOLESKY_HUTCHINSON_HPP
+#define LAPACK_CHOLESKY_HUTCHINSON_HPP
+
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/Cholesky/SolveAfter.hpp"
+#include "elemental/matrices/Rademacher.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Stochastic estimates of the trace and diagonal of the inverse of an HPD
+// matrix from its Cholesky factor. With Rademacher probes z_1, ..., z_m,
+//
+//   trace(inv(A)) ~= (1/m) sum_j z_j^H inv(A) z_j, and
+//   diag(inv(A))  ~= (1/m) sum_j z_j .* (inv(A) z_j),
+//
+// where the first is Hutchinson's estimator and the second is that of
+// Bekas, Kokiopoulou, and Saad, "An estimator for the diagonal of a matrix",
+// Appl. Numer. Math., Vol. 57, 2007. The probes are solved against in
+// batches of at most Blocksize() so that the workspace remains O(n nb).
+
+namespace elem {
+namespace cholesky {
+
+template<typename F>
+inline BASE(F)
+InverseTraceEstimate
+( UpperOrLower uplo, const Matrix<F>& A, int numProbes )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::InverseTraceEstimate");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( numProbes <= 0 )
+        throw std::logic_error("Must use at least one probe");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const int bsize = Blocksize();
+    Matrix<F> Z, W;
+    R sum = 0;
+    for( int s=0; s<numProbes; s+=bsize )
+    {
+        const int b = std::min(bsize,numProbes-s);
+        Rademacher( Z, n, b );
+        W = Z;
+        SolveAfter( uplo, NORMAL, A, W );
+        for( int j=0; j<b; ++j )
+            for( int i=0; i<n; ++i )
+                sum += RealPart(Z.Get(i,j)*W.Get(i,j));
+    }
+    return sum / numProbes;
+}
+
+template<typename F>
+inline BASE(F)
+InverseTraceEstimate
+( UpperOrLower uplo, const DistMatrix<F>& A, int numProbes )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::InverseTraceEstimate");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( numProbes <= 0 )
+        throw std::logic_error("Must use at least one probe");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int bsize = Blocksize();
+    DistMatrix<F> Z( g ), W( g );
+    R localSum = 0;
+    Z.AlignWith( A );
+    for( int s=0; s<numProbes; s+=bsize )
+    {
+        const int b = std::min(bsize,numProbes-s);
+        Rademacher( Z, n, b );
+        W = Z;
+        SolveAfter( uplo, NORMAL, A, W );
+        const int localHeight = Z.LocalHeight();
+        const int localWidth = Z.LocalWidth();
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( int iLoc=0; iLoc<localHeight; ++iLoc )
+                localSum +=
+                    RealPart(Z.GetLocal(iLoc,jLoc)*W.GetLocal(iLoc,jLoc));
+    }
+    R sum;
+    mpi::AllReduce( &localSum, &sum, 1, mpi::SUM, g.Comm() );
+    return sum / numProbes;
+}
+
+template<typename F>
+inline void
+InverseDiagonalEstimate
+( UpperOrLower uplo, const Matrix<F>& A, Matrix<BASE(F)>& d, int numProbes )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::InverseDiagonalEstimate");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( numProbes <= 0 )
+        throw std::logic_error("Must use at least one probe");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const int bsize = Blocksize();
+    Matrix<F> Z, W;
+    Zeros( d, n, 1 );
+    for( int s=0; s<numProbes; s+=bsize )
+    {
+        const int b = std::min(bsize,numProbes-s);
+        Rademacher( Z, n, b );
+        W = Z;
+        SolveAfter( uplo, NORMAL, A, W );
+        for( int j=0; j<b; ++j )
+            for( int i=0; i<n; ++i )
+                d.Update( i, 0, RealPart(Z.Get(i,j)*W.Get(i,j)) );
+    }
+    Scale( R(1)/R(numProbes), d );
+}
+
+template<typename F>
+inline void
+InverseDiagonalEstimate
+( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& d,
+  int numProbes )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::InverseDiagonalEstimate");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( numProbes <= 0 )
+        throw std::logic_error("Must use at least one probe");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int bsize = Blocksize();
+    DistMatrix<F> Z( g ), W( g );
+
+    // Accumulate the local contributions to each row sum and then combine
+    // them within each process row
+    DistMatrix<R,MC,STAR> d_MC_STAR( g );
+    d_MC_STAR.AlignWith( A.DistData() );
+    Zeros( d_MC_STAR, n, 1 );
+    R* dBuffer = d_MC_STAR.Buffer();
+    Z.AlignWith( A );
+    for( int s=0; s<numProbes; s+=bsize )
+    {
+        const int b = std::min(bsize,numProbes-s);
+        Rademacher( Z, n, b );
+        W = Z;
+        SolveAfter( uplo, NORMAL, A, W );
+        const int localHeight = Z.LocalHeight();
+        const int localWidth = Z.LocalWidth();
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( int iLoc=0; iLoc<localHeight; ++iLoc )
+                dBuffer[iLoc] +=
+                    RealPart(Z.GetLocal(iLoc,jLoc)*W.GetLocal(iLoc,jLoc));
+    }
+    mpi::AllReduce
+    ( dBuffer, d_MC_STAR.LocalHeight(), mpi::SUM, g.RowComm() );
+    Scale( R(1)/R(numProbes), d_MC_STAR );
+    d = d_MC_STAR;
+}
+
+} // namespace cholesky
+} // namespace elem
+
+#endif // ifndef LAPACK_CHOLESKY_HUTCHINSON_HPP
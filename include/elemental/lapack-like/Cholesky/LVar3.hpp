@@ -183,7 +183,7 @@ LVar3( DistMatrix<F>& A )
                          A20(g), A21(g), A22(g);
 
     // Temporary matrices
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    SharedStarStar<F> A11_STAR_STAR(g);
     DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
     DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
     DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
@@ -207,12 +207,19 @@ LVar3( DistMatrix<F>& A )
         A21Adj_STAR_MR.AlignWith( A22 );
         //--------------------------------------------------------------------//
         A11_STAR_STAR = A11;
-        LocalCholesky( LOWER, A11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        try
+        {
+            if( A11_STAR_STAR.NodeLeader() )
+                LocalCholesky( LOWER, A11_STAR_STAR.Replica() );
+        }
+        catch( std::exception& e ) { A11_STAR_STAR.Fail( e ); }
+        A11_STAR_STAR.Synchronize();
+        A11 = A11_STAR_STAR.LockedReplica();
 
         A21_VC_STAR = A21;
         LocalTrsm
-        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR.LockedReplica(),
+          A21_VC_STAR );
 
         A21_VR_STAR = A21_VC_STAR;
         A21Trans_STAR_MC.TransposeFrom( A21_VC_STAR );
@@ -254,7 +261,7 @@ ReverseLVar3( DistMatrix<F>& A )
                          A20(g), A21(g), A22(g);
 
     // Temporary matrices
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    SharedStarStar<F> A11_STAR_STAR(g);
     DistMatrix<F,STAR,VR  > A10_STAR_VR(g);
     DistMatrix<F,STAR,MC  > A10_STAR_MC(g);
     DistMatrix<F,STAR,MR  > A10_STAR_MR(g);
@@ -276,12 +283,19 @@ ReverseLVar3( DistMatrix<F>& A )
         A10_STAR_MR.AlignWith( A00 );
         //--------------------------------------------------------------------//
         A11_STAR_STAR = A11;
-        LocalReverseCholesky( LOWER, A11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        try
+        {
+            if( A11_STAR_STAR.NodeLeader() )
+                LocalReverseCholesky( LOWER, A11_STAR_STAR.Replica() );
+        }
+        catch( std::exception& e ) { A11_STAR_STAR.Fail( e ); }
+        A11_STAR_STAR.Synchronize();
+        A11 = A11_STAR_STAR.LockedReplica();
 
         A10_STAR_VR = A10;
         LocalTrsm
-        ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A10_STAR_VR );
+        ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR.LockedReplica(),
+          A10_STAR_VR );
 
         A10_STAR_MC = A10_STAR_VR;
         A10_STAR_MR = A10_STAR_VR;
@@ -0,0 +1,480 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CHOLESKY_MOD_HPP
+#define LAPACK_CHOLESKY_MOD_HPP
+
+#include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level2/Gemv.hpp"
+#include "elemental/blas-like/level2/Trsv.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Identity.hpp"
+
+// Modify a Cholesky factor, T, so that T T^H (or T^H T) becomes
+// T T^H + alpha V V^H, where alpha is real and V has a small number of
+// columns, in O(n^2 k) rather than O(n^3) work. The factor is processed in
+// column panels: the rotations which annihilate the rows of V within each
+// panel (Givens rotations for updates and hyperbolic rotations, in mixed
+// form, for downdates) are computed redundantly from an [* ,* ] copy of the
+// panel and accumulated into a small matrix, which is then applied to the
+// rest of the panel and of V with a single matrix-matrix multiplication.
+//
+// See Section 6.5.4 of G. H. Golub and C. F. Van Loan's "Matrix
+// Computations" and S. T. Alexander, C.-T. Pan, and R. J. Plemmons'
+// "Analysis of a recursive least squares hyperbolic rotation algorithm for
+// signal processing".
+
+namespace elem {
+namespace cholesky {
+
+// Apply the rotation which maps [alpha, beta] to [rho, 0] to columns j and
+// k of the rows [iStart,height) of A
+template<typename F>
+inline void
+ApplyModRotation
+( bool downdate, BASE(F) c, F s, Matrix<F>& A, int j, int k, int iStart )
+{
+    const int height = A.Height();
+    F* aj = A.Buffer(0,j);
+    F* ak = A.Buffer(0,k);
+    if( downdate )
+    {
+        for( int i=iStart; i<height; ++i )
+        {
+            const F chi = c*aj[i] - Conj(s)*ak[i];
+            ak[i] = (ak[i] - s*chi)/c;
+            aj[i] = chi;
+        }
+    }
+    else
+    {
+        for( int i=iStart; i<height; ++i )
+        {
+            const F chi = c*aj[i] + Conj(s)*ak[i];
+            ak[i] = c*ak[i] - s*aj[i];
+            aj[i] = chi;
+        }
+    }
+}
+
+// Given the panel P = [P1, P2], where P1 is nb x nb and lower-triangular
+// with a positive diagonal and P2 is nb x k, overwrite P1 with the modified
+// factor and Q with the accumulated rotations, so that [P1, P2] Q = [P1~, 0]
+template<typename F>
+inline void
+ModPanel( bool downdate, Matrix<F>& P, Matrix<F>& Q )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::ModPanel");
+#endif
+    typedef BASE(F) R;
+    const int nb = P.Height();
+    const int width = P.Width();
+    Identity( Q, width, width );
+    for( int j=0; j<nb; ++j )
+    {
+        for( int k=nb; k<width; ++k )
+        {
+            const F beta = P.Get(j,k);
+            if( beta == F(0) )
+                continue;
+            const R alpha = RealPart(P.Get(j,j));
+            R rho;
+            if( downdate )
+            {
+                const R betaAbs = Abs(beta);
+                if( betaAbs >= alpha )
+                    throw NonHPDMatrixException();
+                rho = Sqrt((alpha-betaAbs)*(alpha+betaAbs));
+            }
+            else
+                rho = lapack::SafeNorm( alpha, Abs(beta) );
+            const R c = alpha/rho;
+            const F s = beta/rho;
+            ApplyModRotation( downdate, c, s, P, j, k, j );
+            ApplyModRotation( downdate, c, s, Q, j, k, 0 );
+            P.Set( j, j, rho );
+            P.Set( j, k, 0 );
+        }
+    }
+}
+
+template<typename F>
+inline void
+LowerMod( Matrix<F>& L, BASE(F) alpha, Matrix<F>& V )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::LowerMod");
+#endif
+    typedef BASE(F) R;
+    const int n = L.Height();
+    const int k = V.Width();
+    const bool downdate = ( alpha < R(0) );
+    Scale( F(Sqrt(Abs(alpha))), V );
+
+    Matrix<F> P, P1, P2, Q, Q11, Q12, Q21, Q22, L21Old, V2Old;
+    Matrix<F> L11, L21, V1, V2;
+    const int bsize = Blocksize();
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        View( L11, L, j, j, nb, nb );
+        View( L21, L, j+nb, j, n-j-nb, nb );
+        View( V1, V, j, 0, nb, k );
+        View( V2, V, j+nb, 0, n-j-nb, k );
+
+        // Compute the rotations from the diagonal block and the top of V
+        P.ResizeTo( nb, nb+k );
+        View( P1, P, 0, 0, nb, nb );
+        View( P2, P, 0, nb, nb, k );
+        P1 = L11;
+        MakeTriangular( LOWER, P1 );
+        P2 = V1;
+        ModPanel( downdate, P, Q );
+        for( int jj=0; jj<nb; ++jj )
+            for( int ii=jj; ii<nb; ++ii )
+                L11.Set( ii, jj, P1.Get(ii,jj) );
+        V1 = P2;
+
+        // [L21, V2] := [L21, V2] Q
+        LockedView( Q11, Q, 0, 0, nb, nb );
+        LockedView( Q12, Q, 0, nb, nb, k );
+        LockedView( Q21, Q, nb, 0, k, nb );
+        LockedView( Q22, Q, nb, nb, k, k );
+        L21Old = L21;
+        V2Old = V2;
+        Gemm( NORMAL, NORMAL, F(1), L21Old, Q11, F(0), L21 );
+        Gemm( NORMAL, NORMAL, F(1), V2Old, Q21, F(1), L21 );
+        Gemm( NORMAL, NORMAL, F(1), L21Old, Q12, F(0), V2 );
+        Gemm( NORMAL, NORMAL, F(1), V2Old, Q22, F(1), V2 );
+    }
+}
+
+template<typename F>
+inline void
+LowerMod( DistMatrix<F>& L, BASE(F) alpha, DistMatrix<F>& V )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::LowerMod");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = L.Grid();
+    const int n = L.Height();
+    const int k = V.Width();
+    const bool downdate = ( alpha < R(0) );
+
+    // V is only ever accessed by rows, so it is stored as [VC,* ], aligned
+    // with the columns of L so that the panels of L redistribute locally
+    DistMatrix<F> VAlign(g);
+    VAlign.AlignWith( L );
+    VAlign = V;
+    DistMatrix<F,VC,STAR> V_VC_STAR(g);
+    V_VC_STAR.AlignWith( L );
+    V_VC_STAR = VAlign;
+    Scale( F(Sqrt(Abs(alpha))), V_VC_STAR );
+
+    Matrix<F> P1, P2, Q11, Q12, Q21, Q22;
+    DistMatrix<F,STAR,STAR> P_STAR_STAR(g), Q_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), V1_STAR_STAR(g);
+    DistMatrix<F,VC,STAR> L21_VC_STAR(g), L21Old_VC_STAR(g), V2Old_VC_STAR(g);
+    DistMatrix<F> L11(g), L21(g);
+    DistMatrix<F,VC,STAR> V1_VC_STAR(g), V2_VC_STAR(g);
+    const int bsize = Blocksize();
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        View( L11, L, j, j, nb, nb );
+        View( L21, L, j+nb, j, n-j-nb, nb );
+        View( V1_VC_STAR, V_VC_STAR, j, 0, nb, k );
+        View( V2_VC_STAR, V_VC_STAR, j+nb, 0, n-j-nb, k );
+
+        // Redundantly compute the rotations from the diagonal block and the
+        // top of V
+        L11_STAR_STAR = L11;
+        V1_STAR_STAR = V1_VC_STAR;
+        P_STAR_STAR.ResizeTo( nb, nb+k );
+        Matrix<F>& P = P_STAR_STAR.Matrix();
+        View( P1, P, 0, 0, nb, nb );
+        View( P2, P, 0, nb, nb, k );
+        P1 = L11_STAR_STAR.LockedMatrix();
+        MakeTriangular( LOWER, P1 );
+        P2 = V1_STAR_STAR.LockedMatrix();
+        ModPanel( downdate, P, Q_STAR_STAR.Matrix() );
+
+        // Overwrite the lower triangle of L11 and the top of V
+        const int colShift = L11.ColShift();
+        const int rowShift = L11.RowShift();
+        const int colStride = L11.ColStride();
+        const int rowStride = L11.RowStride();
+        const int localHeight = L11.LocalHeight();
+        const int localWidth = L11.LocalWidth();
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const int jj = rowShift + jLoc*rowStride;
+            for( int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int ii = colShift + iLoc*colStride;
+                if( ii >= jj )
+                    L11.SetLocal( iLoc, jLoc, P1.Get(ii,jj) );
+            }
+        }
+        V1_STAR_STAR.Matrix() = P2;
+        V1_VC_STAR = V1_STAR_STAR;
+
+        // [L21, V2] := [L21, V2] Q, with each process updating its rows
+        const Matrix<F>& Q = Q_STAR_STAR.LockedMatrix();
+        LockedView( Q11, Q, 0, 0, nb, nb );
+        LockedView( Q12, Q, 0, nb, nb, k );
+        LockedView( Q21, Q, nb, 0, k, nb );
+        LockedView( Q22, Q, nb, nb, k, k );
+        L21Old_VC_STAR.AlignWith( V2_VC_STAR );
+        L21Old_VC_STAR = L21;
+        V2Old_VC_STAR = V2_VC_STAR;
+        L21_VC_STAR.AlignWith( V2_VC_STAR );
+        L21_VC_STAR.ResizeTo( n-j-nb, nb );
+        Gemm
+        ( NORMAL, NORMAL, F(1), L21Old_VC_STAR.LockedMatrix(), Q11,
+          F(0), L21_VC_STAR.Matrix() );
+        Gemm
+        ( NORMAL, NORMAL, F(1), V2Old_VC_STAR.LockedMatrix(), Q21,
+          F(1), L21_VC_STAR.Matrix() );
+        Gemm
+        ( NORMAL, NORMAL, F(1), L21Old_VC_STAR.LockedMatrix(), Q12,
+          F(0), V2_VC_STAR.Matrix() );
+        Gemm
+        ( NORMAL, NORMAL, F(1), V2Old_VC_STAR.LockedMatrix(), Q22,
+          F(1), V2_VC_STAR.Matrix() );
+        L21 = L21_VC_STAR;
+    }
+    VAlign = V_VC_STAR;
+    V = VAlign;
+}
+
+// Remove the i'th row and column of the matrix whose lower Cholesky factor
+// is L: the trailing factor absorbs the i'th column of L as a rank-one
+// update. The other triangle of L is shifted along with the factor.
+template<typename F>
+inline void
+LowerDeleteRowCol( DistMatrix<F>& L, int i )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::LowerDeleteRowCol");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = L.Grid();
+    const int n = L.Height();
+    const int nBot = n-i-1;
+
+    DistMatrix<F> LNew( n-1, n-1, g ), l21(g);
+    DistMatrix<F> A(g), B(g);
+    LockedView( A, L, 0, 0, i, i );
+    View( B, LNew, 0, 0, i, i );
+    B = A;
+    LockedView( A, L, i+1, 0, nBot, i );
+    View( B, LNew, i, 0, nBot, i );
+    B = A;
+    LockedView( A, L, 0, i+1, i, nBot );
+    View( B, LNew, 0, i, i, nBot );
+    B = A;
+    LockedView( A, L, i+1, i+1, nBot, nBot );
+    View( B, LNew, i, i, nBot, nBot );
+    B = A;
+
+    LockedView( A, L, i+1, i, nBot, 1 );
+    l21 = A;
+    LowerMod( B, R(1), l21 );
+    L = LNew;
+}
+
+// Insert a new row and column into the matrix whose lower Cholesky factor
+// is L so that its i'th column is a. The other triangle of L is shifted,
+// and filled in with the new row and column.
+template<typename F>
+inline void
+LowerInsertRowCol( DistMatrix<F>& L, int i, const DistMatrix<F>& a )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::LowerInsertRowCol");
+    if( a.Height() != L.Height()+1 || a.Width() != 1 )
+        throw std::logic_error("a must be a column vector of height n+1");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = L.Grid();
+    const int n = L.Height();
+    const int nBot = n-i;
+
+    DistMatrix<F> LNew( n+1, n+1, g );
+    DistMatrix<F> A(g), B(g), a0(g), a2(g), l10(g), l21(g);
+    LockedView( A, L, 0, 0, i, i );
+    View( B, LNew, 0, 0, i, i );
+    B = A;
+    LockedView( A, L, i, 0, nBot, i );
+    View( B, LNew, i+1, 0, nBot, i );
+    B = A;
+    LockedView( A, L, 0, i, i, nBot );
+    View( B, LNew, 0, i+1, i, nBot );
+    B = A;
+    LockedView( A, L, i, i, nBot, nBot );
+    View( B, LNew, i+1, i+1, nBot, nBot );
+    B = A;
+
+    // l10 := inv(L00) a0 and lambda := sqrt(alpha - || l10 ||_2^2)
+    LockedView( a0, a, 0, 0, i, 1 );
+    LockedView( a2, a, i+1, 0, nBot, 1 );
+    l10 = a0;
+    LockedView( A, L, 0, 0, i, i );
+    if( i > 0 )
+        Trsv( LOWER, NORMAL, NON_UNIT, A, l10 );
+    const R frobL10 = FrobeniusNorm( l10 );
+    const R lambdaSquared = RealPart(a.Get(i,0)) - frobL10*frobL10;
+    if( lambdaSquared <= R(0) )
+        throw NonHPDMatrixException();
+    const R lambda = Sqrt(lambdaSquared);
+
+    // l21 := (a2 - L20 l10) / lambda
+    l21 = a2;
+    LockedView( A, L, i, 0, nBot, i );
+    if( i > 0 )
+        Gemv( NORMAL, F(-1), A, l10, F(1), l21 );
+    Scale( F(1)/lambda, l21 );
+
+    // Fill in the new row and column (including the other triangle)
+    View( A, LNew, i, 0, 1, i );
+    Adjoint( l10, A );
+    View( A, LNew, 0, i, i, 1 );
+    A = a0;
+    LNew.Set( i, i, lambda );
+    View( A, LNew, i+1, i, nBot, 1 );
+    A = l21;
+    View( A, LNew, i, i+1, 1, nBot );
+    Adjoint( a2, A );
+
+    // L22 L22^H := L22 L22^H - l21 l21^H
+    LowerMod( B, R(-1), l21 );
+    L = LNew;
+}
+
+} // namespace cholesky
+
+// Overwrite the Cholesky factor T of A = T T^H (or T^H T) with that of
+// A + alpha V V^H, where alpha is real and V is overwritten
+template<typename F>
+inline void
+CholeskyMod( UpperOrLower uplo, Matrix<F>& T, BASE(F) alpha, Matrix<F>& V )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyMod");
+    if( T.Height() != T.Width() )
+        throw std::logic_error("T must be square");
+    if( T.Height() != V.Height() )
+        throw std::logic_error("T and V must be the same height");
+#endif
+    if( alpha == BASE(F)(0) )
+        return;
+    if( uplo == LOWER )
+        cholesky::LowerMod( T, alpha, V );
+    else
+    {
+        // U^H U = L L^H, where L = U^H
+        Matrix<F> L;
+        Adjoint( T, L );
+        cholesky::LowerMod( L, alpha, V );
+        Adjoint( L, T );
+    }
+}
+
+template<typename F>
+inline void
+CholeskyMod
+( UpperOrLower uplo, DistMatrix<F>& T, BASE(F) alpha, DistMatrix<F>& V )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyMod");
+    if( T.Grid() != V.Grid() )
+        throw std::logic_error("T and V must share the same grid");
+    if( T.Height() != T.Width() )
+        throw std::logic_error("T must be square");
+    if( T.Height() != V.Height() )
+        throw std::logic_error("T and V must be the same height");
+#endif
+    if( alpha == BASE(F)(0) )
+        return;
+    if( uplo == LOWER )
+        cholesky::LowerMod( T, alpha, V );
+    else
+    {
+        // U^H U = L L^H, where L = U^H
+        DistMatrix<F> L( T.Grid() );
+        Adjoint( T, L );
+        cholesky::LowerMod( L, alpha, V );
+        Adjoint( L, T );
+    }
+}
+
+namespace cholesky {
+
+// Overwrite the Cholesky factor of A with that of A with its i'th row and
+// column removed
+template<typename F>
+inline void
+DeleteRowCol( UpperOrLower uplo, DistMatrix<F>& T, int i )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::DeleteRowCol");
+    if( T.Height() != T.Width() )
+        throw std::logic_error("T must be square");
+    if( i < 0 || i >= T.Height() )
+        throw std::logic_error("Invalid index");
+#endif
+    if( uplo == LOWER )
+        LowerDeleteRowCol( T, i );
+    else
+    {
+        DistMatrix<F> L( T.Grid() );
+        Adjoint( T, L );
+        LowerDeleteRowCol( L, i );
+        T.Empty();
+        Adjoint( L, T );
+    }
+}
+
+// Overwrite the Cholesky factor of A with that of the matrix formed by
+// inserting a new i'th row and column into A, where the new column is a
+// (and the new row is its adjoint)
+template<typename F>
+inline void
+InsertRowCol
+( UpperOrLower uplo, DistMatrix<F>& T, int i, const DistMatrix<F>& a )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::InsertRowCol");
+    if( T.Height() != T.Width() )
+        throw std::logic_error("T must be square");
+    if( i < 0 || i > T.Height() )
+        throw std::logic_error("Invalid index");
+#endif
+    if( uplo == LOWER )
+        LowerInsertRowCol( T, i, a );
+    else
+    {
+        DistMatrix<F> L( T.Grid() );
+        Adjoint( T, L );
+        LowerInsertRowCol( L, i, a );
+        T.Empty();
+        Adjoint( L, T );
+    }
+}
+
+} // namespace cholesky
+} // namespace elem
+
+#endif // ifndef LAPACK_CHOLESKY_MOD_HPP
@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CHOLESKY_OUTOFCORE_HPP
+#define LAPACK_CHOLESKY_OUTOFCORE_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/OutOfCore.hpp"
+
+namespace elem {
+namespace cholesky {
+
+// The updates of LVar2, applied to a panel of columns of A = L L^H
+template<typename F>
+struct OutOfCoreLFunctor
+{
+    void Update( int i, const DistMatrix<F>& S, int j, DistMatrix<F>& T )
+    {
+        const Grid& g = T.Grid();
+        const int n = T.Height();
+        const int width = T.Width();
+        DistMatrix<F> S10(g), S20(g), T11(g), T21(g);
+        LockedView( S10, S, j, 0, width, S.Width() );
+        LockedView( S20, S, j+width, 0, n-j-width, S.Width() );
+        View( T11, T, j, 0, width, width );
+        View( T21, T, j+width, 0, n-j-width, width );
+        Herk( LOWER, NORMAL, F(-1), S10, F(1), T11 );
+        Gemm( NORMAL, ADJOINT, F(-1), S20, S10, F(1), T21 );
+    }
+
+    void Factor( int j, DistMatrix<F>& T )
+    {
+        const Grid& g = T.Grid();
+        const int n = T.Height();
+        const int width = T.Width();
+        DistMatrix<F> T11(g), T21(g);
+        View( T11, T, j, 0, width, width );
+        View( T21, T, j+width, 0, n-j-width, width );
+        Cholesky( LOWER, T11 );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), T11, T21 );
+    }
+};
+
+// The column-oriented updates of A = U^H U, which solve for the blocks of
+// each panel of U from the top down
+template<typename F>
+struct OutOfCoreUFunctor
+{
+    void Update( int i, const DistMatrix<F>& S, int j, DistMatrix<F>& T )
+    {
+        const Grid& g = T.Grid();
+        const int width = S.Width();
+        DistMatrix<F> S01(g), S11(g), T01(g), T11(g);
+        LockedView( S01, S, 0, 0, i, width );
+        LockedView( S11, S, i, 0, width, width );
+        LockedView( T01, T, 0, 0, i, T.Width() );
+        View( T11, T, i, 0, width, T.Width() );
+        Gemm( ADJOINT, NORMAL, F(-1), S01, T01, F(1), T11 );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), S11, T11 );
+    }
+
+    void Factor( int j, DistMatrix<F>& T )
+    {
+        const Grid& g = T.Grid();
+        const int width = T.Width();
+        DistMatrix<F> T01(g), T11(g);
+        LockedView( T01, T, 0, 0, j, width );
+        View( T11, T, j, 0, width, width );
+        Herk( UPPER, ADJOINT, F(-1), T01, F(1), T11 );
+        Cholesky( UPPER, T11 );
+    }
+};
+
+template<typename F>
+inline void
+OutOfCoreL( DiskDistMatrix<F>& A, std::size_t memoryBudget )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::OutOfCoreL");
+#endif
+    OutOfCoreLFunctor<F> functor;
+    ooc::LeftLooking( A, ooc::PanelWidth(A,memoryBudget), functor );
+}
+
+template<typename F>
+inline void
+OutOfCoreU( DiskDistMatrix<F>& A, std::size_t memoryBudget )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::OutOfCoreU");
+#endif
+    OutOfCoreUFunctor<F> functor;
+    ooc::LeftLooking( A, ooc::PanelWidth(A,memoryBudget), functor );
+}
+
+} // namespace cholesky
+} // namespace elem
+
+#endif // ifndef LAPACK_CHOLESKY_OUTOFCORE_HPP
@@ -0,0 +1,290 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CHOLESKY_SELECTEDINVERSE_HPP
+#define LAPACK_CHOLESKY_SELECTEDINVERSE_HPP
+
+#include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level1/Nrm2.hpp"
+#include "elemental/blas-like/level1/SetDiagonal.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/TriangularInverse.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Selected entries of the inverse of an HPD matrix A = L L^H, computed from
+// its Cholesky factor without forming the full inverse. Since
+// inv(A) = inv(L)^H inv(L), entry (i,j) of inv(A) is the inner product of
+// columns i and j of inv(L). These columns vanish above their diagonal, so
+// only the trailing submatrix of inv(L) beginning at min(i,j) is needed, and
+// it is the inverse of the same trailing submatrix of L. The diagonal of the
+// inverse therefore costs a single triangular inversion (n^3/3 flops), and a
+// block of the inverse whose indices are all at least k costs (n-k)^3/3.
+
+namespace elem {
+namespace internal {
+
+// Overwrite X with the inverse of tril(L(k:n-1,k:n-1)), where L is either
+// the lower triangle of A or, if uplo=UPPER, the adjoint of its upper
+// triangle
+template<typename F>
+inline void
+TrailingLowerInverse
+( UpperOrLower uplo, UnitOrNonUnit diag, const Matrix<F>& A, int k,
+  Matrix<F>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::TrailingLowerInverse");
+#endif
+    const int n = A.Height();
+    Matrix<F> ABR;
+    LockedView( ABR, A, k, k, n-k, n-k );
+    if( uplo == LOWER )
+        X = ABR;
+    else
+        Adjoint( ABR, X );
+    MakeTriangular( LOWER, X );
+    TriangularInverse( LOWER, diag, X );
+    if( diag == UNIT )
+        SetDiagonal( X, F(1) );
+}
+
+template<typename F>
+inline void
+TrailingLowerInverse
+( UpperOrLower uplo, UnitOrNonUnit diag, const DistMatrix<F>& A, int k,
+  DistMatrix<F>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::TrailingLowerInverse");
+#endif
+    const int n = A.Height();
+    DistMatrix<F> ABR( A.Grid() );
+    LockedView( ABR, A, k, k, n-k, n-k );
+    if( uplo == LOWER )
+        X = ABR;
+    else
+        Adjoint( ABR, X );
+    MakeTriangular( LOWER, X );
+    TriangularInverse( LOWER, diag, X );
+    if( diag == UNIT )
+        SetDiagonal( X, F(1) );
+}
+
+// Copy the columns inds[t]-offset of X into the columns of XSel
+template<typename F>
+inline void
+GatherColumns
+( const Matrix<F>& X, const std::vector<int>& inds, int offset,
+  Matrix<F>& XSel )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::GatherColumns");
+#endif
+    const int height = X.Height();
+    const int numInds = inds.size();
+    XSel.ResizeTo( height, numInds );
+    for( int t=0; t<numInds; ++t )
+    {
+        const int j = inds[t]-offset;
+        for( int i=0; i<height; ++i )
+            XSel.Set( i, t, X.Get(i,j) );
+    }
+}
+
+// Redundantly form the columns inds[t]-offset of X on every process
+template<typename F>
+inline void
+GatherColumns
+( const DistMatrix<F>& X, const std::vector<int>& inds, int offset,
+  Matrix<F>& XSel )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::GatherColumns");
+#endif
+    const int height = X.Height();
+    const int numInds = inds.size();
+    const int localHeight = X.LocalHeight();
+    const int colShift = X.ColShift();
+    const int rowShift = X.RowShift();
+    const int colStride = X.ColStride();
+    const int rowStride = X.RowStride();
+    Zeros( XSel, height, numInds );
+    for( int t=0; t<numInds; ++t )
+    {
+        const int j = inds[t]-offset;
+        if( j % rowStride == rowShift )
+        {
+            const int jLoc = (j-rowShift) / rowStride;
+            for( int iLoc=0; iLoc<localHeight; ++iLoc )
+                XSel.Set
+                ( colShift+iLoc*colStride, t, X.GetLocal(iLoc,jLoc) );
+        }
+    }
+    mpi::AllReduce
+    ( XSel.Buffer(), height*numInds, mpi::SUM, X.Grid().Comm() );
+}
+
+inline int
+MinSelectedIndex
+( int n, const std::vector<int>& rowInds, const std::vector<int>& colInds )
+{
+    int k = n;
+    for( unsigned t=0; t<rowInds.size(); ++t )
+    {
+#ifndef RELEASE
+        if( rowInds[t] < 0 || rowInds[t] >= n )
+            throw std::logic_error("Row index out of bounds");
+#endif
+        k = std::min( k, rowInds[t] );
+    }
+    for( unsigned t=0; t<colInds.size(); ++t )
+    {
+#ifndef RELEASE
+        if( colInds[t] < 0 || colInds[t] >= n )
+            throw std::logic_error("Column index out of bounds");
+#endif
+        k = std::min( k, colInds[t] );
+    }
+    return k;
+}
+
+} // namespace internal
+
+namespace cholesky {
+
+//
+// Overwrite d with the diagonal of inv(A), where the 'uplo' triangle of A
+// holds the Cholesky factor of an HPD matrix
+//
+
+template<typename F>
+inline void
+InverseDiagonal
+( UpperOrLower uplo, const Matrix<F>& A, Matrix<BASE(F)>& d )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::InverseDiagonal");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    Matrix<F> X, x;
+    internal::TrailingLowerInverse( uplo, NON_UNIT, A, 0, X );
+    d.ResizeTo( n, 1 );
+    for( int j=0; j<n; ++j )
+    {
+        LockedView( x, X, j, j, n-j, 1 );
+        const R gamma = Nrm2( x );
+        d.Set( j, 0, gamma*gamma );
+    }
+}
+
+template<typename F>
+inline void
+InverseDiagonal
+( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& d )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::InverseDiagonal");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F> X( g );
+    internal::TrailingLowerInverse( uplo, NON_UNIT, A, 0, X );
+
+    // Sum the squared moduli of the local entries of each column and then
+    // combine the partial sums within each process column
+    DistMatrix<R,MR,STAR> d_MR_STAR( g );
+    d_MR_STAR.AlignWith( X.DistData() );
+    Zeros( d_MR_STAR, n, 1 );
+    const int localHeight = X.LocalHeight();
+    const int localWidth = X.LocalWidth();
+    R* dBuffer = d_MR_STAR.Buffer();
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        R gamma = 0;
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const F chi = X.GetLocal(iLoc,jLoc);
+            gamma += RealPart(chi)*RealPart(chi) + ImagPart(chi)*ImagPart(chi);
+        }
+        dBuffer[jLoc] = gamma;
+    }
+    mpi::AllReduce( dBuffer, localWidth, mpi::SUM, g.ColComm() );
+    d = d_MR_STAR;
+}
+
+//
+// Form the submatrix inv(A)(rowInds,colInds), where the 'uplo' triangle of A
+// holds the Cholesky factor of an HPD matrix. Any number of diagonal or
+// off-diagonal blocks may be requested at once by concatenating their
+// indices, and only the trailing submatrix of the factor beginning at the
+// smallest requested index is inverted.
+//
+
+template<typename F>
+inline void
+SelectedInverse
+( UpperOrLower uplo, const Matrix<F>& A,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  Matrix<F>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::SelectedInverse");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const int k = internal::MinSelectedIndex( A.Height(), rowInds, colInds );
+    Zeros( Z, rowInds.size(), colInds.size() );
+    if( rowInds.size() == 0 || colInds.size() == 0 )
+        return;
+
+    Matrix<F> X, XRow, XCol;
+    internal::TrailingLowerInverse( uplo, NON_UNIT, A, k, X );
+    internal::GatherColumns( X, rowInds, k, XRow );
+    internal::GatherColumns( X, colInds, k, XCol );
+    Gemm( ADJOINT, NORMAL, F(1), XRow, XCol, F(0), Z );
+}
+
+template<typename F>
+inline void
+SelectedInverse
+( UpperOrLower uplo, const DistMatrix<F>& A,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  DistMatrix<F,STAR,STAR>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::SelectedInverse");
+    if( A.Grid() != Z.Grid() )
+        throw std::logic_error("{A,Z} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const int k = internal::MinSelectedIndex( A.Height(), rowInds, colInds );
+    Zeros( Z, rowInds.size(), colInds.size() );
+    if( rowInds.size() == 0 || colInds.size() == 0 )
+        return;
+
+    DistMatrix<F> X( A.Grid() );
+    Matrix<F> XRow, XCol;
+    internal::TrailingLowerInverse( uplo, NON_UNIT, A, k, X );
+    internal::GatherColumns( X, rowInds, k, XRow );
+    internal::GatherColumns( X, colInds, k, XCol );
+    Gemm( ADJOINT, NORMAL, F(1), XRow, XCol, F(0), Z.Matrix() );
+}
+
+} // namespace cholesky
+} // namespace elem
+
+#endif // ifndef LAPACK_CHOLESKY_SELECTEDINVERSE_HPP
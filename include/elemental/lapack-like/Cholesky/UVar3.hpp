@@ -184,7 +184,7 @@ UVar3( DistMatrix<F>& A )
                          A20(g), A21(g), A22(g);
 
     // Temporary matrix distributions
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    SharedStarStar<F> A11_STAR_STAR(g);
     DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,STAR,MC  > A12_STAR_MC(g);
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
@@ -206,12 +206,19 @@ UVar3( DistMatrix<F>& A )
         A12_STAR_VR.AlignWith( A22 );
         //--------------------------------------------------------------------//
         A11_STAR_STAR = A11;
-        LocalCholesky( UPPER, A11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        try
+        {
+            if( A11_STAR_STAR.NodeLeader() )
+                LocalCholesky( UPPER, A11_STAR_STAR.Replica() );
+        }
+        catch( std::exception& e ) { A11_STAR_STAR.Fail( e ); }
+        A11_STAR_STAR.Synchronize();
+        A11 = A11_STAR_STAR.LockedReplica();
 
         A12_STAR_VR = A12;
         LocalTrsm
-        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR.LockedReplica(),
+          A12_STAR_VR );
 
         A12_STAR_MC = A12_STAR_VR;
         A12_STAR_MR = A12_STAR_VR;
@@ -247,7 +254,7 @@ ReverseUVar3( DistMatrix<F>& A )
                          A20(g), A21(g), A22(g);
 
     // Temporary matrix distributions
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    SharedStarStar<F> A11_STAR_STAR(g);
     DistMatrix<F,VC,  STAR> A01_VC_STAR(g);
     DistMatrix<F,VR,  STAR> A01_VR_STAR(g);
     DistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g);
@@ -271,12 +278,19 @@ ReverseUVar3( DistMatrix<F>& A )
         A01Adj_STAR_MR.AlignWith( A00 );
         //--------------------------------------------------------------------//
         A11_STAR_STAR = A11;
-        LocalReverseCholesky( UPPER, A11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        try
+        {
+            if( A11_STAR_STAR.NodeLeader() )
+                LocalReverseCholesky( UPPER, A11_STAR_STAR.Replica() );
+        }
+        catch( std::exception& e ) { A11_STAR_STAR.Fail( e ); }
+        A11_STAR_STAR.Synchronize();
+        A11 = A11_STAR_STAR.LockedReplica();
 
         A01_VC_STAR = A01;
         LocalTrsm
-        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A01_VC_STAR );
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR.LockedReplica(),
+          A01_VC_STAR );
 
         A01_VR_STAR = A01_VC_STAR; 
         A01Trans_STAR_MC.TransposeFrom( A01_VC_STAR );
@@ -11,6 +11,7 @@
 #define LAPACK_DETERMINANT_HPP
 
 #include "elemental/lapack-like/Determinant/Cholesky.hpp"
+#include "elemental/lapack-like/Determinant/LDL.hpp"
 #include "elemental/lapack-like/Determinant/LUPartialPiv.hpp"
 
 namespace elem {
@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_DETERMINANT_LDL_HPP
+#define LAPACK_DETERMINANT_LDL_HPP
+
+#include "elemental/lapack-like/LDL.hpp"
+
+namespace elem {
+namespace determinant {
+
+// Since the pivots are symmetric interchanges, det(A) = det(D), which is
+// the product of the determinants of the 1x1 and 2x2 diagonal blocks
+template<typename F>
+inline SafeProduct<F>
+AfterLDL
+( Orientation orientation, const Matrix<F>& d, const Matrix<F>& dSub )
+{
+#ifndef RELEASE
+    CallStackEntry entry("determinant::AfterLDL");
+    if( dSub.Height() != std::max(d.Height()-1,0) )
+        throw std::logic_error("dSub must be one entry shorter than d");
+#endif
+    typedef BASE(F) R;
+    const int n = d.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    const R scale(n);
+    SafeProduct<F> det( n );
+    int k=0;
+    while( k < n )
+    {
+        const F b = ( k < n-1 ? dSub.Get(k,0) : F(0) );
+        F delta;
+        if( b == F(0) )
+        {
+            delta = d.Get(k,0);
+            k += 1;
+        }
+        else
+        {
+            const F bAdj = ( conjugate ? Conj(b) : b );
+            delta = d.Get(k,0)*d.Get(k+1,0) - b*bAdj;
+            k += 2;
+        }
+        const R alpha = Abs(delta);
+        if( alpha == R(0) )
+        {
+            det.rho = 0;
+            det.kappa = 0;
+            return det;
+        }
+        det.rho *= delta/alpha;
+        det.kappa += Log(alpha)/scale;
+    }
+    return det;
+}
+
+template<typename F>
+inline SafeProduct<F>
+AfterLDL
+( Orientation orientation,
+  const DistMatrix<F,MC,STAR>& d, const DistMatrix<F,MC,STAR>& dSub )
+{
+#ifndef RELEASE
+    CallStackEntry entry("determinant::AfterLDL");
+#endif
+    DistMatrix<F,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+    return AfterLDL
+    ( orientation, d_STAR_STAR.LockedMatrix(), 
+      dSub_STAR_STAR.LockedMatrix() );
+}
+
+template<typename F>
+inline SafeProduct<F>
+LDL( Orientation orientation, Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("determinant::LDL");
+#endif
+    Matrix<F> d, dSub;
+    Matrix<int> p;
+    ldl::BunchKaufman( orientation, A, d, dSub, p );
+    return determinant::AfterLDL( orientation, d, dSub );
+}
+
+template<typename F>
+inline SafeProduct<F>
+LDL( Orientation orientation, DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("determinant::LDL");
+#endif
+    const Grid& g = A.Grid();
+    DistMatrix<F,MC,STAR> d(g), dSub(g);
+    DistMatrix<int,VC,STAR> p(g);
+    ldl::BunchKaufman( orientation, A, d, dSub, p );
+    return determinant::AfterLDL( orientation, d, dSub );
+}
+
+} // namespace determinant
+} // namespace elem
+
+#endif // ifndef LAPACK_DETERMINANT_LDL_HPP
@@ -0,0 +1,604 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_EXP_HPP
+#define LAPACK_EXP_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Nrm2.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level2/Gemv.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+#include "elemental/lapack-like/Norm/TwoUpperBound.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// The exponential of a general square matrix is computed with the
+// scaling-and-squaring algorithm using the Pade degrees and thresholds of
+// Nicholas J. Higham's "The scaling and squaring method for the matrix
+// exponential revisited", SIAM J. Matrix Anal. Appl., Vol. 26, No. 4, 2005.
+// The only kernels are Gemm and an LU solve, so the distributed version
+// runs at the speed of distributed Gemm.
+//
+// The action exp(t A) V is computed one column at a time from a sequence of
+// Krylov subspaces with step-size control in the spirit of Expokit; see
+// Roger B. Sidje's "Expokit: A software package for computing matrix
+// exponentials", ACM Trans. Math. Softw., Vol. 24, No. 1, 1998.
+
+namespace elem {
+namespace expm {
+
+template<typename F>
+inline void
+ShiftDiagonal( Matrix<F>& A, F alpha )
+{
+    const int n = std::min( A.Height(), A.Width() );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, alpha );
+}
+
+template<typename F>
+inline void
+ShiftDiagonal( DistMatrix<F>& A, F alpha )
+{
+    const int n = std::min( A.Height(), A.Width() );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, alpha );
+}
+
+// The coefficients of the numerator of the [m/m] Pade approximant to exp
+inline const double*
+PadeCoefficients( int m )
+{
+    static const double b3[] = { 120., 60., 12., 1. };
+    static const double b5[] = { 30240., 15120., 3360., 420., 30., 1. };
+    static const double b7[] =
+    { 17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1. };
+    static const double b9[] =
+    { 17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+      2162160., 110880., 3960., 90., 1. };
+    static const double b13[] =
+    { 64764752532480000., 32382376266240000., 7771770303897600.,
+      1187353796428800., 129060195264000., 10559470521600.,
+      670442572800., 33522128640., 1323241920., 40840800., 960960.,
+      16380., 182., 1. };
+    switch( m )
+    {
+    case 3:  return b3;
+    case 5:  return b5;
+    case 7:  return b7;
+    case 9:  return b9;
+    case 13: return b13;
+    default: throw std::logic_error("Invalid Pade degree");
+    }
+}
+
+// Choose the smallest Pade degree m whose backward error bound holds for
+// the given norm, and, if even the largest degree does not suffice, the
+// number of squarings s such that the bound holds for A/2^s
+template<typename R>
+inline void
+PadeDegree( R norm, int& m, int& s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::PadeDegree");
+#endif
+    static const int degrees[] = { 3, 5, 7, 9, 13 };
+    static const double doubleThetas[] =
+    { 1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+      2.097847961257068, 5.371920351148152 };
+    static const double singleThetas[] =
+    { 4.258730016922831e-1, 1.880152677804762, 3.925724783138660 };
+
+    const bool singlePrecision = lapack::MachineEpsilon<R>() > R(1e-10);
+    const double* thetas = ( singlePrecision ? singleThetas : doubleThetas );
+    const int numDegrees = ( singlePrecision ? 3 : 5 );
+
+    s = 0;
+    for( int k=0; k<numDegrees-1; ++k )
+    {
+        if( norm <= R(thetas[k]) )
+        {
+            m = degrees[k];
+            return;
+        }
+    }
+    m = degrees[numDegrees-1];
+    const R theta = thetas[numDegrees-1];
+    if( norm > theta )
+        s = int(std::ceil( Log(norm/theta)/Log(R(2)) ));
+}
+
+// Overwrite A with the [m/m] Pade approximant to exp(A),
+//   r_m(A) = inv(V - U) (V + U),
+// where U and V are the odd and even parts of the numerator polynomial
+template<typename F>
+inline void
+Pade( Matrix<F>& A, int m )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::Pade");
+#endif
+    const int n = A.Height();
+    const double* b = PadeCoefficients( m );
+
+    // Form the even powers of A which are needed
+    Matrix<F> A2, A4, A6, A8;
+    Gemm( NORMAL, NORMAL, F(1), A, A, A2 );
+    if( m >= 5 )
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, A4 );
+    if( m >= 7 )
+        Gemm( NORMAL, NORMAL, F(1), A2, A4, A6 );
+    if( m == 9 )
+        Gemm( NORMAL, NORMAL, F(1), A4, A4, A8 );
+
+    // Form W and V such that U = A W
+    Matrix<F> W, V;
+    if( m < 13 )
+    {
+        const Matrix<F>* powers[] = { 0, &A2, &A4, &A6, &A8 };
+        Zeros( W, n, n );
+        Zeros( V, n, n );
+        for( int k=1; k<=m/2; ++k )
+        {
+            Axpy( F(b[2*k+1]), *powers[k], W );
+            Axpy( F(b[2*k]), *powers[k], V );
+        }
+    }
+    else
+    {
+        // W := A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2
+        Matrix<F> Y( A6 );
+        Scale( F(b[13]), Y );
+        Axpy( F(b[11]), A4, Y );
+        Axpy( F(b[9]), A2, Y );
+        Gemm( NORMAL, NORMAL, F(1), A6, Y, W );
+        Axpy( F(b[7]), A6, W );
+        Axpy( F(b[5]), A4, W );
+        Axpy( F(b[3]), A2, W );
+
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2
+        Y = A6;
+        Scale( F(b[12]), Y );
+        Axpy( F(b[10]), A4, Y );
+        Axpy( F(b[8]), A2, Y );
+        Gemm( NORMAL, NORMAL, F(1), A6, Y, V );
+        Axpy( F(b[6]), A6, V );
+        Axpy( F(b[4]), A4, V );
+        Axpy( F(b[2]), A2, V );
+    }
+    ShiftDiagonal( W, F(b[1]) );
+    ShiftDiagonal( V, F(b[0]) );
+    Matrix<F> U;
+    Gemm( NORMAL, NORMAL, F(1), A, W, U );
+
+    // Solve (V - U) X = (V + U)
+    W = V;
+    Axpy( F(-1), U, W );
+    Axpy( F(1), U, V );
+    Matrix<int> p;
+    LU( W, p );
+    lu::SolveAfter( NORMAL, W, p, V );
+    A = V;
+}
+
+template<typename F>
+inline void
+Pade( DistMatrix<F>& A, int m )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::Pade");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const double* b = PadeCoefficients( m );
+
+    // Form the even powers of A which are needed
+    DistMatrix<F> A2(g), A4(g), A6(g), A8(g);
+    Gemm( NORMAL, NORMAL, F(1), A, A, A2 );
+    if( m >= 5 )
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, A4 );
+    if( m >= 7 )
+        Gemm( NORMAL, NORMAL, F(1), A2, A4, A6 );
+    if( m == 9 )
+        Gemm( NORMAL, NORMAL, F(1), A4, A4, A8 );
+
+    // Form W and V such that U = A W
+    DistMatrix<F> W(g), V(g);
+    if( m < 13 )
+    {
+        const DistMatrix<F>* powers[] = { 0, &A2, &A4, &A6, &A8 };
+        Zeros( W, n, n );
+        Zeros( V, n, n );
+        for( int k=1; k<=m/2; ++k )
+        {
+            Axpy( F(b[2*k+1]), *powers[k], W );
+            Axpy( F(b[2*k]), *powers[k], V );
+        }
+    }
+    else
+    {
+        // W := A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2
+        DistMatrix<F> Y( A6 );
+        Scale( F(b[13]), Y );
+        Axpy( F(b[11]), A4, Y );
+        Axpy( F(b[9]), A2, Y );
+        Gemm( NORMAL, NORMAL, F(1), A6, Y, W );
+        Axpy( F(b[7]), A6, W );
+        Axpy( F(b[5]), A4, W );
+        Axpy( F(b[3]), A2, W );
+
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2
+        Y = A6;
+        Scale( F(b[12]), Y );
+        Axpy( F(b[10]), A4, Y );
+        Axpy( F(b[8]), A2, Y );
+        Gemm( NORMAL, NORMAL, F(1), A6, Y, V );
+        Axpy( F(b[6]), A6, V );
+        Axpy( F(b[4]), A4, V );
+        Axpy( F(b[2]), A2, V );
+    }
+    ShiftDiagonal( W, F(b[1]) );
+    ShiftDiagonal( V, F(b[0]) );
+    DistMatrix<F> U(g);
+    Gemm( NORMAL, NORMAL, F(1), A, W, U );
+
+    // Solve (V - U) X = (V + U)
+    W = V;
+    Axpy( F(-1), U, W );
+    Axpy( F(1), U, V );
+    DistMatrix<int,VC,STAR> p(g);
+    LU( W, p );
+    lu::SolveAfter( NORMAL, W, p, V );
+    A = V;
+}
+
+template<typename F>
+inline void
+Square( Matrix<F>& A, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::Square");
+#endif
+    Matrix<F> B;
+    for( int k=0; k<s; ++k )
+    {
+        Gemm( NORMAL, NORMAL, F(1), A, A, B );
+        A = B;
+    }
+}
+
+template<typename F>
+inline void
+Square( DistMatrix<F>& A, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::Square");
+#endif
+    DistMatrix<F> B( A.Grid() );
+    for( int k=0; k<s; ++k )
+    {
+        Gemm( NORMAL, NORMAL, F(1), A, A, B );
+        A = B;
+    }
+}
+
+// Run Arnoldi with classical Gram-Schmidt and one step of
+// reorthogonalization, starting from the normalized first column of Q.
+// The (m+1) x m upper Hessenberg matrix is accumulated into H, and the
+// number of steps, m, is returned. If the new direction is negligible, the
+// Krylov subspace is invariant and 'happy' is set.
+template<typename F>
+inline int
+Arnoldi
+( const Matrix<F>& A, Matrix<F>& Q, Matrix<F>& H, int maxDim,
+  BASE(F) breakdownTol, bool& happy )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::Arnoldi");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    Matrix<F> q, qNext, QPrev, h;
+    happy = false;
+    for( int j=0; j<maxDim; ++j )
+    {
+        LockedView( q, Q, 0, j, n, 1 );
+        View( qNext, Q, 0, j+1, n, 1 );
+        LockedView( QPrev, Q, 0, 0, n, j+1 );
+        Gemv( NORMAL, F(1), A, q, F(0), qNext );
+        for( int pass=0; pass<2; ++pass )
+        {
+            Gemv( ADJOINT, F(1), QPrev, qNext, h );
+            Gemv( NORMAL, F(-1), QPrev, h, F(1), qNext );
+            for( int i=0; i<=j; ++i )
+                H.Update( i, j, h.Get(i,0) );
+        }
+        const R hNext = Nrm2( qNext );
+        H.Set( j+1, j, hNext );
+        if( hNext <= breakdownTol )
+        {
+            happy = true;
+            return j+1;
+        }
+        Scale( F(1)/hNext, qNext );
+    }
+    return maxDim;
+}
+
+template<typename F>
+inline int
+Arnoldi
+( const DistMatrix<F>& A, DistMatrix<F>& Q, Matrix<F>& H, int maxDim,
+  BASE(F) breakdownTol, bool& happy )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::Arnoldi");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F> q(g), qNext(g), QPrev(g), h(g);
+    DistMatrix<F,STAR,STAR> h_STAR_STAR(g);
+    happy = false;
+    for( int j=0; j<maxDim; ++j )
+    {
+        LockedView( q, Q, 0, j, n, 1 );
+        View( qNext, Q, 0, j+1, n, 1 );
+        LockedView( QPrev, Q, 0, 0, n, j+1 );
+        Gemv( NORMAL, F(1), A, q, F(0), qNext );
+        for( int pass=0; pass<2; ++pass )
+        {
+            h.Empty();
+            Gemv( ADJOINT, F(1), QPrev, qNext, h );
+            Gemv( NORMAL, F(-1), QPrev, h, F(1), qNext );
+            h_STAR_STAR = h;
+            for( int i=0; i<=j; ++i )
+                H.Update( i, j, h_STAR_STAR.GetLocal(i,0) );
+        }
+        const R hNext = Nrm2( qNext );
+        H.Set( j+1, j, hNext );
+        if( hNext <= breakdownTol )
+        {
+            happy = true;
+            return j+1;
+        }
+        Scale( F(1)/hNext, qNext );
+    }
+    return maxDim;
+}
+
+// Given the (m+1) x m Hessenberg matrix from Arnoldi, set y := exp(tau H_m) e1
+// and return Saad's estimate, |tau h_{m+1,m} e_m^T phi_1(tau H_m) e1|, of the
+// error relative to the norm of the starting vector. Both exp(tau H_m) e1
+// and phi_1(tau H_m) e1 are read off of the exponential of the augmented
+// matrix [tau H_m, e1; 0, 0].
+template<typename F>
+inline BASE(F)
+KrylovStep( const Matrix<F>& H, int m, BASE(F) tau, Matrix<F>& y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("expm::KrylovStep");
+#endif
+    Matrix<F> E;
+    Zeros( E, m+1, m+1 );
+    for( int j=0; j<m; ++j )
+        for( int i=0; i<=std::min(j+1,m-1); ++i )
+            E.Set( i, j, tau*H.Get(i,j) );
+    E.Set( 0, m, F(1) );
+    Exp( E );
+
+    y.ResizeTo( m, 1 );
+    for( int i=0; i<m; ++i )
+        y.Set( i, 0, E.Get(i,0) );
+    return Abs(tau*H.Get(m,m-1)*E.Get(m-1,m));
+}
+
+} // namespace expm
+
+template<typename F>
+inline void
+Exp( Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Exp");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Can only exponentiate square matrices");
+    typedef BASE(F) R;
+    const R norm = std::min( OneNorm( A ), TwoNormUpperBound( A ) );
+    int m, s;
+    expm::PadeDegree( norm, m, s );
+    if( s > 0 )
+        Scale( F(Pow(R(2),R(-s))), A );
+    expm::Pade( A, m );
+    expm::Square( A, s );
+}
+
+template<typename F>
+inline void
+Exp( DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Exp");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Can only exponentiate square matrices");
+    typedef BASE(F) R;
+    const R norm = std::min( OneNorm( A ), TwoNormUpperBound( A ) );
+    int m, s;
+    expm::PadeDegree( norm, m, s );
+    if( s > 0 )
+        Scale( F(Pow(R(2),R(-s))), A );
+    expm::Pade( A, m );
+    expm::Square( A, s );
+}
+
+//
+// Overwrite each column v of V with exp(t A) v using Krylov subspaces of
+// dimension at most krylovDim. The time steps are chosen so that the
+// estimated error of each is at most tol times its share of |t| ||v||_2.
+// A tolerance of zero is replaced with eps^(3/4).
+//
+
+template<typename F>
+inline void
+ExpAction
+( const Matrix<F>& A, Matrix<F>& V, BASE(F) t=1, int krylovDim=30,
+  BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ExpAction");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != V.Height() )
+        throw std::logic_error("A and V must have the same height");
+    if( krylovDim < 1 )
+        throw std::logic_error("Krylov dimension must be positive");
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+    if( tol == R(0) )
+        tol = Sqrt(eps)*Sqrt(Sqrt(eps));
+    const R breakdownTol = OneNorm( A )*eps;
+    const R sign = ( t < R(0) ? R(-1) : R(1) );
+    const R tEnd = Abs(t);
+    krylovDim = std::min( krylovDim, n );
+
+    Matrix<F> H, Q, QActive, y, v, q;
+    for( int j=0; j<V.Width(); ++j )
+    {
+        View( v, V, 0, j, n, 1 );
+        const R vNorm = Nrm2( v );
+        if( vNorm == R(0) )
+            continue;
+
+        R tNow = 0, tau = tEnd;
+        while( tNow < tEnd )
+        {
+            const R beta = Nrm2( v );
+            Zeros( Q, n, krylovDim+1 );
+            View( q, Q, 0, 0, n, 1 );
+            q = v;
+            Scale( F(1)/beta, q );
+            Zeros( H, krylovDim+1, krylovDim );
+            bool happy;
+            const int m =
+                expm::Arnoldi( A, Q, H, krylovDim, breakdownTol, happy );
+
+            // Halve the step until the error estimate is acceptable
+            tau = ( happy ? tEnd-tNow : std::min( tau, tEnd-tNow ) );
+            R error;
+            while( true )
+            {
+                error = beta*expm::KrylovStep( H, m, sign*tau, y );
+                if( happy || error <= tol*vNorm*tau/tEnd )
+                    break;
+                tau /= 2;
+                if( tau <= eps*tEnd )
+                    throw std::runtime_error("ExpAction time step underflow");
+            }
+
+            // v := beta Q_m y
+            LockedView( QActive, Q, 0, 0, n, m );
+            Gemv( NORMAL, F(beta), QActive, y, F(0), v );
+            tNow += tau;
+
+            // Cautiously lengthen the next step if this one was very accurate
+            if( error <= tol*vNorm*tau/(2*tEnd) )
+                tau *= 2;
+        }
+    }
+}
+
+template<typename F>
+inline void
+ExpAction
+( const DistMatrix<F>& A, DistMatrix<F>& V, BASE(F) t=1, int krylovDim=30,
+  BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ExpAction");
+#endif
+    if( A.Grid() != V.Grid() )
+        throw std::logic_error("A and V must use the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != V.Height() )
+        throw std::logic_error("A and V must have the same height");
+    if( krylovDim < 1 )
+        throw std::logic_error("Krylov dimension must be positive");
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+    if( tol == R(0) )
+        tol = Sqrt(eps)*Sqrt(Sqrt(eps));
+    const R breakdownTol = OneNorm( A )*eps;
+    const R sign = ( t < R(0) ? R(-1) : R(1) );
+    const R tEnd = Abs(t);
+    krylovDim = std::min( krylovDim, n );
+
+    Matrix<F> H, y;
+    DistMatrix<F> Q(g), QActive(g), v(g), q(g), yDist(g);
+    DistMatrix<F,STAR,STAR> y_STAR_STAR(g);
+    for( int j=0; j<V.Width(); ++j )
+    {
+        View( v, V, 0, j, n, 1 );
+        const R vNorm = Nrm2( v );
+        if( vNorm == R(0) )
+            continue;
+
+        R tNow = 0, tau = tEnd;
+        while( tNow < tEnd )
+        {
+            const R beta = Nrm2( v );
+            Zeros( Q, n, krylovDim+1 );
+            View( q, Q, 0, 0, n, 1 );
+            q = v;
+            Scale( F(1)/beta, q );
+            Zeros( H, krylovDim+1, krylovDim );
+            bool happy;
+            const int m =
+                expm::Arnoldi( A, Q, H, krylovDim, breakdownTol, happy );
+
+            // Halve the step until the error estimate is acceptable
+            tau = ( happy ? tEnd-tNow : std::min( tau, tEnd-tNow ) );
+            R error;
+            while( true )
+            {
+                error = beta*expm::KrylovStep( H, m, sign*tau, y );
+                if( happy || error <= tol*vNorm*tau/tEnd )
+                    break;
+                tau /= 2;
+                if( tau <= eps*tEnd )
+                    throw std::runtime_error("ExpAction time step underflow");
+            }
+
+            // v := beta Q_m y
+            y_STAR_STAR.ResizeTo( m, 1 );
+            for( int i=0; i<m; ++i )
+                y_STAR_STAR.SetLocal( i, 0, y.Get(i,0) );
+            yDist = y_STAR_STAR;
+            LockedView( QActive, Q, 0, 0, n, m );
+            Gemv( NORMAL, F(beta), QActive, yDist, F(0), v );
+            tNow += tau;
+
+            // Cautiously lengthen the next step if this one was very accurate
+            if( error <= tol*vNorm*tau/(2*tEnd) )
+                tau *= 2;
+        }
+    }
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_EXP_HPP
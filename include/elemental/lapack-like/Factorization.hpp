@@ -0,0 +1,823 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_FACTORIZATION_HPP
+#define LAPACK_FACTORIZATION_HPP
+
+#include "elemental/blas-like/level1/Conjugate.hpp"
+#include "elemental/blas-like/level1/Zero.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/ApplyRowPivots.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/ComposePivots.hpp"
+#include "elemental/lapack-like/Determinant/Cholesky.hpp"
+#include "elemental/lapack-like/Determinant/LDL.hpp"
+#include "elemental/lapack-like/Determinant/LUPartialPiv.hpp"
+#include "elemental/lapack-like/LDL.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/QR.hpp"
+
+// Handles for factorizations which are reused across many solves. Each
+// handle owns a copy of the factored matrix, the composed form of its
+// pivots, and the redistributed data that would otherwise be recomputed by
+// every call to the corresponding SolveAfter routine. Right-hand sides which
+// are not distributed as [MC,MR] are solved within a temporary copy which is
+// aligned with the factors, so that solves never modify the handle.
+//
+// Solve overwrites B with inv(A) B and SolveAdjoint overwrites B with
+// inv(A^H) B. LogDet returns det(A) in the form rho exp(kappa n) (see
+// SafeProduct), so that log|det(A)| = kappa n. Update refactors a new
+// matrix of the same size within the existing storage.
+
+namespace elem {
+
+//----------------------------------------------------------------------------//
+// Cholesky: A = L L^H or A = U^H U                                           //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+class CholeskyFactor
+{
+public:
+    CholeskyFactor( const elem::Grid& g=DefaultGrid() );
+    CholeskyFactor( UpperOrLower uplo, const DistMatrix<F>& A );
+
+    void Factor( UpperOrLower uplo, const DistMatrix<F>& A );
+    void Update( const DistMatrix<F>& A );
+    // Refactor A + alpha V V^H in O(n^2 k) work; V is overwritten
+    void Mod( BASE(F) alpha, DistMatrix<F>& V );
+
+    void Solve( DistMatrix<F>& B ) const;
+    template<Distribution U,Distribution V>
+    void Solve( DistMatrix<F,U,V>& B ) const;
+    void SolveAdjoint( DistMatrix<F>& B ) const;
+    template<Distribution U,Distribution V>
+    void SolveAdjoint( DistMatrix<F,U,V>& B ) const;
+
+    SafeProduct<F> LogDet() const;
+
+    UpperOrLower Uplo() const;
+    int Height() const;
+    const elem::Grid& Grid() const;
+    const DistMatrix<F>& Factors() const;
+
+private:
+    UpperOrLower uplo_;
+    bool factored_;
+    DistMatrix<F> A_;
+};
+
+//----------------------------------------------------------------------------//
+// LU with partial pivoting: P A = L U                                        //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+class LUFactor
+{
+public:
+    LUFactor( const elem::Grid& g=DefaultGrid() );
+    LUFactor( const DistMatrix<F>& A );
+
+    void Factor( const DistMatrix<F>& A );
+    void Update( const DistMatrix<F>& A );
+
+    void Solve( DistMatrix<F>& B ) const;
+    template<Distribution U,Distribution V>
+    void Solve( DistMatrix<F,U,V>& B ) const;
+    void SolveAdjoint( DistMatrix<F>& B ) const;
+    template<Distribution U,Distribution V>
+    void SolveAdjoint( DistMatrix<F,U,V>& B ) const;
+
+    SafeProduct<F> LogDet() const;
+
+    int Height() const;
+    const elem::Grid& Grid() const;
+    const DistMatrix<F>& Factors() const;
+    const DistMatrix<int,VC,STAR>& Pivots() const;
+
+private:
+    bool factored_;
+    DistMatrix<F> A_;
+    DistMatrix<int,VC,STAR> p_;
+    std::vector<int> image_, preimage_;
+};
+
+//----------------------------------------------------------------------------//
+// Householder QR of a matrix with at least as many rows as columns, A = Q R //
+//----------------------------------------------------------------------------//
+
+// Solve(B,X) overwrites X with the least-squares solution of A X = B, and
+// SolveAdjoint(B,X) overwrites X with the minimum-norm solution of A^H X = B.
+// The determinant is only defined for square matrices.
+template<typename F>
+class QRFactor
+{
+public:
+    QRFactor( const elem::Grid& g=DefaultGrid() );
+    QRFactor( const DistMatrix<F>& A );
+
+    void Factor( const DistMatrix<F>& A );
+    void Update( const DistMatrix<F>& A );
+
+    void Solve( const DistMatrix<F>& B, DistMatrix<F>& X ) const;
+    void SolveAdjoint( const DistMatrix<F>& B, DistMatrix<F>& X ) const;
+
+    SafeProduct<F> LogDet() const;
+
+    int Height() const;
+    int Width() const;
+    const elem::Grid& Grid() const;
+    const DistMatrix<F>& Factors() const;
+    const DistMatrix<F,MD,STAR>& Scalars() const;
+
+private:
+    bool factored_;
+    DistMatrix<F> A_;
+    DistMatrix<F,MD,STAR> t_;
+    DistMatrix<F,STAR,STAR> t_STAR_STAR_;
+};
+
+//----------------------------------------------------------------------------//
+// Bunch-Kaufman LDL: P A P^T = L D L^T or L D L^H                            //
+//----------------------------------------------------------------------------//
+
+// The orientation is ADJOINT for Hermitian matrices and TRANSPOSE for
+// complex symmetric matrices
+template<typename F>
+class LDLFactor
+{
+public:
+    LDLFactor( const elem::Grid& g=DefaultGrid() );
+    LDLFactor( Orientation orientation, const DistMatrix<F>& A );
+
+    void Factor( Orientation orientation, const DistMatrix<F>& A );
+    void Update( const DistMatrix<F>& A );
+
+    void Solve( DistMatrix<F>& B ) const;
+    template<Distribution U,Distribution V>
+    void Solve( DistMatrix<F,U,V>& B ) const;
+    void SolveAdjoint( DistMatrix<F>& B ) const;
+    template<Distribution U,Distribution V>
+    void SolveAdjoint( DistMatrix<F,U,V>& B ) const;
+
+    SafeProduct<F> LogDet() const;
+    InertiaType<int> Inertia() const;
+
+    Orientation Orient() const;
+    int Height() const;
+    const elem::Grid& Grid() const;
+    const DistMatrix<F>& Factors() const;
+
+private:
+    Orientation orientation_;
+    bool factored_;
+    DistMatrix<F> A_;
+    DistMatrix<F,MC,STAR> d_, dSub_;
+    DistMatrix<int,VC,STAR> p_;
+    DistMatrix<F,STAR,STAR> d_STAR_STAR_, dSub_STAR_STAR_;
+    std::vector<int> image_, preimage_;
+};
+
+namespace factor {
+
+inline void
+AssertFactored( bool factored )
+{
+    if( !factored )
+        throw std::logic_error("The matrix has not been factored");
+}
+
+template<typename F>
+inline void
+AssertConforms( const DistMatrix<F>& A, int height )
+{
+    if( A.Height() != height )
+        throw std::logic_error("The right-hand sides do not conform");
+}
+
+} // namespace factor
+
+//----------------------------------------------------------------------------//
+// CholeskyFactor                                                             //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline
+CholeskyFactor<F>::CholeskyFactor( const elem::Grid& g )
+: uplo_(LOWER), factored_(false), A_(g)
+{ }
+
+template<typename F>
+inline
+CholeskyFactor<F>::CholeskyFactor( UpperOrLower uplo, const DistMatrix<F>& A )
+: uplo_(uplo), factored_(false), A_(A.Grid())
+{ Factor( uplo, A ); }
+
+template<typename F>
+inline void
+CholeskyFactor<F>::Factor( UpperOrLower uplo, const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyFactor::Factor");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Grid() != A_.Grid() )
+        throw std::logic_error("A must be distributed over the same grid");
+#endif
+    uplo_ = uplo;
+    factored_ = false;
+    A_ = A;
+    Cholesky( uplo_, A_ );
+    factored_ = true;
+}
+
+template<typename F>
+inline void
+CholeskyFactor<F>::Update( const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyFactor::Update");
+    if( A.Height() != A_.Height() || A.Width() != A_.Width() )
+        throw std::logic_error("A must be the same size as the factors");
+#endif
+    Factor( uplo_, A );
+}
+
+template<typename F>
+inline void
+CholeskyFactor<F>::Mod( BASE(F) alpha, DistMatrix<F>& V )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyFactor::Mod");
+    factor::AssertFactored( factored_ );
+#endif
+    CholeskyMod( uplo_, A_, alpha, V );
+}
+
+template<typename F>
+inline void
+CholeskyFactor<F>::Solve( DistMatrix<F>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyFactor::Solve");
+    factor::AssertConforms( B, A_.Height() );
+#endif
+    factor::AssertFactored( factored_ );
+    cholesky::SolveAfter( uplo_, NORMAL, A_, B );
+}
+
+template<typename F>
+template<Distribution U,Distribution V>
+inline void
+CholeskyFactor<F>::Solve( DistMatrix<F,U,V>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyFactor::Solve");
+#endif
+    DistMatrix<F> BAligned( A_.Grid() );
+    BAligned.AlignWith( A_ );
+    BAligned = B;
+    Solve( BAligned );
+    B = BAligned;
+}
+
+// Since A is Hermitian, inv(A^H) B = inv(A) B
+template<typename F>
+inline void
+CholeskyFactor<F>::SolveAdjoint( DistMatrix<F>& B ) const
+{ Solve( B ); }
+
+template<typename F>
+template<Distribution U,Distribution V>
+inline void
+CholeskyFactor<F>::SolveAdjoint( DistMatrix<F,U,V>& B ) const
+{ Solve( B ); }
+
+template<typename F>
+inline SafeProduct<F>
+CholeskyFactor<F>::LogDet() const
+{
+#ifndef RELEASE
+    CallStackEntry entry("CholeskyFactor::LogDet");
+#endif
+    factor::AssertFactored( factored_ );
+    return hpd_determinant::AfterCholesky( uplo_, A_ );
+}
+
+template<typename F>
+inline UpperOrLower
+CholeskyFactor<F>::Uplo() const
+{ return uplo_; }
+
+template<typename F>
+inline int
+CholeskyFactor<F>::Height() const
+{ return A_.Height(); }
+
+template<typename F>
+inline const elem::Grid&
+CholeskyFactor<F>::Grid() const
+{ return A_.Grid(); }
+
+template<typename F>
+inline const DistMatrix<F>&
+CholeskyFactor<F>::Factors() const
+{ return A_; }
+
+//----------------------------------------------------------------------------//
+// LUFactor                                                                   //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline
+LUFactor<F>::LUFactor( const elem::Grid& g )
+: factored_(false), A_(g), p_(g)
+{ }
+
+template<typename F>
+inline
+LUFactor<F>::LUFactor( const DistMatrix<F>& A )
+: factored_(false), A_(A.Grid()), p_(A.Grid())
+{ Factor( A ); }
+
+template<typename F>
+inline void
+LUFactor<F>::Factor( const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUFactor::Factor");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Grid() != A_.Grid() )
+        throw std::logic_error("A must be distributed over the same grid");
+#endif
+    factored_ = false;
+    A_ = A;
+    LU( A_, p_ );
+
+    // Compose the pivots once rather than during every solve
+    DistMatrix<int,STAR,STAR> p_STAR_STAR( p_ );
+    ComposePivots( p_STAR_STAR, image_, preimage_ );
+    factored_ = true;
+}
+
+template<typename F>
+inline void
+LUFactor<F>::Update( const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUFactor::Update");
+    if( A.Height() != A_.Height() || A.Width() != A_.Width() )
+        throw std::logic_error("A must be the same size as the factors");
+#endif
+    Factor( A );
+}
+
+template<typename F>
+inline void
+LUFactor<F>::Solve( DistMatrix<F>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUFactor::Solve");
+    factor::AssertConforms( B, A_.Height() );
+#endif
+    factor::AssertFactored( factored_ );
+    ApplyRowPivots( B, image_, preimage_ );
+    lu::SolveAfter( NORMAL, A_, B );
+}
+
+template<typename F>
+template<Distribution U,Distribution V>
+inline void
+LUFactor<F>::Solve( DistMatrix<F,U,V>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUFactor::Solve");
+#endif
+    DistMatrix<F> BAligned( A_.Grid() );
+    BAligned.AlignWith( A_ );
+    BAligned = B;
+    Solve( BAligned );
+    B = BAligned;
+}
+
+template<typename F>
+inline void
+LUFactor<F>::SolveAdjoint( DistMatrix<F>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUFactor::SolveAdjoint");
+    factor::AssertConforms( B, A_.Height() );
+#endif
+    factor::AssertFactored( factored_ );
+    lu::SolveAfter( ADJOINT, A_, B );
+    ApplyRowPivots( B, preimage_, image_ );
+}
+
+template<typename F>
+template<Distribution U,Distribution V>
+inline void
+LUFactor<F>::SolveAdjoint( DistMatrix<F,U,V>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUFactor::SolveAdjoint");
+#endif
+    DistMatrix<F> BAligned( A_.Grid() );
+    BAligned.AlignWith( A_ );
+    BAligned = B;
+    SolveAdjoint( BAligned );
+    B = BAligned;
+}
+
+template<typename F>
+inline SafeProduct<F>
+LUFactor<F>::LogDet() const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUFactor::LogDet");
+#endif
+    factor::AssertFactored( factored_ );
+    return determinant::AfterLUPartialPiv( A_, p_ );
+}
+
+template<typename F>
+inline int
+LUFactor<F>::Height() const
+{ return A_.Height(); }
+
+template<typename F>
+inline const elem::Grid&
+LUFactor<F>::Grid() const
+{ return A_.Grid(); }
+
+template<typename F>
+inline const DistMatrix<F>&
+LUFactor<F>::Factors() const
+{ return A_; }
+
+template<typename F>
+inline const DistMatrix<int,VC,STAR>&
+LUFactor<F>::Pivots() const
+{ return p_; }
+
+//----------------------------------------------------------------------------//
+// QRFactor                                                                   //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline
+QRFactor<F>::QRFactor( const elem::Grid& g )
+: factored_(false), A_(g), t_(g), t_STAR_STAR_(g)
+{ }
+
+template<typename F>
+inline
+QRFactor<F>::QRFactor( const DistMatrix<F>& A )
+: factored_(false), A_(A.Grid()), t_(A.Grid()), t_STAR_STAR_(A.Grid())
+{ Factor( A ); }
+
+template<typename F>
+inline void
+QRFactor<F>::Factor( const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("QRFactor::Factor");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A cannot be wider than it is tall");
+    if( A.Grid() != A_.Grid() )
+        throw std::logic_error("A must be distributed over the same grid");
+#endif
+    factored_ = false;
+    A_ = A;
+    QR( A_, t_ );
+    t_STAR_STAR_ = t_;
+    factored_ = true;
+}
+
+template<typename F>
+inline void
+QRFactor<F>::Update( const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("QRFactor::Update");
+    if( A.Height() != A_.Height() || A.Width() != A_.Width() )
+        throw std::logic_error("A must be the same size as the factors");
+#endif
+    Factor( A );
+}
+
+template<typename F>
+inline void
+QRFactor<F>::Solve( const DistMatrix<F>& B, DistMatrix<F>& X ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("QRFactor::Solve");
+    factor::AssertConforms( B, A_.Height() );
+#endif
+    factor::AssertFactored( factored_ );
+    const elem::Grid& g = A_.Grid();
+    const int n = A_.Width();
+
+    // X := R \ (Q^H B)(0:n-1,:)
+    X = B;
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, A_, t_, X );
+    X.ResizeTo( n, X.Width() );
+    DistMatrix<F> AT(g);
+    LockedView( AT, A_, 0, 0, n, n );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), AT, X, true );
+}
+
+template<typename F>
+inline void
+QRFactor<F>::SolveAdjoint( const DistMatrix<F>& B, DistMatrix<F>& X ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("QRFactor::SolveAdjoint");
+    factor::AssertConforms( B, A_.Width() );
+#endif
+    factor::AssertFactored( factored_ );
+    const elem::Grid& g = A_.Grid();
+    const int m = A_.Height();
+    const int n = A_.Width();
+
+    // X := Q [R^{-H} B; 0]
+    X.ResizeTo( m, B.Width() );
+    DistMatrix<F> XT(g),
+                  XB(g);
+    PartitionDown( X, XT,
+                      XB, n );
+    XT = B;
+    Zero( XB );
+    DistMatrix<F> AT(g);
+    LockedView( AT, A_, 0, 0, n, n );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), AT, XT, true );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, A_, t_, X );
+}
+
+// Each Householder reflector, I - tau [1; v] [1, v^H], has determinant
+// -tau/conj(tau), and A is the product of the reflectors and R
+template<typename F>
+inline SafeProduct<F>
+QRFactor<F>::LogDet() const
+{
+#ifndef RELEASE
+    CallStackEntry entry("QRFactor::LogDet");
+#endif
+    typedef BASE(F) R;
+    factor::AssertFactored( factored_ );
+    if( A_.Height() != A_.Width() )
+        throw std::logic_error("The determinant requires a square matrix");
+    const int n = A_.Height();
+    const elem::Grid& g = A_.Grid();
+
+    DistMatrix<F,MD,STAR> d(g);
+    A_.GetDiagonal( d );
+    F localRho = 1;
+    R localKappa = 0;
+    if( d.Participating() )
+    {
+        const R scale(n);
+        const int nLocalDiag = d.LocalHeight();
+        for( int iLoc=0; iLoc<nLocalDiag; ++iLoc )
+        {
+            const F delta = d.GetLocal(iLoc,0);
+            const R alpha = Abs(delta);
+            if( alpha == R(0) )
+            {
+                localRho = 0;
+                continue;
+            }
+            localRho *= delta/alpha;
+            localKappa += Log(alpha)/scale;
+        }
+    }
+    SafeProduct<F> det( n );
+    mpi::AllReduce( &localRho, &det.rho, 1, mpi::PROD, g.VCComm() );
+    mpi::AllReduce( &localKappa, &det.kappa, 1, mpi::SUM, g.VCComm() );
+    if( det.rho == F(0) )
+    {
+        det.kappa = 0;
+        return det;
+    }
+    for( int k=0; k<t_STAR_STAR_.Height(); ++k )
+    {
+        const F tau = t_STAR_STAR_.GetLocal(k,0);
+        if( tau != F(0) )
+            det.rho *= -tau/Conj(tau);
+    }
+    return det;
+}
+
+template<typename F>
+inline int
+QRFactor<F>::Height() const
+{ return A_.Height(); }
+
+template<typename F>
+inline int
+QRFactor<F>::Width() const
+{ return A_.Width(); }
+
+template<typename F>
+inline const elem::Grid&
+QRFactor<F>::Grid() const
+{ return A_.Grid(); }
+
+template<typename F>
+inline const DistMatrix<F>&
+QRFactor<F>::Factors() const
+{ return A_; }
+
+template<typename F>
+inline const DistMatrix<F,MD,STAR>&
+QRFactor<F>::Scalars() const
+{ return t_; }
+
+//----------------------------------------------------------------------------//
+// LDLFactor                                                                  //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline
+LDLFactor<F>::LDLFactor( const elem::Grid& g )
+: orientation_(ADJOINT), factored_(false), A_(g), d_(g), dSub_(g), p_(g),
+  d_STAR_STAR_(g), dSub_STAR_STAR_(g)
+{ }
+
+template<typename F>
+inline
+LDLFactor<F>::LDLFactor( Orientation orientation, const DistMatrix<F>& A )
+: orientation_(orientation), factored_(false), A_(A.Grid()), d_(A.Grid()),
+  dSub_(A.Grid()), p_(A.Grid()), d_STAR_STAR_(A.Grid()),
+  dSub_STAR_STAR_(A.Grid())
+{ Factor( orientation, A ); }
+
+template<typename F>
+inline void
+LDLFactor<F>::Factor( Orientation orientation, const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::Factor");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Grid() != A_.Grid() )
+        throw std::logic_error("A must be distributed over the same grid");
+    if( orientation == NORMAL )
+        throw std::logic_error("Invalid orientation");
+#endif
+    orientation_ = orientation;
+    factored_ = false;
+    A_ = A;
+    ldl::BunchKaufman( orientation_, A_, d_, dSub_, p_ );
+
+    // Gather the block diagonal and compose the pivots once rather than
+    // during every solve
+    d_STAR_STAR_ = d_;
+    dSub_STAR_STAR_ = dSub_;
+    DistMatrix<int,STAR,STAR> p_STAR_STAR( p_ );
+    ComposePivots( p_STAR_STAR, image_, preimage_ );
+    factored_ = true;
+}
+
+template<typename F>
+inline void
+LDLFactor<F>::Update( const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::Update");
+    if( A.Height() != A_.Height() || A.Width() != A_.Width() )
+        throw std::logic_error("A must be the same size as the factors");
+#endif
+    Factor( orientation_, A );
+}
+
+template<typename F>
+inline void
+LDLFactor<F>::Solve( DistMatrix<F>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::Solve");
+    factor::AssertConforms( B, A_.Height() );
+#endif
+    factor::AssertFactored( factored_ );
+    ApplyRowPivots( B, image_, preimage_ );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A_, B );
+    {
+        DistMatrix<F,STAR,MR> B_STAR_MR( B );
+        ldl::BlockDiagonalSolve
+        ( orientation_, d_STAR_STAR_.LockedMatrix(),
+          dSub_STAR_STAR_.LockedMatrix(), B_STAR_MR.Matrix() );
+        B = B_STAR_MR;
+    }
+    Trsm( LEFT, LOWER, orientation_, UNIT, F(1), A_, B );
+    ApplyRowPivots( B, preimage_, image_ );
+}
+
+template<typename F>
+template<Distribution U,Distribution V>
+inline void
+LDLFactor<F>::Solve( DistMatrix<F,U,V>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::Solve");
+#endif
+    DistMatrix<F> BAligned( A_.Grid() );
+    BAligned.AlignWith( A_ );
+    BAligned = B;
+    Solve( BAligned );
+    B = BAligned;
+}
+
+// For Hermitian A, inv(A^H) B = inv(A) B, and for complex symmetric A,
+// inv(A^H) B = conj(inv(A) conj(B))
+template<typename F>
+inline void
+LDLFactor<F>::SolveAdjoint( DistMatrix<F>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::SolveAdjoint");
+#endif
+    if( orientation_ == TRANSPOSE )
+    {
+        Conjugate( B );
+        Solve( B );
+        Conjugate( B );
+    }
+    else
+        Solve( B );
+}
+
+template<typename F>
+template<Distribution U,Distribution V>
+inline void
+LDLFactor<F>::SolveAdjoint( DistMatrix<F,U,V>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::SolveAdjoint");
+#endif
+    DistMatrix<F> BAligned( A_.Grid() );
+    BAligned.AlignWith( A_ );
+    BAligned = B;
+    SolveAdjoint( BAligned );
+    B = BAligned;
+}
+
+template<typename F>
+inline SafeProduct<F>
+LDLFactor<F>::LogDet() const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::LogDet");
+#endif
+    factor::AssertFactored( factored_ );
+    return determinant::AfterLDL
+    ( orientation_, d_STAR_STAR_.LockedMatrix(),
+      dSub_STAR_STAR_.LockedMatrix() );
+}
+
+template<typename F>
+inline InertiaType<int>
+LDLFactor<F>::Inertia() const
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLFactor::Inertia");
+#endif
+    factor::AssertFactored( factored_ );
+    if( orientation_ != ADJOINT )
+        throw std::logic_error("Inertia requires a Hermitian factorization");
+    return ldl::Inertia
+    ( d_STAR_STAR_.LockedMatrix(), dSub_STAR_STAR_.LockedMatrix() );
+}
+
+template<typename F>
+inline Orientation
+LDLFactor<F>::Orient() const
+{ return orientation_; }
+
+template<typename F>
+inline int
+LDLFactor<F>::Height() const
+{ return A_.Height(); }
+
+template<typename F>
+inline const elem::Grid&
+LDLFactor<F>::Grid() const
+{ return A_.Grid(); }
+
+template<typename F>
+inline const DistMatrix<F>&
+LDLFactor<F>::Factors() const
+{ return A_; }
+
+} // namespace elem
+
+#endif // ifndef LAPACK_FACTORIZATION_HPP
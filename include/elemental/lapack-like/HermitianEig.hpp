@@ -14,4 +14,104 @@
 
 #include "elemental/lapack-like/HermitianEig/Sort.hpp"
 
+namespace elem {
+
+namespace batch {
+
+template<typename F>
+struct HermitianEigFunctor
+{
+    UpperOrLower uplo;
+    MatrixBatch<F>* A;
+    MatrixBatch<BASE(F)>* w;
+    MatrixBatch<F>* Z;
+
+    HermitianEigFunctor
+    ( UpperOrLower u, MatrixBatch<F>& ABatch, MatrixBatch<BASE(F)>& wBatch,
+      MatrixBatch<F>* ZBatch )
+    : uplo(u), A(&ABatch), w(&wBatch), Z(ZBatch)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F> AView;
+        Matrix<BASE(F)> wView;
+        A->View( k, AView );
+        w->View( k, wView );
+        if( Z == 0 )
+        {
+            HermitianEig( uplo, AView, wView );
+        }
+        else
+        {
+            Matrix<F> ZView;
+            Z->View( k, ZView );
+            HermitianEig( uplo, AView, wView, ZView );
+        }
+    }
+};
+
+// Unless B is viewing existing matrices, resize it to hold either a column
+// vector or a square matrix of the same height as each member of A
+template<typename F,typename T>
+inline void
+ResizeOutputBatch( const MatrixBatch<F>& A, MatrixBatch<T>& B, bool square )
+{
+    const int batchSize = A.Size();
+    if( B.Viewing() )
+    {
+        if( B.Size() != batchSize )
+            throw std::logic_error("Batches must be the same size");
+    }
+    else
+    {
+        std::vector<int> heights( batchSize ), widths( batchSize, 1 );
+        for( int k=0; k<batchSize; ++k )
+        {
+            heights[k] = A.Height(k);
+            if( square )
+                widths[k] = A.Height(k);
+        }
+        B.ResizeTo( heights, widths );
+    }
+}
+
+} // namespace batch
+
+// Independently compute the eigenvalues of each member of a batch of 
+// Hermitian matrices, starting with the most expensive members
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, MatrixBatch<F>& A, MatrixBatch<BASE(F)>& w )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianEig");
+#endif
+    batch::ResizeOutputBatch( A, w, false );
+    std::vector<int> order;
+    batch::DescendingCostOrder( A, order );
+    batch::Apply( order, batch::HermitianEigFunctor<F>(uplo,A,w,0) );
+}
+
+// Independently compute the eigenvalues and eigenvectors of each member of a
+// batch of Hermitian matrices, starting with the most expensive members
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, MatrixBatch<F>& A, MatrixBatch<BASE(F)>& w,
+  MatrixBatch<F>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianEig");
+#endif
+    batch::ResizeOutputBatch( A, w, false );
+    batch::ResizeOutputBatch( A, Z, true );
+    std::vector<int> order;
+    batch::DescendingCostOrder( A, order );
+    batch::Apply( order, batch::HermitianEigFunctor<F>(uplo,A,w,&Z) );
+}
+
+} // namespace elem
+
 #endif // ifndef LAPACK_HERMITIANEIG_HPP
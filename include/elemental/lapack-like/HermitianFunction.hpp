@@ -406,4 +406,8 @@ ComplexHermitianFunction
 
 } // namespace elem
 
+#include "./HermitianFunction/Lanczos.hpp"
+#include "./HermitianFunction/Chebyshev.hpp"
+#include "./HermitianFunction/Zolotarev.hpp"
+
 #endif // ifndef LAPACK_HERMITIANFUNCTION_HPP
@@ -0,0 +1,336 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
+#define LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/HermitianFunction/Lanczos.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Apply a smooth real function to a Hermitian matrix without an
+// eigensolver by truncating its Chebyshev expansion on an interval
+// containing the spectrum and evaluating the resulting polynomial with the
+// Paterson-Stockmeyer scheme, which needs only about 2 sqrt(d) matrix-matrix
+// multiplications for a degree d polynomial. The Chebyshev variant of
+// Paterson-Stockmeyer follows the identity
+//     T_{qs+j} = 2 T_j T_{qs} - T_{qs-j},
+// which rewrites the expansion as a polynomial in T_s with coefficients that
+// are polynomials of degree less than s; see Section 4.2 of Nicholas J.
+// Higham's "Functions of Matrices: Theory and Computation".
+
+namespace elem {
+namespace hermitian_function {
+
+// Compute the coefficients of the Chebyshev expansion of f on [a,b],
+// doubling the number of Chebyshev points until the trailing coefficients
+// are negligible, and then truncate the expansion so that the sum of the
+// magnitudes of the discarded coefficients is at most tol times the largest
+template<typename R,class RealFunctor>
+inline void
+ChebyshevCoefficients
+( const RealFunctor& f, R a, R b, R tol, int maxDegree, std::vector<R>& c )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::ChebyshevCoefficients");
+#endif
+    const R pi = 4*Atan( R(1) );
+    const R center = (a+b)/2;
+    const R radius = (b-a)/2;
+    std::vector<R> theta, fx;
+    R cMax;
+    int N = std::min( 16, maxDegree+1 );
+    while( true )
+    {
+        theta.resize( N );
+        fx.resize( N );
+        for( int j=0; j<N; ++j )
+        {
+            theta[j] = pi*(j+R(1)/R(2))/N;
+            fx[j] = f( center + radius*Cos(theta[j]) );
+        }
+        c.resize( N );
+        cMax = 0;
+        for( int k=0; k<N; ++k )
+        {
+            R sum = 0;
+            for( int j=0; j<N; ++j )
+                sum += fx[j]*Cos(k*theta[j]);
+            c[k] = ( k == 0 ? sum/N : 2*sum/N );
+            cMax = std::max( cMax, Abs(c[k]) );
+        }
+
+        R tail = Abs(c[N-1]);
+        if( N > 1 )
+            tail = std::max( tail, Abs(c[N-2]) );
+        if( tail <= tol*cMax || N == maxDegree+1 )
+            break;
+        N = std::min( 2*N, maxDegree+1 );
+    }
+
+    R tailSum = 0;
+    int degree = N-1;
+    while( degree > 0 && tailSum+Abs(c[degree]) <= tol*cMax )
+        tailSum += Abs(c[degree--]);
+    c.resize( degree+1 );
+}
+
+// Rewrite the coefficients of sum_k c_k T_k so that the polynomial equals
+// sum_q A_q T_q(T_s), where A_q = sum_{j<s} coef[q s + j] T_j
+template<typename R>
+inline void
+PatersonStockmeyerCoefficients
+( const std::vector<R>& c, int s, int r, std::vector<R>& coef )
+{
+    coef = c;
+    coef.resize( (r+1)*s, R(0) );
+    for( int q=r; q>0; --q )
+    {
+        for( int j=1; j<s; ++j )
+        {
+            coef[(q-1)*s+(s-j)] -= coef[q*s+j];
+            coef[q*s+j] *= 2;
+        }
+    }
+}
+
+// Overwrite B with sum_k c_k T_k(B)
+template<typename F>
+inline void
+ChebyshevPolynomial( const std::vector<BASE(F)>& c, Matrix<F>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::ChebyshevPolynomial");
+#endif
+    typedef BASE(F) R;
+    const int n = B.Height();
+    const int d = c.size()-1;
+    const int s = std::max( 1, int(std::ceil(Sqrt(R(d)))) );
+    const int r = d / s;
+    std::vector<R> coef;
+    PatersonStockmeyerCoefficients( c, s, r, coef );
+
+    // T[j] := T_j(B) for j=1,...,s
+    std::vector<Matrix<F> > T( s+1 );
+    T[1] = B;
+    for( int j=2; j<=s; ++j )
+    {
+        if( j == 2 )
+        {
+            Gemm( NORMAL, NORMAL, F(2), B, B, T[2] );
+            for( int i=0; i<n; ++i )
+                T[2].Update( i, i, F(-1) );
+        }
+        else
+        {
+            T[j] = T[j-2];
+            Gemm( NORMAL, NORMAL, F(2), B, T[j-1], F(-1), T[j] );
+        }
+    }
+    const Matrix<F>& Y = T[s];
+
+    // Clenshaw's recurrence in T_s(B) with matrix coefficients:
+    //   b_q := A_q + 2 T_s(B) b_{q+1} - b_{q+2}
+    Matrix<F> b0, b1, b2;
+    Matrix<F> *bq=&b0, *bq1=&b1, *bq2=&b2;
+    for( int q=r; q>=0; --q )
+    {
+        Zeros( *bq, n, n );
+        for( int i=0; i<n; ++i )
+            bq->Update( i, i, F(coef[q*s]) );
+        for( int j=1; j<s; ++j )
+            Axpy( F(coef[q*s+j]), T[j], *bq );
+        const F alpha = ( q == 0 ? F(1) : F(2) );
+        if( q < r )
+            Gemm( NORMAL, NORMAL, alpha, Y, *bq1, F(1), *bq );
+        if( q < r-1 )
+            Axpy( F(-1), *bq2, *bq );
+        Matrix<F>* bTmp = bq2;
+        bq2 = bq1;
+        bq1 = bq;
+        bq = bTmp;
+    }
+    B = *bq1;
+}
+
+template<typename F>
+inline void
+ChebyshevPolynomial( const std::vector<BASE(F)>& c, DistMatrix<F>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::ChebyshevPolynomial");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = B.Grid();
+    const int n = B.Height();
+    const int d = c.size()-1;
+    const int s = std::max( 1, int(std::ceil(Sqrt(R(d)))) );
+    const int r = d / s;
+    std::vector<R> coef;
+    PatersonStockmeyerCoefficients( c, s, r, coef );
+
+    // T[j] := T_j(B) for j=1,...,s
+    std::vector<DistMatrix<F> > T( s+1, DistMatrix<F>(g) );
+    T[1] = B;
+    for( int j=2; j<=s; ++j )
+    {
+        if( j == 2 )
+        {
+            Gemm( NORMAL, NORMAL, F(2), B, B, T[2] );
+            for( int i=0; i<n; ++i )
+                T[2].Update( i, i, F(-1) );
+        }
+        else
+        {
+            T[j] = T[j-2];
+            Gemm( NORMAL, NORMAL, F(2), B, T[j-1], F(-1), T[j] );
+        }
+    }
+    const DistMatrix<F>& Y = T[s];
+
+    // Clenshaw's recurrence in T_s(B) with matrix coefficients:
+    //   b_q := A_q + 2 T_s(B) b_{q+1} - b_{q+2}
+    DistMatrix<F> b0(g), b1(g), b2(g);
+    DistMatrix<F> *bq=&b0, *bq1=&b1, *bq2=&b2;
+    for( int q=r; q>=0; --q )
+    {
+        Zeros( *bq, n, n );
+        for( int i=0; i<n; ++i )
+            bq->Update( i, i, F(coef[q*s]) );
+        for( int j=1; j<s; ++j )
+            Axpy( F(coef[q*s+j]), T[j], *bq );
+        const F alpha = ( q == 0 ? F(1) : F(2) );
+        if( q < r )
+            Gemm( NORMAL, NORMAL, alpha, Y, *bq1, F(1), *bq );
+        if( q < r-1 )
+            Axpy( F(-1), *bq2, *bq );
+        DistMatrix<F>* bTmp = bq2;
+        bq2 = bq1;
+        bq1 = bq;
+        bq = bTmp;
+    }
+    B = *bq1;
+}
+
+// Overwrite the Hermitian matrix A, whose spectrum lies in [a,b], with f(A)
+template<typename F,class RealFunctor>
+inline void
+Chebyshev
+( UpperOrLower uplo, Matrix<F>& A, const RealFunctor& f,
+  BASE(F) a, BASE(F) b, BASE(F) tol, int maxDegree )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::Chebyshev");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    if( b <= a )
+    {
+        Zeros( A, n, n );
+        for( int i=0; i<n; ++i )
+            A.Set( i, i, F(f(a)) );
+        return;
+    }
+    std::vector<R> c;
+    ChebyshevCoefficients( f, a, b, tol, maxDegree, c );
+
+    // Map [a,b] to [-1,1]
+    MakeHermitian( uplo, A );
+    Scale( F(2/(b-a)), A );
+    for( int i=0; i<n; ++i )
+        A.Update( i, i, F(-(a+b)/(b-a)) );
+    ChebyshevPolynomial( c, A );
+}
+
+template<typename F,class RealFunctor>
+inline void
+Chebyshev
+( UpperOrLower uplo, DistMatrix<F>& A, const RealFunctor& f,
+  BASE(F) a, BASE(F) b, BASE(F) tol, int maxDegree )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::Chebyshev");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    if( b <= a )
+    {
+        Zeros( A, n, n );
+        for( int i=0; i<n; ++i )
+            A.Set( i, i, F(f(a)) );
+        return;
+    }
+    std::vector<R> c;
+    ChebyshevCoefficients( f, a, b, tol, maxDegree, c );
+
+    // Map [a,b] to [-1,1]
+    MakeHermitian( uplo, A );
+    Scale( F(2/(b-a)), A );
+    for( int i=0; i<n; ++i )
+        A.Update( i, i, F(-(a+b)/(b-a)) );
+    ChebyshevPolynomial( c, A );
+}
+
+} // namespace hermitian_function
+
+//
+// Overwrite the Hermitian matrix A with f(A) using a Chebyshev expansion of
+// degree at most maxDegree over Lanczos estimates of the spectral interval.
+// The expansion is truncated at a relative accuracy of tol, which defaults to
+// ten times machine precision. The full Hermitian matrix is returned.
+//
+
+template<typename F,class RealFunctor>
+inline void
+ChebyshevHermitianFunction
+( UpperOrLower uplo, Matrix<F>& A, const RealFunctor& f,
+  BASE(F) tol=0, int maxDegree=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ChebyshevHermitianFunction");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( maxDegree < 0 )
+        throw std::logic_error("Maximum degree must be non-negative");
+    typedef BASE(F) R;
+    if( tol == R(0) )
+        tol = 10*lapack::MachineEpsilon<R>();
+    R a, b;
+    HermitianSpectralBounds( uplo, A, a, b );
+    hermitian_function::Chebyshev( uplo, A, f, a, b, tol, maxDegree );
+}
+
+template<typename F,class RealFunctor>
+inline void
+ChebyshevHermitianFunction
+( UpperOrLower uplo, DistMatrix<F>& A, const RealFunctor& f,
+  BASE(F) tol=0, int maxDegree=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ChebyshevHermitianFunction");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( maxDegree < 0 )
+        throw std::logic_error("Maximum degree must be non-negative");
+    typedef BASE(F) R;
+    if( tol == R(0) )
+        tol = 10*lapack::MachineEpsilon<R>();
+    R a, b;
+    HermitianSpectralBounds( uplo, A, a, b );
+    hermitian_function::Chebyshev( uplo, A, f, a, b, tol, maxDegree );
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANFUNCTION_LANCZOS_HPP
+#define LAPACK_HERMITIANFUNCTION_LANCZOS_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Dot.hpp"
+#include "elemental/blas-like/level1/Nrm2.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level2/Hemv.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Cheap estimates of the extremal eigenvalues of a Hermitian matrix from a
+// few steps of the Lanczos process started from a random vector. The
+// extremal Ritz values are pushed outward by the final off-diagonal entry of
+// the Lanczos tridiagonal, which bounds the norms of the Ritz residuals; see
+// Y. Zhou and R.-C. Li's "Bounding the spectrum of large Hermitian
+// matrices", Linear Algebra Appl., Vol. 435, 2011.
+
+namespace elem {
+namespace hermitian_function {
+
+// The number of eigenvalues of the symmetric tridiagonal matrix with
+// diagonal alpha and subdiagonal beta which are less than sigma
+template<typename R>
+inline int
+SturmCount
+( const std::vector<R>& alpha, const std::vector<R>& beta, R sigma )
+{
+    const int k = alpha.size();
+    const R tiny = lapack::MachineSafeMin<R>();
+    int count = 0;
+    R d = 1;
+    for( int j=0; j<k; ++j )
+    {
+        const R betaSq = ( j == 0 ? R(0) : beta[j-1]*beta[j-1] );
+        d = alpha[j] - sigma - betaSq/d;
+        if( Abs(d) < tiny )
+            d = -tiny;
+        if( d < R(0) )
+            ++count;
+    }
+    return count;
+}
+
+// Use bisection to find the extremal eigenvalues of a symmetric tridiagonal
+template<typename R>
+inline void
+TridiagExtremes
+( const std::vector<R>& alpha, const std::vector<R>& beta,
+  R& minEig, R& maxEig )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::TridiagExtremes");
+#endif
+    const int k = alpha.size();
+
+    // Start from the Gershgorin interval
+    R lower = alpha[0], upper = alpha[0];
+    for( int j=0; j<k; ++j )
+    {
+        const R radius = ( j > 0 ? Abs(beta[j-1]) : R(0) ) +
+                         ( j < k-1 ? Abs(beta[j]) : R(0) );
+        lower = std::min( lower, alpha[j]-radius );
+        upper = std::max( upper, alpha[j]+radius );
+    }
+    const R eps = lapack::MachineEpsilon<R>();
+    const R tol = 2*eps*std::max( Abs(lower), Abs(upper) );
+
+    // Bisect for the smallest eigenvalue
+    R a = lower, b = upper;
+    while( b-a > tol )
+    {
+        const R c = (a+b)/2;
+        if( c == a || c == b )
+            break;
+        if( SturmCount( alpha, beta, c ) >= 1 )
+            b = c;
+        else
+            a = c;
+    }
+    minEig = b;
+
+    // Bisect for the largest eigenvalue
+    a = lower;
+    b = upper;
+    while( b-a > tol )
+    {
+        const R c = (a+b)/2;
+        if( c == a || c == b )
+            break;
+        if( SturmCount( alpha, beta, c ) >= k )
+            b = c;
+        else
+            a = c;
+    }
+    maxEig = a;
+}
+
+} // namespace hermitian_function
+
+//
+// Estimate an interval [lowerBound,upperBound] containing the spectrum of
+// the Hermitian matrix A, of which only the 'uplo' triangle is accessed,
+// using 'numSteps' steps of the Lanczos process.
+//
+
+template<typename F>
+inline void
+HermitianSpectralBounds
+( UpperOrLower uplo, const Matrix<F>& A,
+  BASE(F)& lowerBound, BASE(F)& upperBound, int numSteps=20 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianSpectralBounds");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    typedef BASE(F) R;
+    const int n = A.Height();
+    if( n == 0 )
+    {
+        lowerBound = upperBound = 0;
+        return;
+    }
+    numSteps = std::min( numSteps, n );
+
+    Matrix<F> q, qPrev, w;
+    Uniform( q, n, 1 );
+    Scale( F(1)/Nrm2(q), q );
+    Zeros( qPrev, n, 1 );
+    std::vector<R> alpha, beta;
+    R betaLast = 0;
+    for( int j=0; j<numSteps; ++j )
+    {
+        // w := A q - beta_{j-1} q_{j-1}
+        w = qPrev;
+        Hemv( uplo, F(1), A, q, F(-betaLast), w );
+        const R alphaj = RealPart(Dot( q, w ));
+        Axpy( F(-alphaj), q, w );
+        alpha.push_back( alphaj );
+        betaLast = Nrm2( w );
+        if( betaLast == R(0) )
+            break;
+        if( j < numSteps-1 )
+            beta.push_back( betaLast );
+        qPrev = q;
+        q = w;
+        Scale( F(1)/betaLast, q );
+    }
+    hermitian_function::TridiagExtremes
+    ( alpha, beta, lowerBound, upperBound );
+    lowerBound -= betaLast;
+    upperBound += betaLast;
+}
+
+template<typename F>
+inline void
+HermitianSpectralBounds
+( UpperOrLower uplo, const DistMatrix<F>& A,
+  BASE(F)& lowerBound, BASE(F)& upperBound, int numSteps=20 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianSpectralBounds");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    if( n == 0 )
+    {
+        lowerBound = upperBound = 0;
+        return;
+    }
+    numSteps = std::min( numSteps, n );
+
+    DistMatrix<F> q(g), qPrev(g), w(g);
+    Uniform( q, n, 1 );
+    Scale( F(1)/Nrm2(q), q );
+    Zeros( qPrev, n, 1 );
+    std::vector<R> alpha, beta;
+    R betaLast = 0;
+    for( int j=0; j<numSteps; ++j )
+    {
+        // w := A q - beta_{j-1} q_{j-1}
+        w = qPrev;
+        Hemv( uplo, F(1), A, q, F(-betaLast), w );
+        const R alphaj = RealPart(Dot( q, w ));
+        Axpy( F(-alphaj), q, w );
+        alpha.push_back( alphaj );
+        betaLast = Nrm2( w );
+        if( betaLast == R(0) )
+            break;
+        if( j < numSteps-1 )
+            beta.push_back( betaLast );
+        qPrev = q;
+        q = w;
+        Scale( F(1)/betaLast, q );
+    }
+    hermitian_function::TridiagExtremes
+    ( alpha, beta, lowerBound, upperBound );
+    lowerBound -= betaLast;
+    upperBound += betaLast;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANFUNCTION_LANCZOS_HPP
@@ -0,0 +1,353 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANFUNCTION_ZOLOTAREV_HPP
+#define LAPACK_HERMITIANFUNCTION_ZOLOTAREV_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/HermitianFunction/Lanczos.hpp"
+#include "elemental/lapack-like/HPDSolve.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Spectral projectors of Hermitian matrices from Zolotarev's best rational
+// approximation to the sign function on [-1,-l] U [l,1],
+//     sign(x) ~ M x prod_{j=1}^r (x^2 + c_{2j}) / (x^2 + c_{2j-1}),
+// with
+//     c_i = l^2 sn^2(i K'/(2r+1); l') / cn^2(i K'/(2r+1); l'),
+// where l' = sqrt(1-l^2) and K' is the complete elliptic integral of the
+// first kind for the modulus l'. In partial fraction form, each of the r
+// terms requires a Cholesky factorization of the shifted square of the
+// matrix and a solve against the matrix itself, and the terms are
+// independent of one another. Rather than raising r until a single
+// approximation is accurate, approximations of modest degree are composed.
+// See Y. Nakatsukasa and R. W. Freund's "Computing fundamental matrix
+// decompositions accurately via the matrix sign function in two iterations:
+// The power of Zolotarev's functions", SIAM Review, Vol. 58, No. 3, 2016.
+
+namespace elem {
+namespace hermitian_function {
+
+// The complete elliptic integral of the first kind for the modulus whose
+// complementary modulus is kp, via the arithmetic-geometric mean
+template<typename R>
+inline R
+EllipticK( R kp )
+{
+    const R eps = lapack::MachineEpsilon<R>();
+    R a = 1, b = kp;
+    for( int its=0; its<64 && Abs(a-b) > 4*eps*a; ++its )
+    {
+        const R aNew = (a+b)/2;
+        b = Sqrt(a*b);
+        a = aNew;
+    }
+    const R pi = 4*Atan( R(1) );
+    return pi/(2*a);
+}
+
+// The Jacobi elliptic functions sn(u;k) and cn(u;k) for the modulus k with
+// complementary modulus kp, via the descending Landen transformation
+// (see Section 16.4 of Abramowitz and Stegun)
+template<typename R>
+inline void
+JacobiSnCn( R u, R k, R kp, R& sn, R& cn )
+{
+    const R eps = lapack::MachineEpsilon<R>();
+    std::vector<R> a( 1, R(1) ), c( 1, k );
+    R b = kp;
+    while( Abs(c.back()) > 4*eps*a.back() && a.size() < 64 )
+    {
+        const R aLast = a.back();
+        a.push_back( (aLast+b)/2 );
+        c.push_back( (aLast-b)/2 );
+        b = Sqrt(aLast*b);
+    }
+    const int N = a.size()-1;
+    R phi = Pow(R(2),R(N))*a[N]*u;
+    for( int j=N; j>0; --j )
+        phi = (phi + Asin(c[j]/a[j]*Sin(phi)))/2;
+    sn = Sin(phi);
+    cn = Cos(phi);
+}
+
+// Evaluate x prod_j (x^2+c_{2j})/(x^2+c_{2j-1})
+template<typename R>
+inline R
+ZolotarevValue( const std::vector<R>& c, R x )
+{
+    const int r = c.size()/2;
+    R value = x;
+    for( int j=0; j<r; ++j )
+        value *= (x*x+c[2*j+1])/(x*x+c[2*j]);
+    return value;
+}
+
+// Compute the shifts c_{2j-1} and the partial fraction weights a_j of the
+// Zolotarev function of degree 2r+1 on [-1,-l] U [l,1], as well as the
+// extreme values of its unnormalized form over [l,1], and return the
+// relative error of the best (equioscillating) normalization
+template<typename R>
+inline R
+ZolotarevCoefficients
+( R l, int r, std::vector<R>& shifts, std::vector<R>& weights,
+  R& minValue, R& maxValue )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::ZolotarevCoefficients");
+#endif
+    const R lp = Sqrt( (1-l)*(1+l) );
+    const R KPrime = EllipticK( l );
+    std::vector<R> c( 2*r );
+    for( int i=1; i<=2*r; ++i )
+    {
+        R sn, cn;
+        JacobiSnCn( i*KPrime/(2*r+1), lp, l, sn, cn );
+        c[i-1] = l*l*sn*sn/(cn*cn);
+    }
+
+    // Partial fractions:
+    //   prod_j (t+c_{2j})/(t+c_{2j-1}) = 1 + sum_j a_j/(t+c_{2j-1})
+    shifts.resize( r );
+    weights.resize( r );
+    for( int j=0; j<r; ++j )
+    {
+        shifts[j] = c[2*j];
+        R weight = 1;
+        for( int k=0; k<r; ++k )
+        {
+            weight *= c[2*k+1] - c[2*j];
+            if( k != j )
+                weight /= c[2*k] - c[2*j];
+        }
+        weights[j] = weight;
+    }
+
+    // Sample the unnormalized function on a logarithmic grid over [l,1]
+    const int numSamples = 2000;
+    minValue = maxValue = ZolotarevValue( c, l );
+    for( int k=1; k<=numSamples; ++k )
+    {
+        const R x = Pow( l, R(numSamples-k)/numSamples );
+        const R value = ZolotarevValue( c, x );
+        minValue = std::min( minValue, value );
+        maxValue = std::max( maxValue, value );
+    }
+    return (maxValue-minValue)/(maxValue+minValue);
+}
+
+// Overwrite the full Hermitian matrix X, whose spectrum lies in
+// [-1,-l] U [l,1], with (I + sign(X))/2. Following Nakatsukasa and Freund,
+// Zolotarev functions with at most eight terms are composed: each
+// intermediate step is scaled to map [l,1] into [l',1], with l' much closer
+// to one, and the final step uses the equioscillating normalization.
+template<typename F>
+inline void
+ZolotarevProjector( Matrix<F>& X, BASE(F) l, BASE(F) tol )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::ZolotarevProjector");
+#endif
+    typedef BASE(F) R;
+    const int n = X.Height();
+    const int maxTerms = 8;
+    const int maxSteps = 10;
+    std::vector<R> shifts, weights;
+    Matrix<F> XSquared, C, Y, S;
+    for( int step=0; step<maxSteps; ++step )
+    {
+        // Use the fewest terms which reach the tolerance, if possible
+        R minValue, maxValue, error;
+        int r = 0;
+        do
+        {
+            ++r;
+            error = ZolotarevCoefficients
+                    ( l, r, shifts, weights, minValue, maxValue );
+        } while( error > tol && r < maxTerms );
+        const bool lastStep = ( error <= tol || step == maxSteps-1 );
+
+        // X := M (X + sum_j a_j inv(X^2 + c_{2j-1} I) X)
+        S = X;
+        Herk( LOWER, NORMAL, F(1), X, XSquared );
+        for( int j=0; j<r; ++j )
+        {
+            C = XSquared;
+            for( int i=0; i<n; ++i )
+                C.Update( i, i, F(shifts[j]) );
+            Y = X;
+            HPDSolve( LOWER, NORMAL, C, Y );
+            Axpy( F(weights[j]), Y, S );
+        }
+        X = S;
+        MakeHermitian( LOWER, X );
+        if( lastStep )
+        {
+            Scale( F(1/(minValue+maxValue)), X );
+            break;
+        }
+        Scale( F(1/maxValue), X );
+        l = minValue/maxValue;
+    }
+
+    // X := (I + sign(X))/2, where the factor of 1/2 was absorbed above
+    for( int i=0; i<n; ++i )
+        X.Update( i, i, F(R(1)/R(2)) );
+}
+
+template<typename F>
+inline void
+ZolotarevProjector( DistMatrix<F>& X, BASE(F) l, BASE(F) tol )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::ZolotarevProjector");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = X.Grid();
+    const int n = X.Height();
+    const int maxTerms = 8;
+    const int maxSteps = 10;
+    std::vector<R> shifts, weights;
+    DistMatrix<F> XSquared(g), C(g), Y(g), S(g);
+    for( int step=0; step<maxSteps; ++step )
+    {
+        // Use the fewest terms which reach the tolerance, if possible
+        R minValue, maxValue, error;
+        int r = 0;
+        do
+        {
+            ++r;
+            error = ZolotarevCoefficients
+                    ( l, r, shifts, weights, minValue, maxValue );
+        } while( error > tol && r < maxTerms );
+        const bool lastStep = ( error <= tol || step == maxSteps-1 );
+
+        // X := M (X + sum_j a_j inv(X^2 + c_{2j-1} I) X)
+        S = X;
+        Herk( LOWER, NORMAL, F(1), X, XSquared );
+        for( int j=0; j<r; ++j )
+        {
+            C = XSquared;
+            for( int i=0; i<n; ++i )
+                C.Update( i, i, F(shifts[j]) );
+            Y = X;
+            HPDSolve( LOWER, NORMAL, C, Y );
+            Axpy( F(weights[j]), Y, S );
+        }
+        X = S;
+        MakeHermitian( LOWER, X );
+        if( lastStep )
+        {
+            Scale( F(1/(minValue+maxValue)), X );
+            break;
+        }
+        Scale( F(1/maxValue), X );
+        l = minValue/maxValue;
+    }
+
+    // X := (I + sign(X))/2, where the factor of 1/2 was absorbed above
+    for( int i=0; i<n; ++i )
+        X.Update( i, i, F(R(1)/R(2)) );
+}
+
+} // namespace hermitian_function
+
+//
+// Overwrite the Hermitian matrix A with the orthogonal projector onto the
+// invariant subspace of its eigenvalues greater than sigma. No eigenvalue
+// may lie within 'gap' of sigma, and the rational approximation is chosen to
+// be accurate to within tol (ten times machine precision by default) outside
+// of this gap. Since the first Cholesky factorizations are of shifts of
+// the square of A - sigma I, extremely small relative gaps will limit the
+// attainable accuracy.
+//
+
+template<typename F>
+inline void
+HermitianSpectralProjector
+( UpperOrLower uplo, Matrix<F>& A, BASE(F) sigma, BASE(F) gap,
+  BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianSpectralProjector");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( gap <= 0 )
+        throw std::logic_error("The spectral gap must be positive");
+    typedef BASE(F) R;
+    const int n = A.Height();
+    if( tol == R(0) )
+        tol = 10*lapack::MachineEpsilon<R>();
+
+    R a, b;
+    HermitianSpectralBounds( uplo, A, a, b );
+    if( sigma <= a || sigma >= b )
+    {
+        Zeros( A, n, n );
+        if( sigma <= a )
+            for( int i=0; i<n; ++i )
+                A.Set( i, i, F(1) );
+        return;
+    }
+
+    // X := (A - sigma I)/rho, which has spectrum in [-1,-l] U [l,1]
+    const R rho = std::max( b-sigma, sigma-a );
+    const R l = std::min( gap/rho, R(1)/R(2) );
+    MakeHermitian( uplo, A );
+    for( int i=0; i<n; ++i )
+        A.Update( i, i, F(-sigma) );
+    Scale( F(1/rho), A );
+    hermitian_function::ZolotarevProjector( A, l, tol );
+}
+
+template<typename F>
+inline void
+HermitianSpectralProjector
+( UpperOrLower uplo, DistMatrix<F>& A, BASE(F) sigma, BASE(F) gap,
+  BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianSpectralProjector");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( gap <= 0 )
+        throw std::logic_error("The spectral gap must be positive");
+    typedef BASE(F) R;
+    const int n = A.Height();
+    if( tol == R(0) )
+        tol = 10*lapack::MachineEpsilon<R>();
+
+    R a, b;
+    HermitianSpectralBounds( uplo, A, a, b );
+    if( sigma <= a || sigma >= b )
+    {
+        Zeros( A, n, n );
+        if( sigma <= a )
+            for( int i=0; i<n; ++i )
+                A.Set( i, i, F(1) );
+        return;
+    }
+
+    // X := (A - sigma I)/rho, which has spectrum in [-1,-l] U [l,1]
+    const R rho = std::max( b-sigma, sigma-a );
+    const R l = std::min( gap/rho, R(1)/R(2) );
+    MakeHermitian( uplo, A );
+    for( int i=0; i<n; ++i )
+        A.Update( i, i, F(-sigma) );
+    Scale( F(1/rho), A );
+    hermitian_function::ZolotarevProjector( A, l, tol );
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANFUNCTION_ZOLOTAREV_HPP
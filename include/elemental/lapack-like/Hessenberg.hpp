@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HESSENBERG_HPP
+#define LAPACK_HESSENBERG_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Hessenberg/Panel.hpp"
+#include "elemental/lapack-like/Hessenberg/Unb.hpp"
+
+// Reduce a general square matrix to upper Hessenberg form through a unitary 
+// similarity transformation, A = Q H Q^H. On exit, H is stored in the upper
+// Hessenberg portion of A, and the scaled Householder vectors which define
+// Q are stored below the subdiagonal, with their scalings in t (as in
+// HermitianTridiag).
+
+namespace elem {
+
+template<typename F>
+inline void Hessenberg( Matrix<F>& A, Matrix<F>& t )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hessenberg");
+#endif
+    hessenberg::Unb( A, t );
+}
+
+// The panels are reduced as in LAPACK's xGEHRD, and then the trailing matrix
+// is updated from the right with A2 := A2 - Y V2^H and from the left with
+// A2 := (I - V T V^H)^H A2
+template<typename F>
+inline void Hessenberg( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hessenberg");
+    if( A.Grid() != t.Grid() )
+        throw std::logic_error("{A,t} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( t.Viewing() )
+        throw std::logic_error("t must not be a view");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    t.ResizeTo( std::max(n-1,0), 1 );
+
+    // Matrix views
+    DistMatrix<F> ARight(g), ABottomRight(g);
+    DistMatrix<F,STAR,STAR> VBottom(g);
+
+    // Temporary distributions
+    DistMatrix<F,STAR,STAR> V_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR> V_MC_STAR(g), Y_MC_STAR(g);
+    DistMatrix<F,MR,  STAR> VBottom_MR_STAR(g);
+    DistMatrix<F,STAR,MR  > W_STAR_MR(g);
+    Matrix<F> T, WCopy;
+
+    const int bsize = Blocksize();
+    for( int j0=0; j0<n-1; j0+=bsize )
+    {
+        const int nb = std::min(bsize,(n-1)-j0);
+        hessenberg::Panel( A, j0, nb, t, V_STAR_STAR, T, Y_MC_STAR );
+
+        const int k = j0 + nb;
+        if( k < n )
+        {
+            // A(:,k:n-1) := A(:,k:n-1) - Y V(k:n-1,:)^H
+            View( ARight, A, 0, k, n, n-k );
+            LockedView( VBottom, V_STAR_STAR, k-(j0+1), 0, n-k, nb );
+            VBottom_MR_STAR.AlignWith( ARight );
+            //----------------------------------------------------------------//
+            VBottom_MR_STAR = VBottom;
+            LocalGemm
+            ( NORMAL, ADJOINT, 
+              F(-1), Y_MC_STAR, VBottom_MR_STAR, F(1), ARight );
+            //----------------------------------------------------------------//
+            VBottom_MR_STAR.FreeAlignments();
+
+            // A(j0+1:n-1,k:n-1) := (I - V T V^H)^H A(j0+1:n-1,k:n-1)
+            View( ABottomRight, A, j0+1, k, n-(j0+1), n-k );
+            V_MC_STAR.AlignWith( ABottomRight );
+            W_STAR_MR.AlignWith( ABottomRight );
+            //----------------------------------------------------------------//
+            V_MC_STAR = V_STAR_STAR;
+            Zeros( W_STAR_MR, nb, n-k );
+            LocalGemm
+            ( ADJOINT, NORMAL, F(1), V_MC_STAR, ABottomRight, F(0), W_STAR_MR );
+            W_STAR_MR.SumOverCol();
+            WCopy = W_STAR_MR.Matrix();
+            Gemm
+            ( ADJOINT, NORMAL, F(1), T, WCopy, F(0), W_STAR_MR.Matrix() );
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), V_MC_STAR, W_STAR_MR, F(1), ABottomRight );
+            //----------------------------------------------------------------//
+            V_MC_STAR.FreeAlignments();
+            W_STAR_MR.FreeAlignments();
+        }
+    }
+}
+
+template<typename F>
+inline void Hessenberg( Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hessenberg");
+#endif
+    Matrix<F> t;
+    Hessenberg( A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
+}
+
+template<typename F> 
+inline void Hessenberg( DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hessenberg");
+#endif
+    DistMatrix<F,STAR,STAR> t(A.Grid());
+    Hessenberg( A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
+}
+
+namespace hessenberg {
+
+// Overwrite B with Q B, where A = Q H Q^H was computed by Hessenberg
+template<typename F>
+inline void ApplyQ( const Matrix<F>& A, const Matrix<F>& t, Matrix<F>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hessenberg::ApplyQ");
+#endif
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, -1, A, t, B );
+}
+
+template<typename F>
+inline void ApplyQ
+( const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, DistMatrix<F>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hessenberg::ApplyQ");
+#endif
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, -1, A, t, B );
+}
+
+} // namespace hessenberg
+
+} // namespace elem
+
+#endif // ifndef LAPACK_HESSENBERG_HPP
@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HESSENBERG_PANEL_HPP
+#define LAPACK_HESSENBERG_PANEL_HPP
+
+#include "elemental/blas-like/level2/Gemv.hpp"
+#include "elemental/lapack-like/Reflector.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+namespace elem {
+namespace hessenberg {
+
+// Reduce columns j0:j0+nb-1 of A in the manner of LAPACK's xLAHR2. Only the
+// panel itself is modified; on exit,
+//
+//   V: the (n-j0-1) x nb unit lower-trapezoidal Householder vectors,
+//   T: the nb x nb upper-triangular matrix such that the product of the
+//      panel's reflectors is I - V T V^H, and
+//   Y: A V T, where A is the input matrix,
+//
+// so that the trailing matrix may be updated with level-3 operations.
+template<typename F>
+inline void Panel
+( DistMatrix<F>& A, int j0, int nb, DistMatrix<F,STAR,STAR>& t,
+  DistMatrix<F,STAR,STAR>& V, Matrix<F>& T, DistMatrix<F,MC,STAR>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hessenberg::Panel");
+    if( A.Grid() != t.Grid() || A.Grid() != V.Grid() ||
+        A.Grid() != Y.Grid() )
+        throw std::logic_error("Grids must match");
+    if( j0+nb > A.Height()-1 )
+        throw std::logic_error("Panel extends past the last reflector");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    Zeros( V, n-(j0+1), nb );
+    Zeros( T, nb, nb );
+    Y.AlignWith( A );
+    Zeros( Y, n, nb );
+    const int localHeight = Y.LocalHeight();
+
+    // Matrix views
+    DistMatrix<F> aCol(g), ARight(g);
+    Matrix<F> YLeft, yCol, VLeft, vCol, bBottom, TLeft, tCol;
+
+    // Temporary distributions
+    DistMatrix<F,MC,STAR> b_MC_STAR(g), y_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> b_STAR_STAR(g);
+    DistMatrix<F,MR,STAR> v_MR_STAR(g);
+    Matrix<F> z, x;
+
+    for( int i=0; i<nb; ++i )
+    {
+        const int j = j0 + i;
+        View( aCol, A, 0, j, n, 1 );
+        LockedView( VLeft, V.LockedMatrix(), 0, 0, n-(j0+1), i );
+        LockedView( YLeft, Y.LockedMatrix(), 0, 0, localHeight, i );
+        LockedView( TLeft, T, 0, 0, i, i );
+
+        // Apply the right-hand side of the pending similarity transformation
+        // to the j'th column, b := b - Y V(j,:)^H
+        b_MC_STAR.AlignWith( A );
+        b_MC_STAR = aCol;
+        if( i > 0 )
+        {
+            Zeros( x, i, 1 );
+            for( int k=0; k<i; ++k )
+                x.Set( k, 0, Conj(V.GetLocal(j-(j0+1),k)) );
+            Gemv( NORMAL, F(-1), YLeft, x, F(1), b_MC_STAR.Matrix() );
+        }
+
+        // Apply the left-hand side, b(j0+1:n) := (I - V T^H V^H) b(j0+1:n)
+        b_STAR_STAR = b_MC_STAR;
+        if( i > 0 )
+        {
+            View( bBottom, b_STAR_STAR.Matrix(), j0+1, 0, n-(j0+1), 1 );
+            Zeros( z, i, 1 );
+            Zeros( x, i, 1 );
+            Gemv( ADJOINT, F(1), VLeft, bBottom, F(0), z );
+            Gemv( ADJOINT, F(1), TLeft, z, F(0), x );
+            Gemv( NORMAL, F(-1), VLeft, x, F(1), bBottom );
+        }
+
+        // Compute the reflector which annihilates b(j+2:n)
+        F* bBuffer = b_STAR_STAR.Buffer();
+        F beta = bBuffer[j+1];
+        const F tau = Reflector( beta, n-(j+2), &bBuffer[j+2], 1 );
+        bBuffer[j+1] = beta;
+        aCol = b_STAR_STAR;
+        t.Set( j, 0, tau );
+        V.SetLocal( j-j0, i, F(1) );
+        for( int k=j+2; k<n; ++k )
+            V.SetLocal( k-(j0+1), i, bBuffer[k] );
+
+        // y := A(:,j+1:n) v
+        LockedView( ARight, A, 0, j+1, n, n-(j+1) );
+        v_MR_STAR.AlignWith( ARight );
+        v_MR_STAR.ResizeTo( n-(j+1), 1 );
+        const int vColShift = v_MR_STAR.ColShift();
+        const int vColStride = v_MR_STAR.ColStride();
+        const int vLocalHeight = v_MR_STAR.LocalHeight();
+        for( int kLocal=0; kLocal<vLocalHeight; ++kLocal )
+        {
+            const int k = vColShift + kLocal*vColStride;
+            v_MR_STAR.SetLocal( kLocal, 0, V.GetLocal((j+1+k)-(j0+1),i) );
+        }
+        y_MC_STAR.AlignWith( ARight );
+        Zeros( y_MC_STAR, n, 1 );
+        LocalGemv( NORMAL, F(1), ARight, v_MR_STAR, F(0), y_MC_STAR );
+        y_MC_STAR.SumOverRow();
+
+        // Y(:,i) := tau (y - Y(:,0:i-1) (V(:,0:i-1)^H v)), and
+        // T(0:i-1,i) := -tau T(0:i-1,0:i-1) (V(:,0:i-1)^H v)
+        LockedView( vCol, V.LockedMatrix(), 0, i, n-(j0+1), 1 );
+        View( yCol, Y.Matrix(), 0, i, localHeight, 1 );
+        View( tCol, T, 0, i, i, 1 );
+        Zeros( z, i, 1 );
+        if( i > 0 )
+        {
+            Gemv( ADJOINT, F(1), VLeft, vCol, F(0), z );
+            Gemv( NORMAL, F(-1), YLeft, z, F(1), y_MC_STAR.Matrix() );
+            Gemv( NORMAL, -tau, TLeft, z, F(0), tCol );
+        }
+        for( int kLocal=0; kLocal<localHeight; ++kLocal )
+            yCol.Set( kLocal, 0, tau*y_MC_STAR.GetLocal(kLocal,0) );
+        T.Set( i, i, tau );
+    }
+}
+
+} // namespace hessenberg
+} // namespace elem
+
+#endif // ifndef LAPACK_HESSENBERG_PANEL_HPP
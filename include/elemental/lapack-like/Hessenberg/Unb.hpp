@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HESSENBERG_UNB_HPP
+#define LAPACK_HESSENBERG_UNB_HPP
+
+#include "elemental/blas-like/level2/Gemv.hpp"
+#include "elemental/blas-like/level2/Ger.hpp"
+#include "elemental/lapack-like/Reflector.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+namespace elem {
+namespace hessenberg {
+
+template<typename F>
+inline void Unb( Matrix<F>& A, Matrix<F>& t )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hessenberg::Unb");
+#endif
+    const int n = A.Height();
+    const int tHeight = std::max(n-1,0);
+#ifndef RELEASE
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( t.Viewing() && (t.Height() != tHeight || t.Width() != 1) )
+        throw std::logic_error("t is of the wrong size");
+#endif
+    if( !t.Viewing() )
+        t.ResizeTo( tHeight, 1 );
+
+    // Matrix views
+    Matrix<F> alpha21T, a21, a21B, ARight, A22;
+
+    // Temporary matrices
+    Matrix<F> x12Adj, w01;
+
+    for( int j=0; j<n-1; ++j )
+    {
+        View( a21, A, j+1, j, n-(j+1), 1 );
+        PartitionDown
+        ( a21, alpha21T,
+               a21B,     1 );
+        View( A22, A, j+1, j+1, n-(j+1), n-(j+1) );
+        View( ARight, A, 0, j+1, n, n-(j+1) );
+
+        const F tau = Reflector( alpha21T, a21B );
+        const F epsilon1 = alpha21T.Get(0,0);
+        t.Set(j,0,tau);
+        alpha21T.Set(0,0,F(1));
+
+        // A22 := (I - tau a21 a21^H)^H A22
+        Zeros( x12Adj, n-(j+1), 1 );
+        Gemv( ADJOINT, F(1), A22, a21, F(0), x12Adj );
+        Ger( -Conj(tau), a21, x12Adj, A22 );
+
+        // ARight := ARight (I - tau a21 a21^H)
+        Zeros( w01, n, 1 );
+        Gemv( NORMAL, F(1), ARight, a21, F(0), w01 );
+        Ger( -tau, w01, a21, ARight );
+
+        alpha21T.Set(0,0,epsilon1);
+    }
+}
+
+} // namespace hessenberg
+} // namespace elem
+
+#endif // ifndef LAPACK_HESSENBERG_UNB_HPP
@@ -19,6 +19,10 @@ void LocalLDL
 } // namespace elem
 
 #include "./LDL/Var3.hpp"
+#include "./LDL/BunchKaufman.hpp"
+#include "./LDL/Inertia.hpp"
+#include "./LDL/SolveAfter.hpp"
+#include "./LDL/SelectedInverse.hpp"
 
 namespace elem {
 
@@ -81,6 +85,28 @@ LDLH( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d )
     ldl::Var3( ADJOINT, A, d );
 }
 
+template<typename F>
+inline void
+LDLH( Matrix<F>& A, Matrix<F>& d, Matrix<F>& dSub, Matrix<int>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLH");
+#endif
+    ldl::BunchKaufman( ADJOINT, A, d, dSub, p );
+}
+
+template<typename F>
+inline void 
+LDLH
+( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d, DistMatrix<F,MC,STAR>& dSub,
+  DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLH");
+#endif
+    ldl::BunchKaufman( ADJOINT, A, d, dSub, p );
+}
+
 template<typename F>
 inline void
 LDLT( Matrix<F>& A )
@@ -123,6 +149,28 @@ LDLT( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d )
     ldl::Var3( TRANSPOSE, A, d );
 }
 
+template<typename F>
+inline void
+LDLT( Matrix<F>& A, Matrix<F>& d, Matrix<F>& dSub, Matrix<int>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLT");
+#endif
+    ldl::BunchKaufman( TRANSPOSE, A, d, dSub, p );
+}
+
+template<typename F>
+inline void 
+LDLT
+( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d, DistMatrix<F,MC,STAR>& dSub,
+  DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LDLT");
+#endif
+    ldl::BunchKaufman( TRANSPOSE, A, d, dSub, p );
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_LDL_HPP
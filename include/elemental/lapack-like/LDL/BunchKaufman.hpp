@@ -0,0 +1,654 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LDL_BUNCHKAUFMAN_HPP
+#define LAPACK_LDL_BUNCHKAUFMAN_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level2/Gemv.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Symmetric indefinite factorizations, P A P^T = L D L^{T/H}, where L is
+// unit lower-triangular and D is block-diagonal with 1x1 and 2x2 blocks,
+// chosen with the partial pivoting strategy of Bunch and Kaufman.
+//
+// Only the lower triangle of A is referenced. On exit, the strictly lower
+// triangle of A is overwritten with L (with the entry of L directly beneath
+// the diagonal of each 2x2 block explicitly zeroed), d contains the diagonal
+// of D, and dSub contains its subdiagonal (which is zero wherever a 1x1
+// pivot was chosen). The pivots are stored as a sequence of symmetric
+// interchanges, so that the i'th step swaps rows/columns i and p(i); for a
+// 2x2 pivot beginning at index k, p(k)=k and the interchange is recorded
+// in p(k+1).
+
+namespace elem {
+namespace ldl {
+
+// The Bunch-Kaufman growth parameter, (1+sqrt(17))/8
+template<typename Real>
+inline Real
+BunchKaufmanAlpha()
+{ return (1+Sqrt(Real(17)))/8; }
+
+// Swap rows/columns 'to' and 'from' (to < from) of the symmetric matrix
+// stored in the lower triangle of A
+template<typename F>
+inline void
+SymmetricSwap( Orientation orientation, Matrix<F>& A, int to, int from )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SymmetricSwap");
+    if( to >= from )
+        throw std::logic_error("Expected to < from");
+#endif
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    F* ABuffer = A.Buffer();
+    const int ldim = A.LDim();
+
+    // Rows to the left of the 'to' column
+    for( int j=0; j<to; ++j )
+        std::swap( ABuffer[to+j*ldim], ABuffer[from+j*ldim] );
+    // Columns beneath the 'from' row
+    for( int i=from+1; i<n; ++i )
+        std::swap( ABuffer[i+to*ldim], ABuffer[i+from*ldim] );
+    // The segment between the two indices (which is transposed)
+    for( int k=to+1; k<from; ++k )
+    {
+        const F alpha = ABuffer[k+to*ldim];
+        const F beta = ABuffer[from+k*ldim];
+        ABuffer[k+to*ldim] = ( conjugate ? Conj(beta) : beta );
+        ABuffer[from+k*ldim] = ( conjugate ? Conj(alpha) : alpha );
+    }
+    if( conjugate )
+        ABuffer[from+to*ldim] = Conj(ABuffer[from+to*ldim]);
+    // The diagonal entries
+    std::swap( ABuffer[to+to*ldim], ABuffer[from+from*ldim] );
+}
+
+// Unblocked serial Bunch-Kaufman (right-looking)
+template<typename F>
+inline void
+BunchKaufman
+( Orientation orientation, Matrix<F>& A,
+  Matrix<F>& d, Matrix<F>& dSub, Matrix<int>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::BunchKaufman");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( orientation == NORMAL )
+        throw std::logic_error("Can only perform LDL^T or LDL^H");
+#endif
+    typedef BASE(F) Real;
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    Zeros( d, n, 1 );
+    Zeros( dSub, std::max(n-1,0), 1 );
+    p.ResizeTo( n, 1 );
+
+    const Real alpha = BunchKaufmanAlpha<Real>();
+    F* ABuffer = A.Buffer();
+    const int ldim = A.LDim();
+    std::vector<F> w0, w1;
+    int k=0;
+    while( k < n )
+    {
+        // Find the largest off-diagonal entry in the k'th column
+        const Real absakk =
+            ( conjugate ? Abs(RealPart(ABuffer[k+k*ldim]))
+                        : Abs(ABuffer[k+k*ldim]) );
+        int imax = k;
+        Real colmax = 0;
+        for( int i=k+1; i<n; ++i )
+        {
+            const Real absVal = Abs(ABuffer[i+k*ldim]);
+            if( absVal > colmax )
+            {
+                colmax = absVal;
+                imax = i;
+            }
+        }
+
+        int kp=k, kStep=1;
+        if( std::max(absakk,colmax) != Real(0) && absakk < alpha*colmax )
+        {
+            // Find the largest off-diagonal entry in the imax'th row/column
+            Real rowmax = 0;
+            for( int j=k; j<imax; ++j )
+                rowmax = std::max( rowmax, Abs(ABuffer[imax+j*ldim]) );
+            for( int i=imax+1; i<n; ++i )
+                rowmax = std::max( rowmax, Abs(ABuffer[i+imax*ldim]) );
+
+            const Real absaimax =
+                ( conjugate ? Abs(RealPart(ABuffer[imax+imax*ldim]))
+                            : Abs(ABuffer[imax+imax*ldim]) );
+            if( absakk >= alpha*colmax*(colmax/rowmax) )
+                kp = k;
+            else if( absaimax >= alpha*rowmax )
+                kp = imax;
+            else
+            {
+                kp = imax;
+                kStep = 2;
+            }
+        }
+
+        const int kk = k + kStep - 1;
+        if( kp != kk )
+            SymmetricSwap( orientation, A, kk, kp );
+        if( kStep == 1 )
+            p.Set( k, 0, kp );
+        else
+        {
+            p.Set( k, 0, k );
+            p.Set( k+1, 0, kp );
+        }
+
+        if( kStep == 1 )
+        {
+            // Form the 1x1 pivot and perform the rank-one update
+            F delta = ABuffer[k+k*ldim];
+            if( conjugate )
+                delta = RealPart(delta);
+            ABuffer[k+k*ldim] = delta;
+            d.Set( k, 0, delta );
+            const int a21Height = n - (k+1);
+            F* RESTRICT a21 = &ABuffer[(k+1)+k*ldim];
+            if( delta != F(0) )
+            {
+                // A22 := A22 - a21 (a21 / delta)^{T/H}
+                for( int j=0; j<a21Height; ++j )
+                {
+                    const F beta =
+                        ( conjugate ? Conj(a21[j]/delta) : a21[j]/delta );
+                    F* RESTRICT A22Col = &ABuffer[(k+1)+(k+1+j)*ldim];
+                    for( int i=j; i<a21Height; ++i )
+                        A22Col[i] -= a21[i]*beta;
+                }
+                for( int i=0; i<a21Height; ++i )
+                    a21[i] /= delta;
+            }
+        }
+        else
+        {
+            // Form the 2x2 pivot, D11 = [a, b^{T/H}; b, c]
+            F a = ABuffer[k+k*ldim];
+            F b = ABuffer[(k+1)+k*ldim];
+            F c = ABuffer[(k+1)+(k+1)*ldim];
+            if( conjugate )
+            {
+                a = RealPart(a);
+                c = RealPart(c);
+            }
+            const F bAdj = ( conjugate ? Conj(b) : b );
+            d.Set( k, 0, a );
+            d.Set( k+1, 0, c );
+            dSub.Set( k, 0, b );
+            ABuffer[k+k*ldim] = a;
+            ABuffer[(k+1)+k*ldim] = 0;
+            ABuffer[(k+1)+(k+1)*ldim] = c;
+
+            // Scale so that the inverse of D11 is formed without overflow:
+            //   [l0, l1] = [w0, w1] inv(D11)
+            const int a21Height = n - (k+2);
+            F* RESTRICT a21Left = &ABuffer[(k+2)+k*ldim];
+            F* RESTRICT a21Right = &ABuffer[(k+2)+(k+1)*ldim];
+            w0.assign( a21Left, a21Left+a21Height );
+            w1.assign( a21Right, a21Right+a21Height );
+            const F aScaled = a/bAdj;
+            const F cScaled = c/b;
+            const F tau = F(1)/(aScaled*cScaled-F(1));
+            const F leftScale = tau/bAdj;
+            const F rightScale = tau/b;
+            for( int i=0; i<a21Height; ++i )
+            {
+                a21Left[i] = leftScale*(cScaled*w0[i]-w1[i]);
+                a21Right[i] = rightScale*(aScaled*w1[i]-w0[i]);
+            }
+
+            // A22 := A22 - [l0, l1] [w0, w1]^{T/H}
+            for( int j=0; j<a21Height; ++j )
+            {
+                const F beta0 = ( conjugate ? Conj(w0[j]) : w0[j] );
+                const F beta1 = ( conjugate ? Conj(w1[j]) : w1[j] );
+                F* RESTRICT A22Col = &ABuffer[(k+2)+(k+2+j)*ldim];
+                for( int i=j; i<a21Height; ++i )
+                    A22Col[i] -= a21Left[i]*beta0 + a21Right[i]*beta1;
+            }
+        }
+        k += kStep;
+    }
+}
+
+// Swap rows i1 and i2 of a distributed matrix
+template<typename F>
+inline void
+SwapRows( DistMatrix<F>& A, int i1, int i2 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SwapRows");
+#endif
+    const Grid& g = A.Grid();
+    const int localWidth = A.LocalWidth();
+    if( i1 == i2 || localWidth == 0 )
+        return;
+    const int colStride = A.ColStride();
+    const int colAlignment = A.ColAlignment();
+    const int colShift = A.ColShift();
+    const int owner1 = (i1+colAlignment) % colStride;
+    const int owner2 = (i2+colAlignment) % colStride;
+    const int myRow = g.Row();
+    if( myRow == owner1 && myRow == owner2 )
+    {
+        const int i1Local = (i1-colShift) / colStride;
+        const int i2Local = (i2-colShift) / colStride;
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const F alpha = A.GetLocal(i1Local,jLocal);
+            A.SetLocal( i1Local, jLocal, A.GetLocal(i2Local,jLocal) );
+            A.SetLocal( i2Local, jLocal, alpha );
+        }
+    }
+    else if( myRow == owner1 || myRow == owner2 )
+    {
+        const int i = ( myRow == owner1 ? i1 : i2 );
+        const int partner = ( myRow == owner1 ? owner2 : owner1 );
+        const int iLocal = (i-colShift) / colStride;
+        std::vector<F> buffer( localWidth );
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            buffer[jLocal] = A.GetLocal(iLocal,jLocal);
+        mpi::SendRecv
+        ( &buffer[0], localWidth, partner, 0, partner, 0, g.ColComm() );
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            A.SetLocal( iLocal, jLocal, buffer[jLocal] );
+    }
+}
+
+// Swap columns j1 and j2 of a distributed matrix
+template<typename F>
+inline void
+SwapColumns( DistMatrix<F>& A, int j1, int j2 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SwapColumns");
+#endif
+    const Grid& g = A.Grid();
+    const int localHeight = A.LocalHeight();
+    if( j1 == j2 || localHeight == 0 )
+        return;
+    const int rowStride = A.RowStride();
+    const int rowAlignment = A.RowAlignment();
+    const int rowShift = A.RowShift();
+    const int owner1 = (j1+rowAlignment) % rowStride;
+    const int owner2 = (j2+rowAlignment) % rowStride;
+    const int myCol = g.Col();
+    if( myCol == owner1 && myCol == owner2 )
+    {
+        const int j1Local = (j1-rowShift) / rowStride;
+        const int j2Local = (j2-rowShift) / rowStride;
+        std::vector<F> buffer( localHeight );
+        MemCopy( &buffer[0], A.Buffer(0,j1Local), localHeight );
+        MemCopy( A.Buffer(0,j1Local), A.Buffer(0,j2Local), localHeight );
+        MemCopy( A.Buffer(0,j2Local), &buffer[0], localHeight );
+    }
+    else if( myCol == owner1 || myCol == owner2 )
+    {
+        const int j = ( myCol == owner1 ? j1 : j2 );
+        const int partner = ( myCol == owner1 ? owner2 : owner1 );
+        const int jLocal = (j-rowShift) / rowStride;
+        mpi::SendRecv
+        ( A.Buffer(0,jLocal), localHeight, partner, 0, partner, 0,
+          g.RowComm() );
+    }
+}
+
+template<typename F>
+inline void
+SymmetricSwap( Orientation orientation, DistMatrix<F>& A, int to, int from )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SymmetricSwap");
+    if( to >= from )
+        throw std::logic_error("Expected to < from");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+
+    // Rows to the left of the 'to' column
+    DistMatrix<F> ALeft(g);
+    View( ALeft, A, 0, 0, n, to );
+    SwapRows( ALeft, to, from );
+
+    // Columns beneath the 'from' row
+    DistMatrix<F> ABottom(g);
+    View( ABottom, A, from+1, 0, n-(from+1), n );
+    SwapColumns( ABottom, to, from );
+
+    // The segment between the two indices (which is transposed)
+    const int numBetween = from - (to+1);
+    if( numBetween > 0 )
+    {
+        DistMatrix<F> aCol(g), aRow(g);
+        View( aCol, A, to+1, to, numBetween, 1 );
+        View( aRow, A, from, to+1, 1, numBetween );
+        DistMatrix<F,STAR,STAR> aCol_STAR_STAR( aCol ), aRow_STAR_STAR( aRow );
+        if( aCol.LocalWidth() == 1 )
+        {
+            const int colShift = aCol.ColShift();
+            const int colStride = aCol.ColStride();
+            const int localHeight = aCol.LocalHeight();
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                const F beta = aRow_STAR_STAR.GetLocal(0,i);
+                aCol.SetLocal( iLocal, 0, (conjugate ? Conj(beta) : beta) );
+            }
+        }
+        if( aRow.LocalHeight() == 1 )
+        {
+            const int rowShift = aRow.RowShift();
+            const int rowStride = aRow.RowStride();
+            const int localWidth = aRow.LocalWidth();
+            for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            {
+                const int j = rowShift + jLocal*rowStride;
+                const F beta = aCol_STAR_STAR.GetLocal(j,0);
+                aRow.SetLocal( 0, jLocal, (conjugate ? Conj(beta) : beta) );
+            }
+        }
+    }
+    if( conjugate )
+        A.Set( from, to, Conj(A.Get(from,to)) );
+
+    // The diagonal entries
+    const F alphaTo = A.Get( to, to );
+    const F alphaFrom = A.Get( from, from );
+    A.Set( to, to, alphaFrom );
+    A.Set( from, from, alphaTo );
+}
+
+// Form the c'th column of the trailing symmetric matrix A(k:n-1,k:n-1),
+// including the updates from the pending columns j0:k-1 of the current panel,
+//   z := A(k:n-1,c) - L(k:n-1,j0:k-1) W(c,0:k-j0-1)^{T/H},
+// where W = L D over the panel's columns
+template<typename F>
+inline void
+UpdatedColumn
+( Orientation orientation, const DistMatrix<F>& A, const DistMatrix<F>& W,
+  int j0, int k, int c, DistMatrix<F,STAR,STAR>& z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::UpdatedColumn");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+
+    // Gather the original column from the lower triangle
+    DistMatrix<F> aRow(g), aCol(g);
+    LockedView( aRow, A, c, k, 1, c-k );
+    LockedView( aCol, A, c, c, n-c, 1 );
+    DistMatrix<F,STAR,STAR> aRow_STAR_STAR( aRow ), aCol_STAR_STAR( aCol );
+    z.ResizeTo( n-k, 1 );
+    for( int i=0; i<c-k; ++i )
+    {
+        const F beta = aRow_STAR_STAR.GetLocal(0,i);
+        z.SetLocal( i, 0, (conjugate ? Conj(beta) : beta) );
+    }
+    for( int i=0; i<n-c; ++i )
+        z.SetLocal( (c-k)+i, 0, aCol_STAR_STAR.GetLocal(i,0) );
+
+    // Subtract off the pending updates
+    const int numPending = k - j0;
+    if( numPending > 0 )
+    {
+        DistMatrix<F> L(g), wRow(g);
+        LockedView( L, A, k, j0, n-k, numPending );
+        LockedView( wRow, W, c-j0, 0, 1, numPending );
+        DistMatrix<F,STAR,STAR> wRow_STAR_STAR( wRow );
+        DistMatrix<F,MR,STAR> x_MR_STAR(g);
+        x_MR_STAR.AlignWith( L );
+        x_MR_STAR.ResizeTo( numPending, 1 );
+        const int colShift = x_MR_STAR.ColShift();
+        const int colStride = x_MR_STAR.ColStride();
+        const int localHeight = x_MR_STAR.LocalHeight();
+        for( int jLocal=0; jLocal<localHeight; ++jLocal )
+        {
+            const int j = colShift + jLocal*colStride;
+            const F beta = wRow_STAR_STAR.GetLocal(0,j);
+            x_MR_STAR.SetLocal( jLocal, 0, (conjugate ? Conj(beta) : beta) );
+        }
+        DistMatrix<F,MC,STAR> y_MC_STAR(g);
+        y_MC_STAR.AlignWith( L );
+        Zeros( y_MC_STAR, n-k, 1 );
+        LocalGemv( NORMAL, F(1), L, x_MR_STAR, F(0), y_MC_STAR );
+        y_MC_STAR.SumOverRow();
+        DistMatrix<F,STAR,STAR> y_STAR_STAR( y_MC_STAR );
+        Axpy( F(-1), y_STAR_STAR, z );
+    }
+}
+
+// Blocked distributed Bunch-Kaufman: each panel is factored in a left-looking
+// manner, with the pending updates accumulated in W = L D (as in LAPACK's
+// xLASYF), and the trailing matrix is then updated with a single rank-k
+// update, A22 := A22 - L21 W21^{T/H}
+template<typename F>
+inline void
+BunchKaufman
+( Orientation orientation, DistMatrix<F>& A,
+  DistMatrix<F,MC,STAR>& d, DistMatrix<F,MC,STAR>& dSub,
+  DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::BunchKaufman");
+    if( orientation == NORMAL )
+        throw std::logic_error("Can only perform LDL^T and LDL^H");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Grid() != d.Grid() || A.Grid() != dSub.Grid() ||
+        A.Grid() != p.Grid() )
+        throw std::logic_error("A, d, dSub, and p must use the same grid");
+#endif
+    typedef BASE(F) Real;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    d.AlignWith( A );
+    dSub.AlignWith( A );
+    Zeros( d, n, 1 );
+    Zeros( dSub, std::max(n-1,0), 1 );
+    p.ResizeTo( n, 1 );
+
+    const Real alpha = BunchKaufmanAlpha<Real>();
+    const int bsize = std::max( Blocksize(), 2 );
+
+    DistMatrix<F> W(g), ABR(g), wCol(g), aCol(g), A22(g), L21(g), W21(g);
+    DistMatrix<F,STAR,STAR> z(g), y(g), lCol(g);
+    DistMatrix<F,MC,STAR> L21_MC_STAR(g);
+    DistMatrix<F,MR,STAR> W21_MR_STAR(g);
+
+    int k=0;
+    while( k < n )
+    {
+        const int j0 = k;
+        const int nb = std::min( bsize, n-j0 );
+        const bool lastPanel = ( j0+nb == n );
+        LockedView( ABR, A, j0, j0, n-j0, n-j0 );
+        W.AlignWith( ABR );
+        Zeros( W, n-j0, nb );
+
+        // Factor columns of the panel until there might not be room for a
+        // 2x2 pivot, unless this is the last panel
+        while( k < n && (lastPanel || k-j0 < nb-1) )
+        {
+            UpdatedColumn( orientation, A, W, j0, k, k, z );
+
+            const F zeta = z.GetLocal(0,0);
+            const Real absakk =
+                ( conjugate ? Abs(RealPart(zeta)) : Abs(zeta) );
+            int imax = k;
+            Real colmax = 0;
+            for( int i=k+1; i<n; ++i )
+            {
+                const Real absVal = Abs(z.GetLocal(i-k,0));
+                if( absVal > colmax )
+                {
+                    colmax = absVal;
+                    imax = i;
+                }
+            }
+
+            int kp=k, kStep=1;
+            if( std::max(absakk,colmax) != Real(0) &&
+                absakk < alpha*colmax )
+            {
+                UpdatedColumn( orientation, A, W, j0, k, imax, y );
+                Real rowmax = 0;
+                for( int i=k; i<n; ++i )
+                    if( i != imax )
+                        rowmax = std::max( rowmax, Abs(y.GetLocal(i-k,0)) );
+
+                const F eta = y.GetLocal(imax-k,0);
+                const Real absaimax =
+                    ( conjugate ? Abs(RealPart(eta)) : Abs(eta) );
+                if( absakk >= alpha*colmax*(colmax/rowmax) )
+                    kp = k;
+                else if( absaimax >= alpha*rowmax )
+                {
+                    kp = imax;
+                    z = y;
+                }
+                else
+                {
+                    kp = imax;
+                    kStep = 2;
+                }
+            }
+
+            // Store the updated column(s) in W
+            View( wCol, W, k-j0, k-j0, n-k, 1 );
+            wCol = z;
+            if( kStep == 2 )
+            {
+                View( wCol, W, k-j0, k-j0+1, n-k, 1 );
+                wCol = y;
+            }
+
+            // Perform the symmetric interchange on A, W, and the updated
+            // columns
+            const int kk = k + kStep - 1;
+            if( kp != kk )
+            {
+                SymmetricSwap( orientation, A, kk, kp );
+                SwapRows( W, kk-j0, kp-j0 );
+                const F zetaKK = z.GetLocal(kk-k,0);
+                z.SetLocal( kk-k, 0, z.GetLocal(kp-k,0) );
+                z.SetLocal( kp-k, 0, zetaKK );
+                if( kStep == 2 )
+                {
+                    const F etaKK = y.GetLocal(kk-k,0);
+                    y.SetLocal( kk-k, 0, y.GetLocal(kp-k,0) );
+                    y.SetLocal( kp-k, 0, etaKK );
+                }
+            }
+            if( kStep == 1 )
+                p.Set( k, 0, kp );
+            else
+            {
+                p.Set( k, 0, k );
+                p.Set( k+1, 0, kp );
+            }
+
+            if( kStep == 1 )
+            {
+                // Form the 1x1 pivot and the k'th column of L
+                F delta = z.GetLocal(0,0);
+                if( conjugate )
+                    delta = RealPart(delta);
+                d.Set( k, 0, delta );
+                lCol.ResizeTo( n-k, 1 );
+                lCol.SetLocal( 0, 0, delta );
+                for( int i=1; i<n-k; ++i )
+                    lCol.SetLocal
+                    ( i, 0, (delta != F(0) ? z.GetLocal(i,0)/delta : F(0)) );
+                View( aCol, A, k, k, n-k, 1 );
+                aCol = lCol;
+            }
+            else
+            {
+                // Form the 2x2 pivot and the k'th and k+1'th columns of L
+                F a = z.GetLocal(0,0);
+                const F b = z.GetLocal(1,0);
+                F c = y.GetLocal(1,0);
+                if( conjugate )
+                {
+                    a = RealPart(a);
+                    c = RealPart(c);
+                }
+                const F bAdj = ( conjugate ? Conj(b) : b );
+                d.Set( k, 0, a );
+                d.Set( k+1, 0, c );
+                dSub.Set( k, 0, b );
+
+                const F aScaled = a/bAdj;
+                const F cScaled = c/b;
+                const F tau = F(1)/(aScaled*cScaled-F(1));
+                const F leftScale = tau/bAdj;
+                const F rightScale = tau/b;
+                lCol.ResizeTo( n-k, 2 );
+                lCol.SetLocal( 0, 0, a );
+                lCol.SetLocal( 1, 0, 0 );
+                lCol.SetLocal( 0, 1, 0 );
+                lCol.SetLocal( 1, 1, c );
+                for( int i=2; i<n-k; ++i )
+                {
+                    const F omega0 = z.GetLocal(i,0);
+                    const F omega1 = y.GetLocal(i,0);
+                    lCol.SetLocal( i, 0, leftScale*(cScaled*omega0-omega1) );
+                    lCol.SetLocal( i, 1, rightScale*(aScaled*omega1-omega0) );
+                }
+                DistMatrix<F,STAR,STAR> lSub(g);
+                View( aCol, A, k, k, n-k, 1 );
+                LockedView( lSub, lCol, 0, 0, n-k, 1 );
+                aCol = lSub;
+                View( aCol, A, k+1, k+1, n-(k+1), 1 );
+                LockedView( lSub, lCol, 1, 1, n-(k+1), 1 );
+                aCol = lSub;
+            }
+            k += kStep;
+        }
+
+        // A22 := A22 - L21 W21^{T/H}
+        if( k < n )
+        {
+            const int kb = k - j0;
+            View( A22, A, k, k, n-k, n-k );
+            LockedView( L21, A, k, j0, n-k, kb );
+            LockedView( W21, W, kb, 0, n-k, kb );
+            L21_MC_STAR.AlignWith( A22 );
+            W21_MR_STAR.AlignWith( A22 );
+            //----------------------------------------------------------------//
+            L21_MC_STAR = L21;
+            W21_MR_STAR = W21;
+            LocalTrrk
+            ( LOWER, orientation,
+              F(-1), L21_MC_STAR, W21_MR_STAR, F(1), A22 );
+            //----------------------------------------------------------------//
+            L21_MC_STAR.FreeAlignments();
+            W21_MR_STAR.FreeAlignments();
+        }
+    }
+}
+
+} // namespace ldl
+} // namespace elem
+
+#endif // ifndef LAPACK_LDL_BUNCHKAUFMAN_HPP
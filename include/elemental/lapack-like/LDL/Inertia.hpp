@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LDL_INERTIA_HPP
+#define LAPACK_LDL_INERTIA_HPP
+
+namespace elem {
+namespace ldl {
+
+// By Sylvester's law of inertia, a Hermitian matrix has the same inertia as
+// the block-diagonal factor D from its LDL^H factorization. Each 2x2 block
+// is counted using the sign of its determinant and trace.
+template<typename F>
+inline InertiaType<int>
+Inertia( const Matrix<F>& d, const Matrix<F>& dSub )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::Inertia");
+#endif
+    typedef BASE(F) R;
+    const int n = d.Height();
+    InertiaType<int> inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    int k=0;
+    while( k < n )
+    {
+        const F b = ( k < n-1 ? dSub.Get(k,0) : F(0) );
+        if( b == F(0) )
+        {
+            const R delta = RealPart(d.Get(k,0));
+            if( delta > R(0) )
+                ++inertia.numPositive;
+            else if( delta < R(0) )
+                ++inertia.numNegative;
+            else
+                ++inertia.numZero;
+            k += 1;
+        }
+        else
+        {
+            const R a = RealPart(d.Get(k,0));
+            const R c = RealPart(d.Get(k+1,0));
+            const R bAbs = Abs(b);
+            const R det = a*c - bAbs*bAbs;
+            const R trace = a + c;
+            if( det < R(0) )
+            {
+                ++inertia.numPositive;
+                ++inertia.numNegative;
+            }
+            else if( det > R(0) )
+            {
+                if( trace > R(0) )
+                    inertia.numPositive += 2;
+                else
+                    inertia.numNegative += 2;
+            }
+            else
+            {
+                ++inertia.numZero;
+                if( trace > R(0) )
+                    ++inertia.numPositive;
+                else if( trace < R(0) )
+                    ++inertia.numNegative;
+                else
+                    ++inertia.numZero;
+            }
+            k += 2;
+        }
+    }
+    return inertia;
+}
+
+template<typename F>
+inline InertiaType<int>
+Inertia( const DistMatrix<F,MC,STAR>& d, const DistMatrix<F,MC,STAR>& dSub )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::Inertia");
+#endif
+    DistMatrix<F,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+    return Inertia( d_STAR_STAR.LockedMatrix(), dSub_STAR_STAR.LockedMatrix() );
+}
+
+} // namespace ldl
+} // namespace elem
+
+#endif // ifndef LAPACK_LDL_INERTIA_HPP
@@ -0,0 +1,372 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LDL_SELECTEDINVERSE_HPP
+#define LAPACK_LDL_SELECTEDINVERSE_HPP
+
+#include "elemental/lapack-like/Cholesky/SelectedInverse.hpp"
+#include "elemental/lapack-like/LDL/SolveAfter.hpp"
+
+// Selected entries of the inverse of a Hermitian or symmetric matrix from its
+// LDL^H or LDL^T factorization, A = P^T L D L^{H/T} P, where L is unit lower
+// triangular, D is block diagonal with 1x1 and 2x2 blocks, and P is a
+// permutation. With X = inv(L),
+//
+//   inv(A)(i,j) = (X^{H/T} inv(D) X)(sigma(i),sigma(j)),
+//
+// where sigma(i) is the position that index i is pivoted to. As in the
+// Cholesky case, only the trailing submatrix of X beginning at the smallest
+// needed index is formed.
+
+namespace elem {
+namespace ldl {
+
+// invPerm[i] is the row of P A which row i of A is moved to
+inline void
+InversePivots( const Matrix<int>& p, std::vector<int>& invPerm )
+{
+    const int n = p.Height();
+    std::vector<int> perm( n );
+    for( int i=0; i<n; ++i )
+        perm[i] = i;
+    for( int i=0; i<n; ++i )
+        std::swap( perm[i], perm[p.Get(i,0)] );
+    invPerm.resize( n );
+    for( int i=0; i<n; ++i )
+        invPerm[perm[i]] = i;
+}
+
+// Return the row at which the trailing submatrix of X must begin so that
+// none of the given indices are excluded and no 2x2 block of D is split
+template<typename F>
+inline int
+SelectedInverseOffset
+( const Matrix<F>& dSub, const std::vector<int>& rowInds,
+  const std::vector<int>& colInds, int n )
+{
+    int k = elem::internal::MinSelectedIndex( n, rowInds, colInds );
+    if( k > 0 && k < n && dSub.Get(k-1,0) != F(0) )
+        --k;
+    return k;
+}
+
+// Z := XRow^{H/T} inv(D(k:n-1,k:n-1)) XCol, where XCol is overwritten
+template<typename F>
+inline void
+SelectedInverseKernel
+( Orientation orientation, const Matrix<F>& d, const Matrix<F>& dSub, int k,
+  const Matrix<F>& XRow, Matrix<F>& XCol, Matrix<F>& Z )
+{
+    const int n = d.Height();
+    Matrix<F> dBR, dSubBR;
+    LockedView( dBR, d, k, 0, n-k, 1 );
+    LockedView( dSubBR, dSub, k, 0, std::max(n-k-1,0), 1 );
+    BlockDiagonalSolve( orientation, dBR, dSubBR, XCol );
+    Gemm( orientation, NORMAL, F(1), XRow, XCol, F(0), Z );
+}
+
+//
+// Overwrite dInv with the diagonal of inv(A) from the factorization computed
+// by ldl::BunchKaufman
+//
+
+template<typename F>
+inline void
+InverseDiagonal
+( Orientation orientation, const Matrix<F>& A,
+  const Matrix<F>& d, const Matrix<F>& dSub, const Matrix<int>& p,
+  Matrix<F>& dInv )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::InverseDiagonal");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( d.Height() != A.Height() || p.Height() != A.Height() )
+        throw std::logic_error("d and p must be the same height as A");
+    if( orientation == NORMAL )
+        throw std::logic_error("Invalid orientation");
+#endif
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    Matrix<F> X, Y;
+    elem::internal::TrailingLowerInverse( LOWER, UNIT, A, 0, X );
+    Y = X;
+    BlockDiagonalSolve( orientation, d, dSub, Y );
+
+    std::vector<int> invPerm;
+    InversePivots( p, invPerm );
+    dInv.ResizeTo( n, 1 );
+    for( int i=0; i<n; ++i )
+    {
+        const int j = invPerm[i];
+        F gamma = 0;
+        for( int k=j; k<n; ++k )
+        {
+            const F chi = X.Get(k,j);
+            gamma += ( conjugate ? Conj(chi) : chi )*Y.Get(k,j);
+        }
+        dInv.Set( i, 0, gamma );
+    }
+}
+
+template<typename F>
+inline void
+InverseDiagonal
+( Orientation orientation, const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& d, const DistMatrix<F,MC,STAR>& dSub,
+  const DistMatrix<int,VC,STAR>& p, DistMatrix<F,VR,STAR>& dInv )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::InverseDiagonal");
+    if( A.Grid() != dInv.Grid() )
+        throw std::logic_error
+        ("{A,dInv} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( d.Height() != A.Height() || p.Height() != A.Height() )
+        throw std::logic_error("d and p must be the same height as A");
+    if( orientation == NORMAL )
+        throw std::logic_error("Invalid orientation");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    DistMatrix<F> X( g );
+    elem::internal::TrailingLowerInverse( LOWER, UNIT, A, 0, X );
+
+    // Since the 2x2 blocks of D couple neighboring rows, each process works
+    // with entire columns of X
+    DistMatrix<F,STAR,VR> X_STAR_VR( X );
+    DistMatrix<F,STAR,VR> Y_STAR_VR( X_STAR_VR );
+    {
+        DistMatrix<F,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+        BlockDiagonalSolve
+        ( orientation, d_STAR_STAR.LockedMatrix(),
+          dSub_STAR_STAR.LockedMatrix(), Y_STAR_VR.Matrix() );
+    }
+    std::vector<F> mDiag( n, F(0) );
+    const int rowShift = X_STAR_VR.RowShift();
+    const int rowStride = X_STAR_VR.RowStride();
+    const int localWidth = X_STAR_VR.LocalWidth();
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        F gamma = 0;
+        for( int k=j; k<n; ++k )
+        {
+            const F chi = X_STAR_VR.GetLocal(k,jLoc);
+            const F psi = Y_STAR_VR.GetLocal(k,jLoc);
+            gamma += ( conjugate ? Conj(chi) : chi )*psi;
+        }
+        mDiag[j] = gamma;
+    }
+    if( n > 0 )
+        mpi::AllReduce( &mDiag[0], n, mpi::SUM, g.VRComm() );
+
+    // Undo the symmetric pivoting
+    std::vector<int> invPerm;
+    {
+        DistMatrix<int,STAR,STAR> p_STAR_STAR( p );
+        InversePivots( p_STAR_STAR.LockedMatrix(), invPerm );
+    }
+    dInv.ResizeTo( n, 1 );
+    const int colShift = dInv.ColShift();
+    const int colStride = dInv.ColStride();
+    const int localHeight = dInv.LocalHeight();
+    for( int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const int i = colShift + iLoc*colStride;
+        dInv.SetLocal( iLoc, 0, mDiag[invPerm[i]] );
+    }
+}
+
+// Unpivoted LDL^H and LDL^T factorizations, as computed by LDLH and LDLT
+template<typename F>
+inline void
+InverseDiagonal
+( Orientation orientation, const Matrix<F>& A, const Matrix<F>& d,
+  Matrix<F>& dInv )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::InverseDiagonal");
+#endif
+    const int n = A.Height();
+    Matrix<F> dSub;
+    Matrix<int> p;
+    Zeros( dSub, std::max(n-1,0), 1 );
+    p.ResizeTo( n, 1 );
+    for( int i=0; i<n; ++i )
+        p.Set( i, 0, i );
+    InverseDiagonal( orientation, A, d, dSub, p, dInv );
+}
+
+template<typename F>
+inline void
+InverseDiagonal
+( Orientation orientation, const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& d, DistMatrix<F,VR,STAR>& dInv )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::InverseDiagonal");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F,MC,STAR> dSub( g );
+    DistMatrix<int,VC,STAR> p( g );
+    Zeros( dSub, std::max(n-1,0), 1 );
+    p.ResizeTo( n, 1 );
+    const int colShift = p.ColShift();
+    const int colStride = p.ColStride();
+    const int localHeight = p.LocalHeight();
+    for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        p.SetLocal( iLoc, 0, colShift+iLoc*colStride );
+    InverseDiagonal( orientation, A, d, dSub, p, dInv );
+}
+
+//
+// Form the submatrix inv(A)(rowInds,colInds) from an LDL factorization
+//
+
+template<typename F>
+inline void
+SelectedInverse
+( Orientation orientation, const Matrix<F>& A,
+  const Matrix<F>& d, const Matrix<F>& dSub, const Matrix<int>& p,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  Matrix<F>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SelectedInverse");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( d.Height() != A.Height() || p.Height() != A.Height() )
+        throw std::logic_error("d and p must be the same height as A");
+    if( orientation == NORMAL )
+        throw std::logic_error("Invalid orientation");
+#endif
+    const int n = A.Height();
+    Zeros( Z, rowInds.size(), colInds.size() );
+    if( rowInds.size() == 0 || colInds.size() == 0 )
+        return;
+
+    std::vector<int> invPerm;
+    InversePivots( p, invPerm );
+    std::vector<int> rowPerm( rowInds.size() ), colPerm( colInds.size() );
+    for( unsigned t=0; t<rowInds.size(); ++t )
+        rowPerm[t] = invPerm[rowInds[t]];
+    for( unsigned t=0; t<colInds.size(); ++t )
+        colPerm[t] = invPerm[colInds[t]];
+    const int k = SelectedInverseOffset( dSub, rowPerm, colPerm, n );
+
+    Matrix<F> X, XRow, XCol;
+    elem::internal::TrailingLowerInverse( LOWER, UNIT, A, k, X );
+    elem::internal::GatherColumns( X, rowPerm, k, XRow );
+    elem::internal::GatherColumns( X, colPerm, k, XCol );
+    SelectedInverseKernel( orientation, d, dSub, k, XRow, XCol, Z );
+}
+
+template<typename F>
+inline void
+SelectedInverse
+( Orientation orientation, const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& d, const DistMatrix<F,MC,STAR>& dSub,
+  const DistMatrix<int,VC,STAR>& p,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  DistMatrix<F,STAR,STAR>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SelectedInverse");
+    if( A.Grid() != Z.Grid() )
+        throw std::logic_error("{A,Z} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( d.Height() != A.Height() || p.Height() != A.Height() )
+        throw std::logic_error("d and p must be the same height as A");
+    if( orientation == NORMAL )
+        throw std::logic_error("Invalid orientation");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    Zeros( Z, rowInds.size(), colInds.size() );
+    if( rowInds.size() == 0 || colInds.size() == 0 )
+        return;
+
+    DistMatrix<F,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+    std::vector<int> invPerm;
+    {
+        DistMatrix<int,STAR,STAR> p_STAR_STAR( p );
+        InversePivots( p_STAR_STAR.LockedMatrix(), invPerm );
+    }
+    std::vector<int> rowPerm( rowInds.size() ), colPerm( colInds.size() );
+    for( unsigned t=0; t<rowInds.size(); ++t )
+        rowPerm[t] = invPerm[rowInds[t]];
+    for( unsigned t=0; t<colInds.size(); ++t )
+        colPerm[t] = invPerm[colInds[t]];
+    const int k = SelectedInverseOffset
+        ( dSub_STAR_STAR.LockedMatrix(), rowPerm, colPerm, n );
+
+    DistMatrix<F> X( g );
+    Matrix<F> XRow, XCol;
+    elem::internal::TrailingLowerInverse( LOWER, UNIT, A, k, X );
+    elem::internal::GatherColumns( X, rowPerm, k, XRow );
+    elem::internal::GatherColumns( X, colPerm, k, XCol );
+    SelectedInverseKernel
+    ( orientation, d_STAR_STAR.LockedMatrix(), dSub_STAR_STAR.LockedMatrix(),
+      k, XRow, XCol, Z.Matrix() );
+}
+
+template<typename F>
+inline void
+SelectedInverse
+( Orientation orientation, const Matrix<F>& A, const Matrix<F>& d,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  Matrix<F>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SelectedInverse");
+#endif
+    const int n = A.Height();
+    Matrix<F> dSub;
+    Matrix<int> p;
+    Zeros( dSub, std::max(n-1,0), 1 );
+    p.ResizeTo( n, 1 );
+    for( int i=0; i<n; ++i )
+        p.Set( i, 0, i );
+    SelectedInverse( orientation, A, d, dSub, p, rowInds, colInds, Z );
+}
+
+template<typename F>
+inline void
+SelectedInverse
+( Orientation orientation, const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& d,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  DistMatrix<F,STAR,STAR>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SelectedInverse");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F,MC,STAR> dSub( g );
+    DistMatrix<int,VC,STAR> p( g );
+    Zeros( dSub, std::max(n-1,0), 1 );
+    p.ResizeTo( n, 1 );
+    const int colShift = p.ColShift();
+    const int colStride = p.ColStride();
+    const int localHeight = p.LocalHeight();
+    for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        p.SetLocal( iLoc, 0, colShift+iLoc*colStride );
+    SelectedInverse( orientation, A, d, dSub, p, rowInds, colInds, Z );
+}
+
+} // namespace ldl
+} // namespace elem
+
+#endif // ifndef LAPACK_LDL_SELECTEDINVERSE_HPP
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LDL_SOLVEAFTER_HPP
+#define LAPACK_LDL_SOLVEAFTER_HPP
+
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyRowPivots.hpp"
+
+namespace elem {
+namespace ldl {
+
+// Solve against the block-diagonal matrix D = diag(d) + subdiag(dSub) with
+// 1x1 and 2x2 blocks (the superdiagonal is the transpose/adjoint of dSub)
+template<typename F>
+inline void
+BlockDiagonalSolve
+( Orientation orientation, const Matrix<F>& d, const Matrix<F>& dSub,
+  Matrix<F>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::BlockDiagonalSolve");
+    if( d.Height() != B.Height() )
+        throw std::logic_error("d and B must be the same height");
+#endif
+    const int n = B.Height();
+    const int width = B.Width();
+    const bool conjugate = ( orientation == ADJOINT );
+    int k=0;
+    while( k < n )
+    {
+        const F b = ( k < n-1 ? dSub.Get(k,0) : F(0) );
+        if( b == F(0) )
+        {
+            const F delta = d.Get(k,0);
+            if( delta == F(0) )
+                throw SingularMatrixException();
+            for( int j=0; j<width; ++j )
+                B.Set( k, j, B.Get(k,j)/delta );
+            k += 1;
+        }
+        else
+        {
+            // Apply inv([a, b^{T/H}; b, c]) using the same scaling as the
+            // factorization
+            const F a = d.Get(k,0);
+            const F c = d.Get(k+1,0);
+            const F bAdj = ( conjugate ? Conj(b) : b );
+            const F aScaled = a/bAdj;
+            const F cScaled = c/b;
+            const F denom = aScaled*cScaled-F(1);
+            if( denom == F(0) )
+                throw SingularMatrixException();
+            const F tau = F(1)/denom;
+            for( int j=0; j<width; ++j )
+            {
+                const F beta0 = B.Get(k,j)/bAdj;
+                const F beta1 = B.Get(k+1,j)/b;
+                B.Set( k, j, tau*(cScaled*beta0-beta1) );
+                B.Set( k+1, j, tau*(aScaled*beta1-beta0) );
+            }
+            k += 2;
+        }
+    }
+}
+
+template<typename F>
+inline void
+SolveAfter
+( Orientation orientation, const Matrix<F>& A,
+  const Matrix<F>& d, const Matrix<F>& dSub, const Matrix<int>& p,
+  Matrix<F>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SolveAfter");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+    if( p.Height() != A.Height() )
+        throw std::logic_error("A and p must be the same height");
+    if( orientation == NORMAL )
+        throw std::logic_error("Invalid orientation");
+#endif
+    ApplyRowPivots( B, p );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A, B );
+    BlockDiagonalSolve( orientation, d, dSub, B );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), A, B );
+    ApplyInverseRowPivots( B, p );
+}
+
+template<typename F>
+inline void
+SolveAfter
+( Orientation orientation, const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& d, const DistMatrix<F,MC,STAR>& dSub,
+  const DistMatrix<int,VC,STAR>& p, DistMatrix<F>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ldl::SolveAfter");
+    if( A.Grid() != B.Grid() || A.Grid() != p.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+    if( A.Height() != p.Height() )
+        throw std::logic_error("A and p must be the same height");
+    if( orientation == NORMAL )
+        throw std::logic_error("Invalid orientation");
+#endif
+    ApplyRowPivots( B, p );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A, B );
+    {
+        DistMatrix<F,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+        DistMatrix<F,STAR,MR> B_STAR_MR( B );
+        BlockDiagonalSolve
+        ( orientation, d_STAR_STAR.LockedMatrix(),
+          dSub_STAR_STAR.LockedMatrix(), B_STAR_MR.Matrix() );
+        B = B_STAR_MR;
+    }
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), A, B );
+    ApplyInverseRowPivots( B, p );
+}
+
+} // namespace ldl
+} // namespace elem
+
+#endif // ifndef LAPACK_LDL_SOLVEAFTER_HPP
@@ -18,6 +18,7 @@
 #include "elemental/lapack-like/LU/Panel.hpp"
 
 #include "elemental/lapack-like/LU/SolveAfter.hpp"
+#include "elemental/lapack-like/LU/OutOfCore.hpp"
 
 namespace elem {
 
@@ -89,7 +90,7 @@ LU( DistMatrix<F>& A )
                          A20(g), A21(g), A22(g);
 
     // Temporary distributions
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    SharedStarStar<F> A11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> A21_MC_STAR(g);
     DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
@@ -112,19 +113,27 @@ LU( DistMatrix<F>& A )
         A11_STAR_STAR.ResizeTo( A11.Height(), A11.Width() );
         //--------------------------------------------------------------------//
         A11_STAR_STAR = A11;
-        LocalLU( A11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        try
+        {
+            if( A11_STAR_STAR.NodeLeader() )
+                LocalLU( A11_STAR_STAR.Replica() );
+        }
+        catch( std::exception& e ) { A11_STAR_STAR.Fail( e ); }
+        A11_STAR_STAR.Synchronize();
+        A11 = A11_STAR_STAR.LockedReplica();
 
         A21_MC_STAR = A21;
         LocalTrsm
-        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A21_MC_STAR );
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR.LockedReplica(),
+          A21_MC_STAR );
         A21 = A21_MC_STAR;
 
         // Perhaps we should give up perfectly distributing this operation since
         // it's total contribution is only O(n^2)
         A12_STAR_VR = A12;
         LocalTrsm
-        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR.LockedReplica(),
+          A12_STAR_VR );
 
         A12_STAR_MR = A12_STAR_VR;
         LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
@@ -217,6 +226,78 @@ LU( Matrix<F>& A, Matrix<int>& p )
     }
 }
 
+namespace batch {
+
+template<typename F>
+struct LUFunctor
+{
+    MatrixBatch<F>* A;
+    MatrixBatch<int>* p;
+
+    LUFunctor( MatrixBatch<F>& ABatch, MatrixBatch<int>* pBatch )
+    : A(&ABatch), p(pBatch)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F> AView;
+        A->View( k, AView );
+        if( p == 0 )
+        {
+            LU( AView );
+        }
+        else
+        {
+            Matrix<int> pView;
+            p->View( k, pView );
+            LU( AView, pView );
+        }
+    }
+};
+
+} // namespace batch
+
+// Independently factor each member of a batch without pivoting, starting
+// with the most expensive members
+template<typename F>
+inline void
+LU( MatrixBatch<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LU");
+#endif
+    std::vector<int> order;
+    batch::DescendingCostOrder( A, order );
+    batch::Apply( order, batch::LUFunctor<F>(A,0) );
+}
+
+// Independently factor each member of a batch with partial pivoting; unless
+// p is viewing existing pivot vectors, it is resized to hold them
+template<typename F>
+inline void
+LU( MatrixBatch<F>& A, MatrixBatch<int>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LU");
+#endif
+    const int batchSize = A.Size();
+    if( p.Viewing() )
+    {
+        if( p.Size() != batchSize )
+            throw std::logic_error("Batches must be the same size");
+    }
+    else
+    {
+        std::vector<int> heights( batchSize ), widths( batchSize, 1 );
+        for( int k=0; k<batchSize; ++k )
+            heights[k] = std::min( A.Height(k), A.Width(k) );
+        p.ResizeTo( heights, widths );
+    }
+    std::vector<int> order;
+    batch::DescendingCostOrder( A, order );
+    batch::Apply( order, batch::LUFunctor<F>(A,&p) );
+}
+
 template<typename F> 
 inline void
 LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
@@ -320,6 +401,22 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
     }
 }
 
+// Factor a matrix stored on disk, with partial pivoting, by streaming panels
+// of its columns through roughly 'memoryBudget' bytes of memory per process
+template<typename F>
+inline void
+LU
+( DiskDistMatrix<F>& A, DistMatrix<int,VC,STAR>& p,
+  std::size_t memoryBudget )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LU");
+    if( A.Grid() != p.Grid() )
+        throw std::logic_error("{A,p} must be distributed over the same grid");
+#endif
+    lu::OutOfCore( A, p, memoryBudget );
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_LU_HPP
@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LU_OUTOFCORE_HPP
+#define LAPACK_LU_OUTOFCORE_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyRowPivots.hpp"
+#include "elemental/lapack-like/OutOfCore.hpp"
+
+namespace elem {
+namespace lu {
+
+// Each factored panel is stored with only its own row interchanges applied
+// (so that its L is consistent with the panels to its right at the time of
+// their updates), and the pivots are stored relative to the entire matrix
+template<typename F>
+struct OutOfCoreFunctor
+{
+    int panelWidth;
+    DistMatrix<int,STAR,STAR>* p;
+
+    OutOfCoreFunctor( int width, DistMatrix<int,STAR,STAR>& pAll )
+    : panelWidth(width), p(&pAll)
+    { }
+
+    void Update( int i, const DistMatrix<F>& S, int j, DistMatrix<F>& T )
+    {
+        const Grid& g = T.Grid();
+        const int m = T.Height();
+        if( i >= m )
+            return;
+        const int width = std::min( S.Width(), m-i );
+
+        // Apply the row interchanges of the panel containing S
+        if( i % panelWidth == 0 )
+        {
+            const int numPivots = std::min( panelWidth, p->Height()-i );
+            DistMatrix<int,STAR,STAR> pPanel(g);
+            LockedView( pPanel, *p, i, 0, numPivots, 1 );
+            std::vector<int> image, preimage;
+            ComposePivots( pPanel, i, image, preimage );
+            DistMatrix<F> TB(g);
+            View( TB, T, i, 0, m-i, T.Width() );
+            ApplyRowPivots( TB, image, preimage );
+        }
+
+        DistMatrix<F> S11(g), S21(g), T1(g), T2(g);
+        LockedView( S11, S, i, 0, width, width );
+        LockedView( S21, S, i+width, 0, m-i-width, width );
+        View( T1, T, i, 0, width, T.Width() );
+        View( T2, T, i+width, 0, m-i-width, T.Width() );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), S11, T1 );
+        Gemm( NORMAL, NORMAL, F(-1), S21, T1, F(1), T2 );
+    }
+
+    void Factor( int j, DistMatrix<F>& T )
+    {
+        const Grid& g = T.Grid();
+        const int m = T.Height();
+        if( j >= m )
+            return;
+        DistMatrix<F> TB(g);
+        View( TB, T, j, 0, m-j, T.Width() );
+        DistMatrix<int,VC,STAR> pPanel(g);
+        LU( TB, pPanel );
+
+        // Store the pivots relative to the entire matrix
+        DistMatrix<int,STAR,STAR> pPanel_STAR_STAR( pPanel );
+        for( int k=0; k<pPanel_STAR_STAR.Height(); ++k )
+            p->SetLocal( j+k, 0, pPanel_STAR_STAR.GetLocal(k,0)+j );
+    }
+};
+
+// Apply the row interchanges of the panels to the right of each panel
+template<typename F>
+inline void
+OutOfCorePivots
+( DiskDistMatrix<F>& A, int panelWidth, const DistMatrix<int,STAR,STAR>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lu::OutOfCorePivots");
+#endif
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = p.Height();
+    Memory<F> memory[2];
+    F* buffers[2];
+    for( int k=0; k<2; ++k )
+        buffers[k] = memory[k].Require( A.PanelSize(panelWidth) );
+    DistMatrix<F> P0(g), P1(g);
+    DistMatrix<F>* panels[2] = { &P0, &P1 };
+    std::vector<mpi::Request> requests[2];
+
+    if( panelWidth < minDim )
+    {
+        A.AttachPanel( 0, panelWidth, buffers[0], P0 );
+        A.StartRead( 0, P0, requests[0] );
+    }
+    int panel = 0;
+    std::vector<int> image, preimage;
+    for( int i=0; i+panelWidth<minDim; i+=panelWidth )
+    {
+        DistMatrix<F>& P = *panels[panel];
+        DiskDistMatrix<F>::Wait( requests[panel] );
+
+        const int iNext = i + panelWidth;
+        if( iNext+panelWidth < minDim )
+        {
+            DiskDistMatrix<F>::Wait( requests[1-panel] );
+            A.AttachPanel
+            ( iNext, std::min(panelWidth,n-iNext), buffers[1-panel],
+              *panels[1-panel] );
+            A.StartRead( iNext, *panels[1-panel], requests[1-panel] );
+        }
+
+        DistMatrix<int,STAR,STAR> pAfter(g);
+        LockedView( pAfter, p, iNext, 0, minDim-iNext, 1 );
+        ComposePivots( pAfter, iNext, image, preimage );
+        DistMatrix<F> PB(g);
+        View( PB, P, iNext, 0, m-iNext, P.Width() );
+        ApplyRowPivots( PB, image, preimage );
+        A.StartWrite( i, P, requests[panel] );
+        panel = 1-panel;
+    }
+    DiskDistMatrix<F>::Wait( requests[0] );
+    DiskDistMatrix<F>::Wait( requests[1] );
+}
+
+template<typename F>
+inline void
+OutOfCore
+( DiskDistMatrix<F>& A, DistMatrix<int,VC,STAR>& p,
+  std::size_t memoryBudget )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lu::OutOfCore");
+#endif
+    const int panelWidth = ooc::PanelWidth( A, memoryBudget );
+    DistMatrix<int,STAR,STAR> pAll( std::min(A.Height(),A.Width()), 1,
+                                    A.Grid() );
+    OutOfCoreFunctor<F> functor( panelWidth, pAll );
+    ooc::LeftLooking( A, panelWidth, functor );
+    OutOfCorePivots( A, panelWidth, pAll );
+    p = pAll;
+}
+
+} // namespace lu
+} // namespace elem
+
+#endif // ifndef LAPACK_LU_OUTOFCORE_HPP
@@ -0,0 +1,554 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_MIXEDPRECISION_HPP
+#define LAPACK_MIXEDPRECISION_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Copy.hpp"
+#include "elemental/blas-like/level1/Zero.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Hemm.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/GaussianElimination.hpp"
+#include "elemental/lapack-like/HPDSolve.hpp"
+#include "elemental/lapack-like/LeastSquares.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/Norm/Infinity.hpp"
+#include "elemental/lapack-like/Norm/Max.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+// Mixed-precision solvers which factor a single-precision copy of the matrix
+// and then recover working-precision accuracy through iterative refinement
+// with working-precision residuals. If the refinement fails to converge
+// (e.g., the matrix is too ill-conditioned for the single-precision factors
+// to be a useful preconditioner), then the system is solved with a
+// working-precision factorization instead.
+
+namespace elem {
+
+// Summarizes a mixed-precision solve: the number of refinement iterations
+// which were performed after the initial low-precision solve, and whether or
+// not the solver fell back to a working-precision factorization
+struct MixedPrecisionInfo
+{
+    int numIts;
+    bool fellBack;
+
+    MixedPrecisionInfo() : numIts(0), fellBack(false) { }
+};
+
+namespace mixed_precision {
+
+// The datatype which the factorization is computed in
+template<typename F> struct Demote { };
+template<> struct Demote<double> { typedef float type; };
+template<> struct Demote<Complex<double> > { typedef Complex<float> type; };
+
+// Refinement is deemed to have stalled if a step does not at least halve
+// the norm of the residual (or correction)
+template<typename R>
+inline bool
+Stalled( R norm, R lastNorm, int numIts )
+{ return norm != norm || ( numIts > 0 && norm > lastNorm/2 ); }
+
+template<typename R>
+inline R
+DefaultTolerance( int n )
+{ return Sqrt(R(std::max(n,1)))*lapack::MachineEpsilon<R>(); }
+
+} // namespace mixed_precision
+
+//----------------------------------------------------------------------------//
+// Mixed-precision Gaussian elimination (LU with partial pivoting)            //
+//----------------------------------------------------------------------------//
+
+// Overwrites B with the solution of A X = B
+template<typename F>
+inline MixedPrecisionInfo
+MixedPrecisionGaussianElimination
+( const Matrix<F>& A, Matrix<F>& B, int maxIts=30, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MixedPrecisionGaussianElimination");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    typedef BASE(F) Real;
+    typedef typename mixed_precision::Demote<F>::type FLow;
+    if( tol == Real(0) )
+        tol = mixed_precision::DefaultTolerance<Real>( A.Height() );
+
+    MixedPrecisionInfo info;
+    Matrix<FLow> ALow, XLow;
+    Matrix<int> p;
+    Matrix<F> X, E;
+    try
+    {
+        Convert( A, ALow );
+        LU( ALow, p );
+        Convert( B, XLow );
+        lu::SolveAfter( NORMAL, ALow, p, XLow );
+        Convert( XLow, X );
+
+        const Real ANorm = InfinityNorm( A );
+        Real lastResidNorm = 0;
+        while( true )
+        {
+            E = B;
+            Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+            const Real residNorm = MaxNorm( E );
+            if( residNorm <= tol*ANorm*MaxNorm(X) )
+                break;
+            if( info.numIts == maxIts ||
+                mixed_precision::Stalled( residNorm, lastResidNorm,
+                                          info.numIts ) )
+            {
+                info.fellBack = true;
+                break;
+            }
+            lastResidNorm = residNorm;
+
+            Convert( E, XLow );
+            lu::SolveAfter( NORMAL, ALow, p, XLow );
+            Convert( XLow, E );
+            Axpy( F(1), E, X );
+            ++info.numIts;
+        }
+    }
+    catch( SingularMatrixException& e ) { info.fellBack = true; }
+
+    if( info.fellBack )
+    {
+        Matrix<F> ACopy( A );
+        GaussianElimination( ACopy, B );
+    }
+    else
+        B = X;
+    return info;
+}
+
+template<typename F>
+inline MixedPrecisionInfo
+MixedPrecisionGaussianElimination
+( const DistMatrix<F>& A, DistMatrix<F>& B, int maxIts=30, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MixedPrecisionGaussianElimination");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    typedef BASE(F) Real;
+    typedef typename mixed_precision::Demote<F>::type FLow;
+    if( tol == Real(0) )
+        tol = mixed_precision::DefaultTolerance<Real>( A.Height() );
+    const Grid& g = A.Grid();
+
+    MixedPrecisionInfo info;
+    DistMatrix<FLow> ALow(g), XLow(g);
+    DistMatrix<int,VC,STAR> p(g);
+    DistMatrix<F> X(g), E(g);
+    try
+    {
+        Convert( A, ALow );
+        LU( ALow, p );
+        Convert( B, XLow );
+        lu::SolveAfter( NORMAL, ALow, p, XLow );
+        Convert( XLow, X );
+
+        const Real ANorm = InfinityNorm( A );
+        Real lastResidNorm = 0;
+        while( true )
+        {
+            E = B;
+            Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+            const Real residNorm = MaxNorm( E );
+            if( residNorm <= tol*ANorm*MaxNorm(X) )
+                break;
+            if( info.numIts == maxIts ||
+                mixed_precision::Stalled( residNorm, lastResidNorm,
+                                          info.numIts ) )
+            {
+                info.fellBack = true;
+                break;
+            }
+            lastResidNorm = residNorm;
+
+            Convert( E, XLow );
+            lu::SolveAfter( NORMAL, ALow, p, XLow );
+            Convert( XLow, E );
+            Axpy( F(1), E, X );
+            ++info.numIts;
+        }
+    }
+    catch( SingularMatrixException& e ) { info.fellBack = true; }
+
+    if( info.fellBack )
+    {
+        DistMatrix<F> ACopy( A );
+        GaussianElimination( ACopy, B );
+    }
+    else
+        B = X;
+    return info;
+}
+
+//----------------------------------------------------------------------------//
+// Mixed-precision Hermitian positive-definite solves (Cholesky)              //
+//----------------------------------------------------------------------------//
+
+// Overwrites B with the solution of A X = B, where only the 'uplo' triangle
+// of A is accessed
+template<typename F>
+inline MixedPrecisionInfo
+MixedPrecisionHPDSolve
+( UpperOrLower uplo, const Matrix<F>& A, Matrix<F>& B,
+  int maxIts=30, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MixedPrecisionHPDSolve");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    typedef BASE(F) Real;
+    typedef typename mixed_precision::Demote<F>::type FLow;
+    if( tol == Real(0) )
+        tol = mixed_precision::DefaultTolerance<Real>( A.Height() );
+
+    MixedPrecisionInfo info;
+    Matrix<FLow> ALow, XLow;
+    Matrix<F> X, E;
+    try
+    {
+        Convert( A, ALow );
+        Cholesky( uplo, ALow );
+        Convert( B, XLow );
+        cholesky::SolveAfter( uplo, NORMAL, ALow, XLow );
+        Convert( XLow, X );
+
+        const Real ANorm = HermitianInfinityNorm( uplo, A );
+        Real lastResidNorm = 0;
+        while( true )
+        {
+            E = B;
+            Hemm( LEFT, uplo, F(-1), A, X, F(1), E );
+            const Real residNorm = MaxNorm( E );
+            if( residNorm <= tol*ANorm*MaxNorm(X) )
+                break;
+            if( info.numIts == maxIts ||
+                mixed_precision::Stalled( residNorm, lastResidNorm,
+                                          info.numIts ) )
+            {
+                info.fellBack = true;
+                break;
+            }
+            lastResidNorm = residNorm;
+
+            Convert( E, XLow );
+            cholesky::SolveAfter( uplo, NORMAL, ALow, XLow );
+            Convert( XLow, E );
+            Axpy( F(1), E, X );
+            ++info.numIts;
+        }
+    }
+    // The single-precision copy of A need not be numerically HPD
+    catch( std::logic_error& e ) { info.fellBack = true; }
+
+    if( info.fellBack )
+    {
+        Matrix<F> ACopy( A );
+        HPDSolve( uplo, NORMAL, ACopy, B );
+    }
+    else
+        B = X;
+    return info;
+}
+
+template<typename F>
+inline MixedPrecisionInfo
+MixedPrecisionHPDSolve
+( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<F>& B,
+  int maxIts=30, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MixedPrecisionHPDSolve");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    typedef BASE(F) Real;
+    typedef typename mixed_precision::Demote<F>::type FLow;
+    if( tol == Real(0) )
+        tol = mixed_precision::DefaultTolerance<Real>( A.Height() );
+    const Grid& g = A.Grid();
+
+    MixedPrecisionInfo info;
+    DistMatrix<FLow> ALow(g), XLow(g);
+    DistMatrix<F> X(g), E(g);
+    try
+    {
+        Convert( A, ALow );
+        Cholesky( uplo, ALow );
+        Convert( B, XLow );
+        cholesky::SolveAfter( uplo, NORMAL, ALow, XLow );
+        Convert( XLow, X );
+
+        const Real ANorm = HermitianInfinityNorm( uplo, A );
+        Real lastResidNorm = 0;
+        while( true )
+        {
+            E = B;
+            Hemm( LEFT, uplo, F(-1), A, X, F(1), E );
+            const Real residNorm = MaxNorm( E );
+            if( residNorm <= tol*ANorm*MaxNorm(X) )
+                break;
+            if( info.numIts == maxIts ||
+                mixed_precision::Stalled( residNorm, lastResidNorm,
+                                          info.numIts ) )
+            {
+                info.fellBack = true;
+                break;
+            }
+            lastResidNorm = residNorm;
+
+            Convert( E, XLow );
+            cholesky::SolveAfter( uplo, NORMAL, ALow, XLow );
+            Convert( XLow, E );
+            Axpy( F(1), E, X );
+            ++info.numIts;
+        }
+    }
+    // The single-precision copy of A need not be numerically HPD
+    catch( std::logic_error& e ) { info.fellBack = true; }
+
+    if( info.fellBack )
+    {
+        DistMatrix<F> ACopy( A );
+        HPDSolve( uplo, NORMAL, ACopy, B );
+    }
+    else
+        B = X;
+    return info;
+}
+
+//----------------------------------------------------------------------------//
+// Mixed-precision least squares (Householder QR)                             //
+//----------------------------------------------------------------------------//
+
+// Solves min_X || A X - B ||_F for a full-rank A with at least as many rows
+// as columns. Since the residual of an inconsistent system need not be small,
+// the refinement is performed on the augmented system
+//
+//   | I   A | | R | = | B |
+//   | A^H 0 | | X |   | 0 |,
+//
+// following Bjorck, with each correction computed from the single-precision
+// QR factorization A = Q [S; 0]:
+//
+//   H1 := inv(S)^H G, [F1; F2] := Q^H F, dX := inv(S) (F1 - H1),
+//   dR := Q [H1; F2],
+//
+// where F := B - R - A X and G := -A^H R.
+template<typename F>
+inline MixedPrecisionInfo
+MixedPrecisionLeastSquares
+( const Matrix<F>& A, const Matrix<F>& B, Matrix<F>& X,
+  int maxIts=30, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MixedPrecisionLeastSquares");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B do not conform");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int k = B.Width();
+    if( m < n )
+        throw std::logic_error("Only overdetermined systems are supported");
+    typedef BASE(F) Real;
+    typedef typename mixed_precision::Demote<F>::type FLow;
+    if( tol == Real(0) )
+        tol = mixed_precision::DefaultTolerance<Real>( m );
+
+    MixedPrecisionInfo info;
+    Matrix<FLow> ALow, tLow, FResidLow, GResidLow, SLow;
+    Matrix<F> R, FResid, GResid, dX;
+    Zeros( X, n, k );
+    Zeros( R, m, k );
+    Convert( A, ALow );
+    QR( ALow, tLow );
+    LockedView( SLow, ALow, 0, 0, n, n );
+
+    Real lastCorrNorm = 0;
+    for( int it=0; true; ++it )
+    {
+        // F := B - R - A X and G := -A^H R
+        FResid = B;
+        Axpy( F(-1), R, FResid );
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), FResid );
+        Zeros( GResid, n, k );
+        Gemm( ADJOINT, NORMAL, F(-1), A, R, F(0), GResid );
+        Convert( FResid, FResidLow );
+        Convert( GResid, GResidLow );
+
+        // Solve for the corrections in low precision
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, FLow(1), SLow, GResidLow );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, ALow, tLow,
+          FResidLow );
+        Matrix<FLow> FResidLowT, FResidLowB;
+        PartitionDown
+        ( FResidLow, FResidLowT,
+                     FResidLowB, n );
+        Matrix<FLow> dXLow( FResidLowT );
+        Axpy( FLow(-1), GResidLow, dXLow );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, FLow(1), SLow, dXLow );
+        FResidLowT = GResidLow;
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, ALow, tLow,
+          FResidLow );
+
+        // Apply the corrections in working precision
+        Convert( dXLow, dX );
+        Axpy( F(1), dX, X );
+        Convert( FResidLow, FResid );
+        Axpy( F(1), FResid, R );
+        if( it == 0 )
+            continue;
+
+        const Real corrNorm = MaxNorm( dX );
+        if( corrNorm <= tol*MaxNorm(X) )
+            break;
+        if( info.numIts == maxIts ||
+            mixed_precision::Stalled( corrNorm, lastCorrNorm, info.numIts ) )
+        {
+            info.fellBack = true;
+            break;
+        }
+        lastCorrNorm = corrNorm;
+        ++info.numIts;
+    }
+
+    if( info.fellBack )
+    {
+        Matrix<F> ACopy( A );
+        LeastSquares( NORMAL, ACopy, B, X );
+    }
+    return info;
+}
+
+template<typename F>
+inline MixedPrecisionInfo
+MixedPrecisionLeastSquares
+( const DistMatrix<F>& A, const DistMatrix<F>& B, DistMatrix<F>& X,
+  int maxIts=30, BASE(F) tol=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MixedPrecisionLeastSquares");
+    if( A.Grid() != B.Grid() || A.Grid() != X.Grid() )
+        throw std::logic_error("Grids do not match");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B do not conform");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int k = B.Width();
+    if( m < n )
+        throw std::logic_error("Only overdetermined systems are supported");
+    typedef BASE(F) Real;
+    typedef typename mixed_precision::Demote<F>::type FLow;
+    if( tol == Real(0) )
+        tol = mixed_precision::DefaultTolerance<Real>( m );
+    const Grid& g = A.Grid();
+
+    MixedPrecisionInfo info;
+    DistMatrix<FLow> ALow(g), FResidLow(g), GResidLow(g), SLow(g);
+    DistMatrix<FLow,MD,STAR> tLow(g);
+    DistMatrix<F> R(g), FResid(g), GResid(g), dX(g);
+    Zeros( X, n, k );
+    Zeros( R, m, k );
+    Convert( A, ALow );
+    QR( ALow, tLow );
+    LockedView( SLow, ALow, 0, 0, n, n );
+
+    Real lastCorrNorm = 0;
+    for( int it=0; true; ++it )
+    {
+        // F := B - R - A X and G := -A^H R
+        FResid = B;
+        Axpy( F(-1), R, FResid );
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), FResid );
+        Zeros( GResid, n, k );
+        Gemm( ADJOINT, NORMAL, F(-1), A, R, F(0), GResid );
+        Convert( FResid, FResidLow );
+        Convert( GResid, GResidLow );
+
+        // Solve for the corrections in low precision
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, FLow(1), SLow, GResidLow );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, ALow, tLow,
+          FResidLow );
+        DistMatrix<FLow> FResidLowT(g), FResidLowB(g);
+        PartitionDown
+        ( FResidLow, FResidLowT,
+                     FResidLowB, n );
+        DistMatrix<FLow> dXLow( FResidLowT );
+        Axpy( FLow(-1), GResidLow, dXLow );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, FLow(1), SLow, dXLow );
+        FResidLowT = GResidLow;
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, ALow, tLow,
+          FResidLow );
+
+        // Apply the corrections in working precision
+        Convert( dXLow, dX );
+        Axpy( F(1), dX, X );
+        Convert( FResidLow, FResid );
+        Axpy( F(1), FResid, R );
+        if( it == 0 )
+            continue;
+
+        const Real corrNorm = MaxNorm( dX );
+        if( corrNorm <= tol*MaxNorm(X) )
+            break;
+        if( info.numIts == maxIts ||
+            mixed_precision::Stalled( corrNorm, lastCorrNorm, info.numIts ) )
+        {
+            info.fellBack = true;
+            break;
+        }
+        lastCorrNorm = corrNorm;
+        ++info.numIts;
+    }
+
+    if( info.fellBack )
+    {
+        DistMatrix<F> ACopy( A );
+        LeastSquares( NORMAL, ACopy, B, X );
+    }
+    return info;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_MIXEDPRECISION_HPP
@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_ENTRYWISE_HPP
 #define LAPACK_NORM_ENTRYWISE_HPP
 
+#include "elemental/lapack-like/Norm/Util.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -19,14 +21,8 @@ EntrywiseNorm( const Matrix<F>& A, BASE(F) p )
 #ifndef RELEASE
     CallStackEntry entry("EntrywiseNorm");
 #endif
-    // TODO: Make this more numerically stable
     typedef BASE(F) R;
-    R sum = 0;
-    const int width = A.Width();
-    const int height = A.Height();
-    for( int j=0; j<width; ++j )
-        for( int i=0; i<height; ++i )
-            sum += Pow( Abs(A.Get(i,j)), p );
+    const R sum = norm::LocalAbsPowerSum( A, norm::SequentialRegion(), p );
     return Pow( sum, 1/p );
 }
 
@@ -41,39 +37,13 @@ HermitianEntrywiseNorm
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
 
-    // TODO: make this more numerically stable
+    // Each strictly triangular entry is counted twice
     typedef BASE(F) R;
-    R sum = 0;
-    const int height = A.Height();
-    const int width = A.Width();
-    if( uplo == UPPER )
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=0; i<j; ++i )
-            {
-                const R term = Pow( Abs(A.Get(i,j)), p );
-                if( i ==j )
-                    sum += term;
-                else
-                    sum += 2*term;
-            }
-        }
-    }
-    else
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=j+1; i<height; ++i )
-            {
-                const R term = Pow( Abs(A.Get(i,j)), p );
-                if( i ==j )
-                    sum += term;
-                else
-                    sum += 2*term;
-            }
-        }
-    }
+    const R sum = 
+        2*norm::LocalAbsPowerSum
+          ( A, norm::SequentialRegion(norm::STRICT_TRIANGLE,uplo), p ) +
+          norm::LocalAbsPowerSum
+          ( A, norm::SequentialRegion(norm::DIAGONAL), p );
     return Pow( sum, 1/p );
 }
 
@@ -96,12 +66,8 @@ EntrywiseNorm( const DistMatrix<F,U,V>& A, BASE(F) p )
     CallStackEntry entry("EntrywiseNorm");
 #endif
     typedef BASE(F) R;
-    R localSum = 0;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-            localSum += Pow( Abs(A.GetLocal(iLoc,jLoc)), p ); 
+    const R localSum = 
+        norm::LocalAbsPowerSum( A.LockedMatrix(), norm::DistRegion(A), p );
 
     R sum;
     mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
@@ -120,49 +86,14 @@ HermitianEntrywiseNorm
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
 
-    const int r = A.Grid().Height();
-    const int c = A.Grid().Width();
-    const int colShift = A.ColShift();
-    const int rowShift = A.RowShift();
-
+    // Each strictly triangular entry is counted twice
     typedef BASE(F) R;
-    R localSum = 0;
-    const int localWidth = A.LocalWidth();
-    if( uplo == UPPER )
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numUpperRows = Length(j+1,colShift,r);
-            for( int iLoc=0; iLoc<numUpperRows; ++iLoc )
-            {
-                int i = colShift + iLoc*r;
-                const R term = Pow( Abs(A.GetLocal(iLoc,jLoc)), p );
-                if( i ==j )
-                    localSum += term;
-                else
-                    localSum += 2*term;
-            }
-        }
-    }
-    else
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numStrictlyUpperRows = Length(j,colShift,r);
-            for( int iLoc=numStrictlyUpperRows;
-                 iLoc<A.LocalHeight(); ++iLoc )
-            {
-                int i = colShift + iLoc*r;
-                const R term = Pow( Abs(A.GetLocal(iLoc,jLoc)), p );
-                if( i ==j )
-                    localSum += term;
-                else
-                    localSum += 2*term;
-            }
-        }
-    }
+    const R localSum = 
+        2*norm::LocalAbsPowerSum
+          ( A.LockedMatrix(), 
+            norm::DistRegion(A,norm::STRICT_TRIANGLE,uplo), p ) +
+          norm::LocalAbsPowerSum
+          ( A.LockedMatrix(), norm::DistRegion(A,norm::DIAGONAL), p );
 
     R sum;
     mpi::AllReduce( &localSum, &sum, 1, mpi::SUM, A.Grid().VCComm() );
@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_ENTRYWISEONE_HPP
 #define LAPACK_NORM_ENTRYWISEONE_HPP
 
+#include "elemental/lapack-like/Norm/Util.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -19,14 +21,7 @@ EntrywiseOneNorm( const Matrix<F>& A )
 #ifndef RELEASE
     CallStackEntry entry("EntrywiseOneNorm");
 #endif
-    typedef BASE(F) R;
-    R norm = 0;
-    const int width = A.Width();
-    const int height = A.Height();
-    for( int j=0; j<width; ++j )
-        for( int i=0; i<height; ++i )
-            norm += Abs(A.Get(i,j));
-    return norm;
+    return norm::LocalAbsSum( A, norm::SequentialRegion() );
 }
 
 template<typename F>
@@ -39,39 +34,10 @@ HermitianEntrywiseOneNorm( UpperOrLower uplo, const Matrix<F>& A )
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
 
-    typedef BASE(F) R;
-    R norm = 0;
-    const int height = A.Height();
-    const int width = A.Width();
-    if( uplo == UPPER )
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=0; i<j; ++i )
-            {
-                const R alpha = Abs(A.Get(i,j));
-                if( i ==j )
-                    norm += alpha;
-                else
-                    norm += 2*alpha;
-            }
-        }
-    }
-    else
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=j+1; i<height; ++i )
-            {
-                const R alpha = Abs(A.Get(i,j));
-                if( i ==j )
-                    norm += alpha;
-                else
-                    norm += 2*alpha;
-            }
-        }
-    }
-    return norm;
+    // Each strictly triangular entry is counted twice
+    return 2*norm::LocalAbsSum
+             ( A, norm::SequentialRegion(norm::STRICT_TRIANGLE,uplo) ) +
+             norm::LocalAbsSum( A, norm::SequentialRegion(norm::DIAGONAL) );
 }
 
 template<typename F>
@@ -92,17 +58,13 @@ EntrywiseOneNorm( const DistMatrix<F,U,V>& A )
     CallStackEntry entry("EntrywiseOneNorm");
 #endif
     typedef BASE(F) R;
-    R localSum = 0;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-            localSum += Abs(A.GetLocal(iLoc,jLoc)); 
+    const R localSum = 
+        norm::LocalAbsSum( A.LockedMatrix(), norm::DistRegion(A) );
 
-    R norm;
+    R sum;
     mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
-    mpi::AllReduce( &localSum, &norm, 1, mpi::SUM, comm );
-    return norm;
+    mpi::AllReduce( &localSum, &sum, 1, mpi::SUM, comm );
+    return sum;
 }
 
 template<typename F>
@@ -115,53 +77,18 @@ HermitianEntrywiseOneNorm( UpperOrLower uplo, const DistMatrix<F>& A )
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
 
-    const int r = A.Grid().Height();
-    const int c = A.Grid().Width();
-    const int colShift = A.ColShift();
-    const int rowShift = A.RowShift();
-
+    // Each strictly triangular entry is counted twice
     typedef BASE(F) R;
-    R localSum = 0;
-    const int localWidth = A.LocalWidth();
-    if( uplo == UPPER )
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numUpperRows = Length(j+1,colShift,r);
-            for( int iLoc=0; iLoc<numUpperRows; ++iLoc )
-            {
-                int i = colShift + iLoc*r;
-                const R alpha = Abs(A.GetLocal(iLoc,jLoc));
-                if( i ==j )
-                    localSum += alpha;
-                else
-                    localSum += 2*alpha;
-            }
-        }
-    }
-    else
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numStrictlyUpperRows = Length(j,colShift,r);
-            for( int iLoc=numStrictlyUpperRows;
-                 iLoc<A.LocalHeight(); ++iLoc )
-            {
-                int i = colShift + iLoc*r;
-                const R alpha = Abs(A.GetLocal(iLoc,jLoc));
-                if( i ==j )
-                    localSum += alpha;
-                else
-                    localSum += 2*alpha;
-            }
-        }
-    }
+    const R localSum = 
+        2*norm::LocalAbsSum
+          ( A.LockedMatrix(), 
+            norm::DistRegion(A,norm::STRICT_TRIANGLE,uplo) ) +
+          norm::LocalAbsSum
+          ( A.LockedMatrix(), norm::DistRegion(A,norm::DIAGONAL) );
 
-    R norm;
-    mpi::AllReduce( &localSum, &norm, 1, mpi::SUM, A.Grid().VCComm() );
-    return norm;
+    R sum;
+    mpi::AllReduce( &localSum, &sum, 1, mpi::SUM, A.Grid().VCComm() );
+    return sum;
 }
 
 template<typename F,Distribution U,Distribution V>
@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_FROBENIUS_HPP
 #define LAPACK_NORM_FROBENIUS_HPP
 
+#include "elemental/lapack-like/Norm/Util.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -22,30 +24,9 @@ FrobeniusNorm( const Matrix<F>& A )
     typedef BASE(F) R;
     R scale = 0;
     R scaledSquare = 1;
-    const int width = A.Width();
-    const int height = A.Height();
-    for( int j=0; j<width; ++j )
-    {
-        for( int i=0; i<height; ++i )
-        {
-            const R alphaAbs = Abs(A.Get(i,j));
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= scale )
-                {
-                    const R relScale = alphaAbs/scale;
-                    scaledSquare += relScale*relScale;
-                }
-                else
-                {
-                    const R relScale = scale/alphaAbs;
-                    scaledSquare = scaledSquare*relScale*relScale + 1;
-                    scale = alphaAbs;
-                }
-            }
-        }
-    }
-    return scale*Sqrt(scaledSquare);
+    norm::LocalScaledSquare
+    ( A, norm::SequentialRegion(), scale, scaledSquare );
+    return norm::ScaledSquareToNorm( scale, scaledSquare );
 }
 
 template<typename F>
@@ -58,90 +39,17 @@ HermitianFrobeniusNorm( UpperOrLower uplo, const Matrix<F>& A )
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
 
+    // Each strictly triangular entry is counted twice
     typedef BASE(F) R;
     R scale = 0;
     R scaledSquare = 1;
-    const int height = A.Height();
-    const int width = A.Width();
-    if( uplo == UPPER )
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=0; i<j; ++i )
-            {
-                const R alphaAbs = Abs(A.Get(i,j));
-                if( alphaAbs != 0 )
-                {
-                    if( alphaAbs <= scale )
-                    {
-                        const R relScale = alphaAbs/scale;
-                        scaledSquare += 2*relScale*relScale;
-                    }
-                    else
-                    {
-                        const R relScale = scale/alphaAbs;
-                        scaledSquare = scaledSquare*relScale*relScale + 2;
-                        scale = alphaAbs;
-                    }
-                }
-            }
-            const R alphaAbs = Abs(A.Get(j,j));
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= scale )
-                {
-                    const R relScale = alphaAbs/scale;
-                    scaledSquare += relScale*relScale;
-                }
-                else
-                {
-                    const R relScale = scale/alphaAbs;
-                    scaledSquare = scaledSquare*relScale*relScale + 1;
-                    scale = alphaAbs;
-                }
-            }
-        }
-    }
-    else
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=j+1; i<height; ++i )
-            {
-                const R alphaAbs = Abs(A.Get(i,j));
-                if( alphaAbs != 0 )
-                {
-                    if( alphaAbs <= scale )
-                    {
-                        const R relScale = alphaAbs/scale;
-                        scaledSquare += 2*relScale*relScale;
-                    }
-                    else
-                    {
-                        const R relScale = scale/alphaAbs;
-                        scaledSquare = scaledSquare*relScale*relScale + 2;
-                        scale = alphaAbs;
-                    }
-                }
-            }
-            const R alphaAbs = Abs(A.Get(j,j));
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= scale )
-                {
-                    const R relScale = alphaAbs/scale;
-                    scaledSquare += relScale*relScale;
-                }
-                else
-                {
-                    const R relScale = scale/alphaAbs;
-                    scaledSquare = scaledSquare*relScale*relScale + 1;
-                    scale = alphaAbs;
-                }
-            }
-        }
-    }
-    return scale*Sqrt(scaledSquare);
+    norm::LocalScaledSquare
+    ( A, norm::SequentialRegion(norm::STRICT_TRIANGLE,uplo), 
+      scale, scaledSquare );
+    scaledSquare *= 2;
+    norm::LocalScaledSquare
+    ( A, norm::SequentialRegion(norm::DIAGONAL), scale, scaledSquare );
+    return norm::ScaledSquareToNorm( scale, scaledSquare );
 }
 
 template<typename F>
@@ -162,50 +70,15 @@ FrobeniusNorm( const DistMatrix<F,U,V>& A )
     CallStackEntry entry("FrobeniusNorm");
 #endif
     typedef BASE(F) R;
-    R localScale = 0;
-    R localScaledSquare = 1;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const R alphaAbs = Abs(A.GetLocal(iLoc,jLoc));
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= localScale )
-                {
-                    const R relScale = alphaAbs/localScale;
-                    localScaledSquare += relScale*relScale;
-                }
-                else
-                {
-                    const R relScale = localScale/alphaAbs;
-                    localScaledSquare = localScaledSquare*relScale*relScale + 1;
-                    localScale = alphaAbs; 
-                }
-            }
-        }
-    }
+    R scale = 0;
+    R scaledSquare = 1;
+    norm::LocalScaledSquare
+    ( A.LockedMatrix(), norm::DistRegion(A), scale, scaledSquare );
 
-    // Find the maximum relative scale
-    R scale;
+    // Combine the local scaled squares with a single reduction
     mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
-    mpi::AllReduce( &localScale, &scale, 1, mpi::MAX, comm );
-
-    R norm = 0;
-    if( scale != 0 )
-    {
-        // Equilibrate our local scaled sum to the maximum scale
-        R relScale = localScale/scale;
-        localScaledSquare *= relScale*relScale;
-
-        // The scaled square is now simply the sum of the local contributions
-        R scaledSquare;
-        mpi::AllReduce( &localScaledSquare, &scaledSquare, 1, mpi::SUM, comm );
-        norm = scale*Sqrt(scaledSquare);
-    }
-    return norm;
+    norm::AllReduceScaledSquares( &scale, &scaledSquare, 1, comm );
+    return norm::ScaledSquareToNorm( scale, scaledSquare );
 }
 
 template<typename F>
@@ -219,106 +92,21 @@ HermitianFrobeniusNorm
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
 
-    const int r = A.Grid().Height();
-    const int c = A.Grid().Width();
-    const int colShift = A.ColShift();
-    const int rowShift = A.RowShift();
-
+    // Each strictly triangular entry is counted twice
     typedef BASE(F) R;
-    R localScale = 0;
-    R localScaledSquare = 1;
-    const int localWidth = A.LocalWidth();
-    if( uplo == UPPER )
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numUpperRows = Length(j+1,colShift,r);
-            for( int iLoc=0; iLoc<numUpperRows; ++iLoc )
-            {
-                int i = colShift + iLoc*r;
-                const R alphaAbs = Abs(A.GetLocal(iLoc,jLoc));
-                if( alphaAbs != 0 )
-                {
-                    if( alphaAbs <= localScale )
-                    {
-                        const R relScale = alphaAbs/localScale;
-                        if( i != j )
-                            localScaledSquare += 2*relScale*relScale;
-                        else
-                            localScaledSquare += relScale*relScale;
-                    }
-                    else
-                    {
-                        const R relScale = localScale/alphaAbs;
-                        if( i != j )
-                            localScaledSquare =
-                                localScaledSquare*relScale*relScale + 2;
-                        else
-                            localScaledSquare =
-                                localScaledSquare*relScale*relScale + 1;
-                        localScale = alphaAbs;
-                    }
-                }
-            }
-        }
-    }
-    else
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numStrictlyUpperRows = Length(j,colShift,r);
-            for( int iLoc=numStrictlyUpperRows;
-                 iLoc<A.LocalHeight(); ++iLoc )
-            {
-                int i = colShift + iLoc*r;
-                const R alphaAbs = Abs(A.GetLocal(iLoc,jLoc));
-                if( alphaAbs != 0 )
-                {
-                    if( alphaAbs <= localScale )
-                    {
-                        const R relScale = alphaAbs/localScale;
-                        if( i != j )
-                            localScaledSquare += 2*relScale*relScale;
-                        else
-                            localScaledSquare += relScale*relScale;
-                    }
-                    else
-                    {
-                        const R relScale = localScale/alphaAbs;
-                        if( i != j )
-                            localScaledSquare =
-                                localScaledSquare*relScale*relScale + 2;
-                        else
-                            localScaledSquare =
-                                localScaledSquare*relScale*relScale + 1;
-                        localScale = alphaAbs;
-                    }
-                }
-            }
-        }
-    }
-
-    // Find the maximum relative scale
-    R scale;
-    mpi::AllReduce( &localScale, &scale, 1, mpi::MAX, A.Grid().VCComm() );
-
-    R norm = 0;
-    if( scale != 0 )
-    {
-        // Equilibrate our local scaled sum to the maximum scale
-        R relScale = localScale/scale;
-        localScaledSquare *= relScale*relScale;
-
-        // The scaled square is now simply the sum of the local contributions
-        R scaledSquare;
-        mpi::AllReduce
-        ( &localScaledSquare, &scaledSquare, 1, mpi::SUM, A.Grid().VCComm() );
-
-        norm = scale*Sqrt(scaledSquare);
-    }
-    return norm;
+    R scale = 0;
+    R scaledSquare = 1;
+    norm::LocalScaledSquare
+    ( A.LockedMatrix(), norm::DistRegion(A,norm::STRICT_TRIANGLE,uplo), 
+      scale, scaledSquare );
+    scaledSquare *= 2;
+    norm::LocalScaledSquare
+    ( A.LockedMatrix(), norm::DistRegion(A,norm::DIAGONAL), 
+      scale, scaledSquare );
+
+    norm::AllReduceScaledSquares
+    ( &scale, &scaledSquare, 1, A.Grid().VCComm() );
+    return norm::ScaledSquareToNorm( scale, scaledSquare );
 }
 
 template<typename F,Distribution U,Distribution V>
@@ -22,16 +22,12 @@ InfinityNorm( const Matrix<F>& A )
     CallStackEntry entry("InfinityNorm");
 #endif
     typedef BASE(F) R;
-    R maxRowSum = 0;
     const int height = A.Height();
-    const int width = A.Width();
+    std::vector<R> rowSums( height );
+    norm::LocalRowAbsSums( A, norm::SequentialRegion(), &rowSums[0] );
+    R maxRowSum = 0;
     for( int i=0; i<height; ++i )
-    {
-        R rowSum = 0;
-        for( int j=0; j<width; ++j )
-            rowSum += Abs(A.Get(i,j));
-        maxRowSum = std::max( maxRowSum, rowSum );
-    }
+        maxRowSum = std::max( maxRowSum, rowSums[i] );
     return maxRowSum;
 }
 
@@ -65,14 +61,9 @@ InfinityNorm( const DistMatrix<F,U,V>& A )
     // Compute the partial row sums defined by our local matrix, A[U,V]
     typedef BASE(F) R;
     const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
     std::vector<R> myPartialRowSums( localHeight );
-    for( int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        myPartialRowSums[iLoc] = 0;
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-            myPartialRowSums[iLoc] += Abs(A.GetLocal(iLoc,jLoc));
-    }
+    norm::LocalRowAbsSums
+    ( A.LockedMatrix(), norm::DistRegion(A), &myPartialRowSums[0] );
 
     // Sum our partial row sums to get the row sums over A[U,* ]
     std::vector<R> myRowSums( localHeight );
@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_MAX_HPP
 #define LAPACK_NORM_MAX_HPP
 
+#include "elemental/lapack-like/Norm/Util.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -19,19 +21,7 @@ MaxNorm( const Matrix<F>& A )
 #ifndef RELEASE
     CallStackEntry entry("MaxNorm");
 #endif
-    typedef BASE(F) R;
-    R maxAbs = 0;
-    const int height = A.Height();
-    const int width = A.Width();
-    for( int j=0; j<width; ++j )
-    {
-        for( int i=0; i<height; ++i )
-        {
-            const R thisAbs = Abs(A.Get(i,j));
-            maxAbs = std::max( maxAbs, thisAbs );
-        }
-    }
-    return maxAbs;
+    return norm::LocalMaxAbs( A, norm::SequentialRegion() );
 }
 
 template<typename F>
@@ -43,34 +33,7 @@ HermitianMaxNorm( UpperOrLower uplo, const Matrix<F>& A )
 #endif
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
-
-    typedef BASE(F) R;
-    R maxAbs = 0;
-    const int height = A.Height();
-    const int width = A.Width();
-    if( uplo == UPPER )
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=0; i<=j; ++i )
-            {
-                const R thisAbs = Abs(A.Get(i,j));
-                maxAbs = std::max( maxAbs, thisAbs );
-            }
-        }
-    }
-    else
-    {
-        for( int j=0; j<width; ++j )
-        {
-            for( int i=j; i<height; ++i )
-            {
-                const R thisAbs = Abs(A.Get(i,j));
-                maxAbs = std::max( maxAbs, thisAbs );
-            }
-        }
-    }
-    return maxAbs;
+    return norm::LocalMaxAbs( A, norm::SequentialRegion(norm::TRIANGLE,uplo) );
 }
 
 template<typename F>
@@ -91,17 +54,8 @@ MaxNorm( const DistMatrix<F,U,V>& A )
     CallStackEntry entry("MaxNorm");
 #endif
     typedef BASE(F) R;
-    R localMaxAbs = 0;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const R thisAbs = Abs(A.GetLocal(iLoc,jLoc));
-            localMaxAbs = std::max( localMaxAbs, thisAbs );
-        }
-    }
+    const R localMaxAbs = 
+        norm::LocalMaxAbs( A.LockedMatrix(), norm::DistRegion(A) );
 
     R maxAbs;
     mpi::Comm reduceComm = ReduceComm<U,V>( A.Grid() );
@@ -119,41 +73,10 @@ HermitianMaxNorm( UpperOrLower uplo, const DistMatrix<F>& A )
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square.");
 
-    const int r = A.Grid().Height();
-    const int c = A.Grid().Width();
-    const int colShift = A.ColShift();
-    const int rowShift = A.RowShift();
-
     typedef BASE(F) R;
-    R localMaxAbs = 0;
-    const int localWidth = A.LocalWidth();
-    if( uplo == UPPER )
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numUpperRows = Length(j+1,colShift,r);
-            for( int iLoc=0; iLoc<numUpperRows; ++iLoc )
-            {
-                const R thisAbs = Abs(A.GetLocal(iLoc,jLoc));
-                localMaxAbs = std::max( localMaxAbs, thisAbs );
-            }
-        }
-    }
-    else
-    {
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numStrictlyUpperRows = Length(j,colShift,r);
-            for( int iLoc=numStrictlyUpperRows;
-                 iLoc<A.LocalHeight(); ++iLoc )
-            {
-                const R thisAbs = Abs(A.GetLocal(iLoc,jLoc));
-                localMaxAbs = std::max( localMaxAbs, thisAbs );
-            }
-        }
-    }
+    const R localMaxAbs = 
+        norm::LocalMaxAbs
+        ( A.LockedMatrix(), norm::DistRegion(A,norm::TRIANGLE,uplo) );
 
     R maxAbs;
     mpi::AllReduce( &localMaxAbs, &maxAbs, 1, mpi::MAX, A.Grid().VCComm() );
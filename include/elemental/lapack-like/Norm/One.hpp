@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_ONE_HPP
 #define LAPACK_NORM_ONE_HPP
 
+#include "elemental/lapack-like/Norm/Util.hpp"
+
 namespace elem {
 
 template<typename F>
@@ -20,16 +22,12 @@ OneNorm( const Matrix<F>& A )
     CallStackEntry entry("OneNorm");
 #endif
     typedef BASE(F) R;
-    R maxColSum = 0;
-    const int height = A.Height();
     const int width = A.Width();
+    std::vector<R> colSums( width );
+    norm::LocalColumnAbsSums( A, norm::SequentialRegion(), &colSums[0] );
+    R maxColSum = 0;
     for( int j=0; j<width; ++j )
-    {
-        R colSum = 0;
-        for( int i=0; i<height; ++i )
-            colSum += Abs(A.Get(i,j));
-        maxColSum = std::max( maxColSum, colSum );
-    }
+        maxColSum = std::max( maxColSum, colSums[j] );
     return maxColSum;
 }
 
@@ -43,32 +41,18 @@ HermitianOneNorm( UpperOrLower uplo, const Matrix<F>& A )
     typedef BASE(F) R;
     if( A.Height() != A.Width() )
         throw std::runtime_error("Hermitian matrices must be square.");
-    R maxColSum = 0;
+
+    // Column j of the implicit matrix is the 'uplo' portion of column j
+    // followed by the conjugate of the strictly 'uplo' portion of row j
     const int height = A.Height();
-    if( uplo == UPPER )
-    {
-        for( int j=0; j<height; ++j )
-        {
-            R colSum = 0;
-            for( int i=0; i<=j; ++i )
-                colSum += Abs(A.Get(i,j));
-            for( int i=j+1; i<height; ++i )
-                colSum += Abs(A.Get(j,i));
-            maxColSum = std::max( maxColSum, colSum );
-        }
-    }
-    else
-    {
-        for( int j=0; j<height; ++j )
-        {
-            R colSum = 0;
-            for( int i=0; i<j; ++i )
-                colSum += Abs(A.Get(j,i));
-            for( int i=j; i<height; ++i )
-                colSum += Abs(A.Get(i,j));
-            maxColSum = std::max( maxColSum, colSum );
-        }
-    }
+    std::vector<R> colSums( height ), rowSums( height );
+    norm::LocalColumnAbsSums
+    ( A, norm::SequentialRegion(norm::TRIANGLE,uplo), &colSums[0] );
+    norm::LocalRowAbsSums
+    ( A, norm::SequentialRegion(norm::STRICT_TRIANGLE,uplo), &rowSums[0] );
+    R maxColSum = 0;
+    for( int j=0; j<height; ++j )
+        maxColSum = std::max( maxColSum, colSums[j]+rowSums[j] );
     return maxColSum;
 }
 
@@ -91,15 +75,10 @@ OneNorm( const DistMatrix<F,U,V>& A )
 #endif
     // Compute the partial column sums defined by our local matrix, A[U,V]
     typedef BASE(F) R;
-    const int localHeight = A.LocalHeight();
     const int localWidth = A.LocalWidth();
     std::vector<R> myPartialColSums( localWidth );
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        myPartialColSums[jLoc] = 0;
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-            myPartialColSums[jLoc] += Abs(A.GetLocal(iLoc,jLoc));
-    }
+    norm::LocalColumnAbsSums
+    ( A.LockedMatrix(), norm::DistRegion(A), &myPartialColSums[0] );
 
     // Sum our partial column sums to get the column sums over A[* ,V]
     std::vector<R> myColSums( localWidth );
@@ -127,115 +106,42 @@ HermitianOneNorm( UpperOrLower uplo, const DistMatrix<F>& A )
     CallStackEntry entry("HermitianOneNorm");
 #endif
     typedef BASE(F) R;
-
     if( A.Height() != A.Width() )
         throw std::runtime_error("Hermitian matrices must be square.");
-    const int height = A.Height();
-
-    // For now, we take the 'easy' approach to exploiting the implicit symmetry
-    // by storing all of the column sums of the triangular matrix and the 
-    // row sums of the strictly triangular matrix. We can then add them.
-
-    int r = A.Grid().Height();
-    int c = A.Grid().Width();
-    int rowShift = A.RowShift();
-    int colShift = A.ColShift();
 
-    R maxColSum = 0;
+    // Column j of the implicit matrix is the 'uplo' portion of column j
+    // followed by the conjugate of the strictly 'uplo' portion of row j, so
+    // we form the local contributions to both and scatter them into a single
+    // vector of partial column sums, which is then summed in one AllReduce.
+    const int height = A.Height();
+    const int r = A.Grid().Height();
+    const int c = A.Grid().Width();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
     const int localHeight = A.LocalHeight();
     const int localWidth = A.LocalWidth();
-    if( uplo == UPPER )
-    {
-        std::vector<R> myPartialUpperColSums( localWidth );
-        std::vector<R> myPartialStrictlyUpperRowSums( localHeight );
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numUpperRows = Length(j+1,colShift,r);
-            myPartialUpperColSums[jLoc] = 0;
-            for( int iLoc=0; iLoc<numUpperRows; ++iLoc )
-                myPartialUpperColSums[jLoc] +=
-                    Abs(A.GetLocal(iLoc,jLoc));
-        }
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            int i = colShift + iLoc*r;
-            int numLowerCols = Length(i+1,rowShift,c);
-            myPartialStrictlyUpperRowSums[iLoc] = 0;
-            for( int jLoc=numLowerCols; jLoc<localWidth; ++jLoc )
-                myPartialStrictlyUpperRowSums[iLoc] +=
-                    Abs(A.GetLocal(iLoc,jLoc));
-        }
-
-        // Just place the sums into their appropriate places in a vector an 
-        // AllReduce sum to get the results. This isn't optimal, but it should
-        // be good enough.
-        std::vector<R> partialColSums( height, 0 );
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            partialColSums[j] = myPartialUpperColSums[jLoc];
-        }
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            int i = colShift + iLoc*r;
-            partialColSums[i] += myPartialStrictlyUpperRowSums[iLoc];
-        }
-        std::vector<R> colSums( height );
-        mpi::AllReduce
-        ( &partialColSums[0], &colSums[0], height, mpi::SUM,
-          A.Grid().VCComm() );
-
-        // Find the maximum sum
-        for( int j=0; j<height; ++j )
-            maxColSum = std::max( maxColSum, colSums[j] );
-    }
-    else
-    {
-        std::vector<R> myPartialLowerColSums( localWidth );
-        std::vector<R> myPartialStrictlyLowerRowSums( localHeight );
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            int numStrictlyUpperRows = Length(j,colShift,r);
-            myPartialLowerColSums[jLoc] = 0;
-            for( int iLoc=numStrictlyUpperRows; iLoc<localHeight; ++iLoc )
-                myPartialLowerColSums[jLoc] +=
-                    Abs(A.GetLocal(iLoc,jLoc));
-        }
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            int i = colShift + iLoc*r;
-            int numStrictlyLowerCols = Length(i,rowShift,c);
-            myPartialStrictlyLowerRowSums[iLoc] = 0;
-            for( int jLoc=0; jLoc<numStrictlyLowerCols; ++jLoc )
-                myPartialStrictlyLowerRowSums[iLoc] +=
-                    Abs(A.GetLocal(iLoc,jLoc));
-        }
-
-        // Just place the sums into their appropriate places in a vector an 
-        // AllReduce sum to get the results. This isn't optimal, but it should
-        // be good enough.
-        std::vector<R> partialColSums( height, 0 );
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            int j = rowShift + jLoc*c;
-            partialColSums[j] = myPartialLowerColSums[jLoc];
-        }
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            int i = colShift + iLoc*r;
-            partialColSums[i] += myPartialStrictlyLowerRowSums[iLoc];
-        }
-        std::vector<R> colSums( height );
-        mpi::AllReduce
-        ( &partialColSums[0], &colSums[0], height, mpi::SUM,
-          A.Grid().VCComm() );
-
-        // Find the maximum sum
-        for( int j=0; j<height; ++j )
-            maxColSum = std::max( maxColSum, colSums[j] );
-    }
+    std::vector<R> myPartialColSums( localWidth ), 
+                   myPartialRowSums( localHeight );
+    norm::LocalColumnAbsSums
+    ( A.LockedMatrix(), norm::DistRegion(A,norm::TRIANGLE,uplo), 
+      &myPartialColSums[0] );
+    norm::LocalRowAbsSums
+    ( A.LockedMatrix(), norm::DistRegion(A,norm::STRICT_TRIANGLE,uplo), 
+      &myPartialRowSums[0] );
+
+    std::vector<R> partialColSums( height, 0 );
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+        partialColSums[rowShift+jLoc*c] = myPartialColSums[jLoc];
+    for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        partialColSums[colShift+iLoc*r] += myPartialRowSums[iLoc];
+    std::vector<R> colSums( height );
+    mpi::AllReduce
+    ( &partialColSums[0], &colSums[0], height, mpi::SUM, A.Grid().VCComm() );
+
+    // Find the maximum sum
+    R maxColSum = 0;
+    for( int j=0; j<height; ++j )
+        maxColSum = std::max( maxColSum, colSums[j] );
     return maxColSum;
 }
 
@@ -0,0 +1,382 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_NORM_UTIL_HPP
+#define LAPACK_NORM_UTIL_HPP
+
+#include "elemental/blas-like/level1/Reductions.hpp"
+
+namespace elem {
+namespace norm {
+
+// Single-pass reductions over the entries of a local, column-major matrix.
+// Each column is traversed contiguously with several independent
+// accumulators so that the compiler may vectorize the inner loops, and the
+// columns (or, for row sums, the rows) are split between OpenMP threads.
+
+enum Shape
+{
+    ALL_ENTRIES,
+    TRIANGLE,
+    STRICT_TRIANGLE,
+    DIAGONAL
+};
+
+// The set of local entries visited by a reduction. The local entry
+// (iLoc,jLoc) is assumed to be the global entry
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride), and the triangular
+// shapes refer to the 'uplo' triangle of the global matrix.
+struct Region
+{
+    Shape shape;
+    UpperOrLower uplo;
+    int colShift, colStride, rowShift, rowStride;
+};
+
+inline Region
+SequentialRegion( Shape shape=ALL_ENTRIES, UpperOrLower uplo=LOWER )
+{
+    Region region;
+    region.shape = shape;
+    region.uplo = uplo;
+    region.colShift = 0;
+    region.colStride = 1;
+    region.rowShift = 0;
+    region.rowStride = 1;
+    return region;
+}
+
+template<typename T,Distribution U,Distribution V>
+inline Region
+DistRegion
+( const DistMatrix<T,U,V>& A,
+  Shape shape=ALL_ENTRIES, UpperOrLower uplo=LOWER )
+{
+    Region region;
+    region.shape = shape;
+    region.uplo = uplo;
+    region.colShift = A.ColShift();
+    region.colStride = A.ColStride();
+    region.rowShift = A.RowShift();
+    region.rowStride = A.RowStride();
+    return region;
+}
+
+// The local rows [iBeg,iEnd) of local column jLoc which lie in the region
+inline void
+ColumnRange
+( const Region& region, int jLoc, int localHeight, int& iBeg, int& iEnd )
+{
+    iBeg = 0;
+    iEnd = localHeight;
+    if( region.shape == ALL_ENTRIES )
+        return;
+    const int j = region.rowShift + jLoc*region.rowStride;
+    const int s = region.colShift;
+    const int r = region.colStride;
+    if( region.shape == DIAGONAL )
+    {
+        iBeg = std::min( Length(j,s,r), localHeight );
+        iEnd = std::min( Length(j+1,s,r), localHeight );
+    }
+    else if( region.uplo == LOWER )
+    {
+        const int firstRow = ( region.shape == TRIANGLE ? j : j+1 );
+        iBeg = std::min( Length(firstRow,s,r), localHeight );
+    }
+    else
+    {
+        const int endRow = ( region.shape == TRIANGLE ? j+1 : j );
+        iEnd = std::min( Length(endRow,s,r), localHeight );
+    }
+}
+
+//
+// Kernels for contiguous segments
+//
+
+template<typename F>
+inline BASE(F)
+SegmentAbsSum( int n, const F* x )
+{
+    typedef BASE(F) R;
+    R sum0=0, sum1=0, sum2=0, sum3=0;
+    int i=0;
+    for( ; i+3<n; i+=4 )
+    {
+        sum0 += Abs(x[i  ]);
+        sum1 += Abs(x[i+1]);
+        sum2 += Abs(x[i+2]);
+        sum3 += Abs(x[i+3]);
+    }
+    for( ; i<n; ++i )
+        sum0 += Abs(x[i]);
+    return (sum0+sum1)+(sum2+sum3);
+}
+
+template<typename F>
+inline BASE(F)
+SegmentAbsPowerSum( int n, const F* x, BASE(F) p )
+{
+    typedef BASE(F) R;
+    R sum = 0;
+    for( int i=0; i<n; ++i )
+        sum += Pow( Abs(x[i]), p );
+    return sum;
+}
+
+//
+// Kernels for local matrices
+//
+
+template<typename F>
+inline BASE(F)
+LocalMaxAbs( const Matrix<F>& A, const Region& region )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalMaxAbs");
+#endif
+    typedef BASE(F) R;
+    const int height = A.Height();
+    const int width = A.Width();
+    R maxAbs = 0;
+#ifdef HAVE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        R threadMaxAbs = 0;
+#ifdef HAVE_OPENMP
+#pragma omp for
+#endif
+        for( int jLoc=0; jLoc<width; ++jLoc )
+        {
+            int iBeg, iEnd;
+            ColumnRange( region, jLoc, height, iBeg, iEnd );
+            if( iEnd > iBeg )
+                threadMaxAbs =
+                    std::max
+                    ( threadMaxAbs,
+                      SegmentMaxAbs( iEnd-iBeg, A.LockedBuffer(iBeg,jLoc) ) );
+        }
+#ifdef HAVE_OPENMP
+#pragma omp critical
+#endif
+        maxAbs = std::max( maxAbs, threadMaxAbs );
+    }
+    return maxAbs;
+}
+
+template<typename F>
+inline BASE(F)
+LocalAbsSum( const Matrix<F>& A, const Region& region )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalAbsSum");
+#endif
+    typedef BASE(F) R;
+    const int height = A.Height();
+    const int width = A.Width();
+    R sum = 0;
+#ifdef HAVE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        R threadSum = 0;
+#ifdef HAVE_OPENMP
+#pragma omp for
+#endif
+        for( int jLoc=0; jLoc<width; ++jLoc )
+        {
+            int iBeg, iEnd;
+            ColumnRange( region, jLoc, height, iBeg, iEnd );
+            if( iEnd > iBeg )
+                threadSum +=
+                    SegmentAbsSum( iEnd-iBeg, A.LockedBuffer(iBeg,jLoc) );
+        }
+#ifdef HAVE_OPENMP
+#pragma omp critical
+#endif
+        sum += threadSum;
+    }
+    return sum;
+}
+
+template<typename F>
+inline BASE(F)
+LocalAbsPowerSum( const Matrix<F>& A, const Region& region, BASE(F) p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalAbsPowerSum");
+#endif
+    typedef BASE(F) R;
+    const int height = A.Height();
+    const int width = A.Width();
+    R sum = 0;
+#ifdef HAVE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        R threadSum = 0;
+#ifdef HAVE_OPENMP
+#pragma omp for
+#endif
+        for( int jLoc=0; jLoc<width; ++jLoc )
+        {
+            int iBeg, iEnd;
+            ColumnRange( region, jLoc, height, iBeg, iEnd );
+            if( iEnd > iBeg )
+                threadSum += SegmentAbsPowerSum
+                    ( iEnd-iBeg, A.LockedBuffer(iBeg,jLoc), p );
+        }
+#ifdef HAVE_OPENMP
+#pragma omp critical
+#endif
+        sum += threadSum;
+    }
+    return sum;
+}
+
+// Merge the sum of the squares of the entries in the region into the
+// scaled square (scale,scaledSquare)
+template<typename F>
+inline void
+LocalScaledSquare
+( const Matrix<F>& A, const Region& region,
+  BASE(F)& scale, BASE(F)& scaledSquare )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalScaledSquare");
+#endif
+    typedef BASE(F) R;
+    const int height = A.Height();
+    const int width = A.Width();
+#ifdef HAVE_OPENMP
+#pragma omp parallel
+#endif
+    {
+        R threadScale = 0;
+        R threadScaledSquare = 1;
+#ifdef HAVE_OPENMP
+#pragma omp for
+#endif
+        for( int jLoc=0; jLoc<width; ++jLoc )
+        {
+            int iBeg, iEnd;
+            ColumnRange( region, jLoc, height, iBeg, iEnd );
+            if( iEnd > iBeg )
+                UpdateScaledSquare
+                ( iEnd-iBeg, A.LockedBuffer(iBeg,jLoc),
+                  threadScale, threadScaledSquare );
+        }
+#ifdef HAVE_OPENMP
+#pragma omp critical
+#endif
+        CombineScaledSquares
+        ( threadScale, threadScaledSquare, scale, scaledSquare );
+    }
+}
+
+// Overwrite colScales[jLoc] and colScaledSquares[jLoc] with the scaled
+// square of the portion of local column jLoc within the region
+template<typename F>
+inline void
+LocalColumnScaledSquares
+( const Matrix<F>& A, const Region& region,
+  BASE(F)* colScales, BASE(F)* colScaledSquares )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalColumnScaledSquares");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<width; ++jLoc )
+    {
+        int iBeg, iEnd;
+        ColumnRange( region, jLoc, height, iBeg, iEnd );
+        colScales[jLoc] = 0;
+        colScaledSquares[jLoc] = 1;
+        if( iEnd > iBeg )
+            UpdateScaledSquare
+            ( iEnd-iBeg, A.LockedBuffer(iBeg,jLoc),
+              colScales[jLoc], colScaledSquares[jLoc] );
+    }
+}
+
+// Overwrite colSums[jLoc] with the sum of the magnitudes of the entries of
+// local column jLoc within the region
+template<typename F>
+inline void
+LocalColumnAbsSums
+( const Matrix<F>& A, const Region& region, BASE(F)* colSums )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalColumnAbsSums");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<width; ++jLoc )
+    {
+        int iBeg, iEnd;
+        ColumnRange( region, jLoc, height, iBeg, iEnd );
+        if( iEnd > iBeg )
+            colSums[jLoc] =
+                SegmentAbsSum( iEnd-iBeg, A.LockedBuffer(iBeg,jLoc) );
+        else
+            colSums[jLoc] = 0;
+    }
+}
+
+// Overwrite rowSums[iLoc] with the sum of the magnitudes of the entries of
+// local row iLoc within the region. Each thread owns a contiguous block of
+// rows and sweeps down the columns so that memory is still accessed with
+// unit stride.
+template<typename F>
+inline void
+LocalRowAbsSums
+( const Matrix<F>& A, const Region& region, BASE(F)* rowSums )
+{
+#ifndef RELEASE
+    CallStackEntry entry("norm::LocalRowAbsSums");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    const int blocksize = 256;
+    const int numBlocks = (height+blocksize-1)/blocksize;
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int block=0; block<numBlocks; ++block )
+    {
+        const int blockBeg = block*blocksize;
+        const int blockEnd = std::min(blockBeg+blocksize,height);
+        for( int iLoc=blockBeg; iLoc<blockEnd; ++iLoc )
+            rowSums[iLoc] = 0;
+        for( int jLoc=0; jLoc<width; ++jLoc )
+        {
+            int iBeg, iEnd;
+            ColumnRange( region, jLoc, height, iBeg, iEnd );
+            iBeg = std::max(iBeg,blockBeg);
+            iEnd = std::min(iEnd,blockEnd);
+            const F* ACol = A.LockedBuffer(0,jLoc);
+            for( int iLoc=iBeg; iLoc<iEnd; ++iLoc )
+                rowSums[iLoc] += Abs(ACol[iLoc]);
+        }
+    }
+}
+
+} // namespace norm
+} // namespace elem
+
+#endif // ifndef LAPACK_NORM_UTIL_HPP
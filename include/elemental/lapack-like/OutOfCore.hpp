@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_OUTOFCORE_HPP
+#define LAPACK_OUTOFCORE_HPP
+
+namespace elem {
+namespace ooc {
+
+// The width of the in-core panels of an out-of-core factorization of A such
+// that two panels, two streamed blocks of Blocksize() columns, and the
+// redistributions of a block fit within 'memoryBudget' bytes per process
+template<typename F>
+inline int
+PanelWidth( const DiskDistMatrix<F>& A, std::size_t memoryBudget )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ooc::PanelWidth");
+#endif
+    const Grid& g = A.Grid();
+    const int c = g.Width();
+    const int nb = Blocksize();
+    const std::size_t maxLocalHeight =
+        std::max( MaxLength(A.Height(),g.Height()), 1 );
+    const std::size_t localCols = memoryBudget/(maxLocalHeight*sizeof(F));
+    const std::size_t blockCols = 2*MaxLength(nb,c) + nb;
+    if( localCols < blockCols+2 )
+        throw std::logic_error("Memory budget is too small");
+    int width = c*((localCols-blockCols)/2);
+    if( width > nb )
+        width -= width % nb;
+    return std::max( std::min( width, A.Width() ), 1 );
+}
+
+// Drive a left-looking factorization of A in panels of 'panelWidth'
+// columns. Each panel is read into memory, updated by each of the factored
+// panels to its left, factored, and written back. All but the most recent
+// of the factored panels (which is still in memory) are streamed through
+// memory in blocks of at most Blocksize() columns, and the reads of the
+// next block and panel, as well as the writes, are overlapped with the
+// computation. The functor must provide
+//
+//   void Update( int i, const DistMatrix<F>& S, int j, DistMatrix<F>& T )
+//
+// which updates the panel T (columns [j,j+T.Width()) of A) with the factored
+// columns [i,i+S.Width()) held in S (which never span two panels), and
+//
+//   void Factor( int j, DistMatrix<F>& T ).
+template<typename F,class Functor>
+inline void
+LeftLooking( DiskDistMatrix<F>& A, int panelWidth, Functor& functor )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ooc::LeftLooking");
+    if( panelWidth < 1 )
+        throw std::logic_error("Panel width must be positive");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int nb = Blocksize();
+    Memory<F> panelMemory[2], blockMemory[2];
+    F* panelBuffers[2];
+    F* blockBuffers[2];
+    for( int k=0; k<2; ++k )
+    {
+        panelBuffers[k] = panelMemory[k].Require( A.PanelSize(panelWidth) );
+        blockBuffers[k] =
+            blockMemory[k].Require( A.PanelSize(std::min(nb,panelWidth)) );
+    }
+    DistMatrix<F> T0(g), T1(g), S0(g), S1(g);
+    DistMatrix<F>* panels[2] = { &T0, &T1 };
+    DistMatrix<F>* blocks[2] = { &S0, &S1 };
+    std::vector<mpi::Request> panelRequests[2], blockRequests[2];
+
+    if( n > 0 )
+    {
+        A.AttachPanel( 0, std::min(panelWidth,n), panelBuffers[0], T0 );
+        A.StartRead( 0, T0, panelRequests[0] );
+    }
+    int panel = 0;
+    for( int j=0; j<n; j+=panelWidth )
+    {
+        DistMatrix<F>& T = *panels[panel];
+        DistMatrix<F>& TPrev = *panels[1-panel];
+        DiskDistMatrix<F>::Wait( panelRequests[panel] );
+
+        // Stream in the panels preceding the previous one (the read of the
+        // first block was started during the previous iteration)
+        const int streamEnd = std::max( j-panelWidth, 0 );
+        int block = 0;
+        for( int i=0; i<streamEnd; )
+        {
+            const int iEnd =
+                std::min( i+nb, (i/panelWidth+1)*panelWidth );
+            DiskDistMatrix<F>::Wait( blockRequests[block] );
+            if( iEnd < streamEnd )
+            {
+                const int nextWidth =
+                    std::min( nb, (iEnd/panelWidth+1)*panelWidth-iEnd );
+                A.AttachPanel
+                ( iEnd, nextWidth, blockBuffers[1-block], *blocks[1-block] );
+                A.StartRead( iEnd, *blocks[1-block], blockRequests[1-block] );
+            }
+            functor.Update( i, *blocks[block], j, T );
+            i = iEnd;
+            block = 1-block;
+        }
+        if( j > 0 )
+            functor.Update( j-panelWidth, TPrev, j, T );
+
+        // Once the previous panel has been written, start reading the next
+        // panel into its buffer, as well as the first block of the next
+        // stream
+        DiskDistMatrix<F>::Wait( panelRequests[1-panel] );
+        const int jNext = j + panelWidth;
+        if( jNext < n )
+        {
+            A.AttachPanel
+            ( jNext, std::min(panelWidth,n-jNext), panelBuffers[1-panel],
+              TPrev );
+            A.StartRead( jNext, TPrev, panelRequests[1-panel] );
+            if( j > 0 )
+            {
+                A.AttachPanel
+                ( 0, std::min(nb,panelWidth), blockBuffers[0], S0 );
+                A.StartRead( 0, S0, blockRequests[0] );
+            }
+        }
+
+        functor.Factor( j, T );
+        A.StartWrite( j, T, panelRequests[panel] );
+        panel = 1-panel;
+    }
+    DiskDistMatrix<F>::Wait( panelRequests[0] );
+    DiskDistMatrix<F>::Wait( panelRequests[1] );
+}
+
+} // namespace ooc
+} // namespace elem
+
+#endif // ifndef LAPACK_OUTOFCORE_HPP
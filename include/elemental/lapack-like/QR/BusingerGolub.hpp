@@ -12,7 +12,14 @@
 
 #include "elemental/blas-like/level2/Gemv.hpp"
 #include "elemental/blas-like/level2/Ger.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyColumnPivots.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/Norm/Util.hpp"
+#include "elemental/lapack-like/QR/Householder.hpp"
 #include "elemental/lapack-like/Reflector.hpp"
+#include "elemental/matrices/Uniform.hpp"
 #include "elemental/matrices/Zeros.hpp"
 
 #include <algorithm>
@@ -57,12 +64,12 @@ FindPivot( const std::vector<Real>& norms, int col )
 
 template<typename F> 
 inline void
-BusingerGolub
+UnblockedBusingerGolub
 ( Matrix<F>& A, Matrix<F>& t, Matrix<int>& p,
   int maxSteps, BASE(F) tol, bool alwaysRecompute=false )
 {
 #ifndef RELEASE
-    CallStackEntry entry("qr::BusingerGolub");
+    CallStackEntry entry("qr::UnblockedBusingerGolub");
     if( maxSteps > std::min(A.Height(),A.Width()) )
         throw std::logic_error("Too many steps requested");
     if( t.Viewing() && (t.Height() != maxSteps || t.Width() != 1) )
@@ -170,6 +177,188 @@ BusingerGolub
     }
 }
 
+// A blocked alternative to UnblockedBusingerGolub which selects a block of
+// pivots at a time by running the unblocked algorithm on a small random
+// sketch, Y = G A, of the trailing columns (see Martinsson et al.'s and
+// Duersch and Gu's "HQRRP"). Each panel is then factored without pivoting and
+// the trailing matrix is updated with Level 3 operations, and the sketch is 
+// downdated via Y2 := Y2 - Y1 inv(R11) R12 rather than being recomputed.
+template<typename F>
+inline void
+BlockBusingerGolub
+( Matrix<F>& A, Matrix<F>& t, Matrix<int>& p,
+  int maxSteps, BASE(F) tol, int oversample=10 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::BlockBusingerGolub");
+    if( maxSteps > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Too many steps requested");
+    if( t.Viewing() && (t.Height() != maxSteps || t.Width() != 1) )
+        throw std::logic_error
+        ("t must be a vector of the same height as the number of steps");
+    if( p.Viewing() && (p.Height() != maxSteps || p.Width() != 1) )
+        throw std::logic_error
+        ("p must be a vector of the same height as the number of steps");
+    if( oversample < 0 )
+        throw std::logic_error("Oversampling must be non-negative");
+#endif
+    typedef BASE(F) Real;
+    if( !p.Viewing() )
+        p.ResizeTo( maxSteps, 1 );
+    if( !t.Viewing() )
+        t.ResizeTo( maxSteps, 1 );
+    const int m = A.Height();
+    const int n = A.Width();
+    const int bsize = Blocksize();
+    const int sampleSize = bsize + oversample;
+
+    std::vector<Real> norms;
+    const Real maxOrigNorm = ( tol >= Real(0) ? ColumnNorms( A, norms ) : 0 );
+
+    Matrix<F> G, Y;
+    Uniform( G, sampleSize, m );
+    Zeros( Y, sampleSize, n );
+    Gemm( NORMAL, NORMAL, F(1), G, A, F(0), Y );
+
+    Matrix<F> AR, ABR, APan, APanCopy, ARest, R11, R12, A22, YR, Y1, Y2, 
+              W, sampleT, tPan;
+    Matrix<int> pPan, pTail;
+    for( int col=0; col<maxSteps; col+=bsize )
+    {
+        const int b = std::min(bsize,maxSteps-col);
+        View( AR, A, 0, col, m, n-col );
+        View( ABR, A, col, col, m-col, n-col );
+        View( YR, Y, 0, col, sampleSize, n-col );
+
+        // Stop early if all of the trailing columns are sufficiently small
+        if( tol >= Real(0) && ColumnNorms( ABR, norms ) <= tol*maxOrigNorm )
+        {
+            p.ResizeTo( col, 1 );
+            t.ResizeTo( col, 1 );
+            break;
+        }
+
+        // Select the next b pivots from the sketch of the trailing columns
+        Matrix<F> sample( YR );
+        UnblockedBusingerGolub( sample, sampleT, pPan, b, Real(-1) );
+        ApplyColumnPivots( AR, pPan );
+        ApplyColumnPivots( YR, pPan );
+        for( int k=0; k<b; ++k )
+            p.Set( col+k, 0, col+pPan.Get(k,0) );
+
+        // Factor the panel without pivoting
+        View( APan, A, col, col, m-col, b );
+        if( tol >= Real(0) )
+            APanCopy = APan;
+        Householder( APan, tPan );
+        for( int k=0; k<b; ++k )
+            t.Set( col+k, 0, tPan.Get(k,0) );
+
+        // Truncate at the first sufficiently small diagonal entry of R
+        int kEnd = b;
+        bool singular = false;
+        for( int k=0; k<b; ++k )
+        {
+            const Real rho = Abs(A.Get(col+k,col+k));
+            if( tol >= Real(0) && rho <= tol*maxOrigNorm )
+            {
+                kEnd = k;
+                break;
+            }
+            if( rho == Real(0) )
+                singular = true;
+        }
+        if( kEnd < b )
+        {
+            // Restore the unused panel columns and undo their swaps
+            Matrix<F> APanTail, APanCopyTail;
+            View( APanTail, A, col, col+kEnd, m-col, b-kEnd );
+            LockedView( APanCopyTail, APanCopy, 0, kEnd, m-col, b-kEnd );
+            APanTail = APanCopyTail;
+            pTail.ResizeTo( b-kEnd, 1 );
+            for( int k=kEnd; k<b; ++k )
+                pTail.Set( k-kEnd, 0, pPan.Get(k,0)-kEnd );
+            View( AR, A, 0, col+kEnd, m, n-col-kEnd );
+            ApplyInverseColumnPivots( AR, pTail );
+
+            // Apply the retained reflectors to the rest of the matrix
+            Matrix<F> H, tH;
+            LockedView( H, A, col, col, m-col, kEnd );
+            LockedView( tH, tPan, 0, 0, kEnd, 1 );
+            View( ARest, A, col, col+kEnd, m-col, n-col-kEnd );
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, H, tH, ARest );
+
+            // The sketch does not guarantee that the rejected pivot was the
+            // largest trailing column, so, unless all of the trailing columns
+            // are sufficiently small, finish with the unblocked algorithm
+            const int colEnd = col + kEnd;
+            View( ABR, A, colEnd, colEnd, m-colEnd, n-colEnd );
+            const Real maxTailNorm = ColumnNorms( ABR, norms );
+            int numTailSteps = 0;
+            if( maxTailNorm > tol*maxOrigNorm )
+            {
+                Matrix<F> tTail, AT;
+                UnblockedBusingerGolub
+                ( ABR, tTail, pTail, maxSteps-colEnd, 
+                  tol*maxOrigNorm/maxTailNorm );
+                numTailSteps = pTail.Height();
+                View( AT, A, 0, colEnd, colEnd, n-colEnd );
+                ApplyColumnPivots( AT, pTail );
+                for( int k=0; k<numTailSteps; ++k )
+                {
+                    p.Set( colEnd+k, 0, colEnd+pTail.Get(k,0) );
+                    t.Set( colEnd+k, 0, tTail.Get(k,0) );
+                }
+            }
+            p.ResizeTo( colEnd+numTailSteps, 1 );
+            t.ResizeTo( colEnd+numTailSteps, 1 );
+            break;
+        }
+
+        // Update the trailing matrix with the panel's block reflector
+        View( ARest, A, col, col+b, m-col, n-col-b );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, APan, tPan, ARest );
+        if( col+b == maxSteps )
+            break;
+
+        // Downdate the sketch of the trailing matrix, falling back to a 
+        // fresh sketch if R11 is exactly singular
+        View( Y2, Y, 0, col+b, sampleSize, n-col-b );
+        if( singular )
+        {
+            LockedView( A22, A, col+b, col+b, m-col-b, n-col-b );
+            Uniform( G, sampleSize, m-col-b );
+            Gemm( NORMAL, NORMAL, F(1), G, A22, F(0), Y2 );
+        }
+        else
+        {
+            LockedView( Y1, Y, 0, col, sampleSize, b );
+            LockedView( R11, A, col, col, b, b );
+            LockedView( R12, A, col, col+b, b, n-col-b );
+            W = Y1;
+            Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R11, W );
+            Gemm( NORMAL, NORMAL, F(-1), W, R12, F(1), Y2 );
+        }
+    }
+}
+
+template<typename F> 
+inline void
+BusingerGolub
+( Matrix<F>& A, Matrix<F>& t, Matrix<int>& p,
+  int maxSteps, BASE(F) tol, bool alwaysRecompute=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::BusingerGolub");
+#endif
+    if( alwaysRecompute || maxSteps <= Blocksize() )
+        UnblockedBusingerGolub( A, t, p, maxSteps, tol, alwaysRecompute );
+    else
+        BlockBusingerGolub( A, t, p, maxSteps, tol );
+}
+
 template<typename F> 
 inline void
 BusingerGolub
@@ -245,7 +434,15 @@ FindColumnPivot
     const int rowShift = A.RowShift();
     const int rowStride = A.RowStride();
     const int localColsBefore = Length( col, rowShift, rowStride );
-    const mpi::ValueInt<Real> localPivot = FindPivot( norms, localColsBefore );
+    mpi::ValueInt<Real> localPivot;
+    if( localColsBefore < (int)norms.size() )
+        localPivot = FindPivot( norms, localColsBefore );
+    else
+    {
+        // We do not own any of the remaining columns
+        localPivot.value = -1;
+        localPivot.index = 0;
+    }
     mpi::ValueInt<Real> pivot;
     pivot.value = localPivot.value;
     pivot.index = rowShift + localPivot.index*rowStride;
@@ -261,57 +458,17 @@ ColumnNorms( const DistMatrix<F>& A, std::vector<BASE(F)>& norms )
     CallStackEntry entry("qr::ColumnNorms");
 #endif
     typedef BASE(F) Real;
-    const int localHeight = A.LocalHeight();
     const int localWidth = A.LocalWidth();
     mpi::Comm colComm = A.Grid().ColComm();
     mpi::Comm rowComm = A.Grid().RowComm();
 
-    // Carefully perform the local portion of the computation
-    std::vector<Real> localScales(localWidth,0), 
-                      localScaledSquares(localWidth,1);
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Real alphaAbs = Abs(A.GetLocal(iLoc,jLoc));    
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= localScales[jLoc] )
-                {
-                    const Real relScale = alphaAbs/localScales[jLoc];
-                    localScaledSquares[jLoc] += relScale*relScale;
-                }
-                else
-                {
-                    const Real relScale = localScales[jLoc]/alphaAbs;
-                    localScaledSquares[jLoc] = 
-                        localScaledSquares[jLoc]*relScale*relScale + 1;
-                    localScales[jLoc] = alphaAbs;
-                }
-            }
-        }
-    }
-
-    // Find the maximum relative scales 
-    std::vector<Real> scales(localWidth);
-    mpi::AllReduce
-    ( &localScales[0], &scales[0], localWidth, mpi::MAX, colComm );
-
-    // Equilibrate the local scaled sums to the maximum scale
-    for( int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        if( scales[jLoc] != 0 )
-        {
-            const Real relScale = localScales[jLoc]/scales[jLoc];
-            localScaledSquares[jLoc] *= relScale*relScale;
-        }
-    }
-
-    // Now sum the local contributions (can ignore results where scale is 0)
-    std::vector<Real> scaledSquares(localWidth); 
-    mpi::AllReduce
-    ( &localScaledSquares[0], &scaledSquares[0], localWidth, 
-      mpi::SUM, colComm );
+    // Carefully perform the local portion of the computation and then 
+    // combine the (scale,scaledSquare) pairs of every column at once
+    std::vector<Real> scales(localWidth), scaledSquares(localWidth);
+    norm::LocalColumnScaledSquares
+    ( A.LockedMatrix(), norm::DistRegion(A), &scales[0], &scaledSquares[0] );
+    norm::AllReduceScaledSquares
+    ( &scales[0], &scaledSquares[0], localWidth, colComm );
 
     // Finish the computation
     Real maxLocalNorm = 0;
@@ -333,7 +490,7 @@ ColumnNorms( const DistMatrix<F>& A, std::vector<BASE(F)>& norms )
 template<typename F>
 inline void
 ReplaceColumnNorms
-( const DistMatrix<F>& A, std::vector<int>& inaccurateNorms, 
+( const DistMatrix<F>& A, int rowOffset, std::vector<int>& inaccurateNorms, 
   std::vector<BASE(F)>& norms, std::vector<BASE(F)>& origNorms )
 {
 #ifndef RELEASE
@@ -341,56 +498,28 @@ ReplaceColumnNorms
 #endif
     typedef BASE(F) Real;
     const int localHeight = A.LocalHeight();
+    const int localRowOffset = Length( rowOffset, A.ColShift(), A.ColStride() );
     const int numInaccurate = inaccurateNorms.size();
     mpi::Comm colComm = A.Grid().ColComm();
 
     // Carefully perform the local portion of the computation
-    std::vector<Real> localScales(numInaccurate,0), 
-                      localScaledSquares(numInaccurate,1);
-    for( int s=0; s<numInaccurate; ++s )
+    std::vector<Real> scales(numInaccurate,0), scaledSquares(numInaccurate,1);
+    const int localTailHeight = localHeight - localRowOffset;
+    if( localTailHeight > 0 )
     {
-        const int jLoc = inaccurateNorms[s];
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Real alphaAbs = Abs(A.GetLocal(iLoc,jLoc));    
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= localScales[s] )
-                {
-                    const Real relScale = alphaAbs/localScales[s];
-                    localScaledSquares[s] += relScale*relScale;
-                }
-                else
-                {
-                    const Real relScale = localScales[s]/alphaAbs;
-                    localScaledSquares[s] = 
-                        localScaledSquares[s]*relScale*relScale + 1;
-                    localScales[s] = alphaAbs;
-                }
-            }
-        }
-    }
-
-    // Find the maximum relative scales 
-    std::vector<Real> scales(numInaccurate);
-    mpi::AllReduce
-    ( &localScales[0], &scales[0], numInaccurate, mpi::MAX, colComm );
-
-    // Equilibrate the local scaled sums to the maximum scale
-    for( int s=0; s<numInaccurate; ++s )
-    {
-        if( scales[s] != 0 )
-        {
-            const Real relScale = localScales[s]/scales[s];
-            localScaledSquares[s] *= relScale*relScale;
-        }
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+        for( int s=0; s<numInaccurate; ++s )
+            norm::UpdateScaledSquare
+            ( localTailHeight, 
+              A.LockedBuffer(localRowOffset,inaccurateNorms[s]),
+              scales[s], scaledSquares[s] );
     }
 
-    // Now sum the local contributions (can ignore results where scale is 0)
-    std::vector<Real> scaledSquares(numInaccurate); 
-    mpi::AllReduce
-    ( &localScaledSquares[0], &scaledSquares[0], numInaccurate,
-      mpi::SUM, colComm );
+    // Combine the contributions from the process column in one reduction
+    norm::AllReduceScaledSquares
+    ( &scales[0], &scaledSquares[0], numInaccurate, colComm );
 
     // Finish the computation
     for( int s=0; s<numInaccurate; ++s )
@@ -406,12 +535,12 @@ ReplaceColumnNorms
 
 template<typename F>
 inline void
-BusingerGolub
+UnblockedBusingerGolub
 ( DistMatrix<F>& A, DistMatrix<F,MD,STAR>& t, DistMatrix<int,VR,STAR>& p,
   int maxSteps, BASE(F) tol, bool alwaysRecompute=false )
 {
 #ifndef RELEASE
-    CallStackEntry entry("qr::BusingerGolub");
+    CallStackEntry entry("qr::UnblockedBusingerGolub");
     if( maxSteps > std::min(A.Height(),A.Width()) )
         throw std::logic_error("Too many steps requested");
     if( t.Viewing() && (t.Height() != maxSteps || t.Width() != 1) )
@@ -578,8 +707,9 @@ BusingerGolub
                     norms[jLoc] *= Sqrt(gamma);
             }
         }
-        // Step 2: Compute the replacement norms and also reset origNorms
-        ReplaceColumnNorms( A, inaccurateNorms, norms, origNorms );
+        // Step 2: Compute the replacement norms of the trailing portions of
+        //         the columns and also reset origNorms
+        ReplaceColumnNorms( A, col+1, inaccurateNorms, norms, origNorms );
         //--------------------------------------------------------------------//
 
         SlidePartitionDownDiagonal
@@ -590,6 +720,207 @@ BusingerGolub
     }
 }
 
+template<typename F>
+inline void
+BlockBusingerGolub
+( DistMatrix<F>& A, DistMatrix<F,MD,STAR>& t, DistMatrix<int,VR,STAR>& p,
+  int maxSteps, BASE(F) tol, int oversample=10 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::BlockBusingerGolub");
+    if( maxSteps > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Too many steps requested");
+    if( t.Viewing() && (t.Height() != maxSteps || t.Width() != 1) )
+        throw std::logic_error
+        ("t must be a vector of the same height as the number of steps");
+    if( p.Viewing() && (p.Height() != maxSteps || p.Width() != 1) )
+        throw std::logic_error
+        ("p must be a vector of the same height as the number of steps");
+    if( A.Grid() != p.Grid() || A.Grid() != t.Grid() )
+        throw std::logic_error("A, t, and p must have the same grid");
+    if( oversample < 0 )
+        throw std::logic_error("Oversampling must be non-negative");
+#endif
+    typedef BASE(F) Real;
+    const Grid& g = A.Grid();
+    if( !t.Viewing() )
+        t.ResizeTo( maxSteps, 1 );
+    if( !p.Viewing() )
+        p.ResizeTo( maxSteps, 1 );
+    const int m = A.Height();
+    const int n = A.Width();
+    const int bsize = Blocksize();
+    const int sampleSize = bsize + oversample;
+
+    std::vector<Real> norms;
+    const Real maxOrigNorm = ( tol >= Real(0) ? ColumnNorms( A, norms ) : 0 );
+
+    DistMatrix<F> G(g), Y(g);
+    Uniform( G, sampleSize, m );
+    Zeros( Y, sampleSize, n );
+    Gemm( NORMAL, NORMAL, F(1), G, A, F(0), Y );
+
+    DistMatrix<F> AR(g), ABR(g), APan(g), APanCopy(g), ARest(g), 
+                  R11(g), R12(g), A22(g), YR(g), Y1(g), Y2(g), W(g);
+    DistMatrix<F,MD,STAR> tPan(g);
+
+    // Temporary distributions
+    DistMatrix<F,STAR,STAR> YR_STAR_STAR(g), R11_STAR_STAR(g), 
+                            tPan_STAR_STAR(g);
+    DistMatrix<int,STAR,STAR> pPan_STAR_STAR(g), pTail_STAR_STAR(g);
+
+    Matrix<F> sampleT;
+    Matrix<int> pPan;
+    for( int col=0; col<maxSteps; col+=bsize )
+    {
+        const int b = std::min(bsize,maxSteps-col);
+        View( AR, A, 0, col, m, n-col );
+        View( ABR, A, col, col, m-col, n-col );
+        View( YR, Y, 0, col, sampleSize, n-col );
+
+        // Stop early if all of the trailing columns are sufficiently small
+        if( tol >= Real(0) && ColumnNorms( ABR, norms ) <= tol*maxOrigNorm )
+        {
+            p.ResizeTo( col, 1 );
+            t.ResizeTo( col, 1 );
+            break;
+        }
+
+        // Redundantly select the next b pivots from the sketch of the 
+        // trailing columns
+        YR_STAR_STAR = YR;
+        UnblockedBusingerGolub
+        ( YR_STAR_STAR.Matrix(), sampleT, pPan, b, Real(-1) );
+        pPan_STAR_STAR.ResizeTo( b, 1 );
+        for( int k=0; k<b; ++k )
+        {
+            pPan_STAR_STAR.SetLocal( k, 0, pPan.Get(k,0) );
+            p.Set( col+k, 0, col+pPan.Get(k,0) );
+        }
+        ApplyColumnPivots( AR, pPan_STAR_STAR );
+        ApplyColumnPivots( YR, pPan_STAR_STAR );
+
+        // Factor the panel without pivoting
+        View( APan, A, col, col, m-col, b );
+        if( tol >= Real(0) )
+            APanCopy = APan;
+        tPan.SetGrid( g );
+        Householder( APan, tPan );
+        tPan_STAR_STAR = tPan;
+        for( int k=0; k<b; ++k )
+            t.Set( col+k, 0, tPan_STAR_STAR.GetLocal(k,0) );
+
+        // Truncate at the first sufficiently small diagonal entry of R
+        LockedView( R11, A, col, col, b, b );
+        R11_STAR_STAR = R11;
+        int kEnd = b;
+        bool singular = false;
+        for( int k=0; k<b; ++k )
+        {
+            const Real rho = Abs(R11_STAR_STAR.GetLocal(k,k));
+            if( tol >= Real(0) && rho <= tol*maxOrigNorm )
+            {
+                kEnd = k;
+                break;
+            }
+            if( rho == Real(0) )
+                singular = true;
+        }
+        if( kEnd < b )
+        {
+            // Restore the unused panel columns and undo their swaps
+            DistMatrix<F> APanTail(g), APanCopyTail(g);
+            View( APanTail, A, col, col+kEnd, m-col, b-kEnd );
+            LockedView( APanCopyTail, APanCopy, 0, kEnd, m-col, b-kEnd );
+            APanTail = APanCopyTail;
+            pTail_STAR_STAR.ResizeTo( b-kEnd, 1 );
+            for( int k=kEnd; k<b; ++k )
+                pTail_STAR_STAR.SetLocal( k-kEnd, 0, pPan.Get(k,0)-kEnd );
+            View( AR, A, 0, col+kEnd, m, n-col-kEnd );
+            ApplyInverseColumnPivots( AR, pTail_STAR_STAR );
+
+            // Apply the retained reflectors to the rest of the matrix
+            DistMatrix<F> H(g);
+            DistMatrix<F,MD,STAR> tH(g);
+            LockedView( H, A, col, col, m-col, kEnd );
+            LockedView( tH, tPan, 0, 0, kEnd, 1 );
+            View( ARest, A, col, col+kEnd, m-col, n-col-kEnd );
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, H, tH, ARest );
+
+            // The sketch does not guarantee that the rejected pivot was the
+            // largest trailing column, so, unless all of the trailing columns
+            // are sufficiently small, finish with the unblocked algorithm
+            const int colEnd = col + kEnd;
+            View( ABR, A, colEnd, colEnd, m-colEnd, n-colEnd );
+            const Real maxTailNorm = ColumnNorms( ABR, norms );
+            int numTailSteps = 0;
+            if( maxTailNorm > tol*maxOrigNorm )
+            {
+                DistMatrix<F> AT(g);
+                DistMatrix<F,MD,STAR> tTail(g);
+                DistMatrix<int,VR,STAR> pTail(g);
+                UnblockedBusingerGolub
+                ( ABR, tTail, pTail, maxSteps-colEnd, 
+                  tol*maxOrigNorm/maxTailNorm );
+                numTailSteps = pTail.Height();
+                View( AT, A, 0, colEnd, colEnd, n-colEnd );
+                ApplyColumnPivots( AT, pTail );
+                pTail_STAR_STAR = pTail;
+                DistMatrix<F,STAR,STAR> tTail_STAR_STAR( tTail );
+                for( int k=0; k<numTailSteps; ++k )
+                {
+                    p.Set( colEnd+k, 0, colEnd+pTail_STAR_STAR.GetLocal(k,0) );
+                    t.Set( colEnd+k, 0, tTail_STAR_STAR.GetLocal(k,0) );
+                }
+            }
+            p.ResizeTo( colEnd+numTailSteps, 1 );
+            t.ResizeTo( colEnd+numTailSteps, 1 );
+            break;
+        }
+
+        // Update the trailing matrix with the panel's block reflector
+        View( ARest, A, col, col+b, m-col, n-col-b );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, APan, tPan, ARest );
+        if( col+b == maxSteps )
+            break;
+
+        // Downdate the sketch of the trailing matrix, falling back to a 
+        // fresh sketch if R11 is exactly singular
+        View( Y2, Y, 0, col+b, sampleSize, n-col-b );
+        if( singular )
+        {
+            LockedView( A22, A, col+b, col+b, m-col-b, n-col-b );
+            Uniform( G, sampleSize, m-col-b );
+            Gemm( NORMAL, NORMAL, F(1), G, A22, F(0), Y2 );
+        }
+        else
+        {
+            LockedView( Y1, Y, 0, col, sampleSize, b );
+            LockedView( R12, A, col, col+b, b, n-col-b );
+            W = Y1;
+            Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R11, W );
+            Gemm( NORMAL, NORMAL, F(-1), W, R12, F(1), Y2 );
+        }
+    }
+}
+
+template<typename F>
+inline void
+BusingerGolub
+( DistMatrix<F>& A, DistMatrix<F,MD,STAR>& t, DistMatrix<int,VR,STAR>& p,
+  int maxSteps, BASE(F) tol, bool alwaysRecompute=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::BusingerGolub");
+#endif
+    if( alwaysRecompute || maxSteps <= Blocksize() )
+        UnblockedBusingerGolub( A, t, p, maxSteps, tol, alwaysRecompute );
+    else
+        BlockBusingerGolub( A, t, p, maxSteps, tol );
+}
+
 // If we don't need 't' from the above routine
 template<typename F>
 inline void
@@ -105,7 +105,7 @@ Reflector( R& chi, int m, R* x, int incx )
     R norm = blas::Nrm2( m, x, incx );
     if( norm == 0 )
     {
-        x[0] = -x[0];
+        chi = -chi;
         return R(2);
     }
 
@@ -11,10 +11,13 @@
 #define LAPACK_SCHUR_HPP
 
 #include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
 #include "elemental/blas-like/level1/Scale.hpp"
 #include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/Hessenberg.hpp"
 #include "elemental/lapack-like/Norm/One.hpp"
 #include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/Schur/QR.hpp"
 #include "elemental/lapack-like/Sign.hpp"
 #include "elemental/lapack-like/Trace.hpp"
 #include "elemental/matrices/Identity.hpp"
@@ -115,28 +118,94 @@ NewtonSDC( DistMatrix<F>& A )
 
 } // namespace schur
 
+// Compute the Schur decomposition of a general square matrix, A = Q T Q^H,
+// where T is upper triangular in the complex case and upper quasi-triangular
+// in the real case. On exit, A is overwritten with T and w with the
+// eigenvalues.
+
+template<typename F>
+inline void
+Schur( Matrix<F>& A, Matrix<Complex<BASE(F)> >& w, bool fullTriangle=true )
+{
+#ifndef RELEASE
+    CallStackEntry cse("Schur");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const int n = A.Height();
+    Matrix<F> t;
+    Hessenberg( A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
+    Matrix<F> Q( n, n );
+    w.ResizeTo( n, 1 );
+    lapack::HessenbergSchur
+    ( n, A.Buffer(), A.LDim(), w.Buffer(), Q.Buffer(), Q.LDim(), 
+      fullTriangle );
+}
+
+template<typename F>
+inline void
+Schur
+( Matrix<F>& A, Matrix<Complex<BASE(F)> >& w, Matrix<F>& Q, 
+  bool fullTriangle=true )
+{
+#ifndef RELEASE
+    CallStackEntry cse("Schur");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const int n = A.Height();
+    Matrix<F> t;
+    Hessenberg( A, t );
+    Identity( Q, n, n );
+    hessenberg::ApplyQ( A, t, Q );
+    MakeTrapezoidal( UPPER, A, -1 );
+    w.ResizeTo( n, 1 );
+    lapack::HessenbergSchur
+    ( n, A.Buffer(), A.LDim(), w.Buffer(), Q.Buffer(), Q.LDim(), 
+      fullTriangle, true );
+}
+
 template<typename F>
 inline void
-Schur( Matrix<F>& A )
+Schur( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,STAR,STAR>& w )
 {
 #ifndef RELEASE
     CallStackEntry cse("Schur");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
 #endif
-    throw std::logic_error("This routine not yet written");
-    // TODO: Call LAPACK...
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> t(g);
+    Hessenberg( A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
+    DistMatrix<F> Q(g);
+    schur::QR( A, w, Q, false );
 }
 
 template<typename F>
-inline int
-Schur( DistMatrix<F>& A )
+inline void
+Schur
+( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,STAR,STAR>& w, 
+  DistMatrix<F>& Q )
 {
 #ifndef RELEASE
     CallStackEntry cse("Schur");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
 #endif
-    throw std::logic_error("This routine not yet written");
-    // TODO: Spectral D&C
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F,STAR,STAR> t(g);
+    Hessenberg( A, t );
+    Identity( Q, n, n );
+    hessenberg::ApplyQ( A, t, Q );
+    MakeTrapezoidal( UPPER, A, -1 );
+    schur::QR( A, w, Q, true );
 }
 
 } // namespace elem
 
+#include "elemental/lapack-like/Schur/SDC.hpp"
+
 #endif // ifndef LAPACK_SCHUR_HPP
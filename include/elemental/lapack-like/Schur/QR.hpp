@@ -0,0 +1,588 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SCHUR_QR_HPP
+#define LAPACK_SCHUR_QR_HPP
+
+#include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Hessenberg.hpp"
+#include "elemental/lapack-like/Reflector.hpp"
+#include "elemental/matrices/Identity.hpp"
+
+// A distributed multishift Hessenberg QR algorithm with aggressive early
+// deflation, loosely following
+//
+//   K. Braman, R. Byers, and R. Mathias, "The multishift QR algorithm.
+//   Part I: Maintaining well-focused shifts and level 3 performance" and
+//   "Part II: Aggressive early deflation", SIMAX, 23(4), 2002,
+//
+// and the windowed bulge-chasing of R. Granat, B. Kagstrom, and D. Kressner's
+// "A novel parallel QR algorithm for hybrid distributed memory HPC systems".
+//
+// Each sweep chases a chain of tightly-packed 3x3 bulges through a sequence
+// of windows which are redundantly stored on every process; the accumulated
+// orthogonal transformations are then applied to the rest of the matrix with
+// local Gemm calls. Small active blocks and deflation windows are handled by
+// LAPACK.
+
+namespace elem {
+namespace schur {
+
+// Apply the adjoint of the reflector I - tau u u^H, from the left, to rows
+// i0:i0+k-1 and columns jBeg:jEnd-1 of A
+template<typename F>
+inline void
+LocalReflectLeft
+( Matrix<F>& A, int i0, int k, const F* u, F tau, int jBeg, int jEnd )
+{
+    const F tauConj = Conj(tau);
+    for( int j=jBeg; j<jEnd; ++j )
+    {
+        F* a = A.Buffer(i0,j);
+        F gamma = 0;
+        for( int i=0; i<k; ++i )
+            gamma += Conj(u[i])*a[i];
+        gamma *= tauConj;
+        for( int i=0; i<k; ++i )
+            a[i] -= gamma*u[i];
+    }
+}
+
+// Apply the reflector I - tau u u^H, from the right, to columns j0:j0+k-1 and
+// rows iBeg:iEnd-1 of A
+template<typename F>
+inline void
+LocalReflectRight
+( Matrix<F>& A, int j0, int k, const F* u, F tau, int iBeg, int iEnd )
+{
+    const int ldim = A.LDim();
+    F* buffer = A.Buffer(0,j0);
+    for( int i=iBeg; i<iEnd; ++i )
+    {
+        F gamma = 0;
+        for( int l=0; l<k; ++l )
+            gamma += buffer[i+l*ldim]*u[l];
+        gamma *= tau;
+        for( int l=0; l<k; ++l )
+            buffer[i+l*ldim] -= gamma*Conj(u[l]);
+    }
+}
+
+// Group the shifts (ordered from the bottom of the deflation window upwards)
+// into pairs, each described by the sum and product of its members. For real
+// matrices, complex conjugate pairs are kept together and real shifts are
+// paired with each other.
+template<typename R>
+inline void
+ShiftPairs
+( const std::vector<Complex<R> >& shifts, int maxPairs,
+  std::vector<R>& sums, std::vector<R>& prods )
+{
+    bool havePending = false;
+    R pending = 0;
+    for( int k=shifts.size()-1; k>=0 && (int)sums.size()<maxPairs; --k )
+    {
+        const R alpha = RealPart(shifts[k]);
+        if( ImagPart(shifts[k]) != R(0) )
+        {
+            if( k == 0 )
+                break;
+            const R beta = ImagPart(shifts[k]);
+            sums.push_back( 2*alpha );
+            prods.push_back( alpha*alpha + beta*beta );
+            --k;
+        }
+        else if( havePending )
+        {
+            sums.push_back( pending+alpha );
+            prods.push_back( pending*alpha );
+            havePending = false;
+        }
+        else
+        {
+            pending = alpha;
+            havePending = true;
+        }
+    }
+}
+
+template<typename R>
+inline void
+ShiftPairs
+( const std::vector<Complex<R> >& shifts, int maxPairs,
+  std::vector<Complex<R> >& sums, std::vector<Complex<R> >& prods )
+{
+    for( int k=shifts.size()-1; k>0 && (int)sums.size()<maxPairs; k-=2 )
+    {
+        sums.push_back( shifts[k]+shifts[k-1] );
+        prods.push_back( shifts[k]*shifts[k-1] );
+    }
+}
+
+// Read the eigenvalues off of the diagonal (d), subdiagonal (e), and
+// superdiagonal (f) of a (quasi-)triangular matrix
+template<typename R>
+inline void
+QuasiTriangEig
+( const Matrix<R>& d, const Matrix<R>& e, const Matrix<R>& f,
+  Matrix<Complex<R> >& w )
+{
+    const int n = d.Height();
+    w.ResizeTo( n, 1 );
+    for( int k=0; k<n; ++k )
+    {
+        if( k < n-1 && e.Get(k,0) != R(0) )
+        {
+            const R alpha = d.Get(k,0);
+            const R delta = d.Get(k+1,0);
+            const R mean = (alpha+delta)/2;
+            const R halfGap = (alpha-delta)/2;
+            const R disc = halfGap*halfGap + f.Get(k,0)*e.Get(k,0);
+            if( disc < R(0) )
+            {
+                const R root = Sqrt(-disc);
+                w.Set( k,   0, Complex<R>(mean, root) );
+                w.Set( k+1, 0, Complex<R>(mean,-root) );
+            }
+            else
+            {
+                const R root = Sqrt(disc);
+                w.Set( k,   0, mean+root );
+                w.Set( k+1, 0, mean-root );
+            }
+            ++k;
+        }
+        else
+            w.Set( k, 0, d.Get(k,0) );
+    }
+}
+
+template<typename R>
+inline void
+QuasiTriangEig
+( const Matrix<Complex<R> >& d, const Matrix<Complex<R> >& e,
+  const Matrix<Complex<R> >& f, Matrix<Complex<R> >& w )
+{ w = d; }
+
+template<typename F>
+inline void
+ApplyBlockTransform
+( DistMatrix<F>& H, DistMatrix<F>& Q, int j0, int j1, const Matrix<F>& U,
+  bool formQ )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::ApplyBlockTransform");
+#endif
+    const Grid& g = H.Grid();
+    const int n = H.Height();
+    Matrix<F> X;
+
+    // H(j0:j1-1,j1:n-1) := U^H H(j0:j1-1,j1:n-1)
+    if( j1 < n )
+    {
+        DistMatrix<F> HRight(g);
+        View( HRight, H, j0, j1, j1-j0, n-j1 );
+        DistMatrix<F,STAR,MR> HRight_STAR_MR( HRight );
+        X = HRight_STAR_MR.Matrix();
+        Gemm( ADJOINT, NORMAL, F(1), U, X, F(0), HRight_STAR_MR.Matrix() );
+        HRight = HRight_STAR_MR;
+    }
+
+    // H(0:j0-1,j0:j1-1) := H(0:j0-1,j0:j1-1) U
+    if( j0 > 0 )
+    {
+        DistMatrix<F> HAbove(g);
+        View( HAbove, H, 0, j0, j0, j1-j0 );
+        DistMatrix<F,MC,STAR> HAbove_MC_STAR( HAbove );
+        X = HAbove_MC_STAR.Matrix();
+        Gemm( NORMAL, NORMAL, F(1), X, U, F(0), HAbove_MC_STAR.Matrix() );
+        HAbove = HAbove_MC_STAR;
+    }
+
+    // Q(:,j0:j1-1) := Q(:,j0:j1-1) U
+    if( formQ )
+    {
+        DistMatrix<F> QBlock(g);
+        View( QBlock, Q, 0, j0, n, j1-j0 );
+        DistMatrix<F,MC,STAR> QBlock_MC_STAR( QBlock );
+        X = QBlock_MC_STAR.Matrix();
+        Gemm( NORMAL, NORMAL, F(1), X, U, F(0), QBlock_MC_STAR.Matrix() );
+        QBlock = QBlock_MC_STAR;
+    }
+}
+
+// The number of shifts used per sweep, following LAPACK's IPARMQ
+inline int
+NumShifts( int n )
+{
+    int numShifts;
+    if( n < 30 )
+        numShifts = 2;
+    else if( n < 60 )
+        numShifts = 4;
+    else if( n < 150 )
+        numShifts = 10;
+    else if( n < 590 )
+    {
+        const int logN = int(std::floor(std::log(double(n))/std::log(2.)+0.5));
+        numShifts = std::max( 10, n/logN );
+    }
+    else if( n < 3000 )
+        numShifts = 64;
+    else if( n < 6000 )
+        numShifts = 128;
+    else
+        numShifts = 256;
+    return std::max( 2, numShifts-(numShifts%2) );
+}
+
+// Chase a chain of bulges, defined by the shift pairs (sums[k],prods[k]),
+// through the active block H(iBeg:iEnd-1,iBeg:iEnd-1)
+template<typename F>
+inline void
+Sweep
+( DistMatrix<F>& H, DistMatrix<F>& Q, int iBeg, int iEnd,
+  const std::vector<F>& sums, const std::vector<F>& prods, bool formQ )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::Sweep");
+#endif
+    const Grid& g = H.Grid();
+    const int numBulges = sums.size();
+    const int spacing = 4;
+    const int windowSize = 2*spacing*numBulges + 6;
+
+    DistMatrix<F> HWin(g);
+    DistMatrix<F,STAR,STAR> HWin_STAR_STAR(g);
+    Matrix<F> U;
+
+    // pos[k] is the first row of the next reflector for the k'th bulge
+    std::vector<int> pos( numBulges );
+    int numIntroduced=0, numDone=0;
+    F u[3];
+    while( numDone < numBulges )
+    {
+        const int w0 =
+          ( numIntroduced < numBulges ? iBeg : pos[numBulges-1]-1 );
+        const int w1 = std::min( iEnd, w0+windowSize );
+        const int m = w1-w0;
+        View( HWin, H, w0, w0, m, m );
+        HWin_STAR_STAR = HWin;
+        Matrix<F>& W = HWin_STAR_STAR.Matrix();
+        Identity( U, m, m );
+
+        bool progress = true;
+        while( progress )
+        {
+            progress = false;
+
+            // Move each of the bulges one step, starting with the leading one
+            for( int k=numDone; k<numIntroduced; ++k )
+            {
+                const int r = pos[k];
+                if( std::min(r+4,iEnd) > w1 )
+                    break;
+                const int size = std::min( 3, iEnd-r );
+                const int rLoc = r-w0;
+                F chi = W.Get(rLoc,rLoc-1);
+                for( int i=1; i<size; ++i )
+                {
+                    u[i] = W.Get(rLoc+i,rLoc-1);
+                    W.Set( rLoc+i, rLoc-1, F(0) );
+                }
+                const F tau = Reflector( chi, size-1, &u[1], 1 );
+                u[0] = 1;
+                W.Set( rLoc, rLoc-1, chi );
+                LocalReflectLeft( W, rLoc, size, u, tau, rLoc, m );
+                LocalReflectRight
+                ( W, rLoc, size, u, tau, 0, std::min(rLoc+4,m) );
+                LocalReflectRight( U, rLoc, size, u, tau, 0, m );
+                pos[k] = r+1;
+                if( size == 2 )
+                    ++numDone;
+                progress = true;
+            }
+
+            // Introduce the next bulge if there is room
+            if( numIntroduced < numBulges &&
+                ( numIntroduced == numDone ||
+                  pos[numIntroduced-1] >= iBeg+1+spacing ) )
+            {
+                // u := (H - s0 I)(H - s1 I) e0
+                const F sum = sums[numIntroduced];
+                const F prod = prods[numIntroduced];
+                const F eta00 = W.Get(0,0);
+                const F eta01 = W.Get(0,1);
+                const F eta10 = W.Get(1,0);
+                const F eta11 = W.Get(1,1);
+                const F eta21 = W.Get(2,1);
+                u[0] = eta00*eta00 + eta01*eta10 - sum*eta00 + prod;
+                u[1] = eta10*(eta00+eta11-sum);
+                u[2] = eta10*eta21;
+                const BASE(F) scale = Abs(u[0]) + Abs(u[1]) + Abs(u[2]);
+                if( scale != BASE(F)(0) )
+                    for( int i=0; i<3; ++i )
+                        u[i] /= scale;
+
+                F chi = u[0];
+                const F tau = Reflector( chi, 2, &u[1], 1 );
+                u[0] = 1;
+                LocalReflectLeft( W, 0, 3, u, tau, 0, m );
+                LocalReflectRight( W, 0, 3, u, tau, 0, std::min(4,m) );
+                LocalReflectRight( U, 0, 3, u, tau, 0, m );
+                pos[numIntroduced++] = iBeg+1;
+                progress = true;
+            }
+        }
+
+        HWin = HWin_STAR_STAR;
+        ApplyBlockTransform( H, Q, w0, w1, U, formQ );
+    }
+}
+
+// Overwrite the upper Hessenberg matrix H with its (real) Schur form,
+// T = Z^H H Z, compute its eigenvalues, and, if formQ is true, overwrite Q
+// with Q Z. Any entries of H below the subdiagonal must be zero.
+template<typename F>
+inline void
+QR
+( DistMatrix<F>& H, DistMatrix<Complex<BASE(F)>,STAR,STAR>& w,
+  DistMatrix<F>& Q, bool formQ=true )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::QR");
+    if( H.Height() != H.Width() )
+        throw std::logic_error("H must be square");
+    if( formQ && (Q.Height() != H.Height() || Q.Width() != H.Width()) )
+        throw std::logic_error("Q must be the same size as H");
+#endif
+    typedef BASE(F) R;
+    typedef Complex<R> C;
+    const Grid& g = H.Grid();
+    const int n = H.Height();
+    const R ulp = lapack::MachinePrecision<R>();
+    const R safeMin = lapack::MachineSafeMin<R>();
+    const R smallNum = safeMin*(R(n)/ulp);
+    const int minSize = 75;
+    const int maxIts = 30*std::max(10,n);
+    const int exceptionalFreq = 10;
+    const int nibble = 14;
+
+    // Matrix views
+    DistMatrix<F> HAct(g), HBlock(g), HSpike(g);
+
+    // Temporary distributions
+    DistMatrix<F,MD,STAR> d_MD_STAR(g), e_MD_STAR(g), f_MD_STAR(g);
+    DistMatrix<F,STAR,STAR> d_STAR_STAR(g), e_STAR_STAR(g), f_STAR_STAR(g),
+                            HBlock_STAR_STAR(g), spike_STAR_STAR(g);
+    Matrix<F> V, Z, t, X, TTL, TTR, VL;
+    std::vector<C> shifts;
+    std::vector<F> sums, prods;
+
+    int iEnd = n;
+    int numIts=0, totalIts=0;
+    while( iEnd > 0 )
+    {
+        // Gather the diagonal and subdiagonal of the unconverged portion
+        View( HAct, H, 0, 0, iEnd, iEnd );
+        HAct.GetDiagonal( d_MD_STAR );
+        HAct.GetDiagonal( e_MD_STAR, -1 );
+        d_STAR_STAR = d_MD_STAR;
+        e_STAR_STAR = e_MD_STAR;
+        const Matrix<F>& d = d_STAR_STAR.LockedMatrix();
+        const Matrix<F>& e = e_STAR_STAR.LockedMatrix();
+
+        // Search upwards for a negligible subdiagonal entry
+        int iBeg = 0;
+        for( int k=iEnd-1; k>0; --k )
+        {
+            const R eta = Abs(e.Get(k-1,0));
+            R test = Abs(d.Get(k-1,0)) + Abs(d.Get(k,0));
+            if( test == R(0) )
+            {
+                if( k > 1 )
+                    test += Abs(e.Get(k-2,0));
+                if( k < iEnd-1 )
+                    test += Abs(e.Get(k,0));
+            }
+            if( eta <= std::max(smallNum,ulp*test) )
+            {
+                iBeg = k;
+                break;
+            }
+        }
+        if( iBeg > 0 )
+            H.Set( iBeg, iBeg-1, F(0) );
+        const int size = iEnd-iBeg;
+
+        // Small blocks are redundantly handled by LAPACK
+        if( size <= minSize )
+        {
+            View( HBlock, H, iBeg, iBeg, size, size );
+            HBlock_STAR_STAR = HBlock;
+            Z.ResizeTo( size, size );
+            shifts.resize( size );
+            lapack::HessenbergSchur
+            ( size, HBlock_STAR_STAR.Buffer(), HBlock_STAR_STAR.LDim(),
+              &shifts[0], Z.Buffer(), Z.LDim() );
+            HBlock = HBlock_STAR_STAR;
+            ApplyBlockTransform( H, Q, iBeg, iEnd, Z, formQ );
+            iEnd = iBeg;
+            numIts = 0;
+            continue;
+        }
+
+        if( totalIts == maxIts )
+            throw std::runtime_error("QR algorithm did not converge");
+        ++numIts;
+        ++totalIts;
+
+        // Aggressive early deflation: compute the Schur decomposition of the
+        // trailing window, T = V^H H(k0:iEnd-1,k0:iEnd-1) V, and search for
+        // negligible entries of the spike, s V(0,:)^H
+        const int numShifts = NumShifts( size );
+        const int winSize =
+            std::min( size-1, ( size < 500 ? numShifts : 3*numShifts/2 ) );
+        const int k0 = iEnd-winSize;
+        const F s = H.Get( k0, k0-1 );
+        View( HBlock, H, k0, k0, winSize, winSize );
+        HBlock_STAR_STAR = HBlock;
+        Matrix<F>& T = HBlock_STAR_STAR.Matrix();
+        V.ResizeTo( winSize, winSize );
+        shifts.resize( winSize );
+        lapack::HessenbergSchur
+        ( winSize, T.Buffer(), T.LDim(), &shifts[0], V.Buffer(), V.LDim() );
+        Zeros( spike_STAR_STAR, winSize, 1 );
+        Matrix<F>& spike = spike_STAR_STAR.Matrix();
+        for( int i=0; i<winSize; ++i )
+            spike.Set( i, 0, s*Conj(V.Get(0,i)) );
+
+        int numUndeflated = winSize;
+        while( numUndeflated > 0 )
+        {
+            const int nu = numUndeflated;
+            const int blockSize =
+                ( nu > 1 && T.Get(nu-1,nu-2) != F(0) ? 2 : 1 );
+            R scale = Abs(T.Get(nu-1,nu-1));
+            R spikeMax = Abs(spike.Get(nu-1,0));
+            if( blockSize == 2 )
+            {
+                scale += Sqrt(Abs(T.Get(nu-1,nu-2)))*
+                         Sqrt(Abs(T.Get(nu-2,nu-1)));
+                spikeMax = std::max( spikeMax, Abs(spike.Get(nu-2,0)) );
+            }
+            if( scale == R(0) )
+                scale = Abs(s);
+            if( spikeMax > std::max(smallNum,ulp*scale) )
+                break;
+            for( int i=nu-blockSize; i<nu; ++i )
+                spike.Set( i, 0, F(0) );
+            numUndeflated -= blockSize;
+        }
+        const int numDeflated = winSize - numUndeflated;
+
+        if( numDeflated > 0 )
+        {
+            const int nu = numUndeflated;
+            if( nu > 1 )
+            {
+                // Reflect the undeflated part of the spike onto e0
+                std::vector<F> u( nu );
+                F chi = spike.Get(0,0);
+                for( int i=1; i<nu; ++i )
+                    u[i] = spike.Get(i,0);
+                const F tau = Reflector( chi, nu-1, &u[1], 1 );
+                u[0] = 1;
+                LocalReflectLeft( T, 0, nu, &u[0], tau, 0, winSize );
+                LocalReflectRight( T, 0, nu, &u[0], tau, 0, nu );
+                LocalReflectRight( V, 0, nu, &u[0], tau, 0, winSize );
+                spike.Set( 0, 0, chi );
+                for( int i=1; i<nu; ++i )
+                    spike.Set( i, 0, F(0) );
+
+                // Return the undeflated block to Hessenberg form
+                View( TTL, T, 0, 0, nu, nu );
+                View( TTR, T, 0, nu, nu, winSize-nu );
+                View( VL, V, 0, 0, winSize, nu );
+                Hessenberg( TTL, t );
+                Identity( Z, nu, nu );
+                hessenberg::ApplyQ( TTL, t, Z );
+                MakeTrapezoidal( UPPER, TTL, -1 );
+                X = TTR;
+                Gemm( ADJOINT, NORMAL, F(1), Z, X, F(0), TTR );
+                X = VL;
+                Gemm( NORMAL, NORMAL, F(1), X, Z, F(0), VL );
+            }
+
+            HBlock = HBlock_STAR_STAR;
+            View( HSpike, H, k0, k0-1, winSize, 1 );
+            HSpike = spike_STAR_STAR;
+            ApplyBlockTransform( H, Q, k0, iEnd, V, formQ );
+            iEnd -= numDeflated;
+            numIts = 0;
+            if( 100*numDeflated > nibble*winSize || iEnd-iBeg <= minSize )
+                continue;
+        }
+        const int activeSize = iEnd-iBeg;
+
+        // Choose the shifts
+        sums.clear();
+        prods.clear();
+        if( numIts > 0 && numIts % exceptionalFreq == 0 )
+        {
+            for( int i=iEnd-1;
+                 i>=iBeg+2 && (int)sums.size()<numShifts/2; i-=2 )
+            {
+                const R sigma = Abs(e.Get(i-1,0)) + Abs(e.Get(i-2,0));
+                const F alpha = F(R(3)*sigma/R(4)) + d.Get(i,0);
+                sums.push_back( F(2)*alpha );
+                prods.push_back( alpha*alpha + F(R(7)*sigma*sigma/R(16)) );
+            }
+        }
+        else
+        {
+            shifts.resize( numUndeflated );
+            ShiftPairs( shifts, numShifts/2, sums, prods );
+            if( sums.size() == 0 )
+            {
+                // Fall back to the eigenvalues of the trailing block
+                const int bSize = std::min( numShifts, activeSize );
+                View( HBlock, H, iEnd-bSize, iEnd-bSize, bSize, bSize );
+                HBlock_STAR_STAR = HBlock;
+                shifts.resize( bSize );
+                lapack::HessenbergEig
+                ( bSize, HBlock_STAR_STAR.Buffer(), HBlock_STAR_STAR.LDim(),
+                  &shifts[0] );
+                ShiftPairs( shifts, numShifts/2, sums, prods );
+            }
+        }
+        if( sums.size() == 0 )
+            continue;
+
+        Sweep( H, Q, iBeg, iEnd, sums, prods, formQ );
+    }
+
+    // Read the eigenvalues off of the (quasi-)triangular matrix
+    H.GetDiagonal( d_MD_STAR );
+    H.GetDiagonal( e_MD_STAR, -1 );
+    H.GetDiagonal( f_MD_STAR, 1 );
+    d_STAR_STAR = d_MD_STAR;
+    e_STAR_STAR = e_MD_STAR;
+    f_STAR_STAR = f_MD_STAR;
+    w.ResizeTo( n, 1 );
+    QuasiTriangEig
+    ( d_STAR_STAR.LockedMatrix(), e_STAR_STAR.LockedMatrix(),
+      f_STAR_STAR.LockedMatrix(), w.Matrix() );
+}
+
+} // namespace schur
+} // namespace elem
+
+#endif // ifndef LAPACK_SCHUR_QR_HPP
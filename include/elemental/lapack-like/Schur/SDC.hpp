@@ -0,0 +1,560 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SCHUR_SDC_HPP
+#define LAPACK_SCHUR_SDC_HPP
+
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level1/Zero.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/QR/BusingerGolub.hpp"
+#include "elemental/lapack-like/Sign.hpp"
+#include "elemental/lapack-like/Trace.hpp"
+#include "elemental/matrices/Gaussian.hpp"
+#include "elemental/matrices/Identity.hpp"
+
+// A fully recursive spectral divide-and-conquer Schur decomposition. Each
+// step splits the spectrum along a vertical line through (a perturbation
+// of) its centroid using the matrix sign function, computes an orthonormal
+// basis for the range of the resulting spectral projector with a
+// randomized rank-revealing QR factorization, and then recurses on the two
+// diagonal blocks of the transformed matrix. In the distributed case, the
+// two subproblems are solved concurrently on the two halves of the process
+// grid. Hermitian matrices use the inverse-free QDWH iteration for the sign
+// function, and general matrices use Newton's iteration until the
+// inverse-free Newton-Schulz iteration is guaranteed to converge.
+//
+// See Z. Bai, J. Demmel, and M. Gu's "An inverse free parallel spectral
+// divide and conquer algorithm for nonsymmetric eigenproblems" and
+// Y. Nakatsukasa and N. J. Higham's "Stable and efficient spectral divide
+// and conquer algorithms for the symmetric eigenvalue decomposition and the
+// SVD".
+
+namespace elem {
+namespace schur {
+
+template<typename F>
+inline void
+ShiftDiagonal( Matrix<F>& A, F alpha )
+{
+    const int n = std::min( A.Height(), A.Width() );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, alpha );
+}
+
+template<typename F>
+inline void
+ShiftDiagonal( DistMatrix<F>& A, F alpha )
+{
+    const int n = std::min( A.Height(), A.Width() );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, alpha );
+}
+
+// The shift of the t'th attempt at splitting the spectrum: the centroid of
+// the spectrum, followed by a sequence of perturbations of it relative to
+// the spread of the eigenvalues
+template<typename F>
+inline F
+DivideShift( F centroid, BASE(F) spread, int attempt )
+{
+    typedef BASE(F) R;
+    static const R offsets[] = { 0, 0.1, -0.13, 0.27, -0.31 };
+    return centroid + offsets[attempt % 5]*spread;
+}
+
+// Attempt to split the spectrum of A about the vertical line through
+// 'shift' (or, in the Hermitian case, about the point 'shift'). On success,
+// A is overwritten with V^H A V, where V is unitary and the bottom-left
+// block of V^H A V (which has been set to zero) is sufficiently small, Q is
+// overwritten with Q V (if formQ is true), and the number of eigenvalues to
+// the right of the line is returned. Otherwise, -1 is returned, or -2 if the
+// sign iteration did not converge.
+template<typename F>
+inline int
+SignDivide
+( Matrix<F>& A, Matrix<F>& Q, F shift, bool hermitian, bool formQ,
+  bool random )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::SignDivide");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const int oversample = 10;
+    const int maxSignIts = 40;
+    const R splitTol = 100*n*lapack::MachineEpsilon<R>();
+
+    // P := (sgn(A - shift I) + I)/2
+    Matrix<F> P( A );
+    ShiftDiagonal( P, -shift );
+    if( hermitian )
+        sign::QDWH( LOWER, P );
+    else if( sign::NewtonSchulzHybrid( P, sign::FROB_NORM, maxSignIts ) ==
+             maxSignIts )
+        return -2;
+    ShiftDiagonal( P, F(1) );
+    Scale( F(1)/F(2), P );
+    const int roundedTrace = int(round(RealPart(Trace(P))));
+    const int rank = std::max(std::min(roundedTrace,n),0);
+    if( rank == 0 || rank == n )
+        return -1;
+
+    // Try a randomized rank-revealing QR factorization of P first, and fall
+    // back to a pivoted QR factorization of P itself
+    const R frobA = FrobeniusNorm( A );
+    Matrix<F> Y, YL, t, Omega, ATilde, E21;
+    Matrix<int> p;
+    for( int attempt=(random?0:1); attempt<2; ++attempt )
+    {
+        if( attempt == 0 )
+        {
+            Gaussian( Omega, n, std::min(rank+oversample,n) );
+            Gemm( NORMAL, NORMAL, F(1), P, Omega, Y );
+        }
+        else
+            Y = P;
+        qr::BusingerGolub( Y, t, p, rank );
+        View( YL, Y, 0, 0, n, rank );
+
+        // ATilde := V^H A V
+        ATilde = A;
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, YL, t, ATilde );
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, YL, t, ATilde );
+        View( E21, ATilde, rank, 0, n-rank, rank );
+        if( FrobeniusNorm( E21 ) <= splitTol*frobA )
+        {
+            Zero( E21 );
+            A = ATilde;
+            if( formQ )
+                ApplyPackedReflectors
+                ( RIGHT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, YL, t, Q );
+            return rank;
+        }
+    }
+    return -1;
+}
+
+template<typename F>
+inline int
+SignDivide
+( DistMatrix<F>& A, DistMatrix<F>& Q, F shift, bool hermitian, bool formQ,
+  bool random )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::SignDivide");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int oversample = 10;
+    const int maxSignIts = 40;
+    const R splitTol = 100*n*lapack::MachineEpsilon<R>();
+
+    // P := (sgn(A - shift I) + I)/2
+    DistMatrix<F> P( A );
+    ShiftDiagonal( P, -shift );
+    if( hermitian )
+        sign::QDWH( LOWER, P );
+    else if( sign::NewtonSchulzHybrid( P, sign::FROB_NORM, maxSignIts ) ==
+             maxSignIts )
+        return -2;
+    ShiftDiagonal( P, F(1) );
+    Scale( F(1)/F(2), P );
+    const int roundedTrace = int(round(RealPart(Trace(P))));
+    const int rank = std::max(std::min(roundedTrace,n),0);
+    if( rank == 0 || rank == n )
+        return -1;
+
+    // Try a randomized rank-revealing QR factorization of P first, and fall
+    // back to a pivoted QR factorization of P itself
+    const R frobA = FrobeniusNorm( A );
+    DistMatrix<F> Y(g), YL(g), Omega(g), ATilde(g), E21(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<int,VR,STAR> p(g);
+    for( int attempt=(random?0:1); attempt<2; ++attempt )
+    {
+        if( attempt == 0 )
+        {
+            Gaussian( Omega, n, std::min(rank+oversample,n) );
+            Gemm( NORMAL, NORMAL, F(1), P, Omega, Y );
+        }
+        else
+            Y = P;
+        qr::BusingerGolub( Y, t, p, rank );
+        View( YL, Y, 0, 0, n, rank );
+
+        // ATilde := V^H A V
+        ATilde = A;
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, YL, t, ATilde );
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, YL, t, ATilde );
+        View( E21, ATilde, rank, 0, n-rank, rank );
+        if( FrobeniusNorm( E21 ) <= splitTol*frobA )
+        {
+            Zero( E21 );
+            A = ATilde;
+            if( formQ )
+                ApplyPackedReflectors
+                ( RIGHT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, YL, t, Q );
+            return rank;
+        }
+    }
+    return -1;
+}
+
+// Repeatedly attempt to split the spectrum of A, returning the dimension of
+// the leading block (or -1 if the attempts failed)
+template<typename F>
+inline int
+Divide
+( Matrix<F>& A, Matrix<F>& Q, bool hermitian, bool formQ, bool random,
+  int maxAttempts=5 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::Divide");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const F centroid = Trace(A)/F(n);
+    Matrix<F> B( A );
+    ShiftDiagonal( B, -centroid );
+    const R spread = FrobeniusNorm( B )/Sqrt(R(n));
+    int numDiverged = 0;
+    for( int attempt=0; attempt<maxAttempts; ++attempt )
+    {
+        const F shift = DivideShift( centroid, spread, attempt );
+        const int rank = SignDivide( A, Q, shift, hermitian, formQ, random );
+        if( rank >= 0 )
+            return rank;
+        // Shifting is unlikely to help if the spectrum is so ill-conditioned
+        // that the sign iteration repeatedly fails
+        if( rank == -2 && ++numDiverged == 2 )
+            break;
+    }
+    return -1;
+}
+
+template<typename F>
+inline int
+Divide
+( DistMatrix<F>& A, DistMatrix<F>& Q, bool hermitian, bool formQ,
+  bool random, int maxAttempts=5 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::Divide");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const F centroid = Trace(A)/F(n);
+    DistMatrix<F> B( A );
+    ShiftDiagonal( B, -centroid );
+    const R spread = FrobeniusNorm( B )/Sqrt(R(n));
+    int numDiverged = 0;
+    for( int attempt=0; attempt<maxAttempts; ++attempt )
+    {
+        const F shift = DivideShift( centroid, spread, attempt );
+        const int rank = SignDivide( A, Q, shift, hermitian, formQ, random );
+        if( rank >= 0 )
+            return rank;
+        // Shifting is unlikely to help if the spectrum is so ill-conditioned
+        // that the sign iteration repeatedly fails
+        if( rank == -2 && ++numDiverged == 2 )
+            break;
+    }
+    return -1;
+}
+
+// Overwrite A with its Schur form, w with its eigenvalues, and, if formQ is
+// true, Q with its Schur vectors, by dividing the spectrum until the
+// subproblems are no larger than 'cutoff' (which are then handled by the
+// Hessenberg QR algorithm)
+template<typename F>
+inline void
+RecursiveSDC
+( Matrix<F>& A, Matrix<Complex<BASE(F)> >& w, Matrix<F>& Q, bool formQ,
+  bool hermitian, int cutoff, bool random )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::RecursiveSDC");
+#endif
+    typedef Complex<BASE(F)> C;
+    const int n = A.Height();
+    if( n <= cutoff )
+    {
+        if( formQ )
+            Schur( A, w, Q );
+        else
+            Schur( A, w );
+        return;
+    }
+
+    if( formQ )
+        Identity( Q, n, n );
+    const int rank = Divide( A, Q, hermitian, formQ, random );
+    if( rank < 0 )
+    {
+        // Fall back to the Hessenberg QR algorithm
+        if( formQ )
+            Schur( A, w, Q );
+        else
+            Schur( A, w );
+        return;
+    }
+
+    Matrix<F> ATL, ATR,
+              ABL, ABR;
+    PartitionDownDiagonal
+    ( A, ATL, ATR,
+         ABL, ABR, rank );
+    Matrix<F> Z0, Z1;
+    Matrix<C> w0, w1;
+    RecursiveSDC( ATL, w0, Z0, true, hermitian, cutoff, random );
+    RecursiveSDC( ABR, w1, Z1, true, hermitian, cutoff, random );
+    w.ResizeTo( n, 1 );
+    for( int i=0; i<rank; ++i )
+        w.Set( i, 0, w0.Get(i,0) );
+    for( int i=rank; i<n; ++i )
+        w.Set( i, 0, w1.Get(i-rank,0) );
+
+    // ATR := Z0^H ATR Z1 and Q := Q diag(Z0,Z1)
+    Matrix<F> T;
+    if( hermitian )
+        Zero( ATR );
+    else
+    {
+        Gemm( ADJOINT, NORMAL, F(1), Z0, ATR, T );
+        Gemm( NORMAL, NORMAL, F(1), T, Z1, F(0), ATR );
+    }
+    if( formQ )
+    {
+        Matrix<F> QL, QR;
+        PartitionRight( Q, QL, QR, rank );
+        Gemm( NORMAL, NORMAL, F(1), QL, Z0, T );
+        QL = T;
+        Gemm( NORMAL, NORMAL, F(1), QR, Z1, T );
+        QR = T;
+    }
+}
+
+template<typename F>
+inline void
+RecursiveSDC
+( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,STAR,STAR>& w,
+  DistMatrix<F>& Q, bool formQ, bool hermitian, int cutoff, bool random )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::RecursiveSDC");
+#endif
+    typedef Complex<BASE(F)> C;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+
+    // A single process switches to the sequential algorithm
+    if( g.Size() == 1 )
+    {
+        Matrix<C> wLoc;
+        Matrix<F> Z;
+        if( formQ )
+        {
+            Q.ResizeTo( n, n );
+            RecursiveSDC
+            ( A.Matrix(), wLoc, Q.Matrix(), true, hermitian, cutoff, random );
+        }
+        else
+            RecursiveSDC
+            ( A.Matrix(), wLoc, Z, false, hermitian, cutoff, random );
+        w.ResizeTo( n, 1 );
+        w.Matrix() = wLoc;
+        return;
+    }
+    if( n <= cutoff )
+    {
+        if( formQ )
+            Schur( A, w, Q );
+        else
+            Schur( A, w );
+        return;
+    }
+
+    if( formQ )
+        Identity( Q, n, n );
+    const int rank = Divide( A, Q, hermitian, formQ, random );
+    if( rank < 0 )
+    {
+        // Fall back to the Hessenberg QR algorithm
+        if( formQ )
+            Schur( A, w, Q );
+        else
+            Schur( A, w );
+        return;
+    }
+
+    DistMatrix<F> ATL(g), ATR(g),
+                  ABL(g), ABR(g);
+    PartitionDownDiagonal
+    ( A, ATL, ATR,
+         ABL, ABR, rank );
+
+    // Solve the two subproblems concurrently on the two halves of the grid
+    GridPartition partition( g, 2 );
+    const Grid& g0 = partition.SubGrid( 0 );
+    const Grid& g1 = partition.SubGrid( 1 );
+    DistMatrix<F> A0(g0), A1(g1), Z0(g0), Z1(g1);
+    std::vector<const DistMatrix<F>*> sources( 2 );
+    std::vector<DistMatrix<F>*> targets( 2 );
+    sources[0] = &ATL; targets[0] = &A0;
+    sources[1] = &ABR; targets[1] = &A1;
+    InterGridCopy( sources, targets );
+    Z0.AlignWith( A0 );
+    Z1.AlignWith( A1 );
+    Z0.ResizeTo( rank, rank );
+    Z1.ResizeTo( n-rank, n-rank );
+    std::vector<C> wBuf( n, C(0) );
+    const int part = partition.Part();
+    if( part != mpi::UNDEFINED )
+    {
+        // Since each subgrid is viewed by every process of g, the recursion
+        // continues on an equivalent grid which is only viewed by its
+        // owners, so that it can be partitioned independently of the other
+        const Grid& subGrid = partition.SubGrid( part );
+        Grid ownGrid( subGrid.Comm(), subGrid.Height() );
+        DistMatrix<F>& ASub = ( part==0 ? A0 : A1 );
+        DistMatrix<F>& ZSub = ( part==0 ? Z0 : Z1 );
+        const int offset = ( part==0 ? 0 : rank );
+        const int k = ASub.Height();
+        DistMatrix<F> AOwn(ownGrid), ZOwn(ownGrid);
+        DistMatrix<C,STAR,STAR> wOwn(ownGrid);
+        AOwn.Attach
+        ( k, k, ASub.ColAlignment(), ASub.RowAlignment(), ASub.Buffer(),
+          ASub.LDim(), ownGrid );
+        ZOwn.Attach
+        ( k, k, ZSub.ColAlignment(), ZSub.RowAlignment(), ZSub.Buffer(),
+          ZSub.LDim(), ownGrid );
+        RecursiveSDC( AOwn, wOwn, ZOwn, true, hermitian, cutoff, random );
+        if( subGrid.VCRank() == 0 )
+            for( int i=0; i<k; ++i )
+                wBuf[offset+i] = wOwn.GetLocal(i,0);
+    }
+    mpi::AllReduce( &wBuf[0], n, mpi::SUM, g.Comm() );
+    w.ResizeTo( n, 1 );
+    for( int i=0; i<n; ++i )
+        w.SetLocal( i, 0, wBuf[i] );
+
+    DistMatrix<F> Z0Full(g), Z1Full(g);
+    sources.resize( 4 );
+    targets.resize( 4 );
+    sources[0] = &A0; targets[0] = &ATL;
+    sources[1] = &A1; targets[1] = &ABR;
+    sources[2] = &Z0; targets[2] = &Z0Full;
+    sources[3] = &Z1; targets[3] = &Z1Full;
+    InterGridCopy( sources, targets );
+
+    // ATR := Z0^H ATR Z1 and Q := Q diag(Z0,Z1)
+    DistMatrix<F> T(g);
+    if( hermitian )
+        Zero( ATR );
+    else
+    {
+        Gemm( ADJOINT, NORMAL, F(1), Z0Full, ATR, T );
+        Gemm( NORMAL, NORMAL, F(1), T, Z1Full, F(0), ATR );
+    }
+    if( formQ )
+    {
+        DistMatrix<F> QL(g), QR(g);
+        PartitionRight( Q, QL, QR, rank );
+        Gemm( NORMAL, NORMAL, F(1), QL, Z0Full, T );
+        QL = T;
+        Gemm( NORMAL, NORMAL, F(1), QR, Z1Full, T );
+        QR = T;
+    }
+}
+
+// Overwrite A with its Schur form (see above)
+template<typename F>
+inline void
+SDC
+( Matrix<F>& A, Matrix<Complex<BASE(F)> >& w, Matrix<F>& Q,
+  bool formQ=true, int cutoff=256, bool random=true )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::SDC");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    RecursiveSDC( A, w, Q, formQ, false, cutoff, random );
+}
+
+template<typename F>
+inline void
+SDC
+( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,STAR,STAR>& w,
+  DistMatrix<F>& Q, bool formQ=true, int cutoff=256, bool random=true )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::SDC");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    RecursiveSDC( A, w, Q, formQ, false, cutoff, random );
+}
+
+// Overwrite A with a diagonal matrix of its eigenvalues and, if formQ is
+// true, Q with its eigenvectors, using QDWH-based spectral divide and
+// conquer
+template<typename F>
+inline void
+HermitianSDC
+( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, Matrix<F>& Q,
+  bool formQ=true, int cutoff=256, bool random=true )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::HermitianSDC");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const int n = A.Height();
+    MakeHermitian( uplo, A );
+    Matrix<Complex<BASE(F)> > wComplex;
+    RecursiveSDC( A, wComplex, Q, formQ, true, cutoff, random );
+    w.ResizeTo( n, 1 );
+    for( int i=0; i<n; ++i )
+        w.Set( i, 0, RealPart(wComplex.Get(i,0)) );
+}
+
+template<typename F>
+inline void
+HermitianSDC
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<BASE(F),STAR,STAR>& w,
+  DistMatrix<F>& Q, bool formQ=true, int cutoff=256, bool random=true )
+{
+#ifndef RELEASE
+    CallStackEntry entry("schur::HermitianSDC");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    const int n = A.Height();
+    MakeHermitian( uplo, A );
+    DistMatrix<Complex<BASE(F)>,STAR,STAR> wComplex( A.Grid() );
+    RecursiveSDC( A, wComplex, Q, formQ, true, cutoff, random );
+    w.ResizeTo( n, 1 );
+    for( int i=0; i<n; ++i )
+        w.SetLocal( i, 0, RealPart(wComplex.GetLocal(i,0)) );
+}
+
+} // namespace schur
+} // namespace elem
+
+#endif // ifndef LAPACK_SCHUR_SDC_HPP
@@ -11,13 +11,18 @@
 #define LAPACK_SIGN_HPP
 
 #include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Lazy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
 #include "elemental/blas-like/level1/Scale.hpp"
 #include "elemental/blas-like/level3/Gemm.hpp"
 #include "elemental/lapack-like/HermitianFunction.hpp"
 #include "elemental/lapack-like/Inverse.hpp"
 #include "elemental/lapack-like/Norm/Frobenius.hpp"
 #include "elemental/lapack-like/Norm/One.hpp"
+#include "elemental/lapack-like/Norm/TwoUpperBound.hpp"
 #include "elemental/lapack-like/Determinant.hpp"
+#include "elemental/lapack-like/Polar/QDWH.hpp"
+#include "elemental/matrices/Identity.hpp"
 
 // See Chapter 5 of Nicholas J. Higham's "Functions of Matrices: Theory and
 // Computation", which is currently available at:
@@ -60,8 +65,7 @@ NewtonStep( const Matrix<F>& X, Matrix<F>& XNew, Scaling scaling=FROB_NORM )
     // Overwrite XNew with the new iterate
     const R halfMu = mu/R(2);
     const R halfMuInv = R(1)/(2*mu); 
-    Scale( halfMuInv, XNew );
-    Axpy( halfMu, X, XNew );
+    Evaluate( halfMuInv*Lazy(XNew) + halfMu*Lazy(X), XNew );
 }
 
 template<typename F>
@@ -93,8 +97,7 @@ NewtonStep
     // Overwrite XNew with the new iterate
     const R halfMu = mu/R(2);
     const R halfMuInv = R(1)/(2*mu); 
-    Scale( halfMuInv, XNew );
-    Axpy( halfMu, X, XNew );
+    Evaluate( halfMuInv*Lazy(XNew) + halfMu*Lazy(X), XNew );
 }
 
 template<typename F>
@@ -104,15 +107,14 @@ NewtonSchulzStep( const Matrix<F>& X, Matrix<F>& XTmp, Matrix<F>& XNew )
 #ifndef RELEASE
     CallStackEntry entry("sign::NewtonSchulzStep");
 #endif
-    typedef BASE(F) R;
     const int n = X.Height();
  
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, R(-1), X, X, R(3), XTmp );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, R(1)/R(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, XNew );
 }
 
 template<typename F>
@@ -123,15 +125,14 @@ NewtonSchulzStep
 #ifndef RELEASE
     CallStackEntry entry("sign::NewtonSchulzStep");
 #endif
-    typedef BASE(F) R;
     const int n = X.Height();
 
     // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, R(-1), X, X, R(3), XTmp );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(3), XTmp );
 
     // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, R(1)/R(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, XNew );
 }
 
 template<typename F>
@@ -167,7 +168,7 @@ Newton
             break;
     }
     if( X != &A )
-        A = *XNew;
+        A = *X;
     return numIts;
 }
 
@@ -205,56 +206,202 @@ Newton
             break;
     }
     if( X != &A )
-        A = *XNew;
+        A = *X;
+    return numIts;
+}
+
+// Perform Newton steps until || X^2 - I ||_F (an upper bound for the
+// two-norm) is less than one, which guarantees the convergence of the
+// inverse-free Newton-Schulz iteration, and then switch to the latter. Since
+// testing the switch costs a matrix-matrix multiply, it is only attempted
+// once the relative change in the iterates is at most 'switchTol'.
+
+template<typename F>
+inline int
+NewtonSchulzHybrid
+( Matrix<F>& A, Scaling scaling=FROB_NORM, int maxIts=100, BASE(F) tol=0,
+  BASE(F) switchTol=BASE(F)(1)/BASE(F)(4) )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sign::NewtonSchulzHybrid");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    Matrix<F> B, XTmp;
+    Matrix<F> *X=&A, *XNew=&B;
+
+    if( tol == R(0) )
+        tol = n*lapack::MachineEpsilon<R>();
+
+    int numIts=0;
+    bool schulz=false;
+    while( numIts < maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( schulz )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( R(-1), *XNew, *X );
+        const R oneDiff = OneNorm( *X );
+        const R oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( oneDiff/oneNew <= tol )
+            break;
+
+        // Switch to Newton-Schulz once || X^2 - I ||_F < 1
+        if( !schulz && oneDiff/oneNew <= switchTol )
+        {
+            Identity( XTmp, n, n );
+            Gemm( NORMAL, NORMAL, F(1), *X, *X, F(-1), XTmp );
+            schulz = ( FrobeniusNorm( XTmp ) < R(1) );
+        }
+    }
+    if( X != &A )
+        A = *X;
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+template<typename F>
+inline int
+NewtonSchulzHybrid
+( DistMatrix<F>& A, Scaling scaling=FROB_NORM, int maxIts=100, BASE(F) tol=0,
+  BASE(F) switchTol=BASE(F)(1)/BASE(F)(4) )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sign::NewtonSchulzHybrid");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    DistMatrix<F> B( A.Grid() ), XTmp( A.Grid() );
+    DistMatrix<F> *X=&A, *XNew=&B;
+
+    if( tol == R(0) )
+        tol = n*lapack::MachineEpsilon<R>();
+
+    int numIts=0;
+    bool schulz=false;
+    while( numIts < maxIts )
+    {
+        // Overwrite XNew with the new iterate
+        if( schulz )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, scaling );
+
+        // Use the difference in the iterates to test for convergence
+        Axpy( R(-1), *XNew, *X );
+        const R oneDiff = OneNorm( *X );
+        const R oneNew = OneNorm( *XNew );
+
+        // Ensure that X holds the current iterate and break if possible
+        ++numIts;
+        std::swap( X, XNew );
+        if( oneDiff/oneNew <= tol )
+            break;
+
+        // Switch to Newton-Schulz once || X^2 - I ||_F < 1
+        if( !schulz && oneDiff/oneNew <= switchTol )
+        {
+            Identity( XTmp, n, n );
+            Gemm( NORMAL, NORMAL, F(1), *X, *X, F(-1), XTmp );
+            schulz = ( FrobeniusNorm( XTmp ) < R(1) );
+        }
+    }
+    if( X != &A )
+        A = *X;
+    return numIts;
+}
+
+// The sign of a Hermitian matrix is its unitary polar factor, so that it can
+// be computed with the inverse-free, QR and Cholesky-based QDWH iteration.
+// Since no estimate of the smallest singular value is available, the
+// machine epsilon is used as its lower bound (which costs at most a couple
+// of extra iterations).
+
+template<typename F>
+inline int
+QDWH( UpperOrLower uplo, Matrix<F>& A, int maxIts=100 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sign::QDWH");
+#endif
+    typedef BASE(F) R;
+    MakeHermitian( uplo, A );
+    const R upperBound = TwoNormUpperBound( A );
+    if( upperBound == R(0) )
+        return 0;
+    const R lowerBound = lapack::MachineEpsilon<R>();
+    return hermitian_polar::QDWH( uplo, A, lowerBound, upperBound, maxIts );
+}
+
+template<typename F>
+inline int
+QDWH( UpperOrLower uplo, DistMatrix<F>& A, int maxIts=100 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sign::QDWH");
+#endif
+    typedef BASE(F) R;
+    MakeHermitian( uplo, A );
+    const R upperBound = TwoNormUpperBound( A );
+    if( upperBound == R(0) )
+        return 0;
+    const R lowerBound = lapack::MachineEpsilon<R>();
+    return hermitian_polar::QDWH( uplo, A, lowerBound, upperBound, maxIts );
+}
 
 } // namespace sign
 
 template<typename F>
-inline void
+inline int
 Sign( Matrix<F>& A )
 {
 #ifndef RELEASE
-    PushCallStack("Sign");
+    CallStackEntry entry("Sign");
 #endif
-    sign::Newton( A );
+    return sign::Newton( A );
 }
 
 template<typename F>
-inline void
+inline int
 Sign( Matrix<F>& A, Matrix<F>& N )
 {
 #ifndef RELEASE
-    PushCallStack("Sign");
+    CallStackEntry entry("Sign");
 #endif
     Matrix<F> ACopy( A );
-    sign::Newton( A );
+    const int numIts = sign::Newton( A );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
+    return numIts;
 }
 
 template<typename F>
-inline void
+inline int
 Sign( DistMatrix<F>& A )
 {
 #ifndef RELEASE
-    PushCallStack("Sign");
+    CallStackEntry entry("Sign");
 #endif
-    sign::Newton( A );
+    return sign::Newton( A );
 }
 
 template<typename F>
-inline void
+inline int
 Sign( DistMatrix<F>& A, DistMatrix<F>& N )
 {
 #ifndef RELEASE
-    PushCallStack("Sign");
+    CallStackEntry entry("Sign");
 #endif
     DistMatrix<F> ACopy( A );
-    sign::Newton( A );
+    const int numIts = sign::Newton( A );
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
+    return numIts;
 }
 
 // The Hermitian sign decomposition is equivalent to the Hermitian polar
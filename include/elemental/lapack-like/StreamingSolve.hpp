@@ -0,0 +1,407 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_STREAMINGSOLVE_HPP
+#define LAPACK_STREAMINGSOLVE_HPP
+
+#include "elemental/lapack-like/Factorization.hpp"
+
+// Solves against a factorization handle for a stream of right-hand sides
+// which is too long to be held in memory at once. The right-hand sides are
+// read from a source in batches distributed as [VC,STAR], which is the
+// natural distribution for data arriving from (or leaving for) an external
+// producer, since each process owns whole rows. Each batch is exchanged
+// with an [MC,MR] matrix aligned with the factors through nonblocking
+// point-to-point messages so that the redistribution of the next batch, and
+// the return of the previous solutions, are overlapped with the triangular
+// solves of the current batch.
+
+namespace elem {
+
+// Summarizes a streaming solve: the number of right-hand sides and batches
+// which were processed, the batch size which was settled upon, and the
+// elapsed wall-clock time and resulting throughput
+struct StreamingSolveInfo
+{
+    long numSolves;
+    int numBatches;
+    int batchSize;
+    double seconds;
+    double solvesPerSecond;
+
+    StreamingSolveInfo()
+    : numSolves(0), numBatches(0), batchSize(0), seconds(0),
+      solvesPerSecond(0)
+    { }
+};
+
+namespace streaming {
+
+// The messages which redistribute a single batch
+template<typename F>
+struct Transfer
+{
+    int height, width;
+    std::vector<F> sendBuf, recvBuf;
+    std::vector<int> recvOffsets;
+    std::vector<mpi::Request> requests;
+
+    Transfer() : height(0), width(0) { }
+};
+
+// Trsm switches to the variant which is efficient for many right-hand
+// sides once there are more than five per process, so batches begin just
+// past that point (and at least as wide as the algorithmic blocksize)
+inline int
+InitialBatchSize( const Grid& g )
+{ return std::max( Blocksize(), 5*g.Size()+1 ); }
+
+inline int
+MaxBatchSize( const Grid& g )
+{ return 16*InitialBatchSize( g ); }
+
+// A [VC,STAR] process q owns the rows congruent to q modulo p, all of which
+// are owned by process row (q mod r + colAlign) mod r of an [MC,MR] matrix.
+// The first 'width' columns of B are therefore sent as one message to each
+// process in that row, and each [MC,MR] process receives one message from
+// each of the c processes which share its row in this sense.
+template<typename F>
+inline void
+StartScatter
+( const DistMatrix<F,VC,STAR>& B, int width, int colAlign, int rowAlign,
+  Transfer<F>& transfer )
+{
+#ifndef RELEASE
+    CallStackEntry entry("streaming::StartScatter");
+#endif
+    const Grid& g = B.Grid();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int p = g.Size();
+    const int n = B.Height();
+    const int vcRank = g.VCRank();
+    const int myRow = g.MCRank();
+    const int myCol = g.MRRank();
+    const int localHeight = B.LocalHeight();
+    const int ldim = B.LDim();
+    mpi::Comm comm = g.VCComm();
+    transfer.height = n;
+    transfer.width = width;
+    transfer.requests.clear();
+
+    // Post the receives
+    const int firstSource = Shift( myRow, colAlign, r );
+    const int localWidth = Length( width, myCol, rowAlign, c );
+    transfer.recvOffsets.resize( c+1 );
+    transfer.recvOffsets[0] = 0;
+    for( int t=0; t<c; ++t )
+        transfer.recvOffsets[t+1] = transfer.recvOffsets[t] +
+            Length(n,firstSource+t*r,p)*localWidth;
+    transfer.recvBuf.resize( std::max(transfer.recvOffsets[c],1) );
+    for( int t=0; t<c; ++t )
+    {
+        const int offset = transfer.recvOffsets[t];
+        const int count = transfer.recvOffsets[t+1] - offset;
+        if( count > 0 )
+        {
+            transfer.requests.push_back( mpi::Request() );
+            mpi::IRecv
+            ( &transfer.recvBuf[offset], count, firstSource+t*r, 0, comm,
+              transfer.requests.back() );
+        }
+    }
+
+    // Pack and post the sends
+    const int destRow = (vcRank % r + colAlign) % r;
+    transfer.sendBuf.resize( std::max(localHeight*width,1) );
+    const F* BBuffer = B.LockedBuffer();
+    int offset = 0;
+    for( int destCol=0; destCol<c; ++destCol )
+    {
+        const int start = offset;
+        for( int j=Shift(destCol,rowAlign,c); j<width; j+=c )
+        {
+            MemCopy( &transfer.sendBuf[offset], &BBuffer[j*ldim], localHeight );
+            offset += localHeight;
+        }
+        if( offset > start )
+        {
+            transfer.requests.push_back( mpi::Request() );
+            mpi::ISend
+            ( &transfer.sendBuf[start], offset-start, destRow+destCol*r, 0,
+              comm, transfer.requests.back() );
+        }
+    }
+}
+
+// Wait for the messages posted by StartScatter and unpack them into Y,
+// which must be aligned as specified to StartScatter
+template<typename F>
+inline void
+FinishScatter( Transfer<F>& transfer, DistMatrix<F>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("streaming::FinishScatter");
+#endif
+    const Grid& g = Y.Grid();
+    const int c = g.Width();
+    const int p = g.Size();
+    if( !transfer.requests.empty() )
+        mpi::WaitAll( transfer.requests.size(), &transfer.requests[0] );
+    transfer.requests.clear();
+
+    // The k'th row received from the t'th source is local row t+k*c
+    Y.ResizeTo( transfer.height, transfer.width );
+    const int firstSource = Y.ColShift();
+    const int localWidth = Y.LocalWidth();
+    const int ldim = Y.LDim();
+    F* YBuffer = Y.Buffer();
+    for( int t=0; t<c; ++t )
+    {
+        const int height =
+            Length( transfer.height, firstSource+t*g.Height(), p );
+        const F* recvBuf = &transfer.recvBuf[transfer.recvOffsets[t]];
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( int k=0; k<height; ++k )
+                YBuffer[(t+k*c)+jLoc*ldim] = recvBuf[k+jLoc*height];
+    }
+}
+
+// The reverse of StartScatter: return the rows of Y to their [VC,STAR]
+// owners
+template<typename F>
+inline void
+StartGather( const DistMatrix<F>& Y, Transfer<F>& transfer )
+{
+#ifndef RELEASE
+    CallStackEntry entry("streaming::StartGather");
+#endif
+    const Grid& g = Y.Grid();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int p = g.Size();
+    const int n = Y.Height();
+    const int width = Y.Width();
+    const int vcRank = g.VCRank();
+    const int colAlign = Y.ColAlignment();
+    const int rowAlign = Y.RowAlignment();
+    const int localHeight = Length( n, vcRank, p );
+    mpi::Comm comm = g.VCComm();
+    transfer.height = n;
+    transfer.width = width;
+    transfer.requests.clear();
+
+    // Post the receives
+    const int sourceRow = (vcRank % r + colAlign) % r;
+    transfer.recvOffsets.resize( c+1 );
+    transfer.recvOffsets[0] = 0;
+    for( int t=0; t<c; ++t )
+        transfer.recvOffsets[t+1] = transfer.recvOffsets[t] +
+            Length(width,t,rowAlign,c)*localHeight;
+    transfer.recvBuf.resize( std::max(transfer.recvOffsets[c],1) );
+    for( int t=0; t<c; ++t )
+    {
+        const int offset = transfer.recvOffsets[t];
+        const int count = transfer.recvOffsets[t+1] - offset;
+        if( count > 0 )
+        {
+            transfer.requests.push_back( mpi::Request() );
+            mpi::IRecv
+            ( &transfer.recvBuf[offset], count, sourceRow+t*r, 1, comm,
+              transfer.requests.back() );
+        }
+    }
+
+    // Pack and post the sends, where local rows t+k*c belong to the t'th
+    // destination
+    const int firstDest = Y.ColShift();
+    const int localWidth = Y.LocalWidth();
+    const int ldim = Y.LDim();
+    const F* YBuffer = Y.LockedBuffer();
+    transfer.sendBuf.resize( std::max(Y.LocalHeight()*localWidth,1) );
+    int offset = 0;
+    for( int t=0; t<c; ++t )
+    {
+        const int start = offset;
+        const int height = Length( n, firstDest+t*r, p );
+        for( int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( int k=0; k<height; ++k )
+                transfer.sendBuf[offset++] = YBuffer[(t+k*c)+jLoc*ldim];
+        if( offset > start )
+        {
+            transfer.requests.push_back( mpi::Request() );
+            mpi::ISend
+            ( &transfer.sendBuf[start], offset-start, firstDest+t*r, 1,
+              comm, transfer.requests.back() );
+        }
+    }
+}
+
+// Wait for the messages posted by StartGather and unpack them into X
+template<typename F>
+inline void
+FinishGather
+( Transfer<F>& transfer, int rowAlign, DistMatrix<F,VC,STAR>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("streaming::FinishGather");
+#endif
+    const int c = X.Grid().Width();
+    if( !transfer.requests.empty() )
+        mpi::WaitAll( transfer.requests.size(), &transfer.requests[0] );
+    transfer.requests.clear();
+
+    X.ResizeTo( transfer.height, transfer.width );
+    const int localHeight = X.LocalHeight();
+    const int ldim = X.LDim();
+    F* XBuffer = X.Buffer();
+    for( int t=0; t<c; ++t )
+    {
+        const F* recvBuf = &transfer.recvBuf[transfer.recvOffsets[t]];
+        for( int j=Shift(t,rowAlign,c); j<transfer.width; j+=c )
+        {
+            MemCopy( &XBuffer[j*ldim], recvBuf, localHeight );
+            recvBuf += localHeight;
+        }
+    }
+}
+
+} // namespace streaming
+
+// Solve against 'factor' (a CholeskyFactor, LUFactor, or LDLFactor) for
+// every right-hand side produced by 'source', in batches of 'batchSize'
+// columns, and hand each batch of solutions to 'sink'. The functors must
+// provide
+//
+//   int operator()( DistMatrix<F,VC,STAR>& B )
+//
+// which fills the first k columns of B (which is sized to the requested
+// batch) and returns k, where k <= B.Width() must agree on every process
+// and zero ends the stream, and
+//
+//   void operator()( long offset, const DistMatrix<F,VC,STAR>& X )
+//
+// which consumes the solutions of the right-hand sides with stream indices
+// offset through offset+X.Width()-1. If 'batchSize' is not positive, the
+// batch size begins just past the point where Trsm switches to its
+// many-right-hand-side variant and is doubled for as long as the measured
+// throughput improves by at least five percent.
+template<typename F,template<typename> class FactorType,
+         class Source,class Sink>
+inline StreamingSolveInfo
+StreamingSolve
+( const FactorType<F>& factor, Source& source, Sink& sink,
+  int batchSize=0, Orientation orientation=NORMAL )
+{
+#ifndef RELEASE
+    CallStackEntry entry("StreamingSolve");
+    if( orientation == TRANSPOSE )
+        throw std::logic_error("Orientation must be NORMAL or ADJOINT");
+#endif
+    const Grid& g = factor.Grid();
+    const int n = factor.Height();
+    const DistMatrix<F>& A = factor.Factors();
+    const int colAlign = A.ColAlignment();
+    const int rowAlign = A.RowAlignment();
+    const bool tune = ( batchSize <= 0 );
+    const int maxWidth = streaming::MaxBatchSize( g );
+    int width = ( tune ? streaming::InitialBatchSize(g) : batchSize );
+
+    DistMatrix<F,VC,STAR> B( g ), X( g );
+    DistMatrix<F> Y( g );
+    Y.AlignWith( A );
+    streaming::Transfer<F> scatter, gather;
+
+    StreamingSolveInfo info;
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+
+    // Read the first batch
+    B.ResizeTo( n, width );
+    int numCols = source( B );
+    if( numCols > 0 )
+        streaming::StartScatter( B, numCols, colAlign, rowAlign, scatter );
+
+    bool tuning = tune, gathering = false;
+    int bestWidth = width;
+    double bestRate = 0;
+    long gatherOffset = 0;
+    while( numCols > 0 )
+    {
+#ifndef RELEASE
+        if( numCols > width )
+            throw std::logic_error("Source returned too many columns");
+#endif
+        const double batchStartTime = mpi::Time();
+        const int thisWidth = width;
+        const int thisCols = numCols;
+        streaming::FinishScatter( scatter, Y );
+
+        // Read the next batch and start its redistribution before solving
+        // against this one. The first two batches share a width so that the
+        // second can be timed with the pipeline already full.
+        if( tuning && info.numBatches > 0 )
+            width = std::min( 2*width, maxWidth );
+        else if( !tuning )
+            width = bestWidth;
+        B.ResizeTo( n, width );
+        numCols = source( B );
+        if( numCols > 0 )
+            streaming::StartScatter
+            ( B, numCols, colAlign, rowAlign, scatter );
+
+        if( orientation == NORMAL )
+            factor.Solve( Y );
+        else
+            factor.SolveAdjoint( Y );
+
+        if( gathering )
+        {
+            streaming::FinishGather( gather, rowAlign, X );
+            sink( gatherOffset, X );
+        }
+        streaming::StartGather( Y, gather );
+        gathering = true;
+        gatherOffset = info.numSolves;
+        info.numSolves += thisCols;
+        ++info.numBatches;
+
+        // Keep doubling while the throughput of full batches improves
+        if( tuning && info.numBatches > 1 && thisCols == thisWidth )
+        {
+            double batchTime = mpi::Time() - batchStartTime;
+            mpi::AllReduce( &batchTime, 1, mpi::MAX, g.Comm() );
+            const double rate = thisCols / batchTime;
+            if( rate >= 1.05*bestRate )
+            {
+                bestWidth = thisWidth;
+                bestRate = rate;
+                tuning = ( thisWidth < maxWidth );
+            }
+            else
+                tuning = false;
+        }
+    }
+    if( gathering )
+    {
+        streaming::FinishGather( gather, rowAlign, X );
+        sink( gatherOffset, X );
+    }
+
+    mpi::Barrier( g.Comm() );
+    info.seconds = mpi::Time() - startTime;
+    info.batchSize = ( tune ? bestWidth : batchSize );
+    if( info.seconds > 0 )
+        info.solvesPerSecond = info.numSolves / info.seconds;
+    return info;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_STREAMINGSOLVE_HPP
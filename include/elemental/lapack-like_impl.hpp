@@ -18,12 +18,15 @@
 #include "./lapack-like/ComposePivots.hpp"
 #include "./lapack-like/ConditionNumber.hpp"
 #include "./lapack-like/Determinant.hpp"
+#include "./lapack-like/Exp.hpp"
 #include "./lapack-like/ExpandPackedReflectors.hpp"
+#include "./lapack-like/Factorization.hpp"
 #include "./lapack-like/GaussianElimination.hpp"
 #include "./lapack-like/Hadamard.hpp"
 #include "./lapack-like/HermitianEig.hpp"
 #include "./lapack-like/HermitianFunction.hpp"
 #include "./lapack-like/HermitianGenDefiniteEig.hpp"
+#include "./lapack-like/Hessenberg.hpp"
 #include "./lapack-like/HilbertSchmidt.hpp"
 #include "./lapack-like/HPDSolve.hpp"
 #include "./lapack-like/ID.hpp"
@@ -32,6 +35,7 @@
 #include "./lapack-like/LeastSquares.hpp"
 #include "./lapack-like/LQ.hpp"
 #include "./lapack-like/LU.hpp"
+#include "./lapack-like/MixedPrecision.hpp"
 #include "./lapack-like/Norm.hpp"
 #include "./lapack-like/PivotParity.hpp"
 #include "./lapack-like/Polar.hpp"
@@ -44,6 +48,7 @@
 #include "./lapack-like/Skeleton.hpp"
 #include "./lapack-like/SkewHermitianEig.hpp"
 #include "./lapack-like/SquareRoot.hpp"
+#include "./lapack-like/StreamingSolve.hpp"
 #include "./lapack-like/SVD.hpp"
 #include "./lapack-like/Trace.hpp"
 #include "./lapack-like/TriangularInverse.hpp"
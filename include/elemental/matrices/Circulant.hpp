@@ -10,6 +10,8 @@
 #ifndef MATRICES_CIRCULANT_HPP
 #define MATRICES_CIRCULANT_HPP
 
+#include "elemental/blas-like/level1/FFT.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -53,6 +55,86 @@ Circulant( DistMatrix<T,U,V>& A, const std::vector<T>& a )
     }
 }
 
+// An implicit n x n circulant matrix, A(i,j) = a((i-j) mod n), which is
+// diagonalized by the DFT and applied in O(n log n) work per column
+template<typename T>
+class CirculantOperator
+{
+public:
+    CirculantOperator( const std::vector<T>& a );
+
+    int Height() const { return lambda_.size(); }
+    int Width() const { return lambda_.size(); }
+
+    // Y := op(A) X
+    void Apply
+    ( Orientation orientation, const Matrix<T>& X, Matrix<T>& Y ) const;
+    template<Distribution U,Distribution V>
+    void Apply
+    ( Orientation orientation,
+      const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y ) const;
+
+private:
+    std::vector<Complex<BASE(T)> > lambda_, lambdaAdj_;
+};
+
+template<typename T>
+inline
+CirculantOperator<T>::CirculantOperator( const std::vector<T>& a )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CirculantOperator::CirculantOperator");
+#endif
+    const int n = a.size();
+    Matrix<Complex<BASE(T)> > c( n, 1 );
+    for( int i=0; i<n; ++i )
+        c.Set( i, 0, fft::ToComplex(a[i],false) );
+    FFT( c );
+    lambda_.resize( n );
+    lambdaAdj_.resize( n );
+    for( int i=0; i<n; ++i )
+    {
+        lambda_[i] = c.Get(i,0);
+        lambdaAdj_[i] = Conj(lambda_[i]);
+    }
+}
+
+template<typename T>
+inline void
+CirculantOperator<T>::Apply
+( Orientation orientation, const Matrix<T>& X, Matrix<T>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("CirculantOperator::Apply");
+    if( X.Height() != Width() )
+        throw std::logic_error("Nonconformal CirculantOperator::Apply");
+#endif
+    if( orientation == NORMAL )
+        fft::StructuredApply( -1, lambda_, Height(), false, X, Y );
+    else
+        fft::StructuredApply
+        ( -1, lambdaAdj_, Width(), orientation==TRANSPOSE, X, Y );
+}
+
+template<typename T>
+template<Distribution U,Distribution V>
+inline void
+CirculantOperator<T>::Apply
+( Orientation orientation,
+  const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("CirculantOperator::Apply");
+    if( X.Height() != Width() )
+        throw std::logic_error("Nonconformal CirculantOperator::Apply");
+#endif
+    if( orientation == NORMAL )
+        fft::StructuredApply( -1, lambda_, Height(), false, X, Y );
+    else
+        fft::StructuredApply
+        ( -1, lambdaAdj_, Width(), orientation==TRANSPOSE, X, Y );
+}
+
 } // namespace elem
 
 #endif // ifndef MATRICES_CIRCULANT_HPP
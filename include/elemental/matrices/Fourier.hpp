@@ -10,6 +10,8 @@
 #ifndef MATRICES_FOURIER_HPP
 #define MATRICES_FOURIER_HPP
 
+#include "elemental/blas-like/level1/FFT.hpp"
+
 namespace elem {
 
 template<typename R>
@@ -96,6 +98,73 @@ MakeFourier( DistMatrix<Complex<R>,U,V>& A )
     }
 }
 
+// The implicit n x n unitary DFT matrix generated by Fourier, applied with
+// the FFT in O(n log n) work per column
+template<typename R>
+class FourierOperator
+{
+public:
+    FourierOperator( int n );
+
+    int Height() const { return n_; }
+    int Width() const { return n_; }
+
+    // Y := op(A) X
+    void Apply
+    ( Orientation orientation,
+      const Matrix<Complex<R> >& X, Matrix<Complex<R> >& Y ) const;
+    template<Distribution U,Distribution V>
+    void Apply
+    ( Orientation orientation,
+      const DistMatrix<Complex<R>,U,V>& X,
+            DistMatrix<Complex<R>,U,V>& Y ) const;
+
+private:
+    int n_;
+};
+
+template<typename R>
+inline
+FourierOperator<R>::FourierOperator( int n )
+: n_(n)
+{ }
+
+template<typename R>
+inline void
+FourierOperator<R>::Apply
+( Orientation orientation,
+  const Matrix<Complex<R> >& X, Matrix<Complex<R> >& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("FourierOperator::Apply");
+    if( X.Height() != n_ )
+        throw std::logic_error("Nonconformal FourierOperator::Apply");
+#endif
+    // The DFT matrix is symmetric, so only adjoints differ
+    Y = X;
+    fft::Transform( ( orientation==ADJOINT ? +1 : -1 ), Y );
+    Scale( Complex<R>(1/Sqrt(R(n_))), Y );
+}
+
+template<typename R>
+template<Distribution U,Distribution V>
+inline void
+FourierOperator<R>::Apply
+( Orientation orientation,
+  const DistMatrix<Complex<R>,U,V>& X, DistMatrix<Complex<R>,U,V>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("FourierOperator::Apply");
+    if( X.Height() != n_ )
+        throw std::logic_error("Nonconformal FourierOperator::Apply");
+#endif
+    DistMatrix<Complex<R>,VC,STAR> Z( X.Grid() );
+    fft::Embed( X, Z, n_, false );
+    fft::Transform( ( orientation==ADJOINT ? +1 : -1 ), Z );
+    Scale( Complex<R>(1/Sqrt(R(n_))), Z );
+    fft::Extract( Z, Y, n_, false );
+}
+
 } // namespace elem
 
 #endif // ifndef MATRICES_FOURIER_HPP
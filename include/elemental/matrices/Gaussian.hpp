@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef MATRICES_GAUSSIAN_HPP
+#define MATRICES_GAUSSIAN_HPP
+
+namespace elem {
+
+namespace internal {
+
+template<typename T>
+inline void
+MakeGaussianLocal
+( Matrix<T>& A, const RandomStream& stream, T mean, BASE(T) stddev,
+  int colShift, int colStride, int rowShift, int rowStride )
+{
+    const int localHeight = A.Height();
+    const int localWidth = A.Width();
+    const int ldim = A.LDim();
+    T* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        T* col = &buffer[jLoc*ldim];
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int i = colShift + iLoc*colStride;
+            col[iLoc] = mean + stddev*SampleNormal<T>( stream, i, j );
+        }
+    }
+}
+
+} // namespace internal
+
+// Draw each entry from a normal PDF with the given mean and standard deviation
+template<typename T>
+inline void
+MakeGaussian( Matrix<T>& A, T mean=0, BASE(T) stddev=1 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeGaussian");
+#endif
+    const RandomStream stream = NewLocalRandomStream();
+    internal::MakeGaussianLocal( A, stream, mean, stddev, 0, 1, 0, 1 );
+}
+
+template<typename T>
+inline void
+Gaussian( Matrix<T>& A, int m, int n, T mean=0, BASE(T) stddev=1 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gaussian");
+#endif
+    A.ResizeTo( m, n );
+    MakeGaussian( A, mean, stddev );
+}
+
+// As with MakeUniform, the result does not depend upon the process grid, and
+// this routine must be called by every process in the grid of A.
+template<typename T,Distribution U,Distribution V>
+inline void
+MakeGaussian( DistMatrix<T,U,V>& A, T mean=0, BASE(T) stddev=1 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeGaussian");
+#endif
+    const RandomStream stream = NewDistRandomStream( A.Grid() );
+    if( A.Participating() )
+        internal::MakeGaussianLocal
+        ( A.Matrix(), stream, mean, stddev,
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride() );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+Gaussian( DistMatrix<T,U,V>& A, int m, int n, T mean=0, BASE(T) stddev=1 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gaussian");
+#endif
+    A.ResizeTo( m, n );
+    MakeGaussian( A, mean, stddev );
+}
+
+} // namespace elem
+
+#endif // ifndef MATRICES_GAUSSIAN_HPP
@@ -10,6 +10,8 @@
 #ifndef MATRICES_HANKEL_HPP
 #define MATRICES_HANKEL_HPP
 
+#include "elemental/blas-like/level1/FFT.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -58,6 +60,98 @@ Hankel( DistMatrix<T,U,V>& A, int m, int n, const std::vector<T>& a )
     }
 }
 
+// An implicit m x n Hankel matrix, A(i,j) = a(i+j). Since
+// y(i) = sum_j c(i+j) x(j) is the circular correlation of c = [a; 0] with x,
+// it is applied by transforming x with the inverse (rather than forward)
+// DFT before scaling by the spectrum of c.
+template<typename T>
+class HankelOperator
+{
+public:
+    HankelOperator( int m, int n, const std::vector<T>& a );
+
+    int Height() const { return m_; }
+    int Width() const { return n_; }
+
+    // Y := op(A) X
+    void Apply
+    ( Orientation orientation, const Matrix<T>& X, Matrix<T>& Y ) const;
+    template<Distribution U,Distribution V>
+    void Apply
+    ( Orientation orientation,
+      const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y ) const;
+
+private:
+    int m_, n_;
+    std::vector<Complex<BASE(T)> > lambda_, lambdaAdj_;
+};
+
+template<typename T>
+inline
+HankelOperator<T>::HankelOperator( int m, int n, const std::vector<T>& a )
+: m_(m), n_(n)
+{
+#ifndef RELEASE
+    CallStackEntry entry("HankelOperator::HankelOperator");
+#endif
+    const int length = m+n-1;
+    if( a.size() != (unsigned)length )
+        throw std::logic_error("a was the wrong size");
+    const int N = fft::NextFastSize( length );
+    // A^H is the n x m Hankel matrix generated by conj(a)
+    Matrix<Complex<BASE(T)> > c;
+    Zeros( c, N, 2 );
+    for( int i=0; i<length; ++i )
+    {
+        c.Set( i, 0, fft::ToComplex(a[i],false) );
+        c.Set( i, 1, Conj(c.Get(i,0)) );
+    }
+    FFT( c );
+    lambda_.resize( N );
+    lambdaAdj_.resize( N );
+    for( int i=0; i<N; ++i )
+    {
+        lambda_[i] = c.Get(i,0);
+        lambdaAdj_[i] = c.Get(i,1);
+    }
+}
+
+template<typename T>
+inline void
+HankelOperator<T>::Apply
+( Orientation orientation, const Matrix<T>& X, Matrix<T>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("HankelOperator::Apply");
+    if( X.Height() != (orientation==NORMAL ? n_ : m_) )
+        throw std::logic_error("Nonconformal HankelOperator::Apply");
+#endif
+    if( orientation == NORMAL )
+        fft::StructuredApply( +1, lambda_, m_, false, X, Y );
+    else
+        fft::StructuredApply
+        ( +1, lambdaAdj_, n_, orientation==TRANSPOSE, X, Y );
+}
+
+template<typename T>
+template<Distribution U,Distribution V>
+inline void
+HankelOperator<T>::Apply
+( Orientation orientation,
+  const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("HankelOperator::Apply");
+    if( X.Height() != (orientation==NORMAL ? n_ : m_) )
+        throw std::logic_error("Nonconformal HankelOperator::Apply");
+#endif
+    if( orientation == NORMAL )
+        fft::StructuredApply( +1, lambda_, m_, false, X, Y );
+    else
+        fft::StructuredApply
+        ( +1, lambdaAdj_, n_, orientation==TRANSPOSE, X, Y );
+}
+
 } // namespace elem
 
 #endif // ifndef MATRICES_HANKEL_HPP
@@ -10,11 +10,6 @@
 #ifndef MATRICES_HERMITIANUNIFORMSPECTRUM_HPP
 #define MATRICES_HERMITIANUNIFORMSPECTRUM_HPP
 
-#include "elemental/blas-like/level1/Dot.hpp"
-#include "elemental/blas-like/level1/Nrm2.hpp"
-#include "elemental/blas-like/level1/Scale.hpp"
-#include "elemental/blas-like/level2/Ger.hpp"
-#include "elemental/matrices/Diagonal.hpp"
 #include "elemental/matrices/Uniform.hpp"
 
 namespace elem {
@@ -22,6 +17,84 @@ namespace elem {
 // Draw the spectrum from the specified half-open interval on the real line,
 // then rotate it with a random Householder similarity transformation
 
+namespace internal {
+
+// Sample the diagonal matrix D from the half-open interval [lower,upper)
+// and then rotate it with a random Householder similarity transformation:
+//
+//  (I-2uu^H) D (I-2uu^H)^H = D - 2(u (D u)^H + (D u) u^H) + 
+//                                (4 u^H D u) u u^H
+//
+// The length-n vectors d and u are formed redundantly, in the same order, by
+// every process, and then each entry of the result is formed directly from
+// its global indices, so that the result does not depend upon the grid.
+template<typename F>
+inline void
+MakeHermitianUniformSpectrumLocal
+( Matrix<F>& A, int n, const RandomStream& stream, 
+  BASE(F) lower, BASE(F) upper,
+  int colShift, int colStride, int rowShift, int rowStride )
+{
+    typedef BASE(F) R;
+    const bool isComplex = IsComplex<F>::val;
+
+    // Form d and the normalized u
+    std::vector<R> d( n );
+    std::vector<F> u( n );
+    R uNormSquared = 0;
+    for( int j=0; j<n; ++j )
+    {
+        double sample, sampleUnused;
+        SampleUniformPair( stream, j, 0, sample, sampleUnused );
+        d[j] = lower + (upper-lower)*R(sample);
+        u[j] = SampleUnitBall<F>( stream, j, 1 );
+        uNormSquared += Abs(u[j])*Abs(u[j]);
+    }
+    const R uNorm = Sqrt( uNormSquared );
+    for( int j=0; j<n; ++j )
+        u[j] /= uNorm;
+
+    // Form v := D u and gamma := 4 u^H (D u) = 4 (u,Du)
+    std::vector<F> v( n );
+    R gamma = 0;
+    for( int j=0; j<n; ++j )
+    {
+        v[j] = d[j]*u[j];
+        gamma += 4*RealPart(Conj(u[j])*v[j]);
+    }
+
+    // A := D - 2(u v^H + v u^H) + gamma u u^H
+    const int localHeight = A.Height();
+    const int localWidth = A.Width();
+    const int ldim = A.LDim();
+    F* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        const F uConj = Conj(u[j]);
+        const F vConj = Conj(v[j]);
+        F* col = &buffer[jLoc*ldim];
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int i = colShift + iLoc*colStride;
+            F alpha = -2*(u[i]*vConj + v[i]*uConj) + gamma*u[i]*uConj;
+            if( i == j )
+            {
+                alpha += d[j];
+                // Force the diagonal to be real
+                if( isComplex )
+                    alpha = RealPart(alpha);
+            }
+            col[iLoc] = alpha;
+        }
+    }
+}
+
+} // namespace internal
+
 template<typename F>
 inline void
 HermitianUniformSpectrum
@@ -55,50 +128,12 @@ MakeHermitianUniformSpectrum( Matrix<F>& A, BASE(F) lower=0, BASE(F) upper=1 )
 #endif
     if( A.Height() != A.Width() )
         throw std::logic_error("Cannot make a non-square matrix Hermitian");
-    typedef BASE(F) R;
-    const bool isComplex = IsComplex<F>::val;
-
-    // Sample the diagonal matrix D from the half-open interval (lower,upper]
-    // and then rotate it with a random Householder similarity transformation:
-    //
-    //  (I-2uu^H) D (I-2uu^H)^H = D - 2(u (D u)^H + (D u) u^H) + 
-    //                                (4 u^H D u) u u^H
-    //
-
-    // Form d and D
-    const int n = A.Height();
-    std::vector<F> d( n );
-    for( int j=0; j<n; ++j )
-        d[j] = lower + (upper-lower)*Uniform();
-    Diagonal( A, d );
-
-    // Form u 
-    Matrix<F> u( n, 1 );
-    MakeUniform( u );
-    const R origNorm = Nrm2( u );
-    Scale( 1/origNorm, u );
-
-    // Form v := D u
-    Matrix<F> v( n, 1 );
-    for( int i=0; i<n; ++i )
-        v.Set( i, 0, d[i]*u.Get(i,0) );
-
-    // Update A := A - 2(u v^H + v u^H)
-    Ger( F(-2), u, v, A );
-    Ger( F(-2), v, u, A );
-
-    // Form gamma := 4 u^H (D u) = 4 (u,Du)
-    const F gamma = F(4)*Dot(u,v);
-
-    // Update A := A + gamma u u^H
-    Ger( gamma, u, u, A );
-
-    // Force the diagonal to be real
-    if( isComplex )
-        for( int j=0; j<n; ++j )
-            A.SetImagPart( j, j, R(0) );
+    const RandomStream stream = NewLocalRandomStream();
+    internal::MakeHermitianUniformSpectrumLocal
+    ( A, A.Height(), stream, lower, upper, 0, 1, 0, 1 );
 }
 
+// This routine must be called by every process in the grid of A
 template<typename F,Distribution U,Distribution V>
 inline void
 MakeHermitianUniformSpectrum
@@ -109,108 +144,11 @@ MakeHermitianUniformSpectrum
 #endif
     if( A.Height() != A.Width() )
         throw std::logic_error("Cannot make a non-square matrix Hermitian");
-    const Grid& grid = A.Grid();
-    typedef BASE(F) R;
-    const bool isComplex = IsComplex<F>::val;
-    const bool standardDist = ( U == MC && V == MR );
-
-    // Sample the diagonal matrix D from the half-open interval (lower,upper]
-    // and then rotate it with a random Householder similarity transformation:
-    //
-    //  (I-2uu^H) D (I-2uu^H)^H = D - 2(u (D u)^H + (D u) u^H) + 
-    //                                (4 u^H D u) u u^H
-    //
-
-    // Form d and D
-    const int n = A.Height();
-    std::vector<F> d( n );
-    if( grid.Rank() == 0 )
-        for( int j=0; j<n; ++j )
-            d[j] = lower + (upper-lower)*Uniform();
-    mpi::Broadcast( &d[0], n, 0, grid.Comm() );
-    DistMatrix<F> ABackup( grid );
-    if( standardDist )
-        Diagonal( A, d );
-    else
-    {
-        ABackup.AlignWith( A );
-        Diagonal( ABackup, d );
-    }
-
-    // Form u 
-    DistMatrix<F> u( grid );
-    if( standardDist )
-        u.AlignWith( A );
-    else
-        u.AlignWith( ABackup );
-    Uniform( u, n, 1 );
-    const R origNorm = Nrm2( u );
-    Scale( 1/origNorm, u );
-
-    // Form v := D u
-    DistMatrix<F> v( grid );
-    if( standardDist )
-        v.AlignWith( A );
-    else
-        v.AlignWith( ABackup );
-    v.ResizeTo( n, 1 );
-    if( v.LocalWidth() == 1 )
-    {
-        const int colShift = v.ColShift();
-        const int colStride = v.ColStride();
-        const int localHeight = v.LocalHeight();
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const int i = colShift + iLoc*colStride;
-            v.SetLocal( iLoc, 0, d[i]*u.GetLocal(iLoc,0) );
-        }
-    }
-
-    // Update A := A - 2(u v^H + v u^H)
-    if( standardDist )
-    {
-        Ger( F(-2), u, v, A );
-        Ger( F(-2), v, u, A );
-    }
-    else
-    {
-        Ger( F(-2), u, v, ABackup );
-        Ger( F(-2), v, u, ABackup );
-    }
-
-    // Form gamma := 4 u^H (D u) = 4 (u,Du)
-    const F gamma = F(4)*Dot(u,v);
-
-    // Update A := A + gamma u u^H
-    if( standardDist )
-        Ger( gamma, u, u, A );
-    else
-        Ger( gamma, u, u, ABackup );
-
-    // Copy the result into the correct distribution
-    if( !standardDist )
-        A = ABackup;
-
-    // Force the diagonal to be real-valued
-    if( isComplex )
-    {
-        const int localHeight = A.LocalHeight();
-        const int localWidth = A.LocalWidth();
-        const int colShift = A.ColShift();
-        const int rowShift = A.RowShift();
-        const int colStride = A.ColStride();
-        const int rowStride = A.RowStride();
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const int j = rowShift + jLoc*rowStride;
-            for( int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const int i = colShift + iLoc*colStride;
-                if( i == j )
-                    A.SetLocalImagPart( iLoc, jLoc, R(0) );
-            }
-        }
-    }
+    const RandomStream stream = NewDistRandomStream( A.Grid() );
+    if( A.Participating() )
+        internal::MakeHermitianUniformSpectrumLocal
+        ( A.Matrix(), A.Height(), stream, lower, upper,
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride() );
 }
 
 } // namespace elem
@@ -10,17 +10,81 @@
 #ifndef MATRICES_NORMALUNIFORMSPECTRUM_HPP
 #define MATRICES_NORMALUNIFORMSPECTRUM_HPP
 
-#include "elemental/blas-like/level1/Dot.hpp"
-#include "elemental/blas-like/level1/Nrm2.hpp"
-#include "elemental/blas-like/level1/Scale.hpp"
-#include "elemental/blas-like/level2/Ger.hpp"
-#include "elemental/matrices/Diagonal.hpp"
 #include "elemental/matrices/Uniform.hpp"
 
 namespace elem {
 
-// Draw the spectrum from the specified half-open interval on the real line,
-// then rotate it with a random Householder similarity transformation
+// Draw the spectrum from the specified ball in the complex plane, then rotate 
+// it with a random Householder similarity transformation
+
+namespace internal {
+
+// Sample the diagonal matrix D from the ball B_radius(center)
+// and then rotate it with a random Householder similarity transformation:
+//
+//  (I-2uu^H) D (I-2uu^H)^H = D - 2(u (conj(D) u)^H + (D u) u^H) + 
+//                                (4 u^H D u) u u^H
+//
+// As in MakeHermitianUniformSpectrumLocal, d and u are formed redundantly so
+// that each entry can be formed directly from its global indices.
+template<typename R>
+inline void
+MakeNormalUniformSpectrumLocal
+( Matrix<Complex<R> >& A, int n, const RandomStream& stream,
+  Complex<R> center, R radius,
+  int colShift, int colStride, int rowShift, int rowStride )
+{
+    typedef Complex<R> C;
+
+    // Form d and the normalized u
+    std::vector<C> d( n ), u( n );
+    R uNormSquared = 0;
+    for( int j=0; j<n; ++j )
+    {
+        d[j] = center + radius*SampleUnitBall<C>( stream, j, 0 );
+        u[j] = SampleUnitBall<C>( stream, j, 1 );
+        uNormSquared += Abs(u[j])*Abs(u[j]);
+    }
+    const R uNorm = Sqrt( uNormSquared );
+    for( int j=0; j<n; ++j )
+        u[j] /= uNorm;
+
+    // Form v := D u, w := conj(D) u, and gamma := 4 u^H (D u) = 4 (u,Du)
+    std::vector<C> v( n ), w( n );
+    C gamma = 0;
+    for( int j=0; j<n; ++j )
+    {
+        v[j] = d[j]*u[j];
+        w[j] = Conj(d[j])*u[j];
+        gamma += C(4)*Conj(u[j])*v[j];
+    }
+
+    // A := D - 2(u w^H + v u^H) + gamma u u^H
+    const int localHeight = A.Height();
+    const int localWidth = A.Width();
+    const int ldim = A.LDim();
+    C* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        const C uConj = Conj(u[j]);
+        const C wConj = Conj(w[j]);
+        C* col = &buffer[jLoc*ldim];
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int i = colShift + iLoc*colStride;
+            C alpha = C(-2)*(u[i]*wConj + v[i]*uConj) + gamma*u[i]*uConj;
+            if( i == j )
+                alpha += d[j];
+            col[iLoc] = alpha;
+        }
+    }
+}
+
+} // namespace internal
 
 template<typename R>
 inline void
@@ -54,51 +118,14 @@ MakeNormalUniformSpectrum
 #ifndef RELEASE
     CallStackEntry entry("MakeNormalUniformSpectrum");
 #endif
-    typedef Complex<R> C;
     if( A.Height() != A.Width() )
         throw std::logic_error("Cannot make a non-square matrix normal");
-
-    // Sample the diagonal matrix D from the ball B_radius(center)
-    // and then rotate it with a random Householder similarity transformation:
-    //
-    //  (I-2uu^H) D (I-2uu^H)^H = D - 2(u (conj(D) u)^H + (D u) u^H) + 
-    //                                (4 u^H D u) u u^H
-    //
-
-    // Form d and D
-    const int n = A.Height();
-    std::vector<C> d( n );
-    for( int j=0; j<n; ++j )
-        d[j] = center + radius*SampleUnitBall<C>();
-    Diagonal( A, d );
-
-    // Form u 
-    Matrix<C> u( n, 1 );
-    MakeUniform( u );
-    const R origNorm = Nrm2( u );
-    Scale( 1/origNorm, u );
-
-    // Form v := D u
-    Matrix<C> v( n, 1 );
-    for( int i=0; i<n; ++i )
-        v.Set( i, 0, d[i]*u.Get(i,0) );
-
-    // Form w := conj(D) u
-    Matrix<C> w( n, 1 );
-    for( int i=0; i<n; ++i )
-        w.Set( i, 0, Conj(d[i])*u.Get(i,0) );
-
-    // Update A := A - 2(u w^H + v u^H)
-    Ger( C(-2), u, w, A );
-    Ger( C(-2), v, u, A );
-
-    // Form \gamma := 4 u^H (D u) = 4 (u,Du)
-    const C gamma = 4*Dot(u,v);
-
-    // Update A := A + gamma u u^H
-    Ger( gamma, u, u, A );
+    const RandomStream stream = NewLocalRandomStream();
+    internal::MakeNormalUniformSpectrumLocal
+    ( A, A.Height(), stream, center, radius, 0, 1, 0, 1 );
 }
 
+// This routine must be called by every process in the grid of A
 template<typename R,Distribution U,Distribution V>
 inline void
 MakeNormalUniformSpectrum
@@ -107,107 +134,13 @@ MakeNormalUniformSpectrum
 #ifndef RELEASE
     CallStackEntry entry("MakeNormalUniformSpectrum");
 #endif
-    typedef Complex<R> C;
     if( A.Height() != A.Width() )
         throw std::logic_error("Cannot make a non-square matrix normal");
-    const Grid& grid = A.Grid();
-    const bool standardDist = ( U == MC && V == MR );
-
-    // Sample the diagonal matrix D from the ball B_radius(center)
-    // and then rotate it with a random Householder similarity transformation:
-    //
-    //  (I-2uu^H) D (I-2uu^H)^H = D - 2(u (Conj(D) u)^H + (D u) u^H) + 
-    //                                (4 u^H D u) u u^H
-    //
-
-    // Form d and D
-    const int n = A.Height();
-    std::vector<C> d( n );
-    if( grid.Rank() == 0 )
-        for( int j=0; j<n; ++j )
-            d[j] = center + radius*SampleUnitBall<C>();
-    mpi::Broadcast( &d[0], n, 0, grid.Comm() );
-    DistMatrix<C> ABackup( grid );
-    if( standardDist )
-        Diagonal( A, d );
-    else
-    {
-        ABackup.AlignWith( A );
-        Diagonal( ABackup, d );
-    }
-
-    // Form u 
-    DistMatrix<C> u( grid );
-    if( standardDist )
-        u.AlignWith( A );
-    else
-        u.AlignWith( ABackup );
-    Uniform( u, n, 1 );
-    const R origNorm = Nrm2( u );
-    Scale( 1/origNorm, u );
-
-    // Form v := D u
-    DistMatrix<C> v( grid );
-    if( standardDist )
-        v.AlignWith( A );
-    else
-        v.AlignWith( ABackup );
-    v.ResizeTo( n, 1 );
-    if( v.LocalWidth() == 1 )
-    {
-        const int colShift = v.ColShift();
-        const int colStride = v.ColStride();
-        const int localHeight = v.LocalHeight();
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const int i = colShift + iLoc*colStride;
-            v.SetLocal( iLoc, 0, d[i]*u.GetLocal(iLoc,0) );
-        }
-    }
-
-    // Form w := Conj(D) u
-    DistMatrix<C> w( grid );
-    if( standardDist )
-        w.AlignWith( A );
-    else
-        w.AlignWith( ABackup );
-    w.ResizeTo( n, 1 );
-    if( w.LocalWidth() == 1 )
-    {
-        const int colShift = w.ColShift();
-        const int colStride = w.ColStride();
-        const int localHeight = w.LocalHeight();
-        for( int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const int i = colShift + iLoc*colStride;
-            w.SetLocal( iLoc, 0, Conj(d[i])*u.GetLocal(iLoc,0) );
-        }
-    }
-
-    // Update A := A - 2(u w^H + v u^H)
-    if( standardDist )
-    {
-        Ger( C(-2), u, w, A );
-        Ger( C(-2), v, u, A );
-    }
-    else
-    {
-        Ger( C(-2), u, w, ABackup );
-        Ger( C(-2), v, u, ABackup );
-    }
-
-    // Form \gamma := 4 u^H (D u) = 4 (u,Du)
-    const C gamma = 4*Dot(u,v);
-
-    // Update A := A + gamma u u^H
-    if( standardDist )
-        Ger( gamma, u, u, A );
-    else
-        Ger( gamma, u, u, ABackup );
-
-    // Copy the result into the correct distribution
-    if( !standardDist )
-        A = ABackup;
+    const RandomStream stream = NewDistRandomStream( A.Grid() );
+    if( A.Participating() )
+        internal::MakeNormalUniformSpectrumLocal
+        ( A.Matrix(), A.Height(), stream, center, radius,
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride() );
 }
 
 } // namespace elem
@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef MATRICES_RADEMACHER_HPP
+#define MATRICES_RADEMACHER_HPP
+
+namespace elem {
+
+namespace internal {
+
+template<typename T>
+inline void
+MakeRademacherLocal
+( Matrix<T>& A, const RandomStream& stream,
+  int colShift, int colStride, int rowShift, int rowStride )
+{
+    const int localHeight = A.Height();
+    const int localWidth = A.Width();
+    const int ldim = A.LDim();
+    T* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        T* col = &buffer[jLoc*ldim];
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int i = colShift + iLoc*colStride;
+            double u, uUnused;
+            SampleUniformPair( stream, i, j, u, uUnused );
+            col[iLoc] = ( u < 0.5 ? T(-1) : T(1) );
+        }
+    }
+}
+
+} // namespace internal
+
+// Draw each entry from {-1,+1} with equal probability
+template<typename T>
+inline void
+MakeRademacher( Matrix<T>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeRademacher");
+#endif
+    const RandomStream stream = NewLocalRandomStream();
+    internal::MakeRademacherLocal( A, stream, 0, 1, 0, 1 );
+}
+
+template<typename T>
+inline void
+Rademacher( Matrix<T>& A, int m, int n )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Rademacher");
+#endif
+    A.ResizeTo( m, n );
+    MakeRademacher( A );
+}
+
+// As with MakeUniform, the result does not depend upon the process grid, and
+// this routine must be called by every process in the grid of A.
+template<typename T,Distribution U,Distribution V>
+inline void
+MakeRademacher( DistMatrix<T,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeRademacher");
+#endif
+    const RandomStream stream = NewDistRandomStream( A.Grid() );
+    if( A.Participating() )
+        internal::MakeRademacherLocal
+        ( A.Matrix(), stream,
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride() );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+Rademacher( DistMatrix<T,U,V>& A, int m, int n )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Rademacher");
+#endif
+    A.ResizeTo( m, n );
+    MakeRademacher( A );
+}
+
+} // namespace elem
+
+#endif // ifndef MATRICES_RADEMACHER_HPP
@@ -10,6 +10,8 @@
 #ifndef MATRICES_TOEPLITZ_HPP
 #define MATRICES_TOEPLITZ_HPP
 
+#include "elemental/blas-like/level1/FFT.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -58,6 +60,94 @@ Toeplitz( DistMatrix<T,U,V>& A, int m, int n, const std::vector<T>& a )
     }
 }
 
+// An implicit m x n Toeplitz matrix, A(i,j) = a(i-j+(n-1)), which is
+// applied in O(N log N) work per column by embedding it in an N x N
+// circulant matrix, where N >= m+n-1 has no prime factors larger than seven
+template<typename T>
+class ToeplitzOperator
+{
+public:
+    ToeplitzOperator( int m, int n, const std::vector<T>& a );
+
+    int Height() const { return m_; }
+    int Width() const { return n_; }
+
+    // Y := op(A) X
+    void Apply
+    ( Orientation orientation, const Matrix<T>& X, Matrix<T>& Y ) const;
+    template<Distribution U,Distribution V>
+    void Apply
+    ( Orientation orientation,
+      const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y ) const;
+
+private:
+    int m_, n_;
+    std::vector<Complex<BASE(T)> > lambda_, lambdaAdj_;
+};
+
+template<typename T>
+inline
+ToeplitzOperator<T>::ToeplitzOperator( int m, int n, const std::vector<T>& a )
+: m_(m), n_(n)
+{
+#ifndef RELEASE
+    CallStackEntry entry("ToeplitzOperator::ToeplitzOperator");
+#endif
+    if( a.size() != (unsigned)(m+n-1) )
+        throw std::logic_error("a was the wrong size");
+    const int N = fft::NextFastSize( m+n-1 );
+    // The first column of the circulant holds a(n-1:m+n-2) followed by
+    // zeros and then a(0:n-2)
+    Matrix<Complex<BASE(T)> > c;
+    Zeros( c, N, 1 );
+    for( int d=-(n-1); d<m; ++d )
+        c.Set( (d+N)%N, 0, fft::ToComplex(a[d+n-1],false) );
+    FFT( c );
+    lambda_.resize( N );
+    lambdaAdj_.resize( N );
+    for( int i=0; i<N; ++i )
+    {
+        lambda_[i] = c.Get(i,0);
+        lambdaAdj_[i] = Conj(lambda_[i]);
+    }
+}
+
+template<typename T>
+inline void
+ToeplitzOperator<T>::Apply
+( Orientation orientation, const Matrix<T>& X, Matrix<T>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("ToeplitzOperator::Apply");
+    if( X.Height() != (orientation==NORMAL ? n_ : m_) )
+        throw std::logic_error("Nonconformal ToeplitzOperator::Apply");
+#endif
+    if( orientation == NORMAL )
+        fft::StructuredApply( -1, lambda_, m_, false, X, Y );
+    else
+        fft::StructuredApply
+        ( -1, lambdaAdj_, n_, orientation==TRANSPOSE, X, Y );
+}
+
+template<typename T>
+template<Distribution U,Distribution V>
+inline void
+ToeplitzOperator<T>::Apply
+( Orientation orientation,
+  const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("ToeplitzOperator::Apply");
+    if( X.Height() != (orientation==NORMAL ? n_ : m_) )
+        throw std::logic_error("Nonconformal ToeplitzOperator::Apply");
+#endif
+    if( orientation == NORMAL )
+        fft::StructuredApply( -1, lambda_, m_, false, X, Y );
+    else
+        fft::StructuredApply
+        ( -1, lambdaAdj_, n_, orientation==TRANSPOSE, X, Y );
+}
+
 } // namespace elem
 
 #endif // ifndef MATRICES_TOEPLITZ_HPP
@@ -12,6 +12,38 @@
 
 namespace elem {
 
+namespace internal {
+
+// Fill the local data of A with entries drawn from the given stream, where
+// local entry (iLoc,jLoc) has global indices
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride).
+template<typename T>
+inline void
+MakeUniformLocal
+( Matrix<T>& A, const RandomStream& stream, T center, BASE(T) radius,
+  int colShift, int colStride, int rowShift, int rowStride )
+{
+    const int localHeight = A.Height();
+    const int localWidth = A.Width();
+    const int ldim = A.LDim();
+    T* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+#pragma omp parallel for
+#endif
+    for( int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        T* col = &buffer[jLoc*ldim];
+        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const int i = colShift + iLoc*colStride;
+            col[iLoc] = center + radius*SampleUnitBall<T>( stream, i, j );
+        }
+    }
+}
+
+} // namespace internal
+
 // Draw each entry from a uniform PDF over the closed unit ball.
 template<typename T>
 inline void
@@ -20,11 +52,21 @@ MakeUniform( Matrix<T>& A, T center=0, BASE(T) radius=1 )
 #ifndef RELEASE
     CallStackEntry entry("MakeUniform");
 #endif
-    const int m = A.Height();
-    const int n = A.Width();
-    for( int j=0; j<n; ++j )
-        for( int i=0; i<m; ++i )
-            A.Set( i, j, center+radius*SampleUnitBall<T>() );
+    const RandomStream stream = NewLocalRandomStream();
+    internal::MakeUniformLocal( A, stream, center, radius, 0, 1, 0, 1 );
+}
+
+// Draw from the given stream rather than a fresh one, e.g., so that each
+// member of a batch uses its own stream (see RandomStream)
+template<typename T>
+inline void
+MakeUniform
+( Matrix<T>& A, const RandomStream& stream, T center=0, BASE(T) radius=1 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeUniform");
+#endif
+    internal::MakeUniformLocal( A, stream, center, radius, 0, 1, 0, 1 );
 }
 
 template<typename T>
@@ -39,323 +81,33 @@ Uniform
     MakeUniform( A, center, radius );
 }
 
-namespace internal {
-
+// Each entry is a function of its global indices, so every process can
+// generate its own portion, and the result does not depend upon the grid.
 template<typename T,Distribution U,Distribution V>
-struct MakeUniformHelper
-{
-    static void Func( DistMatrix<T,U,V>& A, T center, BASE(T) radius );  
-};
-
-template<typename T>
-struct MakeUniformHelper<T,CIRC,CIRC>
-{
-    static void Func( DistMatrix<T,CIRC,CIRC>& A, T center, BASE(T) radius )
-    {
-        if( A.Grid().VCRank() == A.Root() )
-        {
-            const int height = A.Height(); 
-            const int width = A.Width();
-            for( int j=0; j<width; ++j )
-                for( int i=0; i<height; ++i )
-                    A.SetLocal( i, j, center+radius*SampleUnitBall<T>() );
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MC,MR>
-{
-    static void Func( DistMatrix<T,MC,MR>& A, T center, BASE(T) radius )
-    {
-        const int localHeight = A.LocalHeight(); 
-        const int localWidth = A.LocalWidth();
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( int iLoc=0; iLoc<localHeight; ++iLoc )
-                A.SetLocal( iLoc, jLoc, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MC,STAR>
-{
-    static void Func( DistMatrix<T,MC,STAR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        if( grid.InGrid() )
-        {
-            const int n = A.Width();
-            const int localHeight = A.LocalHeight();
-            const int bufSize = localHeight*n;
-            std::vector<T> buffer( bufSize );
-
-            // Create random matrix on process column 0, then broadcast
-            if( grid.Col() == 0 )
-            {
-                for( int j=0; j<n; ++j )
-                    for( int iLoc=0; iLoc<localHeight; ++iLoc )
-                        buffer[iLoc+j*localHeight] = 
-                            center + radius*SampleUnitBall<T>();
-            }
-            mpi::Broadcast( &buffer[0], bufSize, 0, grid.RowComm() );
-
-            // Unpack
-            T* localBuffer = A.Buffer();
-            const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-#pragma omp parallel for
-#endif
-            for( int j=0; j<n; ++j )
-            {
-                const T* bufferCol = &buffer[j*localHeight];
-                T* col = &localBuffer[j*ldim];
-                MemCopy( col, bufferCol, localHeight );
-            }
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MD,STAR>
-{
-    static void Func( DistMatrix<T,MD,STAR>& A, T center, BASE(T) radius )
-    {
-        const int n = A.Width();
-        const int localHeight = A.LocalHeight();
-        for( int j=0; j<n; ++j )
-            for( int iLoc=0; iLoc<localHeight; ++iLoc )
-                A.SetLocal( iLoc, j, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MR,MC>
-{
-    static void Func( DistMatrix<T,MR,MC>& A, T center, BASE(T) radius )
-    {
-        const int localHeight = A.LocalHeight(); 
-        const int localWidth = A.LocalWidth();
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( int iLoc=0; iLoc<localHeight; ++iLoc )
-                A.SetLocal( iLoc, jLoc, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MR,STAR>
-{
-    static void Func( DistMatrix<T,MR,STAR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        const int n = A.Width();
-        const int localHeight = A.LocalHeight();
-        const int bufSize = localHeight*n;
-        std::vector<T> buffer( bufSize );
-
-        // Create random matrix on process row 0, then broadcast
-        if( grid.Row() == 0 )
-        {
-            for( int j=0; j<n; ++j )
-                for( int i=0; i<localHeight; ++i )
-                    buffer[i+j*localHeight] = center+radius*SampleUnitBall<T>();
-        }
-        mpi::Broadcast( &buffer[0], bufSize, 0, grid.ColComm() );
-
-        // Unpack
-        T* localBuffer = A.Buffer();
-        const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-#pragma omp parallel for COLLAPSE(2)
-#endif
-        for( int j=0; j<n; ++j )
-            for( int iLoc=0; iLoc<localHeight; ++iLoc )
-                localBuffer[iLoc+j*ldim] = buffer[iLoc+j*localHeight];
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,MC>
-{
-    static void Func( DistMatrix<T,STAR,MC>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        const int bufSize = m*localWidth;
-        std::vector<T> buffer( bufSize );
-
-        // Create a random matrix on process column 0, then broadcast
-        if( grid.Col() == 0 )
-        {
-            for( int jLoc=0; jLoc<localWidth; ++jLoc )
-                for( int i=0; i<m; ++i )
-                    buffer[i+jLoc*m] = center+radius*SampleUnitBall<T>();
-        }
-        mpi::Broadcast( &buffer[0], bufSize, 0, grid.RowComm() );
-
-        // Unpack
-        T* localBuffer = A.Buffer();
-        const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-#pragma omp parallel for
-#endif
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const T* bufferCol = &buffer[jLoc*m];
-            T* col = &localBuffer[jLoc*ldim];
-            MemCopy( col, bufferCol, m );
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,MD>
-{
-    static void Func( DistMatrix<T,STAR,MD>& A, T center, BASE(T) radius )
-    {
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( int i=0; i<m; ++i )
-                A.SetLocal( i, jLoc, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,MR>
-{
-    static void Func( DistMatrix<T,STAR,MR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        const int bufSize = m*localWidth;
-        std::vector<T> buffer( bufSize );
-
-        // Create random matrix on process row 0, then broadcast
-        if( grid.Row() == 0 )
-        {
-            for( int j=0; j<localWidth; ++j )
-                for( int i=0; i<m; ++i )
-                    buffer[i+j*m] = center+radius*SampleUnitBall<T>();
-        }
-        mpi::Broadcast( &buffer[0], bufSize, 0, grid.ColComm() );
-
-        // Unpack
-        T* localBuffer = A.Buffer();
-        const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-#pragma omp parallel for
-#endif
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const T* bufferCol = &buffer[jLoc*m];
-            T* col = &localBuffer[jLoc*ldim];
-            MemCopy( col, bufferCol, m );
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,STAR>
+inline void
+MakeUniform
+( DistMatrix<T,U,V>& A, const RandomStream& stream,
+  T center=0, BASE(T) radius=1 )
 {
-    static void Func( DistMatrix<T,STAR,STAR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        const int m = A.Height();
-        const int n = A.Width();
-        const int bufSize = m*n;
-
-        if( grid.InGrid() )
-        {
-            std::vector<T> buffer( bufSize );
-
-            if( grid.Rank() == 0 )
-            {
-                for( int j=0; j<n; ++j )
-                    for( int i=0; i<m; ++i )
-                        buffer[i+j*m] = center+radius*SampleUnitBall<T>();
-            }
-            mpi::Broadcast( &buffer[0], bufSize, 0, grid.Comm() );
-
-            // Unpack
-            T* localBuffer = A.Buffer();
-            const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-#pragma omp parallel for
+#ifndef RELEASE
+    CallStackEntry entry("MakeUniform");
 #endif
-            for( int j=0; j<n; ++j )
-            {
-                const T* bufferCol = &buffer[j*m];
-                T* col = &localBuffer[j*ldim];
-                MemCopy( col, bufferCol, m );
-            }
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,VC>
-{
-    static void Func( DistMatrix<T,STAR,VC>& A, T center, BASE(T) radius )
-    {
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( int i=0; i<m; ++i )
-                A.SetLocal( i, jLoc, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,VR>
-{
-    static void Func( DistMatrix<T,STAR,VR>& A, T center, BASE(T) radius )
-    {
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        for( int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( int i=0; i<m; ++i )
-                A.SetLocal( i, jLoc, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,VC,STAR>
-{
-    static void Func( DistMatrix<T,VC,STAR>& A, T center, BASE(T) radius )
-    {
-        const int n = A.Width();
-        const int localHeight = A.LocalHeight();
-        for( int j=0; j<n; ++j )
-            for( int iLoc=0; iLoc<localHeight; ++iLoc )
-                A.SetLocal( iLoc, j, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,VR,STAR>
-{
-    static void Func( DistMatrix<T,VR,STAR>& A, T center, BASE(T) radius )
-    {
-        const int n = A.Width();
-        const int localHeight = A.LocalHeight();
-        for( int j=0; j<n; ++j )
-            for( int iLoc=0; iLoc<localHeight; ++iLoc )
-                A.SetLocal( iLoc, j, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-} // namespace internal
+    if( A.Participating() )
+        internal::MakeUniformLocal
+        ( A.Matrix(), stream, center, radius,
+          A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride() );
+}
 
+// This routine must be called by every process in the grid of A, as it
+// draws a fresh stream over the grid
 template<typename T,Distribution U,Distribution V>
 inline void
 MakeUniform( DistMatrix<T,U,V>& A, T center=0, BASE(T) radius=1 )
 {
 #ifndef RELEASE
-    CallStackEntry entry("Uniform");
+    CallStackEntry entry("MakeUniform");
 #endif
-    internal::MakeUniformHelper<T,U,V>::Func( A, center, radius );
+    MakeUniform( A, NewDistRandomStream( A.Grid() ), center, radius );
 }
 
 template<typename T,Distribution U,Distribution V>
@@ -59,9 +59,9 @@
 //
 
 #include "./matrices/Uniform.hpp"
+#include "./matrices/Gaussian.hpp"
+#include "./matrices/Rademacher.hpp"
 #include "./matrices/HermitianUniformSpectrum.hpp"
 #include "./matrices/NormalUniformSpectrum.hpp"
 
-// TODO: Gaussian
-
 #endif // ifndef MATRICES_IMPL_HPP
@@ -9,9 +9,8 @@
 #ifndef BLAS_TRR2K_LOCAL_HPP
 #define BLAS_TRR2K_LOCAL_HPP
 
-#include "elemental/blas-like/level1/AxpyTriangle.hpp"
-#include "elemental/blas-like/level1/ScaleTrapezoid.hpp"
 #include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Gemmt.hpp"
 
 namespace elem {
 
@@ -846,52 +845,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),  CT(g),
-                          AB(g),  CB(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g),
-                          DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), EBL );
-        LocalGemm( NORMAL, NORMAL, alpha, CB, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), ETR );
-        LocalGemm( NORMAL, NORMAL, alpha, CT, DR, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, NORMAL, alpha, AT, BL, FTL );
-    LocalGemm( NORMAL, NORMAL, alpha, CT, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, NORMAL, alpha, AB, BR, FBR );
-    LocalGemm( NORMAL, NORMAL, alpha, CB, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A B + C D^{T/H}) + beta C
@@ -908,55 +863,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfD, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),  CT(g),
-                          AB(g),  CB(g);
-    DistMatrix<T,MR,STAR> DT(g), 
-                          DB(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), EBL );
-        LocalGemm( NORMAL, orientationOfD, alpha, CB, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), ETR );
-        LocalGemm( NORMAL, orientationOfD, alpha, CT, DB, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, NORMAL, alpha, AT, BL, FTL );
-    LocalGemm( NORMAL, orientationOfD, alpha, CT, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, NORMAL, alpha, AB, BR, FBR );
-    LocalGemm( NORMAL, orientationOfD, alpha, CB, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, orientationOfD, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A B + C^{T/H} D) + beta E
@@ -973,51 +881,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfC, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),
-                          AB(g);
-    DistMatrix<T,STAR,MC> CL(g), CR(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g),
-                          DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), EBL );
-        LocalGemm( orientationOfC, NORMAL, alpha, CR, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), ETR );
-        LocalGemm( orientationOfC, NORMAL, alpha, CL, DR, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, NORMAL, alpha, AT, BL, FTL );
-    LocalGemm( orientationOfC, NORMAL, alpha, CL, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, NORMAL, alpha, AB, BR, FBR );
-    LocalGemm( orientationOfC, NORMAL, alpha, CR, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A B + C^{T/H} D^{T/H}) + beta E
@@ -1034,54 +899,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfC, orientationOfD, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),
-                          AB(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g);
-    DistMatrix<T,STAR,MC> CL(g), CR(g);
-    DistMatrix<T,MR,STAR> DT(g),
-                          DB(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), EBL );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CR, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), ETR );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CL, DB, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, NORMAL, alpha, AT, BL, FTL );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CL, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, NORMAL, alpha, AB, BR, FBR );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CR, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, orientationOfD, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A B^{T/H} + C D) + beta C
@@ -1098,55 +917,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfB, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),  CT(g),
-                          AB(g),  CB(g);
-    DistMatrix<T,MR,STAR> BT(g), 
-                          BB(g);
-    DistMatrix<T,STAR,MR> DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), EBL );
-        LocalGemm( NORMAL, NORMAL, alpha, CB, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), ETR );
-        LocalGemm( NORMAL, NORMAL, alpha, CT, DR, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AT, BT, FTL );
-    LocalGemm( NORMAL, NORMAL, alpha, CT, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AB, BB, FBR );
-    LocalGemm( NORMAL, NORMAL, alpha, CB, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A B^{T/H} + C D^{T/H}) + beta C
@@ -1164,56 +936,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfB, orientationOfD, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),  CT(g),
-                          AB(g),  CB(g);
-    DistMatrix<T,MR,STAR> BT(g),  DT(g),
-                          BB(g),  DB(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), EBL );
-        LocalGemm( NORMAL, orientationOfD, alpha, CB, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), ETR );
-        LocalGemm( NORMAL, orientationOfD, alpha, CT, DB, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AT, BT, FTL );
-    LocalGemm( NORMAL, orientationOfD, alpha, CT, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AB, BB, FBR );
-    LocalGemm( NORMAL, orientationOfD, alpha, CB, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, orientationOfD, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A B^{T/H} + C^{T/H} D) + beta E
@@ -1230,54 +954,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfB, orientationOfC, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),
-                          AB(g);
-    DistMatrix<T,MR,STAR> BT(g),
-                          BB(g);
-    DistMatrix<T,STAR,MC> CL(g), CR(g);
-    DistMatrix<T,STAR,MR> DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), EBL );
-        LocalGemm( orientationOfC, NORMAL, alpha, CR, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), ETR );
-        LocalGemm( orientationOfC, NORMAL, alpha, CL, DR, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AT, BT, FTL );
-    LocalGemm( orientationOfC, NORMAL, alpha, CL, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AB, BB, FBR );
-    LocalGemm( orientationOfC, NORMAL, alpha, CR, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A B^{T/H} + C^{T/H} D^{T/H}) + beta C
@@ -1296,57 +974,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfB, orientationOfC, orientationOfD, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),
-                          AB(g);
-    DistMatrix<T,MR,STAR> BT(g), 
-                          BB(g);
-    DistMatrix<T,STAR,MC> CL(g), CR(g);
-    DistMatrix<T,MR,STAR> DT(g), 
-                          DB(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), EBL );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CR, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), ETR );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CL, DB, T(1), ETR );
-    }
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AT, BT, FTL );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CL, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AB, BB, FBR );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CR, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, orientationOfD, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B + C D) + beta E
@@ -1363,51 +992,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfA, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g);
-    DistMatrix<T,MC,STAR> CT(g),
-                          CB(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g),
-                          DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), EBL );
-        LocalGemm( NORMAL, NORMAL, alpha, CB, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), ETR );
-        LocalGemm( NORMAL, NORMAL, alpha, CT, DR, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AL, BL, FTL );
-    LocalGemm( NORMAL, NORMAL, alpha, CT, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AR, BR, FBR );
-    LocalGemm( NORMAL, NORMAL, alpha, CB, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B + C D^{T/H}) + beta E
@@ -1424,54 +1010,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfA, orientationOfD, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g);
-    DistMatrix<T,MC,STAR> CT(g),
-                          CB(g);
-    DistMatrix<T,MR,STAR> DT(g),
-                          DB(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), EBL );
-        LocalGemm( NORMAL, orientationOfD, alpha, CB, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), ETR );
-        LocalGemm( NORMAL, orientationOfD, alpha, CT, DB, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AL, BL, FTL );
-    LocalGemm( NORMAL, orientationOfD, alpha, CT, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AR, BR, FBR );
-    LocalGemm( NORMAL, orientationOfD, alpha, CB, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, orientationOfD, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B + C^{T/H} D) + beta E
@@ -1489,48 +1029,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfA, orientationOfC, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g),
-                          CL(g), CR(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g),
-                          DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), EBL );
-        LocalGemm( orientationOfC, NORMAL, alpha, CR, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), ETR );
-        LocalGemm( orientationOfC, NORMAL, alpha, CL, DR, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AL, BL, FTL );
-    LocalGemm( orientationOfC, NORMAL, alpha, CL, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AR, BR, FBR );
-    LocalGemm( orientationOfC, NORMAL, alpha, CR, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B + C^{T/H} D^{T/H}) + beta E
@@ -1549,51 +1049,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfA, orientationOfC, orientationOfD, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g),
-                          CL(g), CR(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g);
-    DistMatrix<T,MR,STAR> DT(g),
-                          DB(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionRight( B, BL, BR, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), EBL );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CR, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), ETR );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CL, DB, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AL, BL, FTL );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CL, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AR, BR, FBR );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CR, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, NORMAL, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, orientationOfD, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B^{T/H} + C D) + beta E
@@ -1610,54 +1067,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfA, orientationOfB, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g);
-    DistMatrix<T,MR,STAR> BT(g),
-                          BB(g);
-    DistMatrix<T,MC,STAR> CT(g),
-                          CB(g);
-    DistMatrix<T,STAR,MR> DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), EBL );
-        LocalGemm( NORMAL, NORMAL, alpha, CB, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), ETR );
-        LocalGemm( NORMAL, NORMAL, alpha, CT, DR, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AL, BT, FTL );
-    LocalGemm( NORMAL, NORMAL, alpha, CT, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AR, BB, FBR );
-    LocalGemm( NORMAL, NORMAL, alpha, CB, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B^{T/H} + C D^{T/H}) + beta C
@@ -1676,57 +1087,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfA, orientationOfB, orientationOfB, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g);
-    DistMatrix<T,MR,STAR> BT(g), 
-                          BB(g);
-    DistMatrix<T,MC,STAR> CT(g),
-                          CB(g);
-    DistMatrix<T,MR,STAR> DT(g), 
-                          DB(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionDown
-    ( C, CT,
-         CB, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), EBL );
-        LocalGemm( NORMAL, orientationOfD, alpha, CB, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), ETR );
-        LocalGemm( NORMAL, orientationOfD, alpha, CT, DB, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AL, BT, FTL );
-    LocalGemm( NORMAL, orientationOfD, alpha, CT, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AR, BB, FBR );
-    LocalGemm( NORMAL, orientationOfD, alpha, CB, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, NORMAL, orientationOfD, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B^{T/H} + C^{T/H} D) + beta E
@@ -1745,51 +1107,8 @@ LocalTrr2kKernel
     CallStackEntry entry("LocalTrr2kKernel");
     CheckInput( orientationOfA, orientationOfB, orientationOfC, A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g),
-                          CL(g), CR(g);
-    DistMatrix<T,MR,STAR> BT(g),
-                          BB(g);
-    DistMatrix<T,STAR,MR> DL(g), DR(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionRight( D, DL, DR, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), EBL );
-        LocalGemm( orientationOfC, NORMAL, alpha, CR, DL, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), ETR );
-        LocalGemm( orientationOfC, NORMAL, alpha, CL, DR, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AL, BT, FTL );
-    LocalGemm( orientationOfC, NORMAL, alpha, CL, DL, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AR, BB, FBR );
-    LocalGemm( orientationOfC, NORMAL, alpha, CR, DR, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, NORMAL, alpha, C, D, T(1), E );
 }
 
 // E := alpha (A^{T/H} B^{T/H} + C^{T/H} D^{T/H}) + beta C
@@ -1809,52 +1128,8 @@ LocalTrr2kKernel
     ( orientationOfA, orientationOfB, orientationOfC, orientationOfD, 
       A, B, C, D, E );
 #endif
-    const Grid& g = E.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g),
-                          CL(g), CR(g);
-    DistMatrix<T,MR,STAR> BT(g),  DT(g),
-                          BB(g),  DB(g);
-    DistMatrix<T> ETL(g), ETR(g),
-                  EBL(g), EBR(g);
-    DistMatrix<T> FTL(g), FBR(g);
-
-    const int half = E.Height()/2;
-    ScaleTrapezoid( beta, uplo, E );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionDown
-    ( B, BT,
-         BB, half );
-    LockedPartitionRight( C, CL, CR, half );
-    LockedPartitionDown
-    ( D, DT,
-         DB, half );
-    PartitionDownDiagonal
-    ( E, ETL, ETR,
-         EBL, EBR, half );
-
-    FTL.AlignWith( ETL );
-    FBR.AlignWith( EBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), EBL );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CR, DT, T(1), EBL );
-    }
-    else
-    {
-        LocalGemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), ETR );
-        LocalGemm( orientationOfC, orientationOfD, alpha, CL, DB, T(1), ETR );
-    }
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AL, BT, FTL );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CL, DT, T(1), FTL );
-    AxpyTriangle( uplo, T(1), FTL, ETL );
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AR, BB, FBR );
-    LocalGemm( orientationOfC, orientationOfD, alpha, CR, DB, T(1), FBR );
-    AxpyTriangle( uplo, T(1), FBR, EBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, E );
+    LocalGemmt( uplo, orientationOfC, orientationOfD, alpha, C, D, T(1), E );
 }
 
 } // namespace trr2k
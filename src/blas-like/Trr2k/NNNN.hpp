@@ -60,6 +60,7 @@ void Trr2kNNNN
     LockedPartitionDown
     ( D, DT,
          DB, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -88,7 +89,7 @@ void Trr2kNNNN
         ( uplo, TRANSPOSE, TRANSPOSE, 
           alpha, A1_MC_STAR, B1Trans_MR_STAR, 
                  C1_MC_STAR, D1Trans_MR_STAR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
@@ -60,6 +60,7 @@ void Trr2kNNNT
          BB, 0 );
     LockedPartitionRight( C, CL, CR, 0 );
     LockedPartitionRight( D, DL, DR, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -90,7 +91,7 @@ void Trr2kNNNT
         ( uplo, TRANSPOSE, 
           alpha, A1_MC_STAR, B1Trans_MR_STAR, 
                  C1_MC_STAR, D1AdjOrTrans_STAR_MR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
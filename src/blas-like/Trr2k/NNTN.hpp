@@ -64,6 +64,7 @@ void Trr2kNNTN
     LockedPartitionDown
     ( D, DT,
          DB, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -94,7 +95,7 @@ void Trr2kNNTN
         ( uplo, TRANSPOSE, orientationOfC, TRANSPOSE,
           alpha, A1_MC_STAR, B1Trans_MR_STAR, 
                  C1_STAR_MC, D1Trans_MR_STAR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
@@ -63,6 +63,7 @@ void Trr2kNNTT
     ( C, CT,
          CB, 0 );
     LockedPartitionRight( D, DL, DR, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -95,7 +96,7 @@ void Trr2kNNTT
         ( uplo, TRANSPOSE, orientationOfC,
           alpha, A1_MC_STAR, B1Trans_MR_STAR, 
                  C1_STAR_MC, D1AdjOrTrans_STAR_MR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -59,6 +59,7 @@ void Trr2kNTNT
     LockedPartitionRight( B, BL, BR, 0 );
     LockedPartitionRight( C, CL, CR, 0 );
     LockedPartitionRight( D, DL, DR, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -91,7 +92,7 @@ void Trr2kNTNT
         ( uplo, 
           alpha, A1_MC_STAR, B1AdjOrTrans_STAR_MR, 
                  C1_MC_STAR, D1AdjOrTrans_STAR_MR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -63,6 +63,7 @@ void Trr2kNTTN
     LockedPartitionDown
     ( D, DT,
          DB, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -95,7 +96,7 @@ void Trr2kNTTN
         ( uplo, orientationOfC, TRANSPOSE,
           alpha, A1_MC_STAR, B1AdjOrTrans_STAR_MR,
                  C1_STAR_MC, D1Trans_MR_STAR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -63,6 +63,7 @@ void Trr2kNTTT
     ( C, CT,
          CB, 0 );
     LockedPartitionRight( D, DL, DR, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -97,7 +98,7 @@ void Trr2kNTTT
         ( uplo, orientationOfC,
           alpha, A1_MC_STAR, B1AdjOrTrans_STAR_MR, 
                  C1_STAR_MC, D1AdjOrTrans_STAR_MR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -67,6 +67,7 @@ void Trr2kTNTN
     LockedPartitionDown
     ( D, DT,
          DB, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AT.Height() < A.Height() )
     {
         LockedRepartitionDown
@@ -99,7 +100,7 @@ void Trr2kTNTN
         ( uplo, orientationOfA, TRANSPOSE, orientationOfC, TRANSPOSE,
           alpha, A1_STAR_MC, B1Trans_MR_STAR, 
                  C1_STAR_MC, D1Trans_MR_STAR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
@@ -67,6 +67,7 @@ void Trr2kTNTT
     ( C, CT,
          CB, 0 );
     LockedPartitionRight( D, DL, DR, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AT.Height() < A.Height() )
     {
         LockedRepartitionDown
@@ -101,7 +102,7 @@ void Trr2kTNTT
         ( uplo, orientationOfA, TRANSPOSE, orientationOfC,
           alpha, A1_STAR_MC, B1Trans_MR_STAR, 
                  C1_STAR_MC, D1AdjOrTrans_STAR_MR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -66,6 +66,7 @@ void Trr2kTTTT
     ( C, CT,
          CB, 0 );
     LockedPartitionRight( D, DL, DR, 0 );
+    ScaleTrapezoid( beta, uplo, E );
     while( AT.Height() < A.Height() )
     {
         LockedRepartitionDown
@@ -102,7 +103,7 @@ void Trr2kTTTT
         ( uplo, orientationOfA, orientationOfC,
           alpha, A1_STAR_MC, B1AdjOrTrans_STAR_MR,
                  C1_STAR_MC, D1AdjOrTrans_STAR_MR,
-          beta,  E );
+          T(1),  E );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/ScaleTrapezoid.hpp"
 
 #include "./Trrk/Local.hpp"
 #include "./Trrk/NN.hpp"
@@ -9,9 +9,8 @@
 #ifndef BLAS_TRRK_LOCAL_HPP
 #define BLAS_TRRK_LOCAL_HPP
 
-#include "elemental/blas-like/level1/AxpyTriangle.hpp"
-#include "elemental/blas-like/level1/ScaleTrapezoid.hpp"
 #include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Gemmt.hpp"
 
 namespace elem {
 
@@ -270,35 +269,7 @@ TrrkNNKernel
     CallStackEntry entry("TrrkNNKernel");
     CheckInputNN( A, B, C );
 #endif
-    Matrix<T> AT,
-              AB;
-    Matrix<T> BL, BR;
-    Matrix<T> CTL, CTR,
-              CBL, CBR;
-    Matrix<T> DTL, DBR;
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionRight( B, BL, BR, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        Gemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
-    else
-        Gemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
-
-    Gemm( NORMAL, NORMAL, alpha, AT, BL, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    Gemm( NORMAL, NORMAL, alpha, AB, BR, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    Gemmt( uplo, NORMAL, NORMAL, alpha, A, B, beta, C );
 }
 
 // Distributed C := alpha A B + beta C
@@ -314,39 +285,7 @@ LocalTrrkKernel
     CallStackEntry entry("LocalTrrkKernel");
     CheckInput( A, B, C );
 #endif
-    const Grid& g = C.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g), 
-                          AB(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g);
-    DistMatrix<T> CTL(g), CTR(g),
-                  CBL(g), CBR(g);
-    DistMatrix<T> DTL(g), DBR(g);
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionRight( B, BL, BR, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    DTL.AlignWith( CTL );
-    DBR.AlignWith( CBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        LocalGemm( NORMAL, NORMAL, alpha, AB, BL, T(1), CBL );
-    else
-        LocalGemm( NORMAL, NORMAL, alpha, AT, BR, T(1), CTR );
-
-    LocalGemm( NORMAL, NORMAL, alpha, AT, BL, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    LocalGemm( NORMAL, NORMAL, alpha, AB, BR, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, NORMAL, alpha, A, B, beta, C );
 }
 
 // Local C := alpha A B^{T/H} + beta C
@@ -362,38 +301,7 @@ TrrkNTKernel
     CallStackEntry entry("TrrkNTKernel");
     CheckInputNT( orientationOfB, A, B, C );
 #endif
-    Matrix<T> AT,
-              AB;
-    Matrix<T> BT,
-              BB;
-    Matrix<T> CTL, CTR,
-              CBL, CBR;
-    Matrix<T> DTL, DBR;
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionDown
-    ( B, BT, 
-         BB, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        Gemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-    else
-        Gemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-
-    Gemm( NORMAL, orientationOfB, alpha, AT, BT, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    Gemm( NORMAL, orientationOfB, alpha, AB, BB, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    Gemmt( uplo, NORMAL, orientationOfB, alpha, A, B, beta, C );
 }
 
 // Distributed C := alpha A B^{T/H} + beta C
@@ -410,42 +318,7 @@ LocalTrrkKernel
     CallStackEntry entry("LocalTrrkKernel");
     CheckInput( orientationOfB, A, B, C );
 #endif
-    const Grid& g = C.Grid();
-
-    DistMatrix<T,MC,STAR> AT(g),
-                          AB(g);
-    DistMatrix<T,MR,STAR> BT(g), 
-                          BB(g);
-    DistMatrix<T> CTL(g), CTR(g),
-                  CBL(g), CBR(g);
-    DistMatrix<T> DTL(g), DBR(g);
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionDown
-    ( A, AT,
-         AB, half );
-    LockedPartitionDown
-    ( B, BT, 
-         BB, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    DTL.AlignWith( CTL );
-    DBR.AlignWith( CBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        LocalGemm( NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL );
-    else
-        LocalGemm( NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR );
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AT, BT, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    LocalGemm( NORMAL, orientationOfB, alpha, AB, BB, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, NORMAL, orientationOfB, alpha, A, B, beta, C );
 }
 
 // Local C := alpha A^{T/H} B + beta C
@@ -461,32 +334,7 @@ TrrkTNKernel
     CallStackEntry entry("TrrkTNKernel");
     CheckInputTN( orientationOfA, A, B, C );
 #endif
-    Matrix<T> AL, AR;
-    Matrix<T> BL, BR;
-    Matrix<T> CTL, CTR,
-              CBL, CBR;
-    Matrix<T> DTL, DBR;
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionRight( B, BL, BR, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        Gemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-    else
-        Gemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-
-    Gemm( orientationOfA, NORMAL, alpha, AL, BL, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    Gemm( orientationOfA, NORMAL, alpha, AR, BR, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    Gemmt( uplo, orientationOfA, NORMAL, alpha, A, B, beta, C );
 }
 
 // Distributed C := alpha A^{T/H} B + beta C
@@ -503,36 +351,7 @@ LocalTrrkKernel
     CallStackEntry entry("LocalTrrkKernel");
     CheckInput( orientationOfA, A, B, C );
 #endif
-    const Grid& g = C.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g);
-    DistMatrix<T,STAR,MR> BL(g), BR(g);
-    DistMatrix<T> CTL(g), CTR(g),
-                  CBL(g), CBR(g);
-    DistMatrix<T> DTL(g), DBR(g);
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionRight( B, BL, BR, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    DTL.AlignWith( CTL );
-    DBR.AlignWith( CBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        LocalGemm( orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL );
-    else
-        LocalGemm( orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR );
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AL, BL, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    LocalGemm( orientationOfA, NORMAL, alpha, AR, BR, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, NORMAL, alpha, A, B, beta, C );
 }
 
 // Local C := alpha A^{T/H} B^{T/H} + beta C
@@ -549,35 +368,7 @@ TrrkTTKernel
     CallStackEntry entry("TrrkTTKernel");
     CheckInputTT( orientationOfA, orientationOfB, A, B, C );
 #endif
-    Matrix<T> AL, AR;
-    Matrix<T> BT,
-              BB;
-    Matrix<T> CTL, CTR,
-              CBL, CBR;
-    Matrix<T> DTL, DBR;
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionDown
-    ( B, BT, 
-         BB, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        Gemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-    else
-        Gemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
-
-    Gemm( orientationOfA, orientationOfB, alpha, AL, BT, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    Gemm( orientationOfA, orientationOfB, alpha, AR, BB, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    Gemmt( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, C );
 }
 
 // Distributed C := alpha A^{T/H} B^{T/H} + beta C
@@ -595,39 +386,7 @@ LocalTrrkKernel
     CallStackEntry entry("LocalTrrkKernel");
     CheckInput( orientationOfA, orientationOfB, A, B, C );
 #endif
-    const Grid& g = C.Grid();
-
-    DistMatrix<T,STAR,MC> AL(g), AR(g);
-    DistMatrix<T,MR,STAR> BT(g), 
-                          BB(g);
-    DistMatrix<T> CTL(g), CTR(g),
-                  CBL(g), CBR(g);
-    DistMatrix<T> DTL(g), DBR(g);
-
-    const int half = C.Height()/2;
-    ScaleTrapezoid( beta, uplo, C );
-    LockedPartitionRight( A, AL, AR, half );
-    LockedPartitionDown
-    ( B, BT, 
-         BB, half );
-    PartitionDownDiagonal
-    ( C, CTL, CTR,
-         CBL, CBR, half );
-
-    DTL.AlignWith( CTL );
-    DBR.AlignWith( CBR );
-    //------------------------------------------------------------------------//
-    if( uplo == LOWER )
-        LocalGemm( orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL );
-    else
-        LocalGemm( orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR );
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AL, BT, DTL );
-    AxpyTriangle( uplo, T(1), DTL, CTL );
-
-    LocalGemm( orientationOfA, orientationOfB, alpha, AR, BB, DBR );
-    AxpyTriangle( uplo, T(1), DBR, CBR );
-    //------------------------------------------------------------------------//
+    LocalGemmt( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, C );
 }
 
 } // namespace trrk
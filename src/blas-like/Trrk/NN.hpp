@@ -46,6 +46,7 @@ void TrrkNN
     LockedPartitionDown
     ( B, BT,
          BB, 0 );
+    ScaleTrapezoid( beta, uplo, C );
     while( AL.Width() < A.Width() )
     {
         LockedRepartitionRight
@@ -61,7 +62,7 @@ void TrrkNN
         A1_MC_STAR = A1;
         B1Trans_MR_STAR.TransposeFrom( B1 );
         LocalTrrk
-        ( uplo, TRANSPOSE, alpha, A1_MC_STAR, B1Trans_MR_STAR, beta, C );
+        ( uplo, TRANSPOSE, alpha, A1_MC_STAR, B1Trans_MR_STAR, T(1), C );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
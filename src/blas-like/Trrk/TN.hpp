@@ -52,6 +52,7 @@ void TrrkTN
     LockedPartitionDown
     ( B, BT,
          BB, 0 );
+    ScaleTrapezoid( beta, uplo, C );
     while( AT.Height() < A.Height() )
     {
         LockedRepartitionDown
@@ -70,7 +71,7 @@ void TrrkTN
         B1Trans_MR_STAR.TransposeFrom( B1 );
         LocalTrrk
         ( uplo, orientationOfA, TRANSPOSE, 
-          alpha, A1_STAR_MC, B1Trans_MR_STAR, beta, C );
+          alpha, A1_STAR_MC, B1Trans_MR_STAR, T(1), C );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
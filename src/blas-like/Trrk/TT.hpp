@@ -51,7 +51,8 @@ void TrrkTT
     ( A, AT,
          AB, 0 );
     LockedPartitionRight( B, BL, BR, 0 );
-    while( AT.Width() < A.Height() )
+    ScaleTrapezoid( beta, uplo, C );
+    while( AT.Height() < A.Height() )
     {
         LockedRepartitionDown
         ( AT,  A0,
@@ -71,7 +72,7 @@ void TrrkTT
             B1AdjOrTrans_STAR_MR.TransposeFrom( B1_VR_STAR );
         LocalTrrk
         ( uplo, orientationOfA,
-          alpha, A1_STAR_MC, B1AdjOrTrans_STAR_MR, beta, C );
+          alpha, A1_STAR_MC, B1AdjOrTrans_STAR_MR, T(1), C );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -26,6 +26,12 @@ double minRealWindowVal, maxRealWindowVal,
        minImagWindowVal, maxImagWindowVal;
 #endif
 std::stack<int> blocksizeStack;
+bool nodeSharedReplicas = false;
+unsigned randomSeed = 0;
+unsigned randomSeedEpoch = 0;
+unsigned localRandomStreamCount = 0;
+unsigned localRandomSampleCount = 0;
+unsigned localRandomOwner = 1;
 elem::Grid* defaultGrid = 0;
 elem::MpiArgs* args = 0;
 
@@ -202,17 +208,22 @@ void Initialize( int& argc, char**& argv )
     CreatePivotOp<Complex<float> >();
     CreatePivotOp<Complex<double> >();
 
+    // Build the operations used for reducing sums of squares without overflow
+    CreateScaledSquareOp<float>();
+    CreateScaledSquareOp<double>();
+
     // Seed the random number generators using Katzgrabber's approach
-    // from "Random Numbers in Scientific Computing: An Introduction"
-    // NOTE: srand no longer needed after C++11
+    // from "Random Numbers in Scientific Computing: An Introduction",
+    // but only on the root, so that every process shares the same seed
     const unsigned rank = mpi::CommRank( mpi::COMM_WORLD );
     const long secs = time(NULL);
-    const long seed = abs(((secs*181)*((rank-83)*359))%104729);
-#ifdef WIN32
-    srand( seed );
-#else
-    srand48( seed );
-#endif
+    int seed = abs(((secs*181)*((rank-83)*359))%104729);
+    mpi::Broadcast( &seed, 1, 0, mpi::COMM_WORLD );
+    ::randomSeed = seed;
+    ++::randomSeedEpoch;
+    ::localRandomStreamCount = 0;
+    ::localRandomSampleCount = 0;
+    ::localRandomOwner = rank + 1;
 }
 
 void Finalize()
@@ -242,6 +253,10 @@ void Finalize()
             DestroyPivotOp<Complex<float> >();
             DestroyPivotOp<Complex<double> >();
 
+            // Destroy the operations for reducing sums of squares
+            DestroyScaledSquareOp<float>();
+            DestroyScaledSquareOp<double>();
+
             // Delete the default grid
             delete ::defaultGrid;
             ::defaultGrid = 0;
@@ -286,6 +301,57 @@ void PushBlocksizeStack( int blocksize )
 void PopBlocksizeStack()
 { ::blocksizeStack.pop(); }
 
+bool NodeSharedReplicas()
+{ return ::nodeSharedReplicas; }
+
+void SetNodeSharedReplicas( bool share )
+{ ::nodeSharedReplicas = share; }
+
+unsigned RandomSeed()
+{ return ::randomSeed; }
+
+void SetRandomSeed( unsigned seed )
+{
+    ::randomSeed = seed;
+    ++::randomSeedEpoch;
+    ::localRandomStreamCount = 0;
+    ::localRandomSampleCount = 0;
+}
+
+RandomStream NewDistRandomStream( const Grid& g )
+{
+    RandomStream stream;
+    stream.id = g.NextRandomStreamId( ::randomSeedEpoch );
+    stream.index = 0;
+    stream.owner = 0;
+    stream.seed = ::randomSeed;
+    return stream;
+}
+
+RandomStream NewLocalRandomStream()
+{
+    RandomStream stream;
+    stream.id = ::localRandomStreamCount++;
+    stream.index = 0;
+    stream.owner = ::localRandomOwner;
+    stream.seed = ::randomSeed;
+    return stream;
+}
+
+// The scalar samples are drawn from a local stream whose id is the largest
+// unsigned integer, with the sample count used as the row index
+double Uniform()
+{
+    RandomStream stream;
+    stream.id = ~0u;
+    stream.index = 0;
+    stream.owner = ::localRandomOwner;
+    stream.seed = ::randomSeed;
+    double u, uUnused;
+    SampleUniformPair( stream, int(::localRandomSampleCount++), 0, u, uUnused );
+    return u;
+}
+
 const Grid& DefaultGrid()
 {
 #ifndef RELEASE
@@ -294,6 +294,37 @@ void BLAS(zgemm)
   const elem::dcomplex* beta,
         elem::dcomplex* C, const int* ldc );
 
+#ifdef HAVE_GEMMT
+void BLAS(sgemmt)
+( const char* uplo, const char* transA, const char* transB,
+  const int* n, const int* k,
+  const float* alpha, const float* A, const int* lda,
+                      const float* B, const int* ldb,
+  const float* beta,        float* C, const int* ldc );
+void BLAS(dgemmt)
+( const char* uplo, const char* transA, const char* transB,
+  const int* n, const int* k,
+  const double* alpha, const double* A, const int* lda,
+                       const double* B, const int* ldb,
+  const double* beta,        double* C, const int* ldc );
+void BLAS(cgemmt)
+( const char* uplo, const char* transA, const char* transB,
+  const int* n, const int* k,
+  const elem::scomplex* alpha,
+  const elem::scomplex* A, const int* lda,
+  const elem::scomplex* B, const int* ldb,
+  const elem::scomplex* beta,
+        elem::scomplex* C, const int* ldc );
+void BLAS(zgemmt)
+( const char* uplo, const char* transA, const char* transB,
+  const int* n, const int* k,
+  const elem::dcomplex* alpha,
+  const elem::dcomplex* A, const int* lda,
+  const elem::dcomplex* B, const int* ldb,
+  const elem::dcomplex* beta,
+        elem::dcomplex* C, const int* ldc );
+#endif // ifdef HAVE_GEMMT
+
 void BLAS(chemm)
 ( const char* side, const char* uplo,
   const int* m, const int* n,
@@ -957,6 +988,48 @@ void Gemm
                  &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
 }
 
+#ifdef HAVE_GEMMT
+void Gemmt
+( char uplo, char transA, char transB, int n, int k, 
+  float alpha, const float* A, int lda, const float* B, int ldb,
+  float beta,        float* C, int ldc )
+{
+    const char fixedTransA = ( transA == 'C' ? 'T' : transA );
+    const char fixedTransB = ( transB == 'C' ? 'T' : transB );
+    BLAS(sgemmt)( &uplo, &fixedTransA, &fixedTransB, &n, &k,
+                  &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+void Gemmt
+( char uplo, char transA, char transB, int n, int k, 
+  double alpha, const double* A, int lda, const double* B, int ldb,
+  double beta,        double* C, int ldc )
+{
+    const char fixedTransA = ( transA == 'C' ? 'T' : transA );
+    const char fixedTransB = ( transB == 'C' ? 'T' : transB );
+    BLAS(dgemmt)( &uplo, &fixedTransA, &fixedTransB, &n, &k,
+                  &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+void Gemmt
+( char uplo, char transA, char transB, int n, int k, 
+  scomplex alpha, const scomplex* A, int lda, const scomplex* B, int ldb,
+  scomplex beta,        scomplex* C, int ldc )
+{
+    BLAS(cgemmt)( &uplo, &transA, &transB, &n, &k,
+                  &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+void Gemmt
+( char uplo, char transA, char transB, int n, int k, 
+  dcomplex alpha, const dcomplex* A, int lda, const dcomplex* B, int ldb,
+  dcomplex beta,        dcomplex* C, int ldc )
+{
+    BLAS(zgemmt)( &uplo, &transA, &transB, &n, &k,
+                  &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+#endif // ifdef HAVE_GEMMT
+
 void Hemm
 ( char side, char uplo, int m, int n,
   float alpha, const float* A, int lda, const float* B, int ldb,
@@ -1076,6 +1076,158 @@ void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w )
     }
 }
 
+//
+// Compute the Schur decomposition of an upper Hessenberg matrix
+//
+
+void HessenbergSchur
+( int n, float* H, int ldh, scomplex* w, float* Q, int ldq, 
+  bool fullTriangle, bool multiplyQ )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lapack::HessenbergSchur");
+#endif
+    if( n == 0 )
+        return;
+
+    const char job=(fullTriangle?'S':'E'), compz=(multiplyQ?'V':'I');
+    int ilo=1, ihi=n;
+    int lwork=-1, info;
+    float dummyWork;
+    std::vector<float> wr( n ), wi( n );
+    LAPACK(shseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, &wr[0], &wi[0], Q, &ldq,
+      &dummyWork, &lwork, &info );
+
+    lwork = dummyWork;
+    std::vector<float> work(lwork);
+    LAPACK(shseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, &wr[0], &wi[0], Q, &ldq,
+      &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("shseqr's failed to compute all eigenvalues");
+    }
+    
+    for( int i=0; i<n; ++i )
+        w[i] = elem::Complex<float>(wr[i],wi[i]);
+}
+
+void HessenbergSchur
+( int n, double* H, int ldh, dcomplex* w, double* Q, int ldq, 
+  bool fullTriangle, bool multiplyQ )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lapack::HessenbergSchur");
+#endif
+    if( n == 0 )
+        return;
+
+    const char job=(fullTriangle?'S':'E'), compz=(multiplyQ?'V':'I');
+    int ilo=1, ihi=n;
+    int lwork=-1, info;
+    double dummyWork;
+    std::vector<double> wr( n ), wi( n );
+    LAPACK(dhseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, &wr[0], &wi[0], Q, &ldq,
+      &dummyWork, &lwork, &info );
+
+    lwork = dummyWork;
+    std::vector<double> work(lwork);
+    LAPACK(dhseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, &wr[0], &wi[0], Q, &ldq,
+      &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("dhseqr's failed to compute all eigenvalues");
+    }
+    
+    for( int i=0; i<n; ++i )
+        w[i] = elem::Complex<double>(wr[i],wi[i]);
+}
+
+void HessenbergSchur
+( int n, scomplex* H, int ldh, scomplex* w, scomplex* Q, int ldq, 
+  bool fullTriangle, bool multiplyQ )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lapack::HessenbergSchur");
+#endif
+    if( n == 0 )
+        return;
+
+    const char job=(fullTriangle?'S':'E'), compz=(multiplyQ?'V':'I');
+    int ilo=1, ihi=n;
+    int lwork=-1, info;
+    scomplex dummyWork;
+    LAPACK(chseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, w, Q, &ldq,
+      &dummyWork, &lwork, &info );
+
+    lwork = dummyWork.real;
+    std::vector<scomplex> work(lwork);
+    LAPACK(chseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, w, Q, &ldq,
+      &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("chseqr's failed to compute all eigenvalues");
+    }
+}
+
+void HessenbergSchur
+( int n, dcomplex* H, int ldh, dcomplex* w, dcomplex* Q, int ldq, 
+  bool fullTriangle, bool multiplyQ )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lapack::HessenbergSchur");
+#endif
+    if( n == 0 )
+        return;
+
+    const char job=(fullTriangle?'S':'E'), compz=(multiplyQ?'V':'I');
+    int ilo=1, ihi=n;
+    int lwork=-1, info;
+    dcomplex dummyWork;
+    LAPACK(zhseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, w, Q, &ldq,
+      &dummyWork, &lwork, &info );
+
+    lwork = dummyWork.real;
+    std::vector<dcomplex> work(lwork);
+    LAPACK(zhseqr)
+    ( &job, &compz, &n, &ilo, &ihi, H, &ldh, w, Q, &ldq,
+      &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        throw std::runtime_error("zhseqr's failed to compute all eigenvalues");
+    }
+}
+
 int HermitianEig
 ( char job, char range, char uplo, int n, float* A, int lda, 
   float vl, float vu, int il, int iu, float abstol, 
@@ -183,6 +183,43 @@ void CommSplit( Comm comm, int color, int key, Comm& newComm )
     SafeMpi( MPI_Comm_split( comm, color, key, &newComm ) );
 }
 
+void CommSplitNode( Comm comm, Comm& nodeComm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::CommSplitNode");
+#endif
+    const int rank = CommRank( comm );
+#ifdef HAVE_MPI_COMM_SPLIT_TYPE
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm ) );
+#else
+    // Assume that the processes with the same processor name share a node
+    const int size = CommSize( comm );
+    char name[MPI_MAX_PROCESSOR_NAME];
+    std::memset( name, 0, MPI_MAX_PROCESSOR_NAME );
+    int nameLength;
+    SafeMpi( MPI_Get_processor_name( name, &nameLength ) );
+    std::vector<char> names( size*MPI_MAX_PROCESSOR_NAME );
+    SafeMpi
+    ( MPI_Allgather
+      ( name, MPI_MAX_PROCESSOR_NAME, MPI_CHAR, 
+        &names[0], MPI_MAX_PROCESSOR_NAME, MPI_CHAR, comm ) );
+    int color = rank;
+    for( int q=0; q<rank; ++q )
+    {
+        if( std::strncmp
+            ( &names[q*MPI_MAX_PROCESSOR_NAME], name, 
+              MPI_MAX_PROCESSOR_NAME ) == 0 )
+        {
+            color = q;
+            break;
+        }
+    }
+    CommSplit( comm, color, rank, nodeComm );
+#endif
+}
+
 void CommFree( Comm& comm )
 {
 #ifndef RELEASE
@@ -710,6 +747,298 @@ template void SendRecv
 ( Complex<double>* buf, int sc, int to, int stag, 
   int from, int rtag, Comm comm );
 
+//------------------------------------------//
+// One-sided communication (passive target) //
+//------------------------------------------//
+
+void WindowCreate
+( void* baseAddress, std::size_t numBytes, int dispUnit, Comm comm, 
+  Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowCreate");
+#endif
+    SafeMpi( 
+        MPI_Win_create
+        ( baseAddress, MPI_Aint(numBytes), dispUnit, MPI_INFO_NULL, comm, 
+          &window ) 
+    );
+}
+
+void WindowFree( Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowFree");
+#endif
+    SafeMpi( MPI_Win_free( &window ) );
+}
+
+void WindowLock( int rank, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowLock");
+#endif
+    SafeMpi( MPI_Win_lock( MPI_LOCK_SHARED, rank, 0, window ) );
+}
+
+void WindowUnlock( int rank, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowUnlock");
+#endif
+    SafeMpi( MPI_Win_unlock( rank, window ) );
+}
+
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+void WindowAllocateShared( std::size_t numBytes, Comm comm, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowAllocateShared");
+#endif
+    void* baseAddress;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( MPI_Aint(numBytes), 1, MPI_INFO_NULL, comm, &baseAddress, 
+        &window ) );
+}
+
+void* WindowSharedQuery( int rank, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowSharedQuery");
+#endif
+    MPI_Aint numBytes;
+    int dispUnit;
+    void* baseAddress;
+    SafeMpi
+    ( MPI_Win_shared_query
+      ( window, rank, &numBytes, &dispUnit, &baseAddress ) );
+    return baseAddress;
+}
+
+void WindowLockAll( Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowLockAll");
+#endif
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window ) );
+}
+
+void WindowUnlockAll( Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowUnlockAll");
+#endif
+    SafeMpi( MPI_Win_unlock_all( window ) );
+}
+
+void WindowSync( Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::WindowSync");
+#endif
+    SafeMpi( MPI_Win_sync( window ) );
+}
+#endif // ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+
+void FileOpen
+( Comm comm, const std::string& filename, bool deleteOnClose, File& file )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::FileOpen");
+#endif
+    int mode = MPI_MODE_RDWR | MPI_MODE_CREATE;
+    if( deleteOnClose )
+        mode |= MPI_MODE_DELETE_ON_CLOSE;
+    SafeMpi
+    ( MPI_File_open
+      ( comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL,
+        &file ) );
+}
+
+void FileClose( File& file )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::FileClose");
+#endif
+    SafeMpi( MPI_File_close( &file ) );
+}
+
+void FileSetSize( File& file, Offset numBytes )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::FileSetSize");
+#endif
+    SafeMpi( MPI_File_set_size( file, numBytes ) );
+}
+
+void FileIReadAt
+( File& file, Offset offset, void* buf, int numBytes, Request& request )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::FileIReadAt");
+#endif
+    SafeMpi
+    ( MPI_File_iread_at( file, offset, buf, numBytes, MPI_BYTE, &request ) );
+}
+
+void FileIWriteAt
+( File& file, Offset offset, const void* buf, int numBytes,
+  Request& request )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::FileIWriteAt");
+#endif
+    SafeMpi
+    ( MPI_File_iwrite_at
+      ( file, offset, const_cast<void*>(buf), numBytes, MPI_BYTE,
+        &request ) );
+}
+
+template<typename R>
+void Accumulate
+( const R* buf, int numBlocks, const int* blockLengths, const int* displs,
+  Op op, int rank, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::Accumulate");
+#endif
+    if( numBlocks == 0 )
+        return;
+    int count = 0;
+    for( int k=0; k<numBlocks; ++k )
+        count += blockLengths[k];
+
+    MpiMap<R> map;
+    Datatype targetType;
+    SafeMpi( 
+        MPI_Type_indexed
+        ( numBlocks, const_cast<int*>(blockLengths), const_cast<int*>(displs),
+          map.type, &targetType )
+    );
+    SafeMpi( MPI_Type_commit( &targetType ) );
+    SafeMpi(
+        MPI_Accumulate
+        ( const_cast<R*>(buf), count, map.type, rank, 0, 1, targetType, 
+          op, window )
+    );
+    SafeMpi( MPI_Type_free( &targetType ) );
+}
+
+template<typename R>
+void Accumulate
+( const Complex<R>* buf, int numBlocks, const int* blockLengths, 
+  const int* displs, Op op, int rank, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::Accumulate");
+#endif
+    if( numBlocks == 0 )
+        return;
+#ifdef AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        std::vector<int> blockLengthsDoubled(numBlocks), 
+                         displsDoubled(numBlocks);
+        for( int k=0; k<numBlocks; ++k )
+        {
+            blockLengthsDoubled[k] = 2*blockLengths[k];
+            displsDoubled[k] = 2*displs[k];
+        }
+        Accumulate
+        ( reinterpret_cast<const R*>(buf), numBlocks, 
+          &blockLengthsDoubled[0], &displsDoubled[0], op, rank, window );
+        return;
+    }
+#endif
+    int count = 0;
+    for( int k=0; k<numBlocks; ++k )
+        count += blockLengths[k];
+
+    MpiMap<Complex<R> > map;
+    Datatype targetType;
+    SafeMpi( 
+        MPI_Type_indexed
+        ( numBlocks, const_cast<int*>(blockLengths), const_cast<int*>(displs),
+          map.type, &targetType )
+    );
+    SafeMpi( MPI_Type_commit( &targetType ) );
+    SafeMpi(
+        MPI_Accumulate
+        ( const_cast<Complex<R>*>(buf), count, map.type, rank, 0, 1, 
+          targetType, op, window )
+    );
+    SafeMpi( MPI_Type_free( &targetType ) );
+}
+
+template void Accumulate( const byte* buf, int numBlocks, const int* blockLengths, const int* displs, Op op, int rank, Window& window );
+template void Accumulate( const int* buf, int numBlocks, const int* blockLengths, const int* displs, Op op, int rank, Window& window );
+template void Accumulate( const float* buf, int numBlocks, const int* blockLengths, const int* displs, Op op, int rank, Window& window );
+template void Accumulate( const double* buf, int numBlocks, const int* blockLengths, const int* displs, Op op, int rank, Window& window );
+template void Accumulate( const Complex<float>* buf, int numBlocks, const int* blockLengths, const int* displs, Op op, int rank, Window& window );
+template void Accumulate( const Complex<double>* buf, int numBlocks, const int* blockLengths, const int* displs, Op op, int rank, Window& window );
+
+template<typename R>
+void Get
+( R* buf, int height, int width, int ldim, int displ, 
+  int rank, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::Get");
+#endif
+    if( height == 0 || width == 0 )
+        return;
+    MpiMap<R> map;
+    Datatype targetType;
+    SafeMpi( MPI_Type_vector( width, height, ldim, map.type, &targetType ) );
+    SafeMpi( MPI_Type_commit( &targetType ) );
+    SafeMpi(
+        MPI_Get
+        ( buf, height*width, map.type, rank, displ, 1, targetType, window )
+    );
+    SafeMpi( MPI_Type_free( &targetType ) );
+}
+
+template<typename R>
+void Get
+( Complex<R>* buf, int height, int width, int ldim, int displ, 
+  int rank, Window& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::Get");
+#endif
+    if( height == 0 || width == 0 )
+        return;
+    Datatype targetType;
+#ifdef AVOID_COMPLEX_MPI
+    MpiMap<R> map;
+    SafeMpi( 
+        MPI_Type_vector( width, 2*height, 2*ldim, map.type, &targetType ) 
+    );
+    SafeMpi( MPI_Type_commit( &targetType ) );
+    SafeMpi(
+        MPI_Get
+        ( buf, 2*height*width, map.type, rank, displ, 1, targetType, window )
+    );
+#else
+    MpiMap<Complex<R> > map;
+    SafeMpi( MPI_Type_vector( width, height, ldim, map.type, &targetType ) );
+    SafeMpi( MPI_Type_commit( &targetType ) );
+    SafeMpi(
+        MPI_Get
+        ( buf, height*width, map.type, rank, displ, 1, targetType, window )
+    );
+#endif
+    SafeMpi( MPI_Type_free( &targetType ) );
+}
+
+template void Get( byte* buf, int height, int width, int ldim, int displ, int rank, Window& window );
+template void Get( int* buf, int height, int width, int ldim, int displ, int rank, Window& window );
+template void Get( float* buf, int height, int width, int ldim, int displ, int rank, Window& window );
+template void Get( double* buf, int height, int width, int ldim, int displ, int rank, Window& window );
+template void Get( Complex<float>* buf, int height, int width, int ldim, int displ, int rank, Window& window );
+template void Get( Complex<double>* buf, int height, int width, int ldim, int displ, int rank, Window& window );
+
 template<typename R>
 void Broadcast( R* buf, int count, int root, Comm comm )
 {
@@ -750,7 +1079,9 @@ void IBroadcast( R* buf, int count, int root, Comm comm, Request& request )
     CallStackEntry entry("mpi::IBroadcast");
 #endif
     MpiMap<R> map;
-    SafeMpi( MPI_Ibcast( buf, count, map.type, root, comm, &request ) );
+    SafeMpi(
+        NONBLOCKING_COLL(Ibcast)( buf, count, map.type, root, comm, &request )
+    );
 }
 
 template<typename R>
@@ -762,10 +1093,14 @@ void IBroadcast
 #endif
 #ifdef AVOID_COMPLEX_MPI
     MpiMap<R> map;
-    SafeMpi( MPI_Ibcast( buf, 2*count, map.type, root, comm, &request ) );
+    SafeMpi(
+        NONBLOCKING_COLL(Ibcast)( buf, 2*count, map.type, root, comm, &request )
+    );
 #else
     MpiMap<Complex<R> > map;
-    SafeMpi( MPI_Ibcast( buf, count, map.type, root, comm, &request ) );
+    SafeMpi(
+        NONBLOCKING_COLL(Ibcast)( buf, count, map.type, root, comm, &request )
+    );
 #endif
 }
 
@@ -836,7 +1171,7 @@ void IGather
 #endif
     MpiMap<R> map;
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<R*>(sbuf), sc, map.type,
           rbuf,                 rc, map.type, root, comm, &request )
     );
@@ -853,7 +1188,7 @@ void IGather
 #ifdef AVOID_COMPLEX_MPI
     MpiMap<R> map;
     SafeMpi(
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<Complex<R>*>(sbuf), 2*sc, map.type,
           rbuf,                          2*rc, map.type, 
           root, comm, &request )
@@ -861,7 +1196,7 @@ void IGather
 #else
     MpiMap<Complex<R> > map;
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<Complex<R>*>(sbuf), sc, map.type,
           rbuf,                          rc, map.type, 
           root, comm, &request ) 
@@ -1812,6 +2147,78 @@ template void AllReduce( ValueInt<int>* buf, int count, Op op, Comm comm );
 template void AllReduce( ValueInt<float>* buf, int count, Op op, Comm comm );
 template void AllReduce( ValueInt<double>* buf, int count, Op op, Comm comm );
 
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::IAllReduce");
+#endif
+    MpiMap<T> map;
+    SafeMpi(
+        NONBLOCKING_COLL(Iallreduce)
+        ( const_cast<T*>(sbuf), rbuf, count, map.type, op, comm, &request )
+    );
+}
+
+template<typename R>
+void IAllReduce
+( const Complex<R>* sbuf, Complex<R>* rbuf, int count, Op op, Comm comm,
+  Request& request )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::IAllReduce");
+#endif
+#ifdef AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MpiMap<R> map;
+        SafeMpi(
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<Complex<R>*>(sbuf),
+              rbuf, 2*count, map.type, op, comm, &request )
+        );
+    }
+    else
+    {
+        MpiMap<Complex<R> > map;
+        SafeMpi(
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<Complex<R>*>(sbuf),
+              rbuf, count, map.type, op, comm, &request )
+        );
+    }
+#else
+    MpiMap<Complex<R> > map;
+    SafeMpi(
+        NONBLOCKING_COLL(Iallreduce)
+        ( const_cast<Complex<R>*>(sbuf),
+          rbuf, count, map.type, op, comm, &request )
+    );
+#endif
+}
+
+template void IAllReduce
+( const byte* sbuf, byte* rbuf, int count, Op op, Comm comm,
+  Request& request );
+template void IAllReduce
+( const int* sbuf, int* rbuf, int count, Op op, Comm comm,
+  Request& request );
+template void IAllReduce
+( const float* sbuf, float* rbuf, int count, Op op, Comm comm,
+  Request& request );
+template void IAllReduce
+( const double* sbuf, double* rbuf, int count, Op op, Comm comm,
+  Request& request );
+template void IAllReduce
+( const Complex<float>* sbuf, Complex<float>* rbuf, int count, Op op,
+  Comm comm, Request& request );
+template void IAllReduce
+( const Complex<double>* sbuf, Complex<double>* rbuf, int count, Op op,
+  Comm comm, Request& request );
+#endif // ifdef HAVE_NONBLOCKING_COLLECTIVES
+
 template<typename R>
 void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
 {
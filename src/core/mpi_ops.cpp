@@ -17,6 +17,10 @@ elem::mpi::Op pivotOpFloat;
 elem::mpi::Op pivotOpDouble;
 elem::mpi::Op pivotOpScomplex;
 elem::mpi::Op pivotOpDcomplex;
+bool createdScaledSquareOpFloat = false;
+bool createdScaledSquareOpDouble = false;
+elem::mpi::Op scaledSquareOpFloat;
+elem::mpi::Op scaledSquareOpDouble;
 }   
 
 namespace elem {
@@ -198,6 +202,112 @@ mpi::Op PivotOp<Complex<double> >()
     return ::pivotOpDcomplex;
 }
 
+template<typename R>
+void
+ScaledSquareFunc
+( void* inData, void* outData, int* length, mpi::Datatype* datatype )
+{
+    const Complex<R>* inPairs = (const Complex<R>*)inData;
+    Complex<R>* outPairs = (Complex<R>*)outData;
+    for( int k=0; k<*length; ++k )
+    {
+        const R inScale = inPairs[k].real;
+        const R inScaledSquare = inPairs[k].imag;
+        R& outScale = outPairs[k].real;
+        R& outScaledSquare = outPairs[k].imag;
+        if( inScale == 0 )
+            continue;
+        if( inScale <= outScale )
+        {
+            const R relScale = inScale/outScale;
+            outScaledSquare += inScaledSquare*relScale*relScale;
+        }
+        else
+        {
+            const R relScale = outScale/inScale;
+            outScaledSquare =
+                inScaledSquare + outScaledSquare*relScale*relScale;
+            outScale = inScale;
+        }
+    }
+}
+
+template<>
+void CreateScaledSquareOp<float>()
+{
+#ifndef RELEASE
+    CallStackEntry entry("CreateScaledSquareOp<float>");
+    if( ::createdScaledSquareOpFloat )
+        throw std::logic_error("Already created scaled square op");
+#endif
+    mpi::OpCreate
+    ( (mpi::UserFunction*)ScaledSquareFunc<float>, true, 
+      ::scaledSquareOpFloat );
+    ::createdScaledSquareOpFloat = true;
+}
+
+template<>
+void CreateScaledSquareOp<double>()
+{
+#ifndef RELEASE
+    CallStackEntry entry("CreateScaledSquareOp<double>");
+    if( ::createdScaledSquareOpDouble )
+        throw std::logic_error("Already created scaled square op");
+#endif
+    mpi::OpCreate
+    ( (mpi::UserFunction*)ScaledSquareFunc<double>, true, 
+      ::scaledSquareOpDouble );
+    ::createdScaledSquareOpDouble = true;
+}
+
+template<>
+void DestroyScaledSquareOp<float>()
+{
+#ifndef RELEASE
+    CallStackEntry entry("DestroyScaledSquareOp<float>");
+    if( ! ::createdScaledSquareOpFloat )
+        throw std::logic_error("Have not created this scaled square op");
+#endif
+    if( ::createdScaledSquareOpFloat )
+        mpi::OpFree( ::scaledSquareOpFloat );
+    ::createdScaledSquareOpFloat = false;
+}
+
+template<>
+void DestroyScaledSquareOp<double>()
+{
+#ifndef RELEASE
+    CallStackEntry entry("DestroyScaledSquareOp<double>");
+    if( ! ::createdScaledSquareOpDouble )
+        throw std::logic_error("Have not created this scaled square op");
+#endif
+    if( ::createdScaledSquareOpDouble )
+        mpi::OpFree( ::scaledSquareOpDouble );
+    ::createdScaledSquareOpDouble = false;
+}
+
+template<>
+mpi::Op ScaledSquareOp<float>()
+{
+#ifndef RELEASE
+    CallStackEntry entry("ScaledSquareOp<float>");
+    if( ! ::createdScaledSquareOpFloat )
+        throw std::logic_error("Tried to return uncreated scaled square op");
+#endif
+    return ::scaledSquareOpFloat;
+}
+
+template<>
+mpi::Op ScaledSquareOp<double>()
+{
+#ifndef RELEASE
+    CallStackEntry entry("ScaledSquareOp<double>");
+    if( ! ::createdScaledSquareOpDouble )
+        throw std::logic_error("Tried to return uncreated scaled square op");
+#endif
+    return ::scaledSquareOpDouble;
+}
+
 template void
 PivotFunc<float>
 ( void* inData, void* outData, int* length, mpi::Datatype* datatype );
@@ -214,4 +324,12 @@ template void
 PivotFunc<elem::Complex<double> >
 ( void* inData, void* outData, int* length, mpi::Datatype* datatype );
 
+template void
+ScaledSquareFunc<float>
+( void* inData, void* outData, int* length, mpi::Datatype* datatype );
+
+template void
+ScaledSquareFunc<double>
+( void* inData, void* outData, int* length, mpi::Datatype* datatype );
+
 } // namespace elem
@@ -46,8 +46,8 @@ void LSquare( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
 
     // Temporary distributions
     DistMatrix<F> WPan(g);
-    DistMatrix<F,STAR,STAR> t1_STAR_STAR(g);
-    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    SharedStarStar<F> t1_STAR_STAR(g);
+    SharedStarStar<F> A11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g),  A11_MC_STAR(g),
                                               A21_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g),  A11_MR_STAR(g),
@@ -120,11 +120,19 @@ void LSquare( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
             A11_STAR_STAR = A11;
             t1_STAR_STAR.ResizeTo( t1.Height(), 1 );
 
-            HermitianTridiag
-            ( LOWER, A11_STAR_STAR.Matrix(), t1_STAR_STAR.Matrix() );
-
-            A11 = A11_STAR_STAR;
-            t1 = t1_STAR_STAR;
+            try
+            {
+                if( A11_STAR_STAR.NodeLeader() )
+                    HermitianTridiag
+                    ( LOWER, A11_STAR_STAR.Replica().Matrix(),
+                      t1_STAR_STAR.Replica().Matrix() );
+            }
+            catch( std::exception& e ) { A11_STAR_STAR.Fail( e ); }
+            A11_STAR_STAR.Synchronize();
+            t1_STAR_STAR.Synchronize();
+
+            A11 = A11_STAR_STAR.LockedReplica();
+            t1 = t1_STAR_STAR.LockedReplica();
         }
 
         SlidePartitionDown
@@ -132,8 +132,6 @@ AbDMT(T,int,LocalWidth)
 AbDMT(T,int,LDim)
 AbDMT(T,size_t,AllocatedMemory)
 %attribute_custom(%arg(elem::AbstractDistMatrix<T,int>),elem::Grid,Grid,Grid,SetGrid,&self_->Grid(),self_->SetGrid(*val_))
-%attribute_readonly(%arg(elem::AbstractDistMatrix<T,int>),PyObject*,Matrix,Matrix,create_npmatrix(self_->Matrix(),true))
-%attribute_readonly(%arg(elem::AbstractDistMatrix<T,int>),PyObject*,LockedMatrix,LockedMatrix,create_npmatrix(self_->LockedMatrix(),false))
 AbDMT(T,bool,ConstrainedColAlignment)
 AbDMT(T,bool,ConstrainedRowAlignment)
 AbDMT(T,int,ColAlignment)
@@ -168,6 +166,30 @@ namespace elem {
 %template(AbstractDistMatrix_z) AbstractDistMatrix<Complex<double>,int>;
 };
 
+// The Matrix and LockedMatrix attributes are NumPy views of the local data
+// which hold a reference to the distributed matrix, so that its buffer
+// cannot be freed while a view is still alive
+%define AbDMNumPy(T)
+%extend elem::AbstractDistMatrix<T,int> {
+	PyObject* _LocalMatrix( PyObject* owner, bool writable ) {
+		if( writable )
+			return create_npmatrix( $self->Matrix(), true, owner );
+		else
+			return create_npmatrix( $self->LockedMatrix(), false, owner );
+	}
+	%pythoncode %{
+	Matrix = property(lambda self: self._LocalMatrix(self,True))
+	LockedMatrix = property(lambda self: self._LocalMatrix(self,False))
+	%}
+}
+%enddef
+AbDMNumPy(int)
+AbDMNumPy(float)
+AbDMNumPy(double)
+AbDMNumPy(elem::Complex<float>)
+AbDMNumPy(elem::Complex<double>)
+#undef AbDMNumPy
+
 /*
  * DISTMATRIX
  */
@@ -208,6 +230,24 @@ DCC(elem::Complex<double>)
 %define DISTMATRIX(F,U,V,sfx)
 %template(DistMatrix_ ## sfx) DistMatrix<F,U,V,int>;
 %extend DistMatrix<F,U,V,int> {
+	void _AttachArray( PyObject* array, int height, int width ) {
+		attach_nparray( *$self, array, height, width );
+	}
+	%pythoncode %{
+	def AttachArray(self,array,height,width):
+		"""Make this a height x width matrix, with its current alignments, 
+		whose local data is the column-major NumPy array 'array' (which is 
+		not copied and is kept alive by this matrix)"""
+		self._AttachArray(array,height,width)
+		self._attachedArray = array
+	@classmethod
+	def FromArray(cls,array,height,width,grid=None):
+		"""Construct a matrix which is attached to a NumPy array (see 
+		AttachArray), aligned with the first process of the grid"""
+		A = cls() if grid is None else cls(grid)
+		A.AttachArray(array,height,width)
+		return A
+	%}
 	const char *__str__() {
 		std::string ans;
 		std::ostringstream msg;
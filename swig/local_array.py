@@ -0,0 +1,36 @@
+from elem import *
+import numpy
+import time
+
+# Compare moving the local data of a distributed matrix into NumPy entry by
+# entry against using a zero-copy view of the local buffer (which keeps A
+# alive)
+n = 2000
+A = DistMatrix_d()
+Uniform( A, n, n )
+grid = A.Grid
+localHeight = A.LocalHeight
+localWidth = A.LocalWidth
+
+startTime = time.time()
+B = numpy.empty( (localHeight,localWidth), order='F' )
+for jLoc in range(localWidth):
+  for iLoc in range(localHeight):
+    B[iLoc,jLoc] = A.GetLocal( iLoc, jLoc )
+entrywiseTime = time.time() - startTime
+
+startTime = time.time()
+C = numpy.array( A.Matrix, order='F' )
+bulkTime = time.time() - startTime
+
+if grid.Rank == 0:
+  print( "Entrywise transfer: %e seconds" % entrywiseTime )
+  print( "Bulk transfer:      %e seconds" % bulkTime )
+  print( "Max difference:     %e" % abs(B-C).max() )
+
+# Attach a new distributed matrix to the NumPy copy (without copying again)
+# and check that updates through either are seen by both
+D = DistMatrix_d.FromArray( C, n, n, grid )
+D.Matrix[:,:] *= 2
+if grid.Rank == 0:
+  print( "Shared update error: %e" % abs(C-2*B).max() )
@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/FFT.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Circulant.hpp"
+#include "elemental/matrices/Fourier.hpp"
+#include "elemental/matrices/Hankel.hpp"
+#include "elemental/matrices/Toeplitz.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// || Y - YRef ||_F / || YRef ||_F
+template<typename T>
+BASE(T) RelativeError( const DistMatrix<T>& Y, const DistMatrix<T>& YRef )
+{
+    DistMatrix<T> E( Y );
+    Axpy( T(-1), YRef, E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( YRef );
+}
+
+template<typename T>
+std::vector<T> RandomGenerator( int length, const Grid& g )
+{
+    std::vector<T> a( length );
+    for( int i=0; i<length; ++i )
+        a[i] = SampleUnitBall<T>();
+    mpi::Broadcast( &a[0], length, 0, g.Comm() );
+    return a;
+}
+
+// Compare an implicit operator against Gemm with the dense generator
+template<typename T,class Operator>
+void CompareWithDense
+( const std::string& name, const Operator& op, const DistMatrix<T>& A,
+  double generateTime, int numRhs, const Grid& g )
+{
+    typedef BASE(T) R;
+    const int m = op.Height();
+    const int n = op.Width();
+    const Orientation orientations[3] = { NORMAL, TRANSPOSE, ADJOINT };
+    for( int k=0; k<3; ++k )
+    {
+        const Orientation orientation = orientations[k];
+        const int height = ( orientation==NORMAL ? n : m );
+        DistMatrix<T> X(g), Y(g), YRef(g);
+        Uniform( X, height, numRhs );
+        Zeros( YRef, ( orientation==NORMAL ? m : n ), numRhs );
+
+        mpi::Barrier( g.Comm() );
+        double startTime = mpi::Time();
+        Gemm( orientation, NORMAL, T(1), A, X, T(0), YRef );
+        mpi::Barrier( g.Comm() );
+        const double gemmTime = mpi::Time() - startTime;
+
+        startTime = mpi::Time();
+        op.Apply( orientation, X, Y );
+        mpi::Barrier( g.Comm() );
+        const double fastTime = mpi::Time() - startTime;
+
+        const R error = RelativeError( Y, YRef );
+        if( g.Rank() == 0 )
+        {
+            cout << "  " << name << " ("
+                 << ( orientation==NORMAL ? "normal" :
+                     (orientation==TRANSPOSE ? "transpose" : "adjoint") )
+                 << "): generate+Gemm=" << generateTime+gemmTime
+                 << " secs (Gemm=" << gemmTime << " secs), fast="
+                 << fastTime << " secs, error=" << error << endl;
+        }
+    }
+}
+
+template<typename T>
+void TestOperators( int n, int numRhs, const Grid& g )
+{
+    DistMatrix<T> A(g);
+    const int m = n + n/3;
+    const std::vector<T> c = RandomGenerator<T>( n, g );
+    const std::vector<T> a = RandomGenerator<T>( m+n-1, g );
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Circulant( A, c );
+    mpi::Barrier( g.Comm() );
+    double generateTime = mpi::Time() - startTime;
+    CompareWithDense
+    ( "Circulant", CirculantOperator<T>( c ), A, generateTime, numRhs, g );
+
+    startTime = mpi::Time();
+    Toeplitz( A, m, n, a );
+    mpi::Barrier( g.Comm() );
+    generateTime = mpi::Time() - startTime;
+    CompareWithDense
+    ( "Toeplitz", ToeplitzOperator<T>( m, n, a ), A, generateTime, numRhs, g );
+
+    startTime = mpi::Time();
+    Hankel( A, m, n, a );
+    mpi::Barrier( g.Comm() );
+    generateTime = mpi::Time() - startTime;
+    CompareWithDense
+    ( "Hankel", HankelOperator<T>( m, n, a ), A, generateTime, numRhs, g );
+}
+
+template<typename R>
+void TestFourier( int n, int numRhs, const Grid& g )
+{
+    typedef Complex<R> C;
+    DistMatrix<C> A(g);
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Fourier( A, n );
+    mpi::Barrier( g.Comm() );
+    const double generateTime = mpi::Time() - startTime;
+    CompareWithDense
+    ( "Fourier", FourierOperator<R>( n ), A, generateTime, numRhs, g );
+
+    // Check that the [VC,* ] transforms invert one another
+    DistMatrix<C,VC,STAR> X(g), Y(g);
+    Uniform( X, n, numRhs );
+    Y = X;
+    FFT( Y );
+    InverseFFT( Y );
+    Axpy( C(-1), X, Y );
+    const R error = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+    if( g.Rank() == 0 )
+        cout << "  || inv(F) F X - X ||_F / || X ||_F = " << error << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",1000);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        ComplainIfDebug();
+
+        // Exercise the four-step, mixed-radix, and Bluestein paths
+        const int p = commSize;
+        const int sizes[3] = { n, p*p*((n+p*p-1)/(p*p)), 2*(n/2)+1 };
+        for( int k=0; k<3; ++k )
+        {
+            if( commRank == 0 )
+                cout << "Size " << sizes[k] << ":" << endl;
+            if( commRank == 0 )
+                cout << "---------------------\n"
+                     << "Testing with doubles:\n"
+                     << "---------------------" << endl;
+            TestOperators<double>( sizes[k], numRhs, g );
+
+            if( commRank == 0 )
+                cout << "--------------------------------------\n"
+                     << "Testing with double-precision complex:\n"
+                     << "--------------------------------------" << endl;
+            TestOperators<Complex<double> >( sizes[k], numRhs, g );
+            TestFourier<double>( sizes[k], numRhs, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Gemmt.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Form the expected result of a triangular update: the 'uplo' triangle of
+// the full product together with the untouched opposite triangle of C
+template<typename T,Distribution U,Distribution V>
+void ExpectedResult
+( UpperOrLower uplo, const DistMatrix<T,U,V>& CFull,
+  const DistMatrix<T,U,V>& COrig, DistMatrix<T,U,V>& CExpected )
+{
+    DistMatrix<T,U,V> COpposite( COrig );
+    CExpected = CFull;
+    MakeTrapezoidal( uplo, CExpected );
+    if( uplo == LOWER )
+        MakeTrapezoidal( UPPER, COpposite, 1 );
+    else
+        MakeTrapezoidal( LOWER, COpposite, -1 );
+    Axpy( T(1), COpposite, CExpected );
+}
+
+template<typename T>
+void TestGemmt
+( UpperOrLower uplo, Orientation orientationOfA, Orientation orientationOfB,
+  int m, int k, T alpha, T beta, bool testCorrectness, const Grid& g )
+{
+    typedef BASE(T) R;
+    DistMatrix<T> A(g), B(g), COrig(g), C(g), CFull(g);
+
+    if( orientationOfA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientationOfB == NORMAL )
+        Uniform( B, k, m );
+    else
+        Uniform( B, m, k );
+    Uniform( COrig, m, m );
+
+    // Time the full update for reference
+    CFull = COrig;
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Gemm...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Gemm( orientationOfA, orientationOfB, alpha, A, B, beta, CFull );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. Time = " << runTime << " seconds" << endl;
+
+    // The distributed triangular update, whose diagonal blocks are formed
+    // with LocalGemmt
+    C = COrig;
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Trrk...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Trrk( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. Time = " << runTime << " seconds" << endl;
+
+    // The sequential triangular update on a redundant copy
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                            C_STAR_STAR( COrig );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting sequential Gemmt...";
+        cout.flush();
+    }
+    startTime = mpi::Time();
+    Gemmt
+    ( uplo, orientationOfA, orientationOfB,
+      alpha, A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(),
+      beta, C_STAR_STAR.Matrix() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. Time = " << runTime << " seconds" << endl;
+
+    if( testCorrectness )
+    {
+        DistMatrix<T> CExpected(g);
+        ExpectedResult( uplo, CFull, COrig, CExpected );
+        const R frobExpected = FrobeniusNorm( CExpected );
+
+        DistMatrix<T> E( CExpected );
+        Axpy( T(-1), C, E );
+        const R frobTrrk = FrobeniusNorm( E );
+
+        E = CExpected;
+        DistMatrix<T> CSeq( C_STAR_STAR );
+        Axpy( T(-1), CSeq, E );
+        const R frobSeq = FrobeniusNorm( E );
+        if( g.Rank() == 0 )
+            cout << "  || C_Trrk  - C_expected ||_F / || C_expected ||_F = "
+                 << frobTrrk/frobExpected << "\n"
+                 << "  || C_Gemmt - C_expected ||_F / || C_expected ||_F = "
+                 << frobSeq/frobExpected << endl;
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--r","height of process grid",0);
+        const char uploChar = Input("--uplo","upper/lower storage: L/U",'L');
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const int m = Input("--m","height of result",100);
+        const int k = Input("--k","inner dimension",100);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const int nbLocal = Input("--nbLocal","local blocksize",32);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const Orientation orientationOfA = CharToOrientation( transA );
+        const Orientation orientationOfB = CharToOrientation( transB );
+        SetBlocksize( nb );
+        SetLocalTrrkBlocksize<double>( nbLocal );
+        SetLocalTrrkBlocksize<Complex<double> >( nbLocal );
+
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test Gemmt" << uploChar << transA << transB << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with doubles:                 \n"
+                 << "--------------------------------------" << endl;
+        }
+        TestGemmt<double>
+        ( uplo, orientationOfA, orientationOfB, m, k, 3., 4.,
+          testCorrectness, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestGemmt<Complex<double> >
+        ( uplo, orientationOfA, orientationOfB, m, k,
+          Complex<double>(3), Complex<double>(4), testCorrectness, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
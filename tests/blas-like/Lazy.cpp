@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Conjugate.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level1/Lazy.hpp"
+#include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/Hadamard.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/convex/SoftThreshold.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// || X - Y ||_F / || Y ||_F, where X is overwritten
+template<typename T,Distribution U,Distribution V>
+BASE(T) RelativeDifference( DistMatrix<T,U,V>& X, const DistMatrix<T,U,V>& Y )
+{
+    typedef BASE(T) R;
+    const R frobY = FrobeniusNorm( Y );
+    Axpy( T(-1), Y, X );
+    const R frobDiff = FrobeniusNorm( X );
+    return ( frobY == R(0) ? frobDiff : frobDiff/frobY );
+}
+
+template<typename T>
+BASE(T) RelativeDifference( Matrix<T>& X, const Matrix<T>& Y )
+{
+    typedef BASE(T) R;
+    const R frobY = FrobeniusNorm( Y );
+    Axpy( T(-1), Y, X );
+    const R frobDiff = FrobeniusNorm( X );
+    return ( frobY == R(0) ? frobDiff : frobDiff/frobY );
+}
+
+template<typename T,Distribution U,Distribution V>
+void TestLazy
+( const std::string& name, int m, int n, T alpha, T beta, const Grid& g )
+{
+    typedef BASE(T) R;
+    const R tau = R(1)/R(2);
+    DistMatrix<T,U,V> A(g), B(g), C(g), X(g), Y(g);
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( C, m, n );
+    R error = 0;
+
+    // X := ST_tau(alpha A + beta B - C), with B overwritten
+    Y = B;
+    Scale( beta, Y );
+    Axpy( alpha, A, Y );
+    Axpy( T(-1), C, Y );
+    SoftThreshold( Y, tau );
+    X = B;
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Evaluate
+    ( lazy::SoftThreshold( alpha*Lazy(A)+beta*Lazy(X)-Lazy(C), tau ), X );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    error = std::max( error, RelativeDifference( X, Y ) );
+
+    // X := conj(A .* B) - C
+    Hadamard( A, B, Y );
+    Conjugate( Y );
+    Axpy( T(-1), C, Y );
+    X.Empty();
+    Evaluate( lazy::Conjugate( lazy::Hadamard(Lazy(A),Lazy(B)) )-Lazy(C), X );
+    error = std::max( error, RelativeDifference( X, Y ) );
+
+    // X := trapezoid(-A), for each combination of uplo and side
+    for( int k=0; k<4; ++k )
+    {
+        const UpperOrLower uplo = ( k%2==0 ? LOWER : UPPER );
+        const LeftOrRight side = ( k/2==0 ? LEFT : RIGHT );
+        const int offset = ( uplo==LOWER ? -1 : 2 );
+        Y = A;
+        Scale( T(-1), Y );
+        MakeTrapezoidal( uplo, Y, offset, side );
+        Evaluate( lazy::MakeTrapezoidal( uplo, -Lazy(A), offset, side ), X );
+        error = std::max( error, RelativeDifference( X, Y ) );
+    }
+
+    // X := diag(dLeft)^H A diag(dRight), where only dLeft is aligned
+    DistMatrix<T,U,STAR> dLeft(g);
+    DistMatrix<T,VR,STAR> dRight(g);
+    dLeft.AlignWith( A );
+    Uniform( dLeft, m, 1 );
+    Uniform( dRight, n, 1 );
+    Y = A;
+    DiagonalScale( LEFT, ADJOINT, dLeft, Y );
+    DiagonalScale( RIGHT, NORMAL, dRight, Y );
+    Evaluate
+    ( lazy::DiagonalScale
+      ( LEFT, ADJOINT, dLeft,
+        lazy::DiagonalScale( RIGHT, NORMAL, dRight, Lazy(A) ) ), X );
+    error = std::max( error, RelativeDifference( X, Y ) );
+
+    // The sequential versions, on the local matrices
+    Matrix<T> ALoc( A.LockedMatrix() ), BLoc( B.LockedMatrix() ),
+              CLoc( C.LockedMatrix() ), XLoc, YLoc;
+    R seqError = 0;
+    YLoc = BLoc;
+    Scale( beta, YLoc );
+    Axpy( alpha, ALoc, YLoc );
+    Axpy( T(-1), CLoc, YLoc );
+    SoftThreshold( YLoc, tau );
+    XLoc = BLoc;
+    Evaluate
+    ( lazy::SoftThreshold
+      ( alpha*Lazy(ALoc)+beta*Lazy(XLoc)-Lazy(CLoc), tau ), XLoc );
+    seqError = std::max( seqError, RelativeDifference( XLoc, YLoc ) );
+
+    YLoc = ALoc;
+    MakeTrapezoidal( UPPER, YLoc, 1 );
+    Hadamard( YLoc, BLoc, XLoc );
+    YLoc = XLoc;
+    Evaluate
+    ( lazy::Hadamard
+      ( lazy::MakeTrapezoidal( UPPER, Lazy(ALoc), 1 ), Lazy(BLoc) ), XLoc );
+    seqError = std::max( seqError, RelativeDifference( XLoc, YLoc ) );
+    mpi::AllReduce( &seqError, 1, mpi::MAX, g.Comm() );
+
+    if( g.Rank() == 0 )
+        cout << "  " << name << ": fused update in " << runTime << " seconds\n"
+             << "    maximum relative error (distributed): " << error << "\n"
+             << "    maximum relative error (sequential):  " << seqError
+             << endl;
+}
+
+template<typename T>
+void TestLazy( int m, int n, T alpha, T beta, const Grid& g )
+{
+    TestLazy<T,MC,MR>( "[MC,MR]", m, n, alpha, beta, g );
+    TestLazy<T,VC,STAR>( "[VC,* ]", m, n, alpha, beta, g );
+    TestLazy<T,STAR,STAR>( "[* ,* ]", m, n, alpha, beta, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestLazy<double>( m, n, 3., -2., g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestLazy<Complex<double> >
+        ( m, n, Complex<double>(3,4), Complex<double>(-2,1), g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Transpose.hpp"
+#include "elemental/blas-like/level2/Trsv.hpp"
+#include "elemental/blas-like/level3/Trmm.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+using namespace std;
+using namespace elem;
+
+// Compare the standard and pipelined algorithms for 1 to 16 right-hand sides
+template<typename F>
+void TestPipelinedTrsm
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  int m, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AInv(g), X(g), Y(g), Z(g);
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    AInv = A;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    InvertDiagonalBlocks( uplo, diag, AInv );
+    mpi::Barrier( g.Comm() );
+    const double invertTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "  Inverting diagonal blocks: " << invertTime << " seconds"
+             << endl;
+
+    for( int n=1; n<=16; n*=2 )
+    {
+        Uniform( X, m, n );
+        Y = X;
+        Z = X;
+        mpi::Barrier( g.Comm() );
+        startTime = mpi::Time();
+        Trsm( LEFT, uplo, orientation, diag, F(1), A, X );
+        mpi::Barrier( g.Comm() );
+        const double stdTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        PipelinedTrsm( uplo, orientation, diag, F(1), A, Y );
+        mpi::Barrier( g.Comm() );
+        const double pipeTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        PipelinedTrsm( uplo, orientation, diag, F(1), AInv, Z, true );
+        mpi::Barrier( g.Comm() );
+        const double invTime = mpi::Time() - startTime;
+
+        const R XNorm = FrobeniusNorm( X );
+        Axpy( F(-1), X, Y );
+        Axpy( F(-1), X, Z );
+        const R pipeError = FrobeniusNorm( Y ) / XNorm;
+        const R invError = FrobeniusNorm( Z ) / XNorm;
+        if( g.Rank() == 0 )
+            cout << "  " << n << " right-hand sides: Trsm=" << stdTime
+                 << " secs, pipelined=" << pipeTime
+                 << " secs (error=" << pipeError << "), selective inversion="
+                 << invTime << " secs (error=" << invError << ")" << endl;
+    }
+}
+
+// Compare Trsv against the pipelined algorithm for column and row vectors
+template<typename F>
+void TestPipelinedTrsv
+( UpperOrLower uplo, Orientation orientation, UnitOrNonUnit diag,
+  int m, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), x(g), y(g), z(g), zRow(g);
+
+    // Generate random A and x and form either y := op(L) x or y := op(U) x
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    Uniform( x, m, 1 );
+    y = x;
+    Trmm( LEFT, uplo, orientation, diag, F(1), A, y );
+    z = y;
+    Transpose( y, zRow );
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Trsv( uplo, orientation, diag, A, y );
+    mpi::Barrier( g.Comm() );
+    const double stdTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    PipelinedTrsv( uplo, orientation, diag, A, z );
+    mpi::Barrier( g.Comm() );
+    const double pipeTime = mpi::Time() - startTime;
+    PipelinedTrsv( uplo, orientation, diag, A, zRow );
+
+    const R xNorm = FrobeniusNorm( x );
+    Axpy( F(-1), x, y );
+    Axpy( F(-1), x, z );
+    const R yNorm = FrobeniusNorm( y );
+    const R zNorm = FrobeniusNorm( z );
+    Transpose( zRow, y );
+    Axpy( F(-1), x, y );
+    const R zRowNorm = FrobeniusNorm( y );
+    if( g.Rank() == 0 )
+        cout << "  Trsv=" << stdTime << " secs (error=" << yNorm/xNorm
+             << "), pipelined=" << pipeTime << " secs (error="
+             << zNorm/xNorm << ", row vector error=" << zRowNorm/xNorm << ")"
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--r","height of process grid",0);
+        const char uploChar = Input
+            ("--uplo","lower or upper triangular: L/U",'L');
+        const char transChar = Input
+            ("--trans","orientation of triangular matrix: N/T/C",'N');
+        const char diagChar = Input("--diag","(non-)unit diagonal: N/U",'N');
+        const int m = Input("--m","size of triangular matrix",1000);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const Orientation orientation = CharToOrientation( transChar );
+        const UnitOrNonUnit diag = CharToUnitOrNonUnit( diagChar );
+        SetBlocksize( nb );
+
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test PipelinedTrsm"
+                 << uploChar << transChar << diagChar << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestPipelinedTrsm<double>( uplo, orientation, diag, m, g );
+        TestPipelinedTrsv<double>( uplo, orientation, diag, m, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestPipelinedTrsm<Complex<double> >( uplo, orientation, diag, m, g );
+        TestPipelinedTrsv<Complex<double> >( uplo, orientation, diag, m, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
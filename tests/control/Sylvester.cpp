@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/control/Lyapunov.hpp"
+#include "elemental/control/Sylvester.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite A with a random matrix whose eigenvalues lie in the open
+// right-half plane
+template<typename F>
+void MakeStable( DistMatrix<F>& A )
+{
+    const int n = A.Height();
+    MakeUniform( A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+}
+
+// || A X + X B - C ||_F / || C ||_F
+template<typename F>
+BASE(F) Residual
+( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& C,
+  const DistMatrix<F>& X )
+{
+    DistMatrix<F> R( C );
+    Gemm( NORMAL, NORMAL, F(1), A, X, F(-1), R );
+    Gemm( NORMAL, NORMAL, F(1), X, B, F(1), R );
+    return FrobeniusNorm( R ) / FrobeniusNorm( C );
+}
+
+template<typename F>
+void Report
+( const std::string& name, int embeddedIts, double embeddedTime,
+  int structuredIts, double structuredTime, BASE(F) embeddedResid,
+  BASE(F) structuredResid )
+{
+    cout << "  " << name << ":\n"
+         << "    embedded:   " << embeddedIts << " its, " << embeddedTime
+         << " secs, residual=" << embeddedResid << "\n"
+         << "    structured: " << structuredIts << " its, " << structuredTime
+         << " secs, residual=" << structuredResid << "\n"
+         << "    speedup:    " << embeddedTime/structuredTime << endl;
+}
+
+template<typename F>
+void TestSylvester( int m, int n, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), B(g), C(g), X(g), W(g), WTL(g), WTR(g),
+                                                WBL(g), WBR(g);
+    A.ResizeTo( m, m );
+    B.ResizeTo( n, n );
+    MakeStable( A );
+    MakeStable( B );
+    Uniform( C, m, n );
+
+    // Solve using the sign of the explicitly embedded matrix
+    Zeros( W, m+n, m+n );
+    PartitionDownDiagonal
+    ( W, WTL, WTR,
+         WBL, WBR, m );
+    WTL = A;
+    WBR = B; Scale( F(-1), WBR );
+    WTR = C; Scale( F(-1), WTR );
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    const int embeddedIts = Sylvester( m, W, X );
+    mpi::Barrier( g.Comm() );
+    const double embeddedTime = mpi::Time() - startTime;
+    const R embeddedResid = Residual( A, B, C, X );
+
+    // Solve using the block-structured iteration
+    startTime = mpi::Time();
+    const int structuredIts = Sylvester( A, B, C, X );
+    mpi::Barrier( g.Comm() );
+    const double structuredTime = mpi::Time() - startTime;
+    const R structuredResid = Residual( A, B, C, X );
+
+    if( g.Rank() == 0 )
+        Report<F>
+        ( "Sylvester", embeddedIts, embeddedTime, structuredIts,
+          structuredTime, embeddedResid, structuredResid );
+}
+
+template<typename F>
+void TestLyapunov( int m, int rank, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AAdj(g), G(g), C(g), X(g), Z(g), W(g),
+                  WTL(g), WTR(g),
+                  WBL(g), WBR(g);
+    A.ResizeTo( m, m );
+    MakeStable( A );
+    Adjoint( A, AAdj );
+    Uniform( G, m, rank );
+    Zeros( C, m, m );
+    Gemm( NORMAL, ADJOINT, F(1), G, G, F(0), C );
+
+    // Solve using the sign of the explicitly embedded matrix
+    Zeros( W, 2*m, 2*m );
+    PartitionDownDiagonal
+    ( W, WTL, WTR,
+         WBL, WBR, m );
+    WTL = A;
+    WBR = AAdj; Scale( F(-1), WBR );
+    WTR = C; Scale( F(-1), WTR );
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    const int embeddedIts = Sylvester( m, W, X );
+    mpi::Barrier( g.Comm() );
+    const double embeddedTime = mpi::Time() - startTime;
+    const R embeddedResid = Residual( A, AAdj, C, X );
+
+    // Solve using the block-structured iteration
+    startTime = mpi::Time();
+    const int structuredIts = Lyapunov( A, C, X );
+    mpi::Barrier( g.Comm() );
+    const double structuredTime = mpi::Time() - startTime;
+    const R structuredResid = Residual( A, AAdj, C, X );
+
+    if( g.Rank() == 0 )
+        Report<F>
+        ( "Lyapunov", embeddedIts, embeddedTime, structuredIts,
+          structuredTime, embeddedResid, structuredResid );
+
+    // Solve using the low-rank factored iteration
+    startTime = mpi::Time();
+    const int factoredIts = FactoredLyapunov( A, G, Z );
+    mpi::Barrier( g.Comm() );
+    const double factoredTime = mpi::Time() - startTime;
+    Gemm( NORMAL, ADJOINT, F(1), Z, Z, F(0), X );
+    const R factoredResid = Residual( A, AAdj, C, X );
+    if( g.Rank() == 0 )
+        cout << "    factored:   " << factoredIts << " its, " << factoredTime
+             << " secs, residual=" << factoredResid << ", rank="
+             << Z.Width() << "\n"
+             << "    speedup:    " << embeddedTime/factoredTime << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--m","height of X",200);
+        const int n = Input("--n","width of X",200);
+        const int rank = Input("--rank","rank of Lyapunov right-hand side",5);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSylvester<double>( m, n, g );
+        TestLyapunov<double>( m, rank, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSylvester<Complex<double> >( m, n, g );
+        TestLyapunov<Complex<double> >( m, rank, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/Max.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Form the contribution of a single element of a one-dimensional mesh with
+// overlapping elements, which mimics finite-element stiffness assembly
+template<typename T>
+void ElementMatrix( int e, Matrix<T>& K )
+{
+    const int b = K.Height();
+    for( int t=0; t<b; ++t )
+        for( int s=0; s<b; ++s )
+            K.Set( s, t, T(e%7+1) + T(s==t ? 2*b : -1) );
+}
+
+// Elements which would fall off the end of the matrix wrap back around, so
+// that the number of contributions is independent of the matrix size
+template<typename T,class Interface>
+double Assemble
+( int numElements, int elemSize, DistMatrix<T>& A,
+  Interface& interface, const string& name, BASE(T)& readError )
+{
+    typedef BASE(T) R;
+    const Grid& g = A.Grid();
+    const int numOffsets = (A.Height()-1)/(elemSize-1);
+    const int commRank = g.Rank();
+    const int commSize = g.Size();
+    Matrix<T> K( elemSize, elemSize ), KCopy( elemSize, elemSize );
+
+    if( commRank == 0 )
+    {
+        cout << "  Assembling with " << name << "...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    interface.Attach( LOCAL_TO_GLOBAL, A );
+    for( int e=commRank; e<numElements; e+=commSize )
+    {
+        ElementMatrix( e, K );
+        const int offset = (e%numOffsets)*(elemSize-1);
+        interface.Axpy( T(1), K, offset, offset );
+    }
+    interface.Detach();
+    mpi::Barrier( g.Comm() );
+    const double assemblyTime = mpi::Time() - startTime;
+
+    // Pull each element's block back out of the assembled matrix and compare
+    // it against the corresponding block of a replicated copy
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    R maxDiff = 0;
+    mpi::Barrier( g.Comm() );
+    const double readStartTime = mpi::Time();
+    interface.Attach( GLOBAL_TO_LOCAL, A );
+    for( int e=commRank; e<numElements; e+=commSize )
+    {
+        Zeros( KCopy, elemSize, elemSize );
+        const int offset = (e%numOffsets)*(elemSize-1);
+        interface.Axpy( T(1), KCopy, offset, offset );
+        for( int t=0; t<elemSize; ++t )
+            for( int s=0; s<elemSize; ++s )
+                maxDiff = std::max
+                ( maxDiff, Abs(KCopy.Get(s,t)-
+                               A_STAR_STAR.GetLocal(offset+s,offset+t)) );
+    }
+    interface.Detach();
+    mpi::Barrier( g.Comm() );
+    const double readTime = mpi::Time() - readStartTime;
+    mpi::AllReduce( &maxDiff, 1, mpi::MAX, g.Comm() );
+    readError = maxDiff / MaxNorm( A_STAR_STAR );
+
+    if( commRank == 0 )
+    {
+        cout << "DONE.\n"
+             << "    Assembly time = " << assemblyTime << " seconds ("
+             << numElements/assemblyTime << " elements/second)\n"
+             << "    Readback time = " << readTime << " seconds" << endl;
+    }
+    return assemblyTime;
+}
+
+template<typename T>
+void TestAssembly
+( int n, int numElements, int elemSize, int maxQueueSize, bool print, 
+  const Grid& g )
+{
+    DistMatrix<T> A(g), B(g);
+    Zeros( A, n, n );
+    Zeros( B, n, n );
+
+    AxpyInterface<T> twoSided;
+    BASE(T) twoSidedReadError, oneSidedReadError;
+    const double twoSidedTime =
+        Assemble
+        ( numElements, elemSize, A, twoSided, "AxpyInterface",
+          twoSidedReadError );
+
+    RmaAxpyInterface<T> oneSided;
+    oneSided.SetMaxQueueSize( maxQueueSize );
+    const double oneSidedTime =
+        Assemble
+        ( numElements, elemSize, B, oneSided, "RmaAxpyInterface",
+          oneSidedReadError );
+
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+    const BASE(T) frobA = FrobeniusNorm( A );
+    Axpy( T(-1), A, B );
+    const BASE(T) frobE = FrobeniusNorm( B );
+    if( g.Rank() == 0 )
+        cout << "  Speedup = " << twoSidedTime/oneSidedTime << "\n"
+             << "  || A_RMA - A ||_F / || A ||_F = " << frobE/frobA << "\n"
+             << "  max readback error / || A ||_max = " << twoSidedReadError
+             << " (AxpyInterface), " << oneSidedReadError
+             << " (RmaAxpyInterface)\n" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--n","size of assembled matrix",1000);
+        const int numElements =
+            Input("--numElements","number of mesh elements",10000);
+        const int elemSize = Input("--elemSize","element matrix size",4);
+        const int maxQueueSize =
+            Input("--maxQueueSize","updates queued per process",1<<16);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( elemSize < 2 || elemSize > n )
+            throw runtime_error("Elements must be at least 2 x 2 and fit");
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestAssembly<double>
+        ( n, numElements, elemSize, maxQueueSize, print, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestAssembly<Complex<double> >
+        ( n, numElements, elemSize, maxQueueSize, print, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
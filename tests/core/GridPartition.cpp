@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Factor 'numMatrices' HPD matrices one after another over the full grid and
+// then concurrently, with each factored over one part of a partition of the
+// grid, and compare the results
+template<typename F>
+void TestConcurrentCholesky
+( int numParts, int numMatrices, int n, const Grid& g )
+{
+    typedef BASE(F) R;
+    const int commRank = mpi::CommRank( g.Comm() );
+    std::vector<DistMatrix<F>*> A( numMatrices ), ASerial( numMatrices ), 
+                                AConcurrent( numMatrices );
+    for( int k=0; k<numMatrices; ++k )
+    {
+        A[k] = new DistMatrix<F>( g );
+        HermitianUniformSpectrum( *A[k], n, 1, 10 );
+        ASerial[k] = new DistMatrix<F>( *A[k] );
+        AConcurrent[k] = new DistMatrix<F>( g );
+    }
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    for( int k=0; k<numMatrices; ++k )
+        Cholesky( LOWER, *ASerial[k] );
+    mpi::Barrier( g.Comm() );
+    const double serialTime = mpi::Time() - startTime;
+
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    GridPartition partition( g, numParts );
+    mpi::Barrier( g.Comm() );
+    const double partitionTime = mpi::Time() - startTime;
+
+    // Member k of the batch is factored on part k % numParts
+    std::vector<DistMatrix<F>*> ASub( numMatrices );
+    std::vector<const DistMatrix<F>*> sources( numMatrices );
+    for( int k=0; k<numMatrices; ++k )
+    {
+        ASub[k] = new DistMatrix<F>( partition.SubGrid(k%numParts) );
+        sources[k] = A[k];
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    InterGridCopy( sources, ASub );
+    mpi::Barrier( g.Comm() );
+    const double scatterTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    for( int k=0; k<numMatrices; ++k )
+        if( k % numParts == partition.Part() )
+            Cholesky( LOWER, *ASub[k] );
+    mpi::Barrier( g.Comm() );
+    const double factorTime = mpi::Time() - startTime;
+    for( int k=0; k<numMatrices; ++k )
+        sources[k] = ASub[k];
+    startTime = mpi::Time();
+    InterGridCopy( sources, AConcurrent );
+    mpi::Barrier( g.Comm() );
+    const double gatherTime = mpi::Time() - startTime;
+
+    R maxError = 0;
+    for( int k=0; k<numMatrices; ++k )
+    {
+        const R frobSerial = FrobeniusNorm( *ASerial[k] );
+        Axpy( F(-1), *ASerial[k], *AConcurrent[k] );
+        maxError = 
+            std::max( maxError, FrobeniusNorm(*AConcurrent[k])/frobSerial );
+        delete A[k];
+        delete ASerial[k];
+        delete AConcurrent[k];
+        delete ASub[k];
+    }
+    if( commRank == 0 )
+        cout << "  serial:     " << serialTime << " secs\n"
+             << "  concurrent: " << scatterTime+factorTime+gatherTime 
+             << " secs (scatter=" << scatterTime << ", factor=" << factorTime 
+             << ", gather=" << gatherTime << ")\n"
+             << "  forming the partition: " << partitionTime << " secs\n"
+             << "  max relative difference: " << maxError << endl;
+}
+
+// Round-trip a matrix with nontrivial alignments through each subgrid
+template<typename F>
+void TestRoundTrip( int numParts, int m, int n, const Grid& g )
+{
+    typedef BASE(F) R;
+    const int commRank = mpi::CommRank( g.Comm() );
+    GridPartition partition( g, numParts );
+    DistMatrix<F> A( m, n, g.Height()-1, g.Width()-1, g ), 
+                  B( m, n, 0, g.Width()/2, g );
+    MakeUniform( A );
+    R maxError = 0;
+    for( int part=0; part<numParts; ++part )
+    {
+        const Grid& subGrid = partition.SubGrid( part );
+        DistMatrix<F> ASub( m, n, subGrid.Height()/2, subGrid.Width()-1, 
+                            subGrid );
+        InterGridCopy( A, ASub );
+        InterGridCopy( ASub, B );
+        Axpy( F(-1), A, B );
+        maxError = std::max( maxError, FrobeniusNorm(B) );
+    }
+    if( commRank == 0 )
+        cout << "  round-trip error: " << maxError << endl;
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+    
+    try
+    {
+        const int numParts = Input("--numParts","number of subgrids",2);
+        const int numMatrices = 
+            Input("--numMatrices","number of matrices to factor",4);
+        const int n = Input("--size","size of each matrix",500);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        ProcessInput();
+        PrintInputReport();
+
+        if( numParts > commSize )
+            throw std::logic_error("Cannot have more parts than processes");
+        SetBlocksize( nb );
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestRoundTrip<double>( numParts, 37, 29, g );
+        TestConcurrentCholesky<double>( numParts, numMatrices, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestRoundTrip<Complex<double> >( numParts, 37, 29, g );
+        TestConcurrentCholesky<Complex<double> >
+        ( numParts, numMatrices, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Count the process columns and rows which span more than one node
+void CountSpanningComms( const Grid& g, int& numMCSpans, int& numMRSpans )
+{
+    mpi::Comm nodeComm;
+    mpi::CommSplitNode( g.Comm(), nodeComm );
+    int nodeLabel = g.Rank();
+    mpi::AllReduce( &nodeLabel, 1, mpi::MIN, nodeComm );
+    mpi::CommFree( nodeComm );
+
+    int minLabel = nodeLabel, maxLabel = nodeLabel;
+    mpi::AllReduce( &minLabel, 1, mpi::MIN, g.MCComm() );
+    mpi::AllReduce( &maxLabel, 1, mpi::MAX, g.MCComm() );
+    numMCSpans = ( g.MCRank() == 0 && minLabel != maxLabel ? 1 : 0 );
+    mpi::AllReduce( &numMCSpans, 1, mpi::SUM, g.Comm() );
+
+    minLabel = maxLabel = nodeLabel;
+    mpi::AllReduce( &minLabel, 1, mpi::MIN, g.MRComm() );
+    mpi::AllReduce( &maxLabel, 1, mpi::MAX, g.MRComm() );
+    numMRSpans = ( g.MRRank() == 0 && minLabel != maxLabel ? 1 : 0 );
+    mpi::AllReduce( &numMRSpans, 1, mpi::SUM, g.Comm() );
+}
+
+void ReportGrid( const std::string& name, const Grid& g )
+{
+    int numMCSpans, numMRSpans;
+    CountSpanningComms( g, numMCSpans, numMRSpans );
+    if( g.Rank() == 0 )
+        cout << "  " << name << " " << g.Height() << " x " << g.Width() 
+             << " grid: " << numMCSpans << " of " << g.Width() 
+             << " process columns and " << numMRSpans << " of " << g.Height()
+             << " process rows span multiple nodes" << endl;
+}
+
+double TimeGemm( int m, int n, int k, const Grid& g, double& frobC )
+{
+    SetRandomSeed( 17 );
+    DistMatrix<double> A(g), B(g), C(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Zeros( C, m, n );
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    frobC = FrobeniusNorm( C );
+    return runTime;
+}
+
+double TimeCholesky( int n, const Grid& g, double& frobL )
+{
+    SetRandomSeed( 17 );
+    DistMatrix<double> A(g);
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Cholesky( LOWER, A );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    MakeTriangular( LOWER, A );
+    frobL = FrobeniusNorm( A );
+    return runTime;
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    
+    try
+    {
+        const int m = Input("--m","height of C in Gemm",2000);
+        const int n = Input("--n","width of C in Gemm",200);
+        const int k = Input("--k","inner dimension of Gemm",400);
+        const int cholSize = Input("--cholSize","size of Cholesky",1000);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        mpi::Comm nodeComm;
+        mpi::CommSplitNode( comm, nodeComm );
+        int numNodes = ( mpi::CommRank(nodeComm) == 0 ? 1 : 0 );
+        mpi::CommFree( nodeComm );
+        mpi::AllReduce( &numNodes, 1, mpi::SUM, comm );
+        if( commRank == 0 )
+            cout << "Running over " << numNodes << " node(s)\n" << endl;
+
+        // The default grid
+        const Grid defaultGrid( comm );
+        ReportGrid( "default", defaultGrid );
+        double frobGemm, frobChol, frobChosen;
+        const double gemmDefaultTime = 
+            TimeGemm( m, n, k, defaultGrid, frobGemm );
+        const double cholDefaultTime = 
+            TimeCholesky( cholSize, defaultGrid, frobChol );
+
+        // A topology-aware grid shaped for the Gemm
+        int height;
+        GridOrder order;
+        GemmGridShape( comm, m, n, k, height, order );
+        {
+            const Grid g( comm, height, order );
+            ReportGrid
+            ( order==COLUMN_MAJOR ? "Gemm (column-major)" : "Gemm (row-major)",
+              g );
+            const double gemmTime = TimeGemm( m, n, k, g, frobChosen );
+            if( commRank == 0 )
+                cout << "  Gemm: " << gemmDefaultTime << " secs on the default "
+                     << "grid, " << gemmTime << " secs on the chosen grid "
+                     << "(relative difference in ||C||_F: " 
+                     << Abs(frobChosen-frobGemm)/frobGemm << ")\n" 
+                     << endl;
+        }
+
+        // A topology-aware grid shaped for the Cholesky factorization
+        CholeskyGridShape( comm, cholSize, height, order );
+        {
+            const Grid g( comm, height, order );
+            ReportGrid
+            ( order==COLUMN_MAJOR ? "Cholesky (column-major)" 
+                                  : "Cholesky (row-major)", g );
+            const double cholTime = TimeCholesky( cholSize, g, frobChosen );
+            if( commRank == 0 )
+                cout << "  Cholesky: " << cholDefaultTime << " secs on the "
+                     << "default grid, " << cholTime << " secs on the chosen "
+                     << "grid (relative difference in ||L||_F: " 
+                     << Abs(frobChosen-frobChol)/frobChol << ")" 
+                     << endl;
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Gaussian.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/NormalUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Return the number of entries of the two matrices which differ
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+int NumMismatches
+( const DistMatrix<T,U,V>& A, const DistMatrix<T,W,Z>& B )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B.Grid() );
+    B_STAR_STAR = B;
+    int numMismatches = 0;
+    for( int j=0; j<A.Width(); ++j )
+        for( int i=0; i<A.Height(); ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                ++numMismatches;
+    return numMismatches;
+}
+
+void Report
+( const std::string& name, const Grid& g, int numMismatches, double runTime )
+{
+    if( g.Rank() == 0 )
+        cout << "  " << name << ": " << runTime << " seconds on the first "
+             << "grid, " << numMismatches << " entries differ between grids"
+             << endl;
+}
+
+template<typename F>
+void TestRandom( int m, int n, const Grid& g1, const Grid& g2 )
+{
+    const unsigned seed = RandomSeed();
+
+    // Uniform
+    {
+        DistMatrix<F> A(g1);
+        DistMatrix<F,VC,STAR> B(g2);
+        SetRandomSeed( seed );
+        mpi::Barrier( g1.Comm() );
+        const double startTime = mpi::Time();
+        Uniform( A, m, n );
+        mpi::Barrier( g1.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        SetRandomSeed( seed );
+        Uniform( B, m, n );
+        Report( "Uniform", g1, NumMismatches( A, B ), runTime );
+    }
+
+    // Gaussian
+    {
+        DistMatrix<F> A(g1);
+        DistMatrix<F,STAR,VR> B(g2);
+        SetRandomSeed( seed );
+        mpi::Barrier( g1.Comm() );
+        const double startTime = mpi::Time();
+        Gaussian( A, m, n );
+        mpi::Barrier( g1.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        SetRandomSeed( seed );
+        Gaussian( B, m, n );
+        Report( "Gaussian", g1, NumMismatches( A, B ), runTime );
+    }
+
+    // HermitianUniformSpectrum
+    {
+        DistMatrix<F> A(g1), B(g2);
+        SetRandomSeed( seed );
+        mpi::Barrier( g1.Comm() );
+        const double startTime = mpi::Time();
+        HermitianUniformSpectrum( A, m, 1, 10 );
+        mpi::Barrier( g1.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        SetRandomSeed( seed );
+        HermitianUniformSpectrum( B, m, 1, 10 );
+        Report
+        ( "HermitianUniformSpectrum", g1, NumMismatches( A, B ), runTime );
+    }
+}
+
+template<typename R>
+void TestNormalUniformSpectrum( int m, const Grid& g1, const Grid& g2 )
+{
+    typedef Complex<R> C;
+    const unsigned seed = RandomSeed();
+    DistMatrix<C> A(g1);
+    DistMatrix<C,MR,MC> B(g2);
+    SetRandomSeed( seed );
+    mpi::Barrier( g1.Comm() );
+    const double startTime = mpi::Time();
+    NormalUniformSpectrum( A, m, C(1), R(2) );
+    mpi::Barrier( g1.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    SetRandomSeed( seed );
+    NormalUniformSpectrum( B, m, C(1), R(2) );
+    Report( "NormalUniformSpectrum", g1, NumMismatches( A, B ), runTime );
+}
+
+// Draw different numbers of random matrices on the two halves of g, and then
+// check that a replicated random matrix drawn over g is identical on every
+// process
+template<typename F>
+void TestSubgridDraws( int m, int n, const Grid& g )
+{
+    GridPartition partition( g, 2 );
+    const int part = partition.Part();
+    if( part != mpi::UNDEFINED )
+    {
+        const Grid& subGrid = partition.SubGrid( part );
+        Grid ownGrid( subGrid.Comm(), subGrid.Height() );
+        DistMatrix<F> A(ownGrid);
+        for( int draw=0; draw<=2*part; ++draw )
+            Uniform( A, m, n );
+    }
+
+    DistMatrix<F,STAR,STAR> A(g);
+    Uniform( A, m, n );
+    Matrix<F> ARoot( A.Matrix() );
+    mpi::Broadcast( ARoot.Buffer(), m*n, 0, g.Comm() );
+    int numMismatches = 0;
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<m; ++i )
+            if( A.GetLocal(i,j) != ARoot.Get(i,j) )
+                ++numMismatches;
+    mpi::AllReduce( &numMismatches, 1, mpi::SUM, g.Comm() );
+    if( g.Rank() == 0 )
+        cout << "  [* ,* ] Uniform after subgrid draws: " << numMismatches
+             << " entries differ between processes" << endl;
+    if( numMismatches != 0 )
+        throw std::logic_error("Replicated random matrices differ");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of first process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g1( comm, r );
+        const Grid g2( comm, 1 );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Comparing random matrices generated over "
+                 << g1.Height() << " x " << g1.Width() << " and "
+                 << g2.Height() << " x " << g2.Width() << " grids" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestRandom<double>( m, n, g1, g2 );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestRandom<Complex<double> >( m, n, g1, g2 );
+        TestNormalUniformSpectrum<double>( m, g1, g2 );
+        if( commSize > 1 )
+            TestSubgridDraws<double>( m, n, g1 );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite A with a random, diagonally dominant Hermitian matrix
+template<typename F>
+void MakeDominant( DistMatrix<F>& A )
+{
+    const int n = A.Height();
+    MakeUniform( A );
+    MakeHermitian( LOWER, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+}
+
+// || X - Y ||_F / || Y ||_F, where X is overwritten
+template<typename F>
+BASE(F) RelativeDifference( DistMatrix<F>& X, const DistMatrix<F>& Y )
+{
+    const BASE(F) frobY = FrobeniusNorm( Y );
+    Axpy( F(-1), Y, X );
+    return FrobeniusNorm( X ) / frobY;
+}
+
+// The number of bytes allocated for a [* ,* ] copy by all of the
+// processes on the node of the calling process
+template<typename F>
+double NodeMemory( const SharedStarStar<F>& A )
+{
+    mpi::Comm nodeComm;
+    mpi::CommSplitNode( A.Grid().Comm(), nodeComm );
+    double bytes = double(A.AllocatedMemory())*sizeof(F);
+    mpi::AllReduce( &bytes, 1, mpi::SUM, nodeComm );
+    mpi::CommFree( nodeComm );
+    return bytes;
+}
+
+template<typename F>
+void TestRedistribution( int n, int numReps, const Grid& g )
+{
+    DistMatrix<F> A(g);
+    Uniform( A, n, n );
+    double times[2], memory[2];
+    for( int k=0; k<2; ++k )
+    {
+        SetNodeSharedReplicas( k==1 );
+        SharedStarStar<F> A_STAR_STAR(g);
+        A_STAR_STAR = A;
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        for( int rep=0; rep<numReps; ++rep )
+            A_STAR_STAR = A;
+        mpi::Barrier( g.Comm() );
+        times[k] = (mpi::Time()-startTime)/numReps;
+        memory[k] = NodeMemory( A_STAR_STAR );
+
+        // Ensure that the copy is correct
+        DistMatrix<F> B(g);
+        B = A_STAR_STAR.LockedReplica();
+        const BASE(F) error = RelativeDifference( B, A );
+        if( g.Rank() == 0 )
+            cout << "  [MC,MR] -> [* ,* ] ("
+                 << ( A_STAR_STAR.Shared() ? "shared" : "private" ) << "): "
+                 << times[k] << " secs, " << memory[k]/1.e6
+                 << " MB on node, relative error=" << error << endl;
+    }
+    SetNodeSharedReplicas( false );
+    if( g.Rank() == 0 )
+        cout << "  speedup=" << times[0]/times[1]
+             << ", memory reduction=" << memory[0]/memory[1] << endl;
+}
+
+// Time a factorization with private and with node-shared [* ,* ] copies
+// and return the relative difference between the two results
+template<typename F,class Factorization>
+void TestFactorization
+( const std::string& name, Factorization factor, int n, const Grid& g )
+{
+    DistMatrix<F> A(g), AOrig(g), AShared(g);
+    A.ResizeTo( n, n );
+    MakeDominant( A );
+    AOrig = A;
+    double times[2];
+    for( int k=0; k<2; ++k )
+    {
+        SetNodeSharedReplicas( k==1 );
+        DistMatrix<F>& B = ( k==0 ? A : AShared );
+        if( k == 1 )
+            B = AOrig;
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        factor( B );
+        mpi::Barrier( g.Comm() );
+        times[k] = mpi::Time() - startTime;
+    }
+    SetNodeSharedReplicas( false );
+    const BASE(F) diff = RelativeDifference( AShared, A );
+    if( g.Rank() == 0 )
+        cout << "  " << name << ": private=" << times[0] << " secs, shared="
+             << times[1] << " secs, relative difference=" << diff << endl;
+}
+
+// Ensure that, with node-shared copies, a failed factorization of a diagonal
+// block on a node leader is rethrown with its original type on every process
+template<typename F>
+void TestFailures( int n, const Grid& g )
+{
+    SetNodeSharedReplicas( true );
+    DistMatrix<F> A(g);
+
+    // A Hermitian matrix with a negative diagonal is not HPD
+    A.ResizeTo( n, n );
+    MakeDominant( A );
+    A.Set( n-1, n-1, F(-n) );
+    int caught = 0;
+    try { Cholesky( LOWER, A ); }
+    catch( std::logic_error& e ) { caught = 1; }
+
+    // The zero matrix is singular
+    Zeros( A, n, n );
+    try { LU( A ); }
+    catch( SingularMatrixException& e ) { ++caught; }
+
+    // A failure recorded before the first resize, when the copy does not yet
+    // have a shared window
+    try
+    {
+        SharedStarStar<F> B(g);
+        try
+        {
+            if( B.NodeLeader() )
+                throw SingularMatrixException();
+        }
+        catch( std::exception& e ) { B.Fail( e ); }
+        B.Synchronize();
+    }
+    catch( SingularMatrixException& e ) { ++caught; }
+    SetNodeSharedReplicas( false );
+
+    mpi::AllReduce( &caught, 1, mpi::MIN, g.Comm() );
+    if( g.Rank() == 0 )
+        cout << "  Failed factorizations caught on every process: "
+             << ( caught == 3 ? "YES" : "NO" ) << endl;
+    if( caught != 3 )
+        throw std::logic_error("Failure was not rethrown on every process");
+}
+
+template<typename F>
+void CholeskyFactor( DistMatrix<F>& A )
+{ Cholesky( LOWER, A ); }
+
+template<typename F>
+void LUFactor( DistMatrix<F>& A )
+{ LU( A ); }
+
+template<typename F>
+void TridiagFactor( DistMatrix<F>& A )
+{
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    HermitianTridiag( LOWER, A, t );
+}
+
+template<typename F>
+void TestShared( int n, int numReps, const Grid& g )
+{
+    TestRedistribution<F>( n, numReps, g );
+    TestFactorization<F>( "Cholesky", CholeskyFactor<F>, n, g );
+    TestFactorization<F>( "LU", LUFactor<F>, n, g );
+    TestFactorization<F>( "HermitianTridiag", TridiagFactor<F>, n, g );
+    TestFailures<F>( n, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",500);
+        const int numReps = Input("--numReps","number of redistributions",10);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestShared<double>( n, numReps, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestShared<Complex<double> >( n, numReps, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,389 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/HermitianEig.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/Max.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite the random matrix A with a diagonally dominant HPD matrix
+template<typename F>
+void ShiftToHPD( Matrix<F>& A )
+{
+    const int n = A.Height();
+    MakeHermitian( LOWER, A );
+    for( int j=0; j<n; ++j )
+        A.Set( j, j, A.Get(j,j)+F(n) );
+}
+
+template<typename F>
+void MakeHPD( Matrix<F>& A )
+{
+    MakeUniform( A );
+    ShiftToHPD( A );
+}
+
+template<typename F>
+void MakeHPD( Matrix<F>& A, const RandomStream& stream )
+{
+    MakeUniform( A, stream );
+    ShiftToHPD( A );
+}
+
+template<typename F>
+void MakeHPD( DistMatrix<F>& A, const RandomStream& stream )
+{
+    const int n = A.Height();
+    MakeUniform( A, stream );
+    MakeHermitian( LOWER, A );
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    for( int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const int j = rowShift + jLoc*rowStride;
+        for( int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( colShift + iLoc*colStride == j )
+                A.SetLocal( iLoc, jLoc, A.GetLocal(iLoc,jLoc)+F(n) );
+    }
+}
+
+// The maximum entrywise difference between the members of a batch and a
+// list of matrices
+template<typename T>
+BASE(T) MaxDifference
+( const MatrixBatch<T>& A, const std::vector<Matrix<T>*>& B )
+{
+    BASE(T) maxDiff = 0;
+    for( int k=0; k<A.Size(); ++k )
+    {
+        Matrix<T> AView;
+        A.LockedView( k, AView );
+        for( int j=0; j<AView.Width(); ++j )
+            for( int i=0; i<AView.Height(); ++i )
+                maxDiff = std::max
+                    ( maxDiff, Abs(AView.Get(i,j)-B[k]->Get(i,j)) );
+    }
+    return maxDiff;
+}
+
+void Report
+( const std::string& name, double loopTime, double batchTime, double diff )
+{
+    cout << "  " << name << ": loop=" << loopTime << " secs, batch="
+         << batchTime << " secs, max difference=" << diff << endl;
+}
+
+template<typename F>
+void TestLocalBatch
+( const std::vector<int>& sizes, int numRhs, bool print )
+{
+    typedef BASE(F) R;
+    const int batchSize = sizes.size();
+    MatrixBatch<F> A( sizes, sizes );
+    std::vector<Matrix<F>*> AOrig( batchSize ), ALoop( batchSize );
+    for( int k=0; k<batchSize; ++k )
+    {
+        Matrix<F> AView;
+        A.View( k, AView );
+        MakeHPD( AView );
+        AOrig[k] = new Matrix<F>( AView );
+        ALoop[k] = new Matrix<F>( AView );
+    }
+
+    // Cholesky
+    double startTime = mpi::Time();
+    for( int k=0; k<batchSize; ++k )
+        Cholesky( LOWER, *ALoop[k] );
+    const double cholLoopTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    Cholesky( LOWER, A );
+    const double cholBatchTime = mpi::Time() - startTime;
+    if( print )
+        Report
+        ( "Cholesky", cholLoopTime, cholBatchTime, MaxDifference(A,ALoop) );
+
+    // Solve against the factors and check the residuals with a batched Gemm
+    // over the original matrices (which are attached to a batch)
+    std::vector<int> widths( batchSize, numRhs );
+    MatrixBatch<F> X( sizes, widths ), Y( sizes, widths ), AOrigBatch;
+    for( int k=0; k<batchSize; ++k )
+    {
+        Matrix<F> XView, YView;
+        X.View( k, XView );
+        Y.View( k, YView );
+        MakeUniform( XView );
+        YView = XView;
+        AOrigBatch.Attach( *AOrig[k] );
+    }
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), A, X );
+    Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), A, X );
+    Gemm( NORMAL, NORMAL, F(1), AOrigBatch, X, F(-1), Y );
+    R maxResidual = 0;
+    for( int k=0; k<batchSize; ++k )
+    {
+        Matrix<F> YView;
+        Y.View( k, YView );
+        maxResidual = std::max( maxResidual, MaxNorm(YView) );
+    }
+    if( print )
+        cout << "  Trsm and Gemm: max residual=" << maxResidual << endl;
+
+    // LU with partial pivoting
+    MatrixBatch<int> p;
+    std::vector<Matrix<int>*> pLoop( batchSize );
+    for( int k=0; k<batchSize; ++k )
+    {
+        Matrix<F> AView;
+        A.View( k, AView );
+        AView = *AOrig[k];
+        *ALoop[k] = *AOrig[k];
+        pLoop[k] = new Matrix<int>;
+    }
+    startTime = mpi::Time();
+    for( int k=0; k<batchSize; ++k )
+        LU( *ALoop[k], *pLoop[k] );
+    const double luLoopTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    LU( A, p );
+    const double luBatchTime = mpi::Time() - startTime;
+    if( print )
+        Report
+        ( "LU", luLoopTime, luBatchTime,
+          MaxDifference(A,ALoop)+MaxDifference(p,pLoop) );
+
+    // Hermitian eigensolver
+    MatrixBatch<R> w;
+    std::vector<Matrix<R>*> wLoop( batchSize );
+    for( int k=0; k<batchSize; ++k )
+    {
+        Matrix<F> AView;
+        A.View( k, AView );
+        AView = *AOrig[k];
+        *ALoop[k] = *AOrig[k];
+        wLoop[k] = new Matrix<R>;
+    }
+    startTime = mpi::Time();
+    for( int k=0; k<batchSize; ++k )
+        HermitianEig( LOWER, *ALoop[k], *wLoop[k] );
+    const double eigLoopTime = mpi::Time() - startTime;
+    startTime = mpi::Time();
+    HermitianEig( LOWER, A, w );
+    const double eigBatchTime = mpi::Time() - startTime;
+    if( print )
+        Report
+        ( "HermitianEig", eigLoopTime, eigBatchTime, MaxDifference(w,wLoop) );
+
+    for( int k=0; k<batchSize; ++k )
+    {
+        delete AOrig[k];
+        delete ALoop[k];
+        delete pLoop[k];
+        delete wLoop[k];
+    }
+}
+
+// A singular member must cause the batched LU to throw a
+// SingularMatrixException, which callers can catch by type
+template<typename F>
+void TestLocalFailure( const std::vector<int>& sizes, bool print )
+{
+    const int batchSize = sizes.size();
+    MatrixBatch<F> A( sizes, sizes );
+    for( int k=0; k<batchSize; ++k )
+    {
+        Matrix<F> AView;
+        A.View( k, AView );
+        if( k == batchSize/2 )
+            MakeZeros( AView );
+        else
+            MakeHPD( AView );
+    }
+    bool caught = false;
+    try { LU( A ); }
+    catch( SingularMatrixException& e ) { caught = true; }
+    if( print )
+        cout << "  LU of a singular member raised SingularMatrixException: "
+             << ( caught ? "YES" : "NO" ) << endl;
+    if( !caught )
+        throw std::logic_error("Batched LU did not preserve the exception");
+}
+
+// The stream of the k'th member of a batch
+RandomStream MemberStream( const RandomStream& stream, int k )
+{
+    RandomStream memberStream = stream;
+    memberStream.index = k;
+    return memberStream;
+}
+
+template<typename F>
+void TestDistBatch( const std::vector<int>& sizes, int teamSize )
+{
+    typedef BASE(F) R;
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int batchSize = sizes.size();
+    BatchDistribution dist( comm, sizes, teamSize );
+    const std::vector<int>& localMembers = dist.LocalMembers();
+    const int numLocalMembers = localMembers.size();
+
+    // Each member is drawn from its own split of a stream of the whole
+    // communicator, so that it does not depend upon the team layout
+    const RandomStream stream = NewDistRandomStream( DefaultGrid() );
+    std::vector<R> frobs( batchSize, 0 );
+
+    // Report the balance of the (per-process) costs of the teams
+    std::vector<double> loads( dist.NumTeams(), 0 );
+    for( int k=0; k<batchSize; ++k )
+        loads[dist.Owner(k)] +=
+            batch::Cost(sizes[k],sizes[k])/dist.TeamSize(dist.Owner(k));
+    double maxLoad = 0, totalLoad = 0;
+    for( int team=0; team<dist.NumTeams(); ++team )
+    {
+        maxLoad = std::max( maxLoad, loads[team] );
+        totalLoad += loads[team];
+    }
+
+    mpi::Barrier( comm );
+    const double startTime = mpi::Time();
+    R maxError = 0;
+    if( dist.TeamGrid().Size() == 1 )
+    {
+        // Each member is owned by a single process, so use a local batch
+        std::vector<int> localSizes( numLocalMembers );
+        for( int s=0; s<numLocalMembers; ++s )
+            localSizes[s] = sizes[localMembers[s]];
+        MatrixBatch<F> A( localSizes, localSizes );
+        std::vector<Matrix<F>*> AOrig( numLocalMembers );
+        for( int s=0; s<numLocalMembers; ++s )
+        {
+            Matrix<F> AView;
+            A.View( s, AView );
+            MakeHPD( AView, MemberStream(stream,localMembers[s]) );
+            AOrig[s] = new Matrix<F>( AView );
+            frobs[localMembers[s]] = FrobeniusNorm( AView );
+        }
+        Cholesky( LOWER, A );
+        for( int s=0; s<numLocalMembers; ++s )
+        {
+            Matrix<F> L;
+            A.View( s, L );
+            MakeTriangular( LOWER, L );
+            const R frobA = FrobeniusNorm( *AOrig[s] );
+            Gemm( NORMAL, ADJOINT, F(-1), L, L, F(1), *AOrig[s] );
+            maxError = std::max( maxError, FrobeniusNorm(*AOrig[s])/frobA );
+            delete AOrig[s];
+        }
+    }
+    else
+    {
+        // Each member is distributed over the grid of its team
+        const Grid& g = dist.TeamGrid();
+        for( int s=0; s<numLocalMembers; ++s )
+        {
+            const int k = localMembers[s];
+            const int n = sizes[k];
+            DistMatrix<F> A(g), AOrig(g);
+            A.ResizeTo( n, n );
+            MakeHPD( A, MemberStream(stream,k) );
+            AOrig = A;
+            const R frob = FrobeniusNorm( A );
+            if( g.Rank() == 0 )
+                frobs[k] = frob;
+            Cholesky( LOWER, A );
+            MakeTriangular( LOWER, A );
+            const R frobA = FrobeniusNorm( AOrig );
+            Gemm( NORMAL, ADJOINT, F(-1), A, A, F(1), AOrig );
+            maxError = std::max( maxError, FrobeniusNorm(AOrig)/frobA );
+        }
+    }
+    mpi::Barrier( comm );
+    const double runTime = mpi::Time() - startTime;
+    mpi::AllReduce( &maxError, 1, mpi::MAX, comm );
+
+    // Compare the members against sequential draws from the same streams
+    mpi::AllReduce( &frobs[0], batchSize, mpi::SUM, comm );
+    R maxFrobDiff = 0;
+    for( int k=0; k<batchSize; ++k )
+    {
+        Matrix<F> B( sizes[k], sizes[k] );
+        MakeHPD( B, MemberStream(stream,k) );
+        const R frobB = FrobeniusNorm( B );
+        maxFrobDiff = std::max( maxFrobDiff, Abs(frobs[k]-frobB)/frobB );
+    }
+
+    if( commRank == 0 )
+        cout << "  Distributed Cholesky over " << dist.NumTeams()
+             << " teams: " << runTime << " secs, max load / average load="
+             << maxLoad/(totalLoad/dist.NumTeams())
+             << ", max relative residual=" << maxError << "\n"
+             << "  Members drawn by the teams vs. sequentially: max relative "
+             << "difference of norms=" << maxFrobDiff << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int batchSize = Input("--batchSize","number of matrices",200);
+        const int minSize = Input("--minSize","minimum matrix size",16);
+        const int maxSize = Input("--maxSize","maximum matrix size",64);
+        const int numRhs = Input("--numRhs","number of right-hand sides",4);
+        const int teamSize = Input("--teamSize","processes per team",1);
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        // Spread the sizes deterministically over [minSize,maxSize]
+        std::vector<int> sizes( batchSize );
+        for( int k=0; k<batchSize; ++k )
+            sizes[k] = minSize + (k*7919) % (maxSize-minSize+1);
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestLocalBatch<double>( sizes, numRhs, commRank==0 );
+        TestLocalFailure<double>( sizes, commRank==0 );
+        TestDistBatch<double>( sizes, teamSize );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestLocalBatch<Complex<double> >( sizes, numRhs, commRank==0 );
+        TestLocalFailure<Complex<double> >( sizes, commRank==0 );
+        TestDistBatch<Complex<double> >( sizes, teamSize );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeSymmetric.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Determinant.hpp"
+#include "elemental/lapack-like/LDL.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+BASE(F) RelativeResidual
+( const DistMatrix<F>& A, const DistMatrix<F>& X, const DistMatrix<F>& B )
+{
+    DistMatrix<F> E( B );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+    return FrobeniusNorm( E ) / (FrobeniusNorm( A )*FrobeniusNorm( X ));
+}
+
+template<typename F>
+void TestBunchKaufman
+( bool conjugated, int n, int numRhs, const Grid& g )
+{
+    typedef BASE(F) R;
+    const Orientation orientation = ( conjugated ? ADJOINT : TRANSPOSE );
+    DistMatrix<F> A(g), B(g), X(g);
+    if( conjugated )
+        HermitianUniformSpectrum( A, n, -100, 100 );
+    else
+    {
+        Uniform( A, n, n );
+        MakeSymmetric( LOWER, A );
+    }
+    Uniform( B, n, numRhs );
+
+    // Bunch-Kaufman LDL^{T/H}
+    DistMatrix<F> ALDL( A );
+    DistMatrix<F,MC,STAR> d(g), dSub(g);
+    DistMatrix<int,VC,STAR> p(g);
+    if( g.Rank() == 0 )
+    {
+        cout << "  Bunch-Kaufman LDL" << (conjugated?"^H":"^T") << "...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    if( conjugated )
+        LDLH( ALDL, d, dSub, p );
+    else
+        LDLT( ALDL, d, dSub, p );
+    mpi::Barrier( g.Comm() );
+    const double ldlTime = mpi::Time() - startTime;
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    ldl::SolveAfter( orientation, ALDL, d, dSub, p, X );
+    mpi::Barrier( g.Comm() );
+    const double ldlSolveTime = mpi::Time() - startTime;
+    const R ldlResid = RelativeResidual( A, X, B );
+    const SafeProduct<F> ldlDet = determinant::AfterLDL( orientation, d, dSub );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    factorization time = " << ldlTime << " seconds\n"
+             << "    solve time = " << ldlSolveTime << " seconds\n"
+             << "    || A X - B ||_F / (|| A ||_F || X ||_F) = " << ldlResid
+             << "\n"
+             << "    det(A) = " << ldlDet.rho << " exp("
+             << ldlDet.kappa*ldlDet.n << ")" << endl;
+    if( conjugated )
+    {
+        const InertiaType<int> inertia = ldl::Inertia( d, dSub );
+        if( g.Rank() == 0 )
+            cout << "    inertia = (" << inertia.numPositive << ","
+                 << inertia.numNegative << "," << inertia.numZero << ")"
+                 << endl;
+    }
+
+    // The sequential algorithm on a redundant copy should agree
+    {
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+        Matrix<F> dSeq, dSubSeq;
+        Matrix<int> pSeq;
+        ldl::BunchKaufman
+        ( orientation, A_STAR_STAR.Matrix(), dSeq, dSubSeq, pSeq );
+        const SafeProduct<F> seqDet =
+            determinant::AfterLDL( orientation, dSeq, dSubSeq );
+        DistMatrix<F,STAR,STAR> XSeq( B );
+        ldl::SolveAfter
+        ( orientation, A_STAR_STAR.LockedMatrix(), dSeq, dSubSeq, pSeq,
+          XSeq.Matrix() );
+        X = XSeq;
+        const R seqResid = RelativeResidual( A, X, B );
+        if( g.Rank() == 0 )
+            cout << "    sequential residual = " << seqResid << "\n"
+                 << "    sequential det(A) = " << seqDet.rho << " exp("
+                 << seqDet.kappa*seqDet.n << ")" << endl;
+    }
+
+    // LU with partial pivoting
+    DistMatrix<F> ALU( A );
+    DistMatrix<int,VC,STAR> pLU(g);
+    if( g.Rank() == 0 )
+    {
+        cout << "  LU with partial pivoting...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    LU( ALU, pLU );
+    mpi::Barrier( g.Comm() );
+    const double luTime = mpi::Time() - startTime;
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    lu::SolveAfter( NORMAL, ALU, pLU, X );
+    mpi::Barrier( g.Comm() );
+    const double luSolveTime = mpi::Time() - startTime;
+    const R luResid = RelativeResidual( A, X, B );
+    const SafeProduct<F> luDet = determinant::AfterLUPartialPiv( ALU, pLU );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    factorization time = " << luTime << " seconds\n"
+             << "    solve time = " << luSolveTime << " seconds\n"
+             << "    || A X - B ||_F / (|| A ||_F || X ||_F) = " << luResid
+             << "\n"
+             << "    det(A) = " << luDet.rho << " exp("
+             << luDet.kappa*luDet.n << ")\n"
+             << "  LU time / LDL time = " << luTime/ldlTime << "\n" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--n","size of matrix",500);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestBunchKaufman<double>( false, n, numRhs, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestBunchKaufman<Complex<double> >( false, n, numRhs, g );
+        TestBunchKaufman<Complex<double> >( true, n, numRhs, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite A with a random, diagonally dominant HPD matrix
+template<typename F>
+void MakeHPD( DistMatrix<F>& A )
+{
+    const int n = A.Height();
+    MakeUniform( A );
+    MakeHermitian( LOWER, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+}
+
+// The relative difference between the triangles of two factors
+template<typename F>
+BASE(F) FactorError
+( UpperOrLower uplo, const DistMatrix<F>& T, const DistMatrix<F>& TRef )
+{
+    DistMatrix<F> E( T ), ERef( TRef );
+    MakeTriangular( uplo, E );
+    MakeTriangular( uplo, ERef );
+    const BASE(F) frobRef = FrobeniusNorm( ERef );
+    Axpy( F(-1), ERef, E );
+    return FrobeniusNorm( E ) / frobRef;
+}
+
+template<typename F>
+void TestMod
+( UpperOrLower uplo, BASE(F) alpha, int n, int rank, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), T(g), V(g), VMod(g);
+    A.ResizeTo( n, n );
+    MakeHPD( A );
+    Uniform( V, n, rank );
+    // Keep downdates safely positive-definite
+    if( alpha < R(0) )
+        Scale( F(1)/F(R(rank)), V );
+    T = A;
+    Cholesky( uplo, T );
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Herk( uplo, NORMAL, F(alpha), V, F(1), A );
+    Cholesky( uplo, A );
+    mpi::Barrier( g.Comm() );
+    const double refactorTime = mpi::Time() - startTime;
+
+    VMod = V;
+    startTime = mpi::Time();
+    CholeskyMod( uplo, T, alpha, VMod );
+    mpi::Barrier( g.Comm() );
+    const double modTime = mpi::Time() - startTime;
+
+    const R error = FactorError( uplo, T, A );
+    if( g.Rank() == 0 )
+        cout << "  " << ( alpha > R(0) ? "update  " : "downdate" )
+             << " (" << ( uplo==LOWER ? "lower" : "upper" ) << ", rank "
+             << rank << "): refactor=" << refactorTime << " secs, mod="
+             << modTime << " secs, error=" << error << endl;
+}
+
+template<typename F>
+void TestRowCol( UpperOrLower uplo, int n, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AHat(g), T(g), a(g), AView(g);
+    A.ResizeTo( n, n );
+    MakeHPD( A );
+    T = A;
+    Cholesky( uplo, T );
+
+    // Delete the i'th row and column and compare against refactoring
+    const int i = n/3;
+    AHat.ResizeTo( n-1, n-1 );
+    const int offsets[2] = { 0, i+1 };
+    const int sizes[2] = { i, n-i-1 };
+    for( int s=0; s<2; ++s )
+    {
+        for( int t=0; t<2; ++t )
+        {
+            DistMatrix<F> AHatView(g);
+            LockedView
+            ( AView, A, offsets[s], offsets[t], sizes[s], sizes[t] );
+            View
+            ( AHatView, AHat, offsets[s]-s, offsets[t]-t, sizes[s], sizes[t] );
+            AHatView = AView;
+        }
+    }
+    cholesky::DeleteRowCol( uplo, T, i );
+    DistMatrix<F> TRef( AHat );
+    Cholesky( uplo, TRef );
+    const R deleteError = FactorError( uplo, T, TRef );
+
+    // Reinsert it and compare against the original factor
+    LockedView( AView, A, 0, i, n, 1 );
+    a = AView;
+    cholesky::InsertRowCol( uplo, T, i, a );
+    TRef = A;
+    Cholesky( uplo, TRef );
+    const R insertError = FactorError( uplo, T, TRef );
+    if( g.Rank() == 0 )
+        cout << "  row/column (" << ( uplo==LOWER ? "lower" : "upper" )
+             << "): delete error=" << deleteError << ", insert error="
+             << insertError << endl;
+}
+
+template<typename F>
+void TestCholeskyMods( int n, int maxRank, const Grid& g )
+{
+    typedef BASE(F) R;
+    for( int rank=1; rank<=maxRank; rank*=2 )
+    {
+        TestMod<F>( LOWER, R(1), n, rank, g );
+        TestMod<F>( LOWER, R(-1), n, rank, g );
+    }
+    TestMod<F>( UPPER, R(1), n, maxRank, g );
+    TestMod<F>( UPPER, R(-1), n, maxRank, g );
+    TestRowCol<F>( LOWER, n, g );
+    TestRowCol<F>( UPPER, n, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",1000);
+        const int maxRank = Input("--maxRank","maximum rank of updates",64);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestCholeskyMods<double>( n, maxRank, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestCholeskyMods<Complex<double> >( n, maxRank, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Exp.hpp"
+#include "elemental/lapack-like/HermitianFunction.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename R>
+class ExpFunctor {
+public:
+    R operator()( R alpha ) const { return Exp(alpha); }
+};
+
+// || Y - YRef ||_F / || YRef ||_F
+template<typename F>
+BASE(F) RelativeError( const DistMatrix<F>& Y, const DistMatrix<F>& YRef )
+{
+    DistMatrix<F> E( Y );
+    Axpy( F(-1), YRef, E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( YRef );
+}
+
+template<typename F>
+void TestHermitian( int n, BASE(F) scale, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), ARef(g);
+    Uniform( A, n, n );
+    MakeHermitian( LOWER, A );
+    Scale( F(scale/n), A );
+    ARef = A;
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    RealHermitianFunction( LOWER, ARef, ExpFunctor<R>() );
+    MakeHermitian( LOWER, ARef );
+    mpi::Barrier( g.Comm() );
+    const double eigTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    Exp( A );
+    mpi::Barrier( g.Comm() );
+    const double padeTime = mpi::Time() - startTime;
+
+    const R error = RelativeError( A, ARef );
+    if( g.Rank() == 0 )
+        cout << "  Hermitian (scale " << scale << "): eigensolver="
+             << eigTime << " secs, Pade=" << padeTime << " secs, error="
+             << error << endl;
+}
+
+template<typename F>
+void TestGeneral( int n, BASE(F) scale, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AExp(g), ANegExp(g), I(g);
+    Uniform( A, n, n );
+    Scale( F(scale/n), A );
+    AExp = A;
+    ANegExp = A;
+    Scale( F(-1), ANegExp );
+
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Exp( AExp );
+    mpi::Barrier( g.Comm() );
+    const double padeTime = mpi::Time() - startTime;
+    Exp( ANegExp );
+
+    // || exp(A) exp(-A) - I ||_F / || I ||_F
+    Identity( I, n, n );
+    Gemm( NORMAL, NORMAL, F(1), AExp, ANegExp, F(-1), I );
+    const R error = FrobeniusNorm( I ) / Sqrt(R(n));
+    if( g.Rank() == 0 )
+        cout << "  general (scale " << scale << "): Pade=" << padeTime
+             << " secs, || exp(A) exp(-A) - I ||_F / || I ||_F = "
+             << error << endl;
+}
+
+template<typename F>
+void TestAction( int n, int numRhs, int krylovDim, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AExp(g), V(g), Y(g), YRef(g);
+    Uniform( A, n, n );
+    Scale( F(R(4)/n), A );
+    Uniform( V, n, numRhs );
+    const R ts[] = { R(1), R(-1)/R(2), R(8) };
+    for( int k=0; k<3; ++k )
+    {
+        const R t = ts[k];
+        mpi::Barrier( g.Comm() );
+        double startTime = mpi::Time();
+        AExp = A;
+        Scale( F(t), AExp );
+        Exp( AExp );
+        Gemm( NORMAL, NORMAL, F(1), AExp, V, YRef );
+        mpi::Barrier( g.Comm() );
+        const double denseTime = mpi::Time() - startTime;
+
+        Y = V;
+        startTime = mpi::Time();
+        ExpAction( A, Y, t, krylovDim );
+        mpi::Barrier( g.Comm() );
+        const double krylovTime = mpi::Time() - startTime;
+
+        const R error = RelativeError( Y, YRef );
+        if( g.Rank() == 0 )
+            cout << "  exp(" << t << " A) V with " << numRhs
+                 << " columns: dense=" << denseTime << " secs, Krylov="
+                 << krylovTime << " secs, error=" << error << endl;
+    }
+}
+
+template<typename F>
+void TestExp( int n, int numRhs, int krylovDim, const Grid& g )
+{
+    typedef BASE(F) R;
+    // Exercise the low-degree approximants as well as scaling and squaring
+    const R scales[] = { R(1)/R(100), R(1), R(50) };
+    for( int k=0; k<3; ++k )
+    {
+        TestHermitian<F>( n, scales[k], g );
+        TestGeneral<F>( n, scales[k], g );
+    }
+    TestAction<F>( n, numRhs, krylovDim, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",500);
+        const int numRhs = Input("--numRhs","number of columns of V",4);
+        const int krylovDim = Input("--krylovDim","Krylov dimension",30);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestExp<double>( n, numRhs, krylovDim, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestExp<Complex<double> >( n, numRhs, krylovDim, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,295 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Determinant.hpp"
+#include "elemental/lapack-like/Factorization.hpp"
+#include "elemental/lapack-like/GaussianElimination.hpp"
+#include "elemental/lapack-like/HPDSolve.hpp"
+#include "elemental/lapack-like/LeastSquares.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite A with a random, diagonally dominant HPD matrix
+template<typename F>
+void MakeHPD( DistMatrix<F>& A )
+{
+    const int n = A.Height();
+    MakeUniform( A );
+    MakeHermitian( LOWER, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+}
+
+// || A X - B ||_F / || B ||_F, where 'orientation' determines whether A or
+// A^H is applied
+template<typename F>
+BASE(F) Residual
+( Orientation orientation, const DistMatrix<F>& A, const DistMatrix<F>& X,
+  const DistMatrix<F>& B )
+{
+    DistMatrix<F> E( B );
+    Gemm( orientation, NORMAL, F(-1), A, X, F(1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( B );
+}
+
+// The relative difference between two determinants in the safe form
+template<typename F>
+BASE(F) LogDetError( const SafeProduct<F>& det, const SafeProduct<F>& detRef )
+{
+    typedef BASE(F) R;
+    const R logAbsDet = det.kappa*det.n;
+    const R logAbsDetRef = detRef.kappa*detRef.n;
+    return Abs(logAbsDet-logAbsDetRef)/std::max(Abs(logAbsDetRef),R(1)) +
+           Abs(det.rho-detRef.rho);
+}
+
+void Report
+( const std::string& name, double repeatTime, double handleTime,
+  double residual, double adjointResidual, double detError )
+{
+    cout << "  " << name << ": refactoring=" << repeatTime << " secs, "
+         << "handle=" << handleTime << " secs\n"
+         << "    || A X - B ||_F / || B ||_F = " << residual << "\n"
+         << "    || A^H X - B ||_F / || B ||_F = " << adjointResidual << "\n"
+         << "    log-determinant error = " << detError << endl;
+}
+
+template<typename F>
+void TestCholesky( int n, int numRhs, int numSolves, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), ACopy(g), B(g), X(g);
+    A.ResizeTo( n, n );
+    MakeHPD( A );
+    Uniform( B, n, numRhs );
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    for( int k=0; k<numSolves; ++k )
+    {
+        ACopy = A;
+        X = B;
+        HPDSolve( LOWER, NORMAL, ACopy, X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double repeatTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    CholeskyFactor<F> factor( LOWER, A );
+    for( int k=0; k<numSolves; ++k )
+    {
+        X = B;
+        factor.Solve( X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double handleTime = mpi::Time() - startTime;
+    const R residual = Residual( NORMAL, A, X, B );
+
+    DistMatrix<F,VC,STAR> X_VC_STAR( B );
+    factor.SolveAdjoint( X_VC_STAR );
+    X = X_VC_STAR;
+    const R adjointResidual = Residual( ADJOINT, A, X, B );
+
+    ACopy = A;
+    const R detError =
+        LogDetError( factor.LogDet(), SafeHPDDeterminant( LOWER, ACopy ) );
+    if( g.Rank() == 0 )
+        Report
+        ( "Cholesky", repeatTime, handleTime, residual, adjointResidual,
+          detError );
+}
+
+template<typename F>
+void TestLU( int n, int numRhs, int numSolves, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), ACopy(g), B(g), X(g);
+    Uniform( A, n, n );
+    Uniform( B, n, numRhs );
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    for( int k=0; k<numSolves; ++k )
+    {
+        ACopy = A;
+        X = B;
+        GaussianElimination( ACopy, X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double repeatTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    LUFactor<F> factor( A );
+    for( int k=0; k<numSolves; ++k )
+    {
+        X = B;
+        factor.Solve( X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double handleTime = mpi::Time() - startTime;
+    const R residual = Residual( NORMAL, A, X, B );
+
+    DistMatrix<F,VC,STAR> X_VC_STAR( B );
+    factor.SolveAdjoint( X_VC_STAR );
+    X = X_VC_STAR;
+    const R adjointResidual = Residual( ADJOINT, A, X, B );
+
+    const R detError = LogDetError( factor.LogDet(), SafeDeterminant( A ) );
+    if( g.Rank() == 0 )
+        Report
+        ( "LU", repeatTime, handleTime, residual, adjointResidual, detError );
+}
+
+template<typename F>
+void TestQR( int n, int numRhs, int numSolves, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), ACopy(g), B(g), X(g);
+    Uniform( A, n, n );
+    Uniform( B, n, numRhs );
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    for( int k=0; k<numSolves; ++k )
+    {
+        ACopy = A;
+        LeastSquares( NORMAL, ACopy, B, X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double repeatTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    QRFactor<F> factor( A );
+    for( int k=0; k<numSolves; ++k )
+        factor.Solve( B, X );
+    mpi::Barrier( g.Comm() );
+    const double handleTime = mpi::Time() - startTime;
+    const R residual = Residual( NORMAL, A, X, B );
+
+    factor.SolveAdjoint( B, X );
+    const R adjointResidual = Residual( ADJOINT, A, X, B );
+
+    const R detError = LogDetError( factor.LogDet(), SafeDeterminant( A ) );
+    if( g.Rank() == 0 )
+        Report
+        ( "QR", repeatTime, handleTime, residual, adjointResidual, detError );
+}
+
+template<typename F>
+void TestLDL
+( Orientation orientation, int n, int numRhs, int numSolves, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), ACopy(g), B(g), X(g);
+    Uniform( A, n, n );
+    if( orientation == ADJOINT )
+        MakeHermitian( LOWER, A );
+    else
+        MakeSymmetric( LOWER, A );
+    Uniform( B, n, numRhs );
+
+    DistMatrix<F,MC,STAR> d(g), dSub(g);
+    DistMatrix<int,VC,STAR> p(g);
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    for( int k=0; k<numSolves; ++k )
+    {
+        ACopy = A;
+        X = B;
+        ldl::BunchKaufman( orientation, ACopy, d, dSub, p );
+        ldl::SolveAfter( orientation, ACopy, d, dSub, p, X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double repeatTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    LDLFactor<F> factor( orientation, A );
+    for( int k=0; k<numSolves; ++k )
+    {
+        X = B;
+        factor.Solve( X );
+    }
+    mpi::Barrier( g.Comm() );
+    const double handleTime = mpi::Time() - startTime;
+    const R residual = Residual( NORMAL, A, X, B );
+
+    DistMatrix<F,VC,STAR> X_VC_STAR( B );
+    factor.SolveAdjoint( X_VC_STAR );
+    X = X_VC_STAR;
+    const R adjointResidual = Residual( ADJOINT, A, X, B );
+
+    const R detError = LogDetError( factor.LogDet(), SafeDeterminant( A ) );
+    if( g.Rank() == 0 )
+        Report
+        ( ( orientation==ADJOINT ? "LDL^H" : "LDL^T" ), repeatTime,
+          handleTime, residual, adjointResidual, detError );
+}
+
+template<typename F>
+void TestFactorizations( int n, int numRhs, int numSolves, const Grid& g )
+{
+    TestCholesky<F>( n, numRhs, numSolves, g );
+    TestLU<F>( n, numRhs, numSolves, g );
+    TestQR<F>( n, numRhs, numSolves, g );
+    TestLDL<F>( ADJOINT, n, numRhs, numSolves, g );
+    if( IsComplex<F>::val )
+        TestLDL<F>( TRANSPOSE, n, numRhs, numSolves, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",500);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const int numSolves = Input("--numSolves","number of solves",10);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestFactorizations<double>( n, numRhs, numSolves, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestFactorizations<Complex<double> >( n, numRhs, numSolves, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/lapack-like/HermitianEig.hpp"
+#include "elemental/lapack-like/HermitianFunction.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename R>
+class ExpFunctor {
+public:
+    R operator()( R alpha ) const { return Exp(alpha); }
+};
+
+template<typename R>
+class StepFunctor {
+public:
+    StepFunctor( R sigma ) : sigma_(sigma) { }
+    R operator()( R alpha ) const { return ( alpha > sigma_ ? 1 : 0 ); }
+private:
+    R sigma_;
+};
+
+// || Y - YRef ||_F / || YRef ||_F
+template<typename F>
+BASE(F) RelativeError( const DistMatrix<F>& Y, const DistMatrix<F>& YRef )
+{
+    DistMatrix<F> E( Y );
+    Axpy( F(-1), YRef, E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( YRef );
+}
+
+template<typename F>
+void TestChebyshev( int n, BASE(F) radius, BASE(F) tol, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), ARef(g);
+    Uniform( A, n, n );
+    MakeHermitian( LOWER, A );
+    // The spectral radius of A is roughly 'radius'
+    Scale( F(radius/Sqrt(R(n))), A );
+    ARef = A;
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    RealHermitianFunction( LOWER, ARef, ExpFunctor<R>() );
+    mpi::Barrier( g.Comm() );
+    const double eigTime = mpi::Time() - startTime;
+    MakeHermitian( LOWER, ARef );
+
+    startTime = mpi::Time();
+    ChebyshevHermitianFunction( LOWER, A, ExpFunctor<R>(), tol );
+    mpi::Barrier( g.Comm() );
+    const double chebTime = mpi::Time() - startTime;
+
+    const R error = RelativeError( A, ARef );
+    if( g.Rank() == 0 )
+        cout << "  exp(A), n=" << n << ", radius~" << radius << ", tol="
+             << tol << ": eigensolver=" << eigTime << " secs, Chebyshev="
+             << chebTime << " secs, error=" << error << endl;
+}
+
+template<typename F>
+void TestProjector( int n, BASE(F) gap, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), PRef(g), Z(g);
+    DistMatrix<R,VR,STAR> w(g);
+
+    // Build a Hermitian matrix with random eigenvectors whose eigenvalues
+    // avoid (-gap,gap)
+    Uniform( A, n, n );
+    MakeHermitian( LOWER, A );
+    HermitianEig( LOWER, A, w, Z );
+    const int numLocalEigs = w.LocalHeight();
+    for( int iLoc=0; iLoc<numLocalEigs; ++iLoc )
+    {
+        const int i = w.ColShift() + iLoc*w.ColStride();
+        const R omega = gap + (1-gap)*R(i)/n;
+        w.SetLocal( iLoc, 0, ( i % 3 == 0 ? -omega : omega ) );
+    }
+    HermitianFromEVD( LOWER, A, w, Z );
+    MakeHermitian( LOWER, A );
+    PRef = A;
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    RealHermitianFunction( LOWER, PRef, StepFunctor<R>(0) );
+    mpi::Barrier( g.Comm() );
+    const double eigTime = mpi::Time() - startTime;
+    MakeHermitian( LOWER, PRef );
+
+    R lowerBound, upperBound;
+    HermitianSpectralBounds( LOWER, A, lowerBound, upperBound );
+
+    startTime = mpi::Time();
+    HermitianSpectralProjector( LOWER, A, R(0), gap );
+    mpi::Barrier( g.Comm() );
+    const double zoloTime = mpi::Time() - startTime;
+
+    const R error = RelativeError( A, PRef );
+    if( g.Rank() == 0 )
+        cout << "  projector, n=" << n << ", gap=" << gap
+             << ": Lanczos bounds=[" << lowerBound << "," << upperBound
+             << "], eigensolver=" << eigTime << " secs, Zolotarev="
+             << zoloTime << " secs, error=" << error << endl;
+}
+
+template<typename F>
+void TestHermitianFunctions( int n, const Grid& g )
+{
+    typedef BASE(F) R;
+    // Report timings for several sizes to expose the crossover point
+    for( int size=n/4; size<=n; size*=2 )
+    {
+        TestChebyshev<F>( size, R(1), R(1e-6), g );
+        TestChebyshev<F>( size, R(1), R(0), g );
+        TestChebyshev<F>( size, R(10), R(0), g );
+        TestProjector<F>( size, R(1)/R(10), g );
+        TestProjector<F>( size, R(1)/R(1000), g );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","largest size of matrices",400);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestHermitianFunctions<double>( n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestHermitianFunctions<Complex<double> >( n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/lapack-like/MixedPrecision.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Hilbert.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void Report
+( const string& name, double mixedTime, double fullTime,
+  const MixedPrecisionInfo& info, const DistMatrix<F>& X,
+  const DistMatrix<F>& XRef )
+{
+    typedef BASE(F) Real;
+    DistMatrix<F> E( X );
+    Axpy( F(-1), XRef, E );
+    const Real relDiff = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    if( X.Grid().Rank() == 0 )
+    {
+        cout << "  " << name << ":\n"
+             << "    mixed-precision time = " << mixedTime << " seconds\n"
+             << "    working-precision time = " << fullTime << " seconds\n"
+             << "    speedup = " << fullTime/mixedTime << "\n"
+             << "    refinement iterations = " << info.numIts
+             << ( info.fellBack ? " (fell back to working precision)" : "" )
+             << "\n"
+             << "    || X_mixed - X ||_F / || X ||_F = " << relDiff << "\n"
+             << endl;
+    }
+}
+
+template<typename F>
+void TestMixedPrecision( int n, int numRhs, bool hilbert, const Grid& g )
+{
+    DistMatrix<F> A(g), B(g), X(g), XRef(g);
+    double startTime, mixedTime, fullTime;
+    MixedPrecisionInfo info;
+
+    // Gaussian elimination on a diagonally-shifted random matrix
+    Identity( X, n, n );
+    Uniform( A, n, n );
+    Axpy( F(n), X, A );
+    Uniform( B, n, numRhs );
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    info = MixedPrecisionGaussianElimination( A, X );
+    mpi::Barrier( g.Comm() );
+    mixedTime = mpi::Time() - startTime;
+    {
+        DistMatrix<F> ACopy( A );
+        XRef = B;
+        mpi::Barrier( g.Comm() );
+        startTime = mpi::Time();
+        GaussianElimination( ACopy, XRef );
+        mpi::Barrier( g.Comm() );
+        fullTime = mpi::Time() - startTime;
+    }
+    Report( "GaussianElimination", mixedTime, fullTime, info, X, XRef );
+
+    // HPD solve, optionally with the (very ill-conditioned) Hilbert matrix
+    // in order to exercise the fallback
+    if( hilbert )
+        Hilbert( A, n );
+    else
+        HermitianUniformSpectrum( A, n, 1, 100 );
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    info = MixedPrecisionHPDSolve( LOWER, A, X );
+    mpi::Barrier( g.Comm() );
+    mixedTime = mpi::Time() - startTime;
+    {
+        DistMatrix<F> ACopy( A );
+        XRef = B;
+        mpi::Barrier( g.Comm() );
+        startTime = mpi::Time();
+        HPDSolve( LOWER, NORMAL, ACopy, XRef );
+        mpi::Barrier( g.Comm() );
+        fullTime = mpi::Time() - startTime;
+    }
+    Report( "HPDSolve", mixedTime, fullTime, info, X, XRef );
+
+    // Least squares with an inconsistent, overdetermined system
+    Uniform( A, 2*n, n );
+    Uniform( B, 2*n, numRhs );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    info = MixedPrecisionLeastSquares( A, B, X );
+    mpi::Barrier( g.Comm() );
+    mixedTime = mpi::Time() - startTime;
+    {
+        DistMatrix<F> ACopy( A );
+        mpi::Barrier( g.Comm() );
+        startTime = mpi::Time();
+        LeastSquares( NORMAL, ACopy, B, XRef );
+        mpi::Barrier( g.Comm() );
+        fullTime = mpi::Time() - startTime;
+    }
+    Report( "LeastSquares", mixedTime, fullTime, info, X, XRef );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--n","size of matrix",500);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool hilbert =
+            Input("--hilbert","use Hilbert matrix for HPD solve?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestMixedPrecision<double>( n, numRhs, hilbert, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestMixedPrecision<Complex<double> >( n, numRhs, hilbert, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
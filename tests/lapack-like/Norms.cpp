@@ -0,0 +1,226 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Dot.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Nrm2.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/Norm.hpp"
+#include "elemental/lapack-like/Norm/Entrywise.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Straightforward (and unscaled) reference implementations
+template<typename F>
+void ReferenceNorms
+( const Matrix<F>& A, BASE(F) p, BASE(F)& maxNorm, BASE(F)& oneNorm,
+  BASE(F)& infNorm, BASE(F)& frobNorm, BASE(F)& entrywiseOneNorm,
+  BASE(F)& entrywiseNorm )
+{
+    typedef BASE(F) R;
+    const int m = A.Height();
+    const int n = A.Width();
+    std::vector<R> rowSums( m, 0 );
+    maxNorm = oneNorm = infNorm = frobNorm = entrywiseOneNorm = 0;
+    R powerSum = 0;
+    for( int j=0; j<n; ++j )
+    {
+        R colSum = 0;
+        for( int i=0; i<m; ++i )
+        {
+            const R alphaAbs = Abs(A.Get(i,j));
+            maxNorm = std::max( maxNorm, alphaAbs );
+            colSum += alphaAbs;
+            rowSums[i] += alphaAbs;
+            frobNorm += alphaAbs*alphaAbs;
+            powerSum += Pow( alphaAbs, p );
+        }
+        oneNorm = std::max( oneNorm, colSum );
+        entrywiseOneNorm += colSum;
+    }
+    for( int i=0; i<m; ++i )
+        infNorm = std::max( infNorm, rowSums[i] );
+    frobNorm = Sqrt( frobNorm );
+    entrywiseNorm = Pow( powerSum, 1/p );
+}
+
+template<typename R>
+R RelativeError( R value, R reference )
+{ return ( reference == 0 ? Abs(value) : Abs(value-reference)/reference ); }
+
+template<typename F>
+void TestNorms( UpperOrLower uplo, int m, int n, const Grid& g )
+{
+    typedef BASE(F) R;
+    const R p = 3;
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+
+    R maxRef, oneRef, infRef, frobRef, entOneRef, entRef;
+    ReferenceNorms
+    ( A_STAR_STAR.LockedMatrix(), p,
+      maxRef, oneRef, infRef, frobRef, entOneRef, entRef );
+    F dotRef = 0;
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<m; ++i )
+            dotRef += Conj(A_STAR_STAR.GetLocal(i,j))*B_STAR_STAR.GetLocal(i,j);
+
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    const R maxNorm = MaxNorm( A );
+    const R oneNorm = OneNorm( A );
+    const R infNorm = InfinityNorm( A );
+    const R frobNorm = FrobeniusNorm( A );
+    const R entOneNorm = EntrywiseOneNorm( A );
+    const R entNorm = EntrywiseNorm( A, p );
+    const F dot = Dot( A, B );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+
+    R error = 0;
+    error = std::max( error, RelativeError(maxNorm,maxRef) );
+    error = std::max( error, RelativeError(oneNorm,oneRef) );
+    error = std::max( error, RelativeError(infNorm,infRef) );
+    error = std::max( error, RelativeError(frobNorm,frobRef) );
+    error = std::max( error, RelativeError(entOneNorm,entOneRef) );
+    error = std::max( error, RelativeError(entNorm,entRef) );
+    error = std::max( error, Abs(dot-dotRef)/Abs(dotRef) );
+
+    // The sequential versions
+    const Matrix<F>& ALoc = A_STAR_STAR.LockedMatrix();
+    R seqError = 0;
+    seqError = std::max( seqError, RelativeError(MaxNorm(ALoc),maxRef) );
+    seqError = std::max( seqError, RelativeError(OneNorm(ALoc),oneRef) );
+    seqError = std::max( seqError, RelativeError(InfinityNorm(ALoc),infRef) );
+    seqError = std::max( seqError, RelativeError(FrobeniusNorm(ALoc),frobRef) );
+    seqError =
+        std::max( seqError, RelativeError(EntrywiseOneNorm(ALoc),entOneRef) );
+    seqError =
+        std::max( seqError, RelativeError(EntrywiseNorm(ALoc,p),entRef) );
+    seqError = std::max
+        ( seqError,
+          Abs(Dot(ALoc,B_STAR_STAR.LockedMatrix())-dotRef)/Abs(dotRef) );
+
+    // Scale far enough that squaring an entry would overflow
+    const R bigScale = R(1)/(lapack::MachineSafeMin<R>()*1000);
+    Scale( bigScale, A );
+    const R scaledFrobError =
+        RelativeError( FrobeniusNorm(A), bigScale*frobRef );
+
+    if( g.Rank() == 0 )
+        cout << "  General norms and Dot: " << runTime << " seconds\n"
+             << "    maximum relative error (distributed): " << error << "\n"
+             << "    maximum relative error (sequential):  " << seqError << "\n"
+             << "    Frobenius norm relative error after scaling by "
+             << bigScale << ": " << scaledFrobError << endl;
+
+    // Hermitian variants on a square matrix, compared against the general
+    // norms of the explicitly Hermitian matrix
+    DistMatrix<F> H(g);
+    Uniform( H, m, m );
+    MakeHermitian( uplo, H );
+    DistMatrix<F,STAR,STAR> H_STAR_STAR( H );
+    ReferenceNorms
+    ( H_STAR_STAR.LockedMatrix(), p,
+      maxRef, oneRef, infRef, frobRef, entOneRef, entRef );
+
+    mpi::Barrier( g.Comm() );
+    const double hermStartTime = mpi::Time();
+    const R hermMax = HermitianMaxNorm( uplo, H );
+    const R hermOne = HermitianOneNorm( uplo, H );
+    const R hermInf = HermitianInfinityNorm( uplo, H );
+    const R hermFrob = HermitianFrobeniusNorm( uplo, H );
+    const R hermEntOne = HermitianEntrywiseOneNorm( uplo, H );
+    const R hermEnt = HermitianEntrywiseNorm( uplo, H, p );
+    mpi::Barrier( g.Comm() );
+    const double hermRunTime = mpi::Time() - hermStartTime;
+
+    R hermError = 0;
+    hermError = std::max( hermError, RelativeError(hermMax,maxRef) );
+    hermError = std::max( hermError, RelativeError(hermOne,oneRef) );
+    hermError = std::max( hermError, RelativeError(hermInf,infRef) );
+    hermError = std::max( hermError, RelativeError(hermFrob,frobRef) );
+    hermError = std::max( hermError, RelativeError(hermEntOne,entOneRef) );
+    hermError = std::max( hermError, RelativeError(hermEnt,entRef) );
+
+    const Matrix<F>& HLoc = H_STAR_STAR.LockedMatrix();
+    R hermSeqError = 0;
+    hermSeqError = std::max
+        ( hermSeqError, RelativeError(HermitianMaxNorm(uplo,HLoc),maxRef) );
+    hermSeqError = std::max
+        ( hermSeqError, RelativeError(HermitianOneNorm(uplo,HLoc),oneRef) );
+    hermSeqError = std::max
+        ( hermSeqError,
+          RelativeError(HermitianInfinityNorm(uplo,HLoc),infRef) );
+    hermSeqError = std::max
+        ( hermSeqError,
+          RelativeError(HermitianFrobeniusNorm(uplo,HLoc),frobRef) );
+    hermSeqError = std::max
+        ( hermSeqError,
+          RelativeError(HermitianEntrywiseOneNorm(uplo,HLoc),entOneRef) );
+    hermSeqError = std::max
+        ( hermSeqError,
+          RelativeError(HermitianEntrywiseNorm(uplo,HLoc,p),entRef) );
+
+    if( g.Rank() == 0 )
+        cout << "  Hermitian norms: " << hermRunTime << " seconds\n"
+             << "    maximum relative error (distributed): " << hermError
+             << "\n"
+             << "    maximum relative error (sequential):  " << hermSeqError
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const char uploChar = Input("--uplo","upper/lower storage: L/U",'L');
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestNorms<double>( uplo, m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestNorms<Complex<double> >( uplo, m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
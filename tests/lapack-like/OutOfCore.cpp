@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite A with a random, diagonally dominant HPD matrix
+template<typename F>
+void MakeHPD( DistMatrix<F>& A )
+{
+    const int n = A.Height();
+    MakeUniform( A );
+    MakeHermitian( LOWER, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+}
+
+// The rate (in GFlops) of 'flops' real (or complex) flops in 'time' seconds
+template<typename F>
+double Rate( double flops, double time )
+{ return ( IsComplex<F>::val ? 4 : 1 )*flops/(1.e9*time); }
+
+void Report
+( const std::string& name, double inCoreTime, double inCoreRate,
+  double outOfCoreTime, double outOfCoreRate, double error )
+{
+    cout << "  " << name << ": in-core=" << inCoreTime << " secs ("
+         << inCoreRate << " GFlops), out-of-core=" << outOfCoreTime
+         << " secs (" << outOfCoreRate << " GFlops), error=" << error << endl;
+}
+
+template<typename F>
+void TestCholesky
+( UpperOrLower uplo, int n, std::size_t memoryBudget,
+  const std::string& filename, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AOrig(g), AOutOfCore(g);
+    A.ResizeTo( n, n );
+    MakeHPD( A );
+    AOrig = A;
+    DiskDistMatrix<F> ADisk( filename, n, n, g );
+    ADisk.Write( A );
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Cholesky( uplo, A );
+    mpi::Barrier( g.Comm() );
+    const double inCoreTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    Cholesky( uplo, ADisk, memoryBudget );
+    mpi::Barrier( g.Comm() );
+    const double outOfCoreTime = mpi::Time() - startTime;
+
+    // Compare the triangular factors
+    ADisk.Read( AOutOfCore );
+    MakeTriangular( uplo, A );
+    MakeTriangular( uplo, AOutOfCore );
+    const R frobL = FrobeniusNorm( A );
+    Axpy( F(-1), A, AOutOfCore );
+    const R error = FrobeniusNorm( AOutOfCore ) / frobL;
+
+    const double flops = double(n)*n*n/3.;
+    if( g.Rank() == 0 )
+        Report
+        ( ( uplo==LOWER ? "Cholesky (lower)" : "Cholesky (upper)" ),
+          inCoreTime, Rate<F>(flops,inCoreTime),
+          outOfCoreTime, Rate<F>(flops,outOfCoreTime), error );
+}
+
+template<typename F>
+void TestLU
+( int n, std::size_t memoryBudget, const std::string& filename,
+  const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AOrig(g);
+    Uniform( A, n, n );
+    AOrig = A;
+    DiskDistMatrix<F> ADisk( filename, n, n, g );
+    ADisk.Write( A );
+    DistMatrix<int,VC,STAR> p(g), pOutOfCore(g);
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    LU( A, p );
+    mpi::Barrier( g.Comm() );
+    const double inCoreTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    LU( ADisk, pOutOfCore, memoryBudget );
+    mpi::Barrier( g.Comm() );
+    const double outOfCoreTime = mpi::Time() - startTime;
+
+    // Check the residual of solving against the out-of-core factors
+    ADisk.Read( A );
+    DistMatrix<F> X(g), B(g);
+    Uniform( X, n, 10 );
+    Zeros( B, n, 10 );
+    Gemm( NORMAL, NORMAL, F(1), AOrig, X, F(0), B );
+    lu::SolveAfter( NORMAL, A, pOutOfCore, B );
+    const R frobX = FrobeniusNorm( X );
+    Axpy( F(-1), X, B );
+    const R error = FrobeniusNorm( B ) / frobX;
+
+    const double flops = 2.*n*n*n/3.;
+    if( g.Rank() == 0 )
+        Report
+        ( "LU", inCoreTime, Rate<F>(flops,inCoreTime),
+          outOfCoreTime, Rate<F>(flops,outOfCoreTime), error );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",1000);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        const double budget =
+            Input("--budget","memory budget per process (in MB)",2.);
+        const std::string filename =
+            Input<std::string>("--filename","scratch file","OutOfCore.bin");
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        const std::size_t memoryBudget = budget*1.e6;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestCholesky<double>( LOWER, n, memoryBudget, filename, g );
+        TestCholesky<double>( UPPER, n, memoryBudget, filename, g );
+        TestLU<double>( n, memoryBudget, filename, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestCholesky<Complex<double> >
+        ( LOWER, n, memoryBudget, filename, g );
+        TestCholesky<Complex<double> >
+        ( UPPER, n, memoryBudget, filename, g );
+        TestLU<Complex<double> >( n, memoryBudget, filename, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/ApplyColumnPivots.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Form A := X D Y, where the diagonal entries of D decay geometrically, so
+// that the singular values of A are graded
+template<typename F>
+void GradedMatrix( DistMatrix<F>& A, int m, int n, BASE(F) decay )
+{
+    typedef BASE(F) Real;
+    const Grid& g = A.Grid();
+    DistMatrix<F> X(g), Y(g);
+    Uniform( X, m, n );
+    Uniform( Y, n, n );
+    const int localHeight = Y.LocalHeight();
+    const int localWidth = Y.LocalWidth();
+    const int colShift = Y.ColShift();
+    const int colStride = Y.ColStride();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const int i = colShift + iLocal*colStride;
+        const Real scale = Pow(decay,Real(i));
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            Y.SetLocal( iLocal, jLocal, scale*Y.GetLocal(iLocal,jLocal) );
+    }
+    Zeros( A, m, n );
+    Gemm( NORMAL, NORMAL, F(1), X, Y, F(0), A );
+}
+
+// Form A := [X Y, 0; 0, D], where the product of the (m-2k) x (rank-k) 
+// matrix X and (rank-k) x (n-2k) matrix Y has columns of norm at most one, 
+// and the diagonal of the 2k x 2k matrix D is (1+delta) tol for its first 
+// k entries and (1-delta) tol for the last k. The residuals of the columns of
+// D are thus exactly known, so that the numerical rank of A is 'rank'.
+template<typename F>
+void KnownRankMatrix
+( DistMatrix<F>& A, int m, int n, int rank, int k, BASE(F) tol )
+{
+    typedef BASE(F) Real;
+    const Grid& g = A.Grid();
+    const Real delta = Real(1)/20;
+    DistMatrix<F> X(g), Y(g), ATL(g);
+    Uniform( X, m-2*k, rank-k );
+    Uniform( Y, rank-k, n-2*k );
+    Zeros( A, m, n );
+    View( ATL, A, 0, 0, m-2*k, n-2*k );
+    Gemm( NORMAL, NORMAL, F(1), X, Y, F(0), ATL );
+    std::vector<Real> norms;
+    const Real maxNorm = qr::ColumnNorms( ATL, norms );
+    Scale( F(1)/maxNorm, ATL );
+    for( int i=0; i<k; ++i )
+    {
+        A.Set( m-2*k+i, n-2*k+i, (1+delta)*tol );
+        A.Set( m-k+i, n-k+i, (1-delta)*tol );
+    }
+}
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& QR,
+  const DistMatrix<F,MD,STAR>& t, const DistMatrix<int,VR,STAR>& p )
+{
+    typedef BASE(F) Real;
+    const Grid& g = A.Grid();
+    const int numSteps = p.Height();
+
+    // Form Q [R11, R12; 0, 0] P^T - A, where R11 is numSteps x numSteps
+    DistMatrix<F> E(g), EBottom(g);
+    E = QR;
+    MakeTriangular( UPPER, E );
+    View( EBottom, E, numSteps, 0, E.Height()-numSteps, E.Width() );
+    MakeZeros( EBottom );
+    DistMatrix<F> H(g);
+    LockedView( H, QR, 0, 0, QR.Height(), numSteps );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, H, t, E );
+    ApplyInverseColumnPivots( E, p );
+    Axpy( F(-1), A, E );
+    const Real frobA = FrobeniusNorm( A );
+    const Real frobE = FrobeniusNorm( E );
+    if( g.Rank() == 0 )
+        cout << "    || A P - Q R ||_F / || A ||_F = " << frobE/frobA << endl;
+}
+
+template<typename F>
+void TestPivotedQR
+( bool blocked, int m, int n, BASE(F) decay, BASE(F) tol, const Grid& g )
+{
+    DistMatrix<F> A(g), QR(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<int,VR,STAR> p(g);
+    GradedMatrix( A, m, n, decay );
+    const int numSteps = std::min(m,n);
+
+    // Full factorization
+    QR = A;
+    if( g.Rank() == 0 )
+    {
+        cout << "  " << ( blocked ? "Blocked" : "Unblocked" )
+             << " factorization...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    if( blocked )
+        qr::BlockBusingerGolub( QR, t, p, numSteps, BASE(F)(-1) );
+    else
+        qr::UnblockedBusingerGolub( QR, t, p, numSteps, BASE(F)(-1) );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    Time = " << runTime << " seconds" << endl;
+    TestCorrectness( A, QR, t, p );
+
+    // Truncated (rank-revealing) factorization
+    QR = A;
+    t.Empty();
+    p.Empty();
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    if( blocked )
+        qr::BlockBusingerGolub( QR, t, p, numSteps, tol );
+    else
+        qr::UnblockedBusingerGolub( QR, t, p, numSteps, tol );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "  Truncated with tolerance " << tol << ":\n"
+             << "    Time = " << runTime << " seconds\n"
+             << "    Number of steps = " << p.Height() << endl;
+    TestCorrectness( A, QR, t, p );
+    if( g.Rank() == 0 )
+        cout << endl;
+}
+
+// Ensure that the blocked and unblocked truncated factorizations, both 
+// sequential and distributed, reveal the same numerical rank
+template<typename F>
+void TestRevealedRank
+( int m, int n, int rank, BASE(F) tol, const Grid& g )
+{
+    DistMatrix<F> A(g), QR(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<int,VR,STAR> p(g);
+    KnownRankMatrix( A, m, n, rank, 20, tol );
+    const int numSteps = std::min(m,n);
+
+    int ranks[4];
+    for( int k=0; k<2; ++k )
+    {
+        QR = A;
+        t.Empty();
+        p.Empty();
+        if( k == 0 )
+            qr::UnblockedBusingerGolub( QR, t, p, numSteps, tol );
+        else
+            qr::BlockBusingerGolub( QR, t, p, numSteps, tol );
+        ranks[k] = p.Height();
+    }
+    TestCorrectness( A, QR, t, p );
+    for( int k=0; k<2; ++k )
+    {
+        DistMatrix<F,STAR,STAR> QR_STAR_STAR( A );
+        Matrix<F> tSeq;
+        Matrix<int> pSeq;
+        if( k == 0 )
+            qr::UnblockedBusingerGolub
+            ( QR_STAR_STAR.Matrix(), tSeq, pSeq, numSteps, tol );
+        else
+            qr::BlockBusingerGolub
+            ( QR_STAR_STAR.Matrix(), tSeq, pSeq, numSteps, tol );
+        ranks[2+k] = pSeq.Height();
+    }
+    if( g.Rank() == 0 )
+        cout << "  Revealed ranks of a rank-" << rank << " matrix: "
+             << "unblocked=" << ranks[0] << ", blocked=" << ranks[1]
+             << ", sequential unblocked=" << ranks[2]
+             << ", sequential blocked=" << ranks[3] << "\n" << endl;
+    for( int k=0; k<4; ++k )
+        if( ranks[k] != rank )
+            throw std::logic_error("Truncated factorization missed the rank");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",300);
+        const int n = Input("--width","width of matrix",300);
+        const int nb = Input("--nb","algorithmic blocksize",32);
+        const double decay = Input("--decay","singular value decay",0.95);
+        const double tol = Input("--tol","truncation tolerance",1e-8);
+        const int rank = Input("--rank","numerical rank for rank test",75);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestPivotedQR<double>( false, m, n, decay, tol, g );
+        TestPivotedQR<double>( true, m, n, decay, tol, g );
+        TestRevealedRank<double>( m, n, rank, tol, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestPivotedQR<Complex<double> >( false, m, n, decay, tol, g );
+        TestPivotedQR<Complex<double> >( true, m, n, decay, tol, g );
+        TestRevealedRank<Complex<double> >( m, n, rank, tol, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
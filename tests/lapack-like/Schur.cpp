@@ -0,0 +1,336 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Schur.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Trace.hpp"
+#include "elemental/matrices/Grcar.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& T, const DistMatrix<F>& Q,
+  const DistMatrix<Complex<BASE(F)>,STAR,STAR>& w )
+{
+    typedef BASE(F) R;
+    typedef Complex<R> C;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+
+    // || A Q - Q T ||_F / || A ||_F
+    DistMatrix<F> E(g);
+    Zeros( E, n, n );
+    Gemm( NORMAL, NORMAL, F(1), A, Q, F(0), E );
+    Gemm( NORMAL, NORMAL, F(-1), Q, T, F(1), E );
+    const R frobA = FrobeniusNorm( A );
+    const R frobResid = FrobeniusNorm( E );
+
+    // || Q^H Q - I ||_F
+    Identity( E, n, n );
+    Gemm( ADJOINT, NORMAL, F(1), Q, Q, F(-1), E );
+    const R frobOrthog = FrobeniusNorm( E );
+
+    // Compare the eigenvalues against those computed by LAPACK
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    Matrix<C> wSeq;
+    Schur( A_STAR_STAR.Matrix(), wSeq, false );
+    std::vector<bool> matched( n, false );
+    R maxDist = 0;
+    for( int i=0; i<n; ++i )
+    {
+        const C lambda = w.GetLocal(i,0);
+        int jBest = -1;
+        R bestDist = 0;
+        for( int j=0; j<n; ++j )
+        {
+            if( matched[j] )
+                continue;
+            const R dist = Abs(lambda-wSeq.Get(j,0));
+            if( jBest == -1 || dist < bestDist )
+            {
+                jBest = j;
+                bestDist = dist;
+            }
+        }
+        matched[jBest] = true;
+        maxDist = std::max( maxDist, bestDist );
+    }
+
+    if( g.Rank() == 0 )
+        cout << "    || A Q - Q T ||_F / || A ||_F = " << frobResid/frobA
+             << "\n"
+             << "    || Q^H Q - I ||_F             = " << frobOrthog << "\n"
+             << "    max eigenvalue distance to LAPACK = " << maxDist
+             << endl;
+}
+
+// Compare Newton's iteration for the matrix sign function against the hybrid
+// Newton/Newton-Schulz iteration (and, for Hermitian matrices, QDWH)
+template<typename F>
+void TestSign( const DistMatrix<F>& A, bool hermitian )
+{
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F> S(g), SHybrid(g), E(g);
+
+    S = A;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    const int numIts = Sign( S );
+    mpi::Barrier( g.Comm() );
+    const double newtonTime = mpi::Time() - startTime;
+
+    SHybrid = A;
+    startTime = mpi::Time();
+    if( hermitian )
+        sign::QDWH( LOWER, SHybrid );
+    else
+        sign::NewtonSchulzHybrid( SHybrid );
+    mpi::Barrier( g.Comm() );
+    const double hybridTime = mpi::Time() - startTime;
+
+    // || S^2 - I ||_F and the difference between the two approximations
+    Identity( E, n, n );
+    Gemm( NORMAL, NORMAL, F(1), SHybrid, SHybrid, F(-1), E );
+    const R frobInvol = FrobeniusNorm( E );
+    const R frobS = FrobeniusNorm( S );
+    Axpy( F(-1), S, SHybrid );
+    const R frobDiff = FrobeniusNorm( SHybrid );
+    if( g.Rank() == 0 )
+        cout << "    Sign: Newton=" << newtonTime << " secs (" << numIts
+             << " its), " << ( hermitian ? "QDWH" : "Newton-Schulz hybrid" )
+             << "=" << hybridTime << " secs\n"
+             << "      || S^2 - I ||_F = " << frobInvol << ", "
+             << "|| S - SNewton ||_F / || SNewton ||_F = " << frobDiff/frobS
+             << endl;
+}
+
+// After the partitioned recursion of SDC, a random [* ,* ] matrix must still
+// be identical on every process
+template<typename F>
+void TestRandomReplicas( const Grid& g )
+{
+    typedef BASE(F) R;
+    const int n = 20;
+    DistMatrix<F,STAR,STAR> X(g);
+    Uniform( X, n, n );
+    Matrix<F> XRoot( X.Matrix() );
+    mpi::Broadcast( XRoot.Buffer(), n*n, 0, g.Comm() );
+    R maxDiff = 0;
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<n; ++i )
+            maxDiff = std::max( maxDiff, Abs(X.GetLocal(i,j)-XRoot.Get(i,j)) );
+    mpi::AllReduce( &maxDiff, 1, mpi::MAX, g.Comm() );
+    if( g.Rank() == 0 )
+        cout << "    max [* ,* ] replica difference after SDC = " << maxDiff
+             << endl;
+    if( maxDiff != R(0) )
+        throw std::logic_error("Random [* ,* ] replicas disagreed after SDC");
+}
+
+// Run SDC on only the first half of the grid, so that its random draws are
+// made over a subgrid, and then check the replicas over the whole grid
+template<typename F>
+void TestSubgridSDC( int n, int cutoff, const Grid& g )
+{
+    typedef BASE(F) R;
+    GridPartition partition( g, 2 );
+    if( partition.Part() == 0 )
+    {
+        const Grid& subGrid = partition.SubGrid( 0 );
+        Grid ownGrid( subGrid.Comm(), subGrid.Height() );
+        DistMatrix<F> A(ownGrid), Q(ownGrid);
+        DistMatrix<Complex<R>,STAR,STAR> w(ownGrid);
+        Uniform( A, n, n );
+        schur::SDC( A, w, Q, true, cutoff );
+    }
+    if( g.Rank() == 0 )
+        cout << "  SDC over half of the grid:" << endl;
+    TestRandomReplicas<F>( g );
+}
+
+template<typename F>
+void TestSchur
+( bool grcar, int n, int cutoff, bool testCorrectness, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), T(g), Q(g);
+    DistMatrix<Complex<R>,STAR,STAR> w(g);
+    if( grcar )
+        Grcar( A, n );
+    else
+        Uniform( A, n, n );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  " << ( grcar ? "Grcar" : "Uniform" ) << " matrix:\n"
+             << "    Hessenberg QR with AED...";
+        cout.flush();
+    }
+    T = A;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Schur( T, w, Q );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    Time = " << runTime << " seconds" << endl;
+    if( testCorrectness )
+        TestCorrectness( A, T, Q, w );
+
+    // A single spectral divide-and-conquer step about the centroid of the
+    // spectrum using the matrix sign function
+    if( g.Rank() == 0 )
+    {
+        cout << "    Sign-function spectral divide...";
+        cout.flush();
+    }
+    DistMatrix<F> I(g);
+    Identity( I, n, n );
+    T = A;
+    Axpy( -Trace(A)/F(n), I, T );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    const R relError = schur::NewtonSDC( T );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    Time = " << runTime << " seconds\n"
+             << "    || E21 ||_1 / || A ||_1 = " << relError << endl;
+
+    // The fully recursive spectral divide and conquer
+    if( g.Rank() == 0 )
+    {
+        cout << "    Recursive spectral divide and conquer...";
+        cout.flush();
+    }
+    T = A;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    schur::SDC( T, w, Q, true, cutoff );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    Time = " << runTime << " seconds" << endl;
+    if( testCorrectness )
+        TestCorrectness( A, T, Q, w );
+    TestRandomReplicas<F>( g );
+    if( g.Size() > 1 )
+        TestSubgridSDC<F>( n, cutoff, g );
+
+    // The matrix sign function of A shifted by its centroid
+    T = A;
+    Axpy( -Trace(A)/F(n), I, T );
+    TestSign( T, false );
+
+    // A Hermitian matrix with QDWH-based sign and divide and conquer
+    DistMatrix<F> H(g);
+    H = A;
+    MakeHermitian( LOWER, H );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Hermitian part of matrix:\n"
+             << "    Hessenberg QR with AED...";
+        cout.flush();
+    }
+    T = H;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Schur( T, w, Q );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    Time = " << runTime << " seconds\n"
+             << "    QDWH-based spectral divide and conquer...";
+    DistMatrix<R,STAR,STAR> wReal(g);
+    T = H;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    schur::HermitianSDC( LOWER, T, wReal, Q, true, cutoff );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    Time = " << runTime << " seconds" << endl;
+    if( testCorrectness )
+    {
+        w.ResizeTo( n, 1 );
+        for( int i=0; i<n; ++i )
+            w.SetLocal( i, 0, wReal.GetLocal(i,0) );
+        TestCorrectness( H, T, Q, w );
+    }
+    Axpy( -Trace(H)/F(n), I, H );
+    TestSign( H, true );
+    if( g.Rank() == 0 )
+        cout << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrix",300);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        const int cutoff =
+            Input("--cutoff","problem size for Hessenberg QR in SDC",64);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSchur<double>( true, n, cutoff, testCorrectness, g );
+        TestSchur<double>( false, n, cutoff, testCorrectness, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSchur<Complex<double> >
+        ( true, n, cutoff, testCorrectness, g );
+        TestSchur<Complex<double> >
+        ( false, n, cutoff, testCorrectness, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
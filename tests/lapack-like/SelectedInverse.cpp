@@ -0,0 +1,279 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/MakeSymmetric.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Inverse.hpp"
+#include "elemental/lapack-like/LDL.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// max_i |d(i) - inv(A)(i,i)| / max_i |inv(A)(i,i)|
+template<typename F,typename T,Distribution U,Distribution V>
+BASE(F) DiagonalError
+( const DistMatrix<T,U,V>& d, const DistMatrix<F,STAR,STAR>& AInv )
+{
+    typedef BASE(F) R;
+    DistMatrix<T,STAR,STAR> d_STAR_STAR( d );
+    const int n = AInv.Height();
+    R maxError = 0, maxDiag = 0;
+    for( int i=0; i<n; ++i )
+    {
+        const F alpha = AInv.GetLocal(i,i);
+        const F delta = d_STAR_STAR.GetLocal(i,0);
+        maxError = std::max( maxError, Abs(delta-alpha) );
+        maxDiag = std::max( maxDiag, Abs(alpha) );
+    }
+    return maxError / maxDiag;
+}
+
+// max_{s,t} |Z(s,t) - inv(A)(rowInds[s],colInds[t])| / max_i |inv(A)(i,i)|
+template<typename F>
+BASE(F) BlockError
+( const DistMatrix<F,STAR,STAR>& Z, const DistMatrix<F,STAR,STAR>& AInv,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds )
+{
+    typedef BASE(F) R;
+    R maxError = 0, maxDiag = 0;
+    for( int i=0; i<AInv.Height(); ++i )
+        maxDiag = std::max( maxDiag, Abs(AInv.GetLocal(i,i)) );
+    for( unsigned s=0; s<rowInds.size(); ++s )
+        for( unsigned t=0; t<colInds.size(); ++t )
+        {
+            const F alpha = AInv.GetLocal(rowInds[s],colInds[t]);
+            maxError = std::max( maxError, Abs(Z.GetLocal(s,t)-alpha) );
+        }
+    return maxError / maxDiag;
+}
+
+template<typename F>
+void TestCholesky
+( UpperOrLower uplo, int n, int numProbes,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), AFact(g), AInv(g);
+    HermitianUniformSpectrum( A, n, 1, 100 );
+
+    AInv = A;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    HPDInverse( uplo, AInv );
+    mpi::Barrier( g.Comm() );
+    const double invTime = mpi::Time() - startTime;
+    MakeHermitian( uplo, AInv );
+    DistMatrix<F,STAR,STAR> AInv_STAR_STAR( AInv );
+
+    AFact = A;
+    startTime = mpi::Time();
+    Cholesky( uplo, AFact );
+    mpi::Barrier( g.Comm() );
+    const double cholTime = mpi::Time() - startTime;
+
+    DistMatrix<R,VR,STAR> d(g);
+    startTime = mpi::Time();
+    cholesky::InverseDiagonal( uplo, AFact, d );
+    mpi::Barrier( g.Comm() );
+    const double diagTime = mpi::Time() - startTime;
+    const R diagError = DiagonalError( d, AInv_STAR_STAR );
+
+    DistMatrix<F,STAR,STAR> Z(g);
+    startTime = mpi::Time();
+    cholesky::SelectedInverse( uplo, AFact, rowInds, colInds, Z );
+    mpi::Barrier( g.Comm() );
+    const double selTime = mpi::Time() - startTime;
+    const R selError = BlockError( Z, AInv_STAR_STAR, rowInds, colInds );
+
+    // The sequential routines on a redundant copy should agree
+    R seqError;
+    {
+        DistMatrix<F,STAR,STAR> AFact_STAR_STAR( AFact );
+        DistMatrix<R,STAR,STAR> dSeq( n, 1, g );
+        cholesky::InverseDiagonal
+        ( uplo, AFact_STAR_STAR.LockedMatrix(), dSeq.Matrix() );
+        cholesky::SelectedInverse
+        ( uplo, AFact_STAR_STAR.LockedMatrix(), rowInds, colInds,
+          Z.Matrix() );
+        seqError = std::max
+        ( DiagonalError( dSeq, AInv_STAR_STAR ),
+          BlockError( Z, AInv_STAR_STAR, rowInds, colInds ) );
+    }
+
+    R trace = 0;
+    for( int i=0; i<n; ++i )
+        trace += RealPart(AInv_STAR_STAR.GetLocal(i,i));
+    startTime = mpi::Time();
+    const R traceEst =
+        cholesky::InverseTraceEstimate( uplo, AFact, numProbes );
+    mpi::Barrier( g.Comm() );
+    const double traceTime = mpi::Time() - startTime;
+    DistMatrix<R,VR,STAR> dEst(g);
+    startTime = mpi::Time();
+    cholesky::InverseDiagonalEstimate( uplo, AFact, dEst, numProbes );
+    mpi::Barrier( g.Comm() );
+    const double diagEstTime = mpi::Time() - startTime;
+    const R diagEstError = DiagonalError( dEst, AInv_STAR_STAR );
+
+    if( g.Rank() == 0 )
+        cout << "  uplo=" << (uplo==LOWER?"LOWER":"UPPER") << "\n"
+             << "    HPDInverse:         " << invTime << " secs\n"
+             << "    Cholesky:           " << cholTime << " secs\n"
+             << "    InverseDiagonal:    " << diagTime << " secs, error="
+             << diagError << "\n"
+             << "    SelectedInverse:    " << selTime << " secs, error="
+             << selError << "\n"
+             << "    sequential error:   " << seqError << "\n"
+             << "    trace estimate:     " << traceTime << " secs, "
+             << traceEst << " vs. " << trace << " (rel. error="
+             << Abs(traceEst-trace)/trace << ")\n"
+             << "    diagonal estimate:  " << diagEstTime << " secs, error="
+             << diagEstError << " with " << numProbes << " probes" << endl;
+}
+
+template<typename F>
+void TestLDL
+( bool conjugated, int n,
+  const std::vector<int>& rowInds, const std::vector<int>& colInds,
+  const Grid& g )
+{
+    typedef BASE(F) R;
+    const Orientation orientation = ( conjugated ? ADJOINT : TRANSPOSE );
+    DistMatrix<F> A(g), AFact(g), AInv(g);
+    if( conjugated )
+        HermitianUniformSpectrum( A, n, -100, 100 );
+    else
+    {
+        Uniform( A, n, n );
+        MakeSymmetric( LOWER, A );
+    }
+    AInv = A;
+    Inverse( AInv );
+    DistMatrix<F,STAR,STAR> AInv_STAR_STAR( AInv );
+
+    AFact = A;
+    DistMatrix<F,MC,STAR> d(g), dSub(g);
+    DistMatrix<int,VC,STAR> p(g);
+    if( conjugated )
+        LDLH( AFact, d, dSub, p );
+    else
+        LDLT( AFact, d, dSub, p );
+
+    DistMatrix<F,VR,STAR> dInv(g);
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    ldl::InverseDiagonal( orientation, AFact, d, dSub, p, dInv );
+    mpi::Barrier( g.Comm() );
+    const double diagTime = mpi::Time() - startTime;
+    const R diagError = DiagonalError( dInv, AInv_STAR_STAR );
+
+    DistMatrix<F,STAR,STAR> Z(g);
+    startTime = mpi::Time();
+    ldl::SelectedInverse
+    ( orientation, AFact, d, dSub, p, rowInds, colInds, Z );
+    mpi::Barrier( g.Comm() );
+    const double selTime = mpi::Time() - startTime;
+    const R selError = BlockError( Z, AInv_STAR_STAR, rowInds, colInds );
+
+    R seqError;
+    {
+        DistMatrix<F,STAR,STAR> AFact_STAR_STAR( AFact ), d_STAR_STAR( d ),
+                                dSub_STAR_STAR( dSub ), dSeq( n, 1, g );
+        DistMatrix<int,STAR,STAR> p_STAR_STAR( p );
+        ldl::InverseDiagonal
+        ( orientation, AFact_STAR_STAR.LockedMatrix(),
+          d_STAR_STAR.LockedMatrix(), dSub_STAR_STAR.LockedMatrix(),
+          p_STAR_STAR.LockedMatrix(), dSeq.Matrix() );
+        ldl::SelectedInverse
+        ( orientation, AFact_STAR_STAR.LockedMatrix(),
+          d_STAR_STAR.LockedMatrix(), dSub_STAR_STAR.LockedMatrix(),
+          p_STAR_STAR.LockedMatrix(), rowInds, colInds, Z.Matrix() );
+        seqError = std::max
+        ( DiagonalError( dSeq, AInv_STAR_STAR ),
+          BlockError( Z, AInv_STAR_STAR, rowInds, colInds ) );
+    }
+
+    if( g.Rank() == 0 )
+        cout << "  Bunch-Kaufman LDL" << (conjugated?"^H":"^T") << "\n"
+             << "    InverseDiagonal:    " << diagTime << " secs, error="
+             << diagError << "\n"
+             << "    SelectedInverse:    " << selTime << " secs, error="
+             << selError << "\n"
+             << "    sequential error:   " << seqError << endl;
+}
+
+template<typename F>
+void TestSelectedInverse( int n, int numProbes, const Grid& g )
+{
+    // A diagonal block near the middle, two scattered indices, and an
+    // off-diagonal block
+    std::vector<int> rowInds, colInds;
+    for( int i=n/2; i<std::min(n/2+10,n); ++i )
+        rowInds.push_back( i );
+    rowInds.push_back( n-1 );
+    rowInds.push_back( std::min(3,n-1) );
+    for( int j=n/3; j<std::min(n/3+5,n); ++j )
+        colInds.push_back( j );
+    colInds.push_back( n/2 );
+
+    TestCholesky<F>( LOWER, n, numProbes, rowInds, colInds, g );
+    TestCholesky<F>( UPPER, n, numProbes, rowInds, colInds, g );
+    TestLDL<F>( false, n, rowInds, colInds, g );
+    if( IsComplex<F>::val )
+        TestLDL<F>( true, n, rowInds, colInds, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--n","size of matrix",500);
+        const int numProbes = Input("--numProbes","number of probes",100);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSelectedInverse<double>( n, numProbes, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSelectedInverse<Complex<double> >( n, numProbes, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
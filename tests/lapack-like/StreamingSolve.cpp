@@ -0,0 +1,236 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/StreamingSolve.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+#include <deque>
+using namespace std;
+using namespace elem;
+
+// Produces 'numRhs' random right-hand sides, optionally remembering the local
+// portion of each batch so that the solutions can be checked
+template<typename F>
+class RandomSource
+{
+public:
+    RandomSource( long numRhs, bool remember )
+    : remaining_(numRhs), remember_(remember)
+    { }
+
+    int operator()( DistMatrix<F,VC,STAR>& B )
+    {
+        const int width = std::min( (long)B.Width(), remaining_ );
+        remaining_ -= width;
+        if( width > 0 )
+        {
+            MakeUniform( B );
+            if( remember_ )
+            {
+                Matrix<F> BL;
+                LockedView
+                ( BL, B.LockedMatrix(), 0, 0, B.LocalHeight(), width );
+                batches_.push_back( Matrix<F>() );
+                batches_.back() = BL;
+            }
+        }
+        return width;
+    }
+
+    std::deque<Matrix<F> >& Batches() { return batches_; }
+
+private:
+    long remaining_;
+    bool remember_;
+    std::deque<Matrix<F> > batches_;
+};
+
+// Checks that each batch of solutions satisfies op(A) X = B, or merely
+// touches the solutions if no source is given
+template<typename F>
+class CheckingSink
+{
+public:
+    CheckingSink
+    ( Orientation orientation, const DistMatrix<F>& A,
+      RandomSource<F>* source )
+    : orientation_(orientation), A_(A), source_(source), numCols_(0),
+      maxError_(0), sum_(0)
+    { }
+
+    void operator()( long offset, const DistMatrix<F,VC,STAR>& X )
+    {
+        typedef BASE(F) R;
+        if( offset != numCols_ )
+            throw std::logic_error("Solutions arrived out of order");
+        numCols_ += X.Width();
+        if( source_ == 0 )
+        {
+            if( X.LocalHeight() > 0 && X.Width() > 0 )
+                sum_ += Abs(X.GetLocal(0,0));
+            return;
+        }
+
+        // Compare op(A) X with the remembered right-hand sides
+        DistMatrix<F> XFull( X ), AX( A_.Grid() );
+        Zeros( AX, A_.Height(), X.Width() );
+        Gemm( orientation_, NORMAL, F(1), A_, XFull, F(0), AX );
+        DistMatrix<F,VC,STAR> AX_VC_STAR( AX );
+        const Matrix<F>& B = source_->Batches().front();
+        R maxError = 0, maxEntry = 0;
+        for( int jLoc=0; jLoc<B.Width(); ++jLoc )
+            for( int iLoc=0; iLoc<B.Height(); ++iLoc )
+            {
+                const F beta = B.Get(iLoc,jLoc);
+                maxError = std::max
+                ( maxError, Abs(AX_VC_STAR.GetLocal(iLoc,jLoc)-beta) );
+                maxEntry = std::max( maxEntry, Abs(beta) );
+            }
+        source_->Batches().pop_front();
+        mpi::AllReduce( &maxError, 1, mpi::MAX, A_.Grid().Comm() );
+        mpi::AllReduce( &maxEntry, 1, mpi::MAX, A_.Grid().Comm() );
+        maxError_ = std::max( maxError_, double(maxError/maxEntry) );
+    }
+
+    long NumCols() const { return numCols_; }
+    double MaxError() const { return maxError_; }
+
+private:
+    Orientation orientation_;
+    const DistMatrix<F>& A_;
+    RandomSource<F>* source_;
+    long numCols_;
+    double maxError_, sum_;
+};
+
+template<typename F,template<typename> class FactorType>
+void TestFactor
+( const std::string& name, const FactorType<F>& factor,
+  const DistMatrix<F>& A, int numCheck, int checkBatch, long numRhs,
+  int batchSize )
+{
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+
+    // Check the solutions of a short stream of batches of an awkward width
+    double error = 0;
+    for( int k=0; k<2; ++k )
+    {
+        const Orientation orientation = ( k==0 ? NORMAL : ADJOINT );
+        RandomSource<F> source( numCheck, true );
+        CheckingSink<F> sink( orientation, A, &source );
+        StreamingSolve( factor, source, sink, checkBatch, orientation );
+        if( sink.NumCols() != numCheck )
+            throw std::logic_error("Solutions were lost");
+        error = std::max( error, sink.MaxError() );
+    }
+
+    // Time the full stream
+    RandomSource<F> source( numRhs, false );
+    CheckingSink<F> sink( NORMAL, A, 0 );
+    const StreamingSolveInfo info =
+        StreamingSolve( factor, source, sink, batchSize );
+
+    // Time the same batches solved one after another without overlap
+    DistMatrix<F,VC,STAR> B( g );
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    for( long s=0; s<numRhs; s+=info.batchSize )
+    {
+        const int width = std::min( (long)info.batchSize, numRhs-s );
+        Uniform( B, n, width );
+        factor.Solve( B );
+    }
+    mpi::Barrier( g.Comm() );
+    const double naiveTime = mpi::Time() - startTime;
+
+    if( g.Rank() == 0 )
+        cout << "  " << name << ":\n"
+             << "    max || op(A) X - B ||_oo / || B ||_oo = " << error << "\n"
+             << "    streamed " << info.numSolves << " solves in "
+             << info.numBatches << " batches of up to " << info.batchSize
+             << ": " << info.seconds << " secs, " << info.solvesPerSecond
+             << " solves/sec\n"
+             << "    without overlap: " << naiveTime << " secs, "
+             << numRhs/naiveTime << " solves/sec" << endl;
+}
+
+template<typename F>
+void TestStreamingSolve
+( int n, int numCheck, int checkBatch, long numRhs, int batchSize,
+  const Grid& g )
+{
+    DistMatrix<F> A( g );
+    Uniform( A, n, n );
+    LUFactor<F> luFactor( A );
+    TestFactor( "LU", luFactor, A, numCheck, checkBatch, numRhs, batchSize );
+
+    MakeHermitian( LOWER, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+    CholeskyFactor<F> cholFactor( LOWER, A );
+    TestFactor
+    ( "Cholesky", cholFactor, A, numCheck, checkBatch, numRhs, batchSize );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",500);
+        const int numCheck =
+            Input("--numCheck","number of right-hand sides to check",250);
+        const int checkBatch =
+            Input("--checkBatch","batch size when checking",37);
+        const int numRhs = Input("--numRhs","number of right-hand sides",20000);
+        const int batchSize =
+            Input("--batchSize","batch size (0 to tune)",0);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestStreamingSolve<double>
+        ( n, numCheck, checkBatch, numRhs, batchSize, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestStreamingSolve<Complex<double> >
+        ( n, numCheck, checkBatch, numRhs, batchSize, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}